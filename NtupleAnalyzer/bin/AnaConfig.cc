@@ -0,0 +1,68 @@
+////////////////////////////////////////////////////////////////////////////
+//            nTuple Analysis Macro, cut flow read from a config file     //
+////////////////////////////////////////////////////////////////////////////
+
+#include "EventData.h"
+#include "Operation.h"
+#include "OperationFactory.h"
+#include "Constants.h"
+
+// ROOT includes
+#include <TStyle.h>
+#include <TROOT.h>
+
+// std includes
+#include <fstream>
+#include <string>
+
+using namespace Operation;
+using namespace Constants;
+using namespace std;
+
+int main(int argc, char ** argv) 
+{  
+  if(argc < 6){
+    cerr << "Program need more than this parameter " << endl;
+    cerr << "Example:   AnaConfig  sampleName(ex:wjets or met or ...)   maxEvents   isMC(0 or 1)   config(ex:../data/AnaMonoJet.cfg)   folder(./results/...)   [nThreads]   [variations(ex:JESUp,JESDown)]" << endl;
+    cerr << "Operations known in the config file:" << endl;
+    ChainBuilder::Usage(cerr);
+    return 1;
+  }
+  
+  string anaout = Constants::outputDir; 
+  anaout += "results/";
+  anaout += argv[5];
+  
+  int  isMC;
+  sscanf(argv[3], "%d", &isMC);
+  
+  int nev;
+  sscanf ( argv[2], "%d", &nev );
+  
+  int nThreads = 1;
+  if ( argc >= 7 ) sscanf ( argv[6], "%d", &nThreads );
+  
+  string histFile = anaout + "/";
+  histFile += argv[1];
+  histFile += "_";
+  
+  // Build the chain before opening anything, a bad config stops here
+  ChainBuilder chain(histFile);
+  if ( !chain.Read(argv[4]) ) return 1;
+  
+  std::string logFileName = anaout + "/";
+  logFileName += argv[1];
+  logFileName += ".log";
+  
+  Manager manager(logFileName);
+  chain.AddTo(manager);
+  
+  cout << "Operation chain from " << argv[4] << ":" << endl;
+  chain.Description(cout);
+  
+  if ( argc >= 8 ) manager.AddVariations(argv[7]);
+  
+  cout << "Running over sample " << argv[1] << " on " << nThreads << " thread(s)" << endl;
+  
+  manager.Run(argv[1], nev, isMC, nThreads);
+}
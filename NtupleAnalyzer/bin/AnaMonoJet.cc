@@ -14,6 +14,7 @@
 
 // std includes
 #include <fstream>
+#include <sstream>
 #include <string>
 
 using namespace Operation;
@@ -28,7 +29,7 @@ int main(int argc, char ** argv)
 {  
   if(argc < 6){
     cerr << "Program need more than this parameter " << endl;
-    cerr << "Example:   Analysis  sampleName(ex:wjets or met or ...)   maxEvents   isMC(0 or 1)   cuts(jet,met,jetmet)   folder(./results/...)" << endl;
+    cerr << "Example:   Analysis  sampleName(ex:wjets or met or ...)   maxEvents   isMC(0 or 1)   cuts(jet,met,jetmet)   folder(./results/...)   [nThreads]   [variations(ex:JESUp,JESDown,JERUp,JERDown)]   [pdfSets(members,reference,alphaS ex:cteq66,cteq66,cteq66alphas)]" << endl;
     return 1;
   }
   
@@ -57,6 +58,18 @@ int main(int argc, char ** argv)
   if ( argc >= 3 ) sscanf ( argv[2], "%d", &nev );
   else nev = 100000000;
   
+  int nThreads = 1;
+  if ( argc >= 7 ) sscanf ( argv[6], "%d", &nThreads );
+  
+  // PDF systematics (csh/PDF.csh), LHAPDF6 set names. An empty name leaves the set out,
+  // e.g. ",MSTW2008nlo68cl_asmz+68cl,MSTW2008nlo68cl_asmz-68cl" for the MSTW alphaS uncertainty
+  if ( argc >= 9 ){
+    string pdfSets[3];
+    stringstream names(argv[8]);
+    for(int i=0; i<3; i++) getline(names, pdfSets[i], ',');
+    EventData::SetPDFSets(pdfSets[0], pdfSets[1], pdfSets[2]);
+  }
+  
   std::string logFileName = anaout + "/";
   logFileName += argv[1];
   logFileName += ".log";
@@ -279,10 +292,11 @@ int main(int argc, char ** argv)
   
   //-------------------------------------------------------------------------------------------------------------------------
   
-  cout << "Running over sample " << argv[1] << endl;
+  // Systematic variations filled in the same event loop, output files get the variation name
+  if ( argc >= 8 ) manager.AddVariations(argv[7]);
   
-  EventData eventData(argv[1], nev, isMC); 
+  cout << "Running over sample " << argv[1] << " on " << nThreads << " thread(s)" << endl;
   
   // Loop over events
-  manager.Run(eventData);
+  manager.Run(argv[1], nev, isMC, nThreads);
 }
@@ -14,6 +14,7 @@
 
 // std includes
 #include <fstream>
+#include <sstream>
 #include <string>
 
 using namespace Operation;
@@ -27,7 +28,7 @@ int main(int argc, char ** argv)
 {
   if(argc < 7){
     cerr << "Program need more than this parameter " << endl;
-    cerr << "Example:  Analysis  sampleName(ex:wjets or met or ...)   maxEvents  cutNumber  isMC(0 or 1)   cuts(jet,met,jetmet)   folder(./results/...)" << endl;
+    cerr << "Example:  Analysis  sampleName(ex:wjets or met or ...)   maxEvents  cutNumber(0-8 or all)  isMC(0 or 1)   cuts(jet,met,jetmet)   folder(./results/...)   [nThreads]   [variations(ex:JESUp,JESDown,JERUp,JERDown)]" << endl;
     return 1;
   }
   
@@ -50,14 +51,18 @@ int main(int argc, char ** argv)
   int  isMC;
   sscanf(argv[4], "%d", &isMC);	
 
-  int  sel;
-  sscanf(argv[3], "%d", &sel);
+  // "all" runs every cut number (0-8) in a single pass over the sample
+  int  sel = -1;
   string selName = argv[3];
+  if(selName != "all") sscanf(argv[3], "%d", &sel);
   
   int nev;
   if ( argc >= 5 ) sscanf ( argv[2], "%d", &nev );
   else nev = 100000000;
   
+  int nThreads = 1;
+  if ( argc >= 8 ) sscanf ( argv[7], "%d", &nThreads );
+  
   std::string logFileName = anaout + "/";
   logFileName += argv[1];
   logFileName += ".log";
@@ -124,28 +129,43 @@ int main(int argc, char ** argv)
     manager.Add(&CHLT13); //HCal Laser 2012
   */
   
-  if(sel!=1) manager.Add(&CNoiseClean);
-  if(sel!=2){
-    if(varycutIndex==1)
-      manager.Add(&CJet1);
-    else
-      manager.Add(&CJet2);
-  }
-  if(sel!=3) manager.Add(&CNJet);
-  if(sel!=4) manager.Add(&CDeltaPhi3);
-  if(sel!=5) manager.Add(&CMet);
-  if(sel!=6) manager.Add(&CTau);
-  if(sel!=7) manager.Add(&CNoPFMuon);
-  if(sel!=8) manager.Add(&CNoPFElec);
+  // Cut number N (1-8) drops cut point N-1 of this list, 0 keeps all of them
+  Operation::_Base * cutPoints[8] = { &CNoiseClean, &CJet2, &CNJet, &CDeltaPhi3, &CMet, &CTau, &CNoPFMuon, &CNoPFElec };
+  if(varycutIndex==1) cutPoints[1] = &CJet1;
+  
+  MultiCutEff  CMultiCut(logFileName);
+  vector<hDataMcMatching*> DataMcMatching;
   
-  hDataMcMatching  DataMcMatching(histFile+"_AnaMonoJetCutEff_" +selName + ".root");   manager.Add(&DataMcMatching);
+  if(sel < 0){
+    for(int c=0; c<8; c++) CMultiCut.AddCut(cutPoints[c]);
+    for(int k=0; k<=8; k++){
+      ostringstream cutName;
+      cutName << k;
+      unsigned int mask = 0xFF;
+      if(k>0) mask &= ~(1u << (k-1));
+      DataMcMatching.push_back(new hDataMcMatching(histFile+"_AnaMonoJetCutEff_" +cutName.str() + ".root"));
+      CMultiCut.AddConfig(cutName.str(), mask, DataMcMatching.back());
+    }
+    manager.Add(&CMultiCut);
+  }
+  else{
+    for(int c=0; c<8; c++){
+      if(sel!=c+1) manager.Add(cutPoints[c]);
+    }
+    DataMcMatching.push_back(new hDataMcMatching(histFile+"_AnaMonoJetCutEff_" +selName + ".root"));
+    manager.Add(DataMcMatching.back());
+  }
   
   //-------------------------------------------------------------------------------------------------------------------------
   
-  cout << "Running over sample " << argv[1] << endl;
+  // Systematic variations filled in the same event loop, output files get the variation name
+  if ( argc >= 9 ) manager.AddVariations(argv[8]);
   
-  EventData eventData(argv[1], nev, isMC); 
+  cout << "Running over sample " << argv[1] << " on " << nThreads << " thread(s)" << endl;
   
   // Loop over events
-  manager.Run(eventData); 
+  manager.Run(argv[1], nev, isMC, nThreads); 
+  
+  // Histograms are written when the histogrammers are deleted
+  for(size_t k=0; k<DataMcMatching.size(); k++) delete DataMcMatching[k];
 }
@@ -0,0 +1,120 @@
+#include "DatasetCatalog.h"
+
+#include <iostream>
+#include <fstream>
+#include <sstream>
+#include <stdlib.h>
+
+using namespace std;
+
+DatasetCatalog::DatasetCatalog(const string & fileName) : mFileName(fileName)
+{
+  ifstream in(fileName.c_str());
+  if ( !in ) {
+    cerr << "DatasetCatalog: can not read " << fileName << endl;
+    return;
+  }
+
+  map<string, string> vars;
+  string line;
+  while ( getline(in, line) ) {
+    size_t hash = line.find('#');
+    if ( hash != string::npos ) line.erase(hash);
+
+    istringstream fields(line);
+    string name, lumi, files;
+    if ( !(fields >> name) ) continue;
+
+    if ( name == "set" ) {
+      fields >> name >> vars[name];
+      continue;
+    }
+    if ( !(fields >> lumi >> files) ) {
+      cerr << "DatasetCatalog: incomplete line for " << name << " in " << fileName << endl;
+      continue;
+    }
+
+    // ${var} in the file paths
+    for(map<string, string>::iterator v=vars.begin(); v!=vars.end(); ++v) {
+      string key = "${" + v->first + "}";
+      for(size_t pos; (pos = files.find(key)) != string::npos; ) files.replace(pos, key.size(), v->second);
+    }
+
+    Sample & sample = mSamples[name];
+    sample = FileList(files);
+    sample.name = name;
+
+    // events/cross-section or a plain luminosity
+    sample.lumi = 0;
+    if ( lumi != "-" ) {
+      size_t slash = lumi.find('/');
+      sample.lumi = atof( lumi.substr(0, slash).c_str() );
+      if ( slash != string::npos ) {
+	double xsec = atof( lumi.substr(slash+1).c_str() );
+	sample.lumi = xsec > 0 ? sample.lumi / xsec : 0;
+      }
+    }
+  }
+}
+
+// file[=weight],file[=weight],...
+DatasetCatalog::Sample DatasetCatalog::FileList(const string & files)
+{
+  Sample sample;
+  sample.name = files;
+  sample.lumi = 0;
+
+  stringstream list(files);
+  string file;
+  while ( getline(list, file, ',') ) {
+    if ( file.empty() ) continue;
+    double weight = 1.;
+    size_t equal = file.rfind('=');
+    char * end = 0;
+    if ( equal != string::npos ) {
+      double w = strtod(file.c_str()+equal+1, &end);
+      if ( end && *end == 0 && end != file.c_str()+equal+1 ) {
+	weight = w;
+	file.erase(equal);
+      }
+    }
+    sample.files.push_back(file);
+    sample.weights.push_back(weight);
+  }
+  return sample;
+}
+
+static string DefaultCatalogFile()
+{
+  if ( getenv("DATASET_CATALOG") ) return getenv("DATASET_CATALOG");
+  if ( getenv("CMSSW_BASE") )      return string(getenv("CMSSW_BASE")) + "/src/MonoJetAnalysis/NtupleAnalyzer/data/DatasetCatalog.txt";
+  return "../data/DatasetCatalog.txt";
+}
+
+const DatasetCatalog & DatasetCatalog::Default()
+{
+  static const DatasetCatalog catalog( DefaultCatalogFile() );
+  return catalog;
+}
+
+const DatasetCatalog::Sample * DatasetCatalog::Find(const string & name) const
+{
+  map<string, Sample>::const_iterator i = mSamples.find(name);
+  return i == mSamples.end() ? 0 : &i->second;
+}
+
+double DatasetCatalog::Normalization(const string & name, const string & reference) const
+{
+  const Sample * sample = Find(name);
+  const Sample * ref    = Find(reference);
+  if ( !sample || !ref || sample->lumi <= 0 ) {
+    cerr << "DatasetCatalog: no luminosity for " << name << " in " << mFileName << ", its events are not weighted" << endl;
+    return 1.;
+  }
+  return ref->lumi / sample->lumi;
+}
+
+const string & DatasetCatalog::FileName() const
+{
+  return mFileName;
+}
@@ -0,0 +1,57 @@
+#ifndef DatasetCatalog_h
+#define DatasetCatalog_h
+
+#include <TROOT.h>
+#include <string>
+#include <vector>
+#include <map>
+
+// Samples known to EventData: their files and equivalent luminosity, read from
+// NtupleAnalyzer/data/DatasetCatalog.txt (or the file in $DATASET_CATALOG)
+class DatasetCatalog 
+{
+
+public:
+
+  struct Sample
+  {
+    std::string              name;
+    std::vector<std::string> files;    // may contain wildcards
+    std::vector<double>      weights;  // per file (pattern), for samples merged from several productions
+    double                   lumi;     // pb^-1, 0 if unknown
+  };
+
+  /**
+   * \brief A sample made of the comma separated list of files (or patterns), not normalised
+   */
+  static Sample FileList(const std::string & files);
+
+  DatasetCatalog(const std::string & fileName);
+
+  /**
+   * \brief The default catalog, read once per job
+   */
+  static const DatasetCatalog & Default();
+
+  /**
+   * \brief The sample called name, 0 if it is not in the catalog
+   */
+  const Sample * Find(const std::string & name) const;
+
+  /**
+   * \brief Event weight of a sample normalised to the luminosity of reference, lumi(reference)/lumi(name)
+   */
+  double Normalization(const std::string & name, const std::string & reference) const;
+
+  const std::string & FileName() const;
+
+private:
+
+  std::string                   mFileName;
+  std::map<std::string, Sample> mSamples;
+
+};
+
+#include "DatasetCatalog.cc"
+
+#endif
@@ -11,6 +11,16 @@
 #include "string.h"
 #include <map>
 #include <LHAPDF/LHAPDF.h>
+#include <TLeafC.h>
+#include <TSystem.h>
+#include <TEnv.h>
+#include <TTreeCache.h>
+#include <TChain.h>
+#include <fstream>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <fcntl.h>
+#include <unistd.h>
 
 using namespace std;
 using namespace Operation;
@@ -18,600 +28,41 @@ using namespace LHAPDF;
 
 EventData::EventData(const string &  fileName, UInt_t maxEvents, int isMC) : mDataSet("undefined") 
 {
-  // CERN
-  string fileDirectory = "root://eoscms//eos/cms/store/group/phys_exotica/monojet/ntuple-2012-v6D/";
-  //string fileDirectory = "file:/data1/srimanob/Data-Monojet/ntuple-2012-v6D/";
-  // FNAL
-  //string fileDirectory  = "file:/uscms_data/d2/lpcjm/DATA/2012/ntuple_v6A_temp";
-  
-  // Pileup - CERN
-  //mydataset["pileup"]   = "/afs/cern.ch/user/s/srimanob/public/ForMonoJet/PUHist/pileup_monojet_22JanReReco_pixelLumi.root";
-  mydataset["pileup"]   = "/home/sundleeb/DM15ana/Ntuples/pileup_monojet_22JanReReco_pixelLumi.root";
-  // Pileup - FNAL
-  //mydataset["pileup"]   = "/uscms_data/d3/srimanob/ntuple_v6A/pileup_monojet_20130101_All2012_v6A_69300.root";  
-  
   // Check me before run
   mEvent       = 0;
   mMaxEvents   = maxEvents;
   mFileName    = fileName; 
+  
+  // "sample@first-last" runs on the entries [first, last) of sample, used by the local scheduler
+  Long64_t rangeFirst = 0, rangeLast = -1;
+  string dataset = fileName;
+  size_t at = fileName.rfind('@');
+  if ( at != string::npos ){
+    dataset   = fileName.substr(0, at);
+    mFileName = dataset;
+    if ( sscanf(fileName.c_str()+at+1, "%lld-%lld", &rangeFirst, &rangeLast) != 2 ){
+      cerr << "EventData: can not read the entry range of " << fileName << ", running on all entries" << endl;
+      rangeFirst = 0;
+      rangeLast  = -1;
+    }
+  }
   misMC        = isMC;
-  mJetType     = "pf";
-  mLepType     = "m";
+  mJetType     = JetPF;
+  mLepType     = LepMuon;
   mMetType     = 10;
   mEnergyScale = 0.;
+  mJERMode     = JERNone;
   mSecJetCut   = 30;
-  
-  //
-  mydataset["m1avpu20bx25"]       = "file:/afs/cern.ch/work/s/srimanob/Monojet/Production/Ver07B/CMSSW_7_2_3/src/MonoJetAnalysis/NtupleAnalyzer/test/config/M-1_AV_PU20bx25/ntuple_M-1_AV_PU20bx25.root";
-  mylumi["m1avpu20bx25"]          = 19712.;
-  mydataset["m1avpu40bx25"]       = "file:/afs/cern.ch/work/s/srimanob/Monojet/Production/Ver07B/CMSSW_7_2_3/src/MonoJetAnalysis/NtupleAnalyzer/test/config/M-1_AV_PU40bx25/ntuple_M-1_AV_PU40bx25.root";
-  mylumi["m1avpu40bx25"]          = 19712.;
-
-
- // W_test
-  mydataset["W_test"]        ="file:/home/sundleeb/DM15ana/CMSSW_7_4_0_pre6/src/MonoJetAnalysis/NtupleAnalyzer/test/config/test/step4_ntuple_NonThDM_Wtest.root";
-
-  mylumi["W_test"]         = 4958./3.33;  
-
-// Sync Exercise Added by Sonaina on 17-june 2015 ....
-  mydataset["ADD_sync"]      ="file:/media/sf_proj/Monojets/ntuples/ntuple_ADD_Synch.root";
-
-  mylumi["ADD_sync"]     = 1;
-
-  mydataset["TTbar_sync"]   ="file:/media/sf_proj/Monojets/ntuples/ntuple_TTbar_Synch.root";
-
-  mylumi["TTbar_sync"]     =1;
-
-
-
-  // NonTh
-  mydataset["nonth1TeVrun56"]      = "file:/home/sundleeb/DM15ana/CMSSW_7_4_0_pre6/src/MonoJetAnalysis/NtupleAnalyzer/test/config/test/step4_ntuple_NonThDM_1TeV_run56.root";
-  mylumi["nonth1TeVrun56"]         = 1000./3.33;
-
-  mydataset["nonth1TeVrun34"]="/home/sundleeb/DM15ana/CMSSW_7_4_0_pre6/src/MonoJetAnalysis/NtupleAnalyzer/test/config/test/step4_ntuple_NonThDM_1TeV_run34.root";
-  mydataset["nonth2TeVrun34"]="/home/sundleeb/DM15ana/CMSSW_7_4_0_pre6/src/MonoJetAnalysis/NtupleAnalyzer/test/config/test/step4_ntuple_NonThDM_2TeV_run34.root";
-  mydataset["nonth2TeVrun56"]="/home/sundleeb/DM15ana/CMSSW_7_4_0_pre6/src/MonoJetAnalysis/NtupleAnalyzer/test/config/test/step4_ntuple_NonThDM_2TeV_run56.root";
-  mydataset["nonth3TeVrun34"]="/home/sundleeb/DM15ana/CMSSW_7_4_0_pre6/src/MonoJetAnalysis/NtupleAnalyzer/test/config/test/step4_ntuple_NonThDM_3TeV_run34.root";
-  mydataset["nonth3TeVrun56"]="/home/sundleeb/DM15ana/CMSSW_7_4_0_pre6/src/MonoJetAnalysis/NtupleAnalyzer/test/config/test/step4_ntuple_NonThDM_3TeV_run56.root";
-  mydataset["nonth0.5TeVrun34"]="/home/sundleeb/DM15ana/CMSSW_7_4_0_pre6/src/MonoJetAnalysis/NtupleAnalyzer/test/config/test/step4_ntuple_NonThDM_500GeV_run34.root";
-  mydataset["nonth0.5TeVrun56"]="/home/sundleeb/DM15ana/CMSSW_7_4_0_pre6/src/MonoJetAnalysis/NtupleAnalyzer/test/config/test/step4_ntuple_NonThDM_500GeV_run56.root";
-
-  mydataset["nonth1TeV1"]="/home/sundleeb/DM15ana/CMSSW_7_4_0_pre6/src/MonoJetAnalysis/NtupleAnalyzer/test/config/test/ntuple_newNtupleAnalyzer/step4_ntuple_NonThDM_1TeV_1.root";
-  mydataset["nonth1TeV2"]="/home/sundleeb/DM15ana/CMSSW_7_4_0_pre6/src/MonoJetAnalysis/NtupleAnalyzer/test/config/test/ntuple_newNtupleAnalyzer/step4_ntuple_NonThDM_1TeV_2.root";
-  mydataset["nonth1TeV3"]="/home/sundleeb/DM15ana/CMSSW_7_4_0_pre6/src/MonoJetAnalysis/NtupleAnalyzer/test/config/test/ntuple_newNtupleAnalyzer/step4_ntuple_NonThDM_1TeV_3.root";
-  mydataset["nonth1TeV4"]="/home/sundleeb/DM15ana/CMSSW_7_4_0_pre6/src/MonoJetAnalysis/NtupleAnalyzer/test/config/test/ntuple_newNtupleAnalyzer/step4_ntuple_NonThDM_1TeV_4.root";
-
-  mydataset["nonth1TeVrun34v2"]="/home/sundleeb/DM15ana/CMSSW_7_4_0_pre6/src/MonoJetAnalysis/NtupleAnalyzer/test/config/test/step4_ntuple_NonThDM_1TeV_run34_v2.root";
-  mydataset["nonth1TeVrun56v2"]="/home/sundleeb/DM15ana/CMSSW_7_4_0_pre6/src/MonoJetAnalysis/NtupleAnalyzer/test/config/test/step4_ntuple_NonThDM_1TeV_run56_v2.root";
-  mydataset["nonth2TeVrun34v2"]="/home/sundleeb/DM15ana/CMSSW_7_4_0_pre6/src/MonoJetAnalysis/NtupleAnalyzer/test/config/test/step4_ntuple_NonThDM_2TeV_run34_v2.root";
-  mydataset["nonth2TeVrun56v2"]="/home/sundleeb/DM15ana/CMSSW_7_4_0_pre6/src/MonoJetAnalysis/NtupleAnalyzer/test/config/test/step4_ntuple_NonThDM_2TeV_run56_v2.root";
-  mydataset["nonth3TeVrun34v2"]="/home/sundleeb/DM15ana/CMSSW_7_4_0_pre6/src/MonoJetAnalysis/NtupleAnalyzer/test/config/test/step4_ntuple_NonThDM_3TeV_run34_v2.root";
-  mydataset["nonth3TeVrun56v2"]="/home/sundleeb/DM15ana/CMSSW_7_4_0_pre6/src/MonoJetAnalysis/NtupleAnalyzer/test/config/test/step4_ntuple_NonThDM_3TeV_run56_v2.root";
-  mydataset["nonth0.5TeVrun34v2"]="/home/sundleeb/DM15ana/CMSSW_7_4_0_pre6/src/MonoJetAnalysis/NtupleAnalyzer/test/config/test/step4_ntuple_NonThDM_500GeV_run34_v2.root";
-  mydataset["nonth0.5TeVrun56v2"]="/home/sundleeb/DM15ana/CMSSW_7_4_0_pre6/src/MonoJetAnalysis/NtupleAnalyzer/test/config/test/step4_ntuple_NonThDM_500GeV_run56_v2.root";
-
-  mydataset["nonTh1TeV_01_v2"]="/lustre/scratch/sundleeb/CMSSW_7_4_0_pre6/src/MonoJetAnalysis/NtupleAnalyzer/test/config/test/data/step4_ntuple_NonThDM_1000_GeV_run_01_v2.root";
-  mydataset["nonTh1TeV_02_v2"]="/lustre/scratch/sundleeb/CMSSW_7_4_0_pre6/src/MonoJetAnalysis/NtupleAnalyzer/test/config/test/data/step4_ntuple_NonThDM_1000_GeV_run_02_v2.root";
-  mydataset["nonTh1TeV_03_v2"]="/lustre/scratch/sundleeb/CMSSW_7_4_0_pre6/src/MonoJetAnalysis/NtupleAnalyzer/test/config/test/data/step4_ntuple_NonThDM_1000_GeV_run_03_v2.root";
-  mydataset["nonTh1TeV_04_v2"]="/lustre/scratch/sundleeb/CMSSW_7_4_0_pre6/src/MonoJetAnalysis/NtupleAnalyzer/test/config/test/data/step4_ntuple_NonThDM_1000_GeV_run_04_v2.root";
-  mydataset["nonTh1TeV_05_v2"]="/lustre/scratch/sundleeb/CMSSW_7_4_0_pre6/src/MonoJetAnalysis/NtupleAnalyzer/test/config/test/data/step4_ntuple_NonThDM_1000_GeV_run_05_v2.root";
-  mydataset["nonTh1TeV_06_v2"]="/lustre/scratch/sundleeb/CMSSW_7_4_0_pre6/src/MonoJetAnalysis/NtupleAnalyzer/test/config/test/data/step4_ntuple_NonThDM_1000_GeV_run_06_v2.root";
-  mydataset["nonTh1TeV_07_v2"]="/lustre/scratch/sundleeb/CMSSW_7_4_0_pre6/src/MonoJetAnalysis/NtupleAnalyzer/test/config/test/data/step4_ntuple_NonThDM_1000_GeV_run_07_v2.root";
-  mydataset["nonTh1TeV_08_v2"]="/lustre/scratch/sundleeb/CMSSW_7_4_0_pre6/src/MonoJetAnalysis/NtupleAnalyzer/test/config/test/data/step4_ntuple_NonThDM_1000_GeV_run_08_v2.root";
-  mydataset["nonTh1TeV_09_v2"]="/lustre/scratch/sundleeb/CMSSW_7_4_0_pre6/src/MonoJetAnalysis/NtupleAnalyzer/test/config/test/data/step4_ntuple_NonThDM_1000_GeV_run_09_v2.root";
-  mydataset["nonTh1TeV_10_v2"]="/lustre/scratch/sundleeb/CMSSW_7_4_0_pre6/src/MonoJetAnalysis/NtupleAnalyzer/test/config/test/data/step4_ntuple_NonThDM_1000_GeV_run_10_v2.root";
-  mydataset["nonTh1TeV_11_v2"]="/lustre/scratch/sundleeb/CMSSW_7_4_0_pre6/src/MonoJetAnalysis/NtupleAnalyzer/test/config/test/data/step4_ntuple_NonThDM_1000_GeV_run_11_v2.root";
-  mydataset["nonTh1TeV_12_v2"]="/lustre/scratch/sundleeb/CMSSW_7_4_0_pre6/src/MonoJetAnalysis/NtupleAnalyzer/test/config/test/data/step4_ntuple_NonThDM_1000_GeV_run_12_v2.root";
-  mydataset["nonTh1TeV_13_v2"]="/lustre/scratch/sundleeb/CMSSW_7_4_0_pre6/src/MonoJetAnalysis/NtupleAnalyzer/test/config/test/data/step4_ntuple_NonThDM_1000_GeV_run_13_v2.root";
-  mydataset["nonTh1TeV_14_v2"]="/lustre/scratch/sundleeb/CMSSW_7_4_0_pre6/src/MonoJetAnalysis/NtupleAnalyzer/test/config/test/data/step4_ntuple_NonThDM_1000_GeV_run_14_v2.root";
-  mydataset["nonTh1TeV_15_v2"]="/lustre/scratch/sundleeb/CMSSW_7_4_0_pre6/src/MonoJetAnalysis/NtupleAnalyzer/test/config/test/data/step4_ntuple_NonThDM_1000_GeV_run_15_v2.root";
-  mydataset["nonTh1TeV_16_v2"]="/lustre/scratch/sundleeb/CMSSW_7_4_0_pre6/src/MonoJetAnalysis/NtupleAnalyzer/test/config/test/data/step4_ntuple_NonThDM_1000_GeV_run_16_v2.root";
-  mydataset["nonTh1TeV_17_v2"]="/lustre/scratch/sundleeb/CMSSW_7_4_0_pre6/src/MonoJetAnalysis/NtupleAnalyzer/test/config/test/data/step4_ntuple_NonThDM_1000_GeV_run_17_v2.root";
-  mydataset["nonTh1TeV_18_v2"]="/lustre/scratch/sundleeb/CMSSW_7_4_0_pre6/src/MonoJetAnalysis/NtupleAnalyzer/test/config/test/data/step4_ntuple_NonThDM_1000_GeV_run_18_v2.root";
-  mydataset["nonTh1TeV_19_v2"]="/lustre/scratch/sundleeb/CMSSW_7_4_0_pre6/src/MonoJetAnalysis/NtupleAnalyzer/test/config/test/data/step4_ntuple_NonThDM_1000_GeV_run_19_v2.root";
-  mydataset["nonTh1TeV_20_v2"]="/lustre/scratch/sundleeb/CMSSW_7_4_0_pre6/src/MonoJetAnalysis/NtupleAnalyzer/test/config/test/data/step4_ntuple_NonThDM_1000_GeV_run_20_v2.root";
-  mydataset["nonTh1TeV_21_v2"]="/lustre/scratch/sundleeb/CMSSW_7_4_0_pre6/src/MonoJetAnalysis/NtupleAnalyzer/test/config/test/data/step4_ntuple_NonThDM_1000_GeV_run_21_v2.root";
-  mydataset["nonTh1TeV_22_v2"]="/lustre/scratch/sundleeb/CMSSW_7_4_0_pre6/src/MonoJetAnalysis/NtupleAnalyzer/test/config/test/data/step4_ntuple_NonThDM_1000_GeV_run_22_v2.root";
-  mydataset["nonTh1TeV_23_v2"]="/lustre/scratch/sundleeb/CMSSW_7_4_0_pre6/src/MonoJetAnalysis/NtupleAnalyzer/test/config/test/data/step4_ntuple_NonThDM_1000_GeV_run_23_v2.root";
-  mydataset["nonTh1TeV_24_v2"]="/lustre/scratch/sundleeb/CMSSW_7_4_0_pre6/src/MonoJetAnalysis/NtupleAnalyzer/test/config/test/data/step4_ntuple_NonThDM_1000_GeV_run_24_v2.root";
-  mydataset["nonTh1TeV_25_v2"]="/lustre/scratch/sundleeb/CMSSW_7_4_0_pre6/src/MonoJetAnalysis/NtupleAnalyzer/test/config/test/data/step4_ntuple_NonThDM_1000_GeV_run_25_v2.root";
-  mydataset["nonTh1TeV_26_v2"]="/lustre/scratch/sundleeb/CMSSW_7_4_0_pre6/src/MonoJetAnalysis/NtupleAnalyzer/test/config/test/data/step4_ntuple_NonThDM_1000_GeV_run_26_v2.root";
-  mydataset["nonTh1TeV_27_v2"]="/lustre/scratch/sundleeb/CMSSW_7_4_0_pre6/src/MonoJetAnalysis/NtupleAnalyzer/test/config/test/data/step4_ntuple_NonThDM_1000_GeV_run_27_v2.root";
-  mydataset["nonTh1TeV_28_v2"]="/lustre/scratch/sundleeb/CMSSW_7_4_0_pre6/src/MonoJetAnalysis/NtupleAnalyzer/test/config/test/data/step4_ntuple_NonThDM_1000_GeV_run_28_v2.root";
-  mydataset["nonTh1TeV_29_v2"]="/lustre/scratch/sundleeb/CMSSW_7_4_0_pre6/src/MonoJetAnalysis/NtupleAnalyzer/test/config/test/data/step4_ntuple_NonThDM_1000_GeV_run_29_v2.root";
-  mydataset["nonTh1TeV_30_v2"]="/lustre/scratch/sundleeb/CMSSW_7_4_0_pre6/src/MonoJetAnalysis/NtupleAnalyzer/test/config/test/data/step4_ntuple_NonThDM_1000_GeV_run_30_v2.root";
-  mydataset["nonTh1TeV_31_v2"]="/lustre/scratch/sundleeb/CMSSW_7_4_0_pre6/src/MonoJetAnalysis/NtupleAnalyzer/test/config/test/data/step4_ntuple_NonThDM_1000_GeV_run_31_v2.root";
-  mydataset["nonTh1TeV_32_v2"]="/lustre/scratch/sundleeb/CMSSW_7_4_0_pre6/src/MonoJetAnalysis/NtupleAnalyzer/test/config/test/data/step4_ntuple_NonThDM_1000_GeV_run_32_v2.root";
-  mydataset["nonTh1TeV_33_v2"]="/lustre/scratch/sundleeb/CMSSW_7_4_0_pre6/src/MonoJetAnalysis/NtupleAnalyzer/test/config/test/data/step4_ntuple_NonThDM_1000_GeV_run_33_v2.root";
-  mydataset["nonTh1TeV_34_v2"]="/lustre/scratch/sundleeb/CMSSW_7_4_0_pre6/src/MonoJetAnalysis/NtupleAnalyzer/test/config/test/data/step4_ntuple_NonThDM_1000_GeV_run_34_v2.root";
-  mydataset["nonTh1TeV_35_v2"]="/lustre/scratch/sundleeb/CMSSW_7_4_0_pre6/src/MonoJetAnalysis/NtupleAnalyzer/test/config/test/data/step4_ntuple_NonThDM_1000_GeV_run_35_v2.root";
-  mydataset["nonTh1TeV_36_v2"]="/lustre/scratch/sundleeb/CMSSW_7_4_0_pre6/src/MonoJetAnalysis/NtupleAnalyzer/test/config/test/data/step4_ntuple_NonThDM_1000_GeV_run_36_v2.root";
-  mydataset["nonTh1TeV_37_v2"]="/lustre/scratch/sundleeb/CMSSW_7_4_0_pre6/src/MonoJetAnalysis/NtupleAnalyzer/test/config/test/data/step4_ntuple_NonThDM_1000_GeV_run_37_v2.root";
-  mydataset["nonTh1TeV_38_v2"]="/lustre/scratch/sundleeb/CMSSW_7_4_0_pre6/src/MonoJetAnalysis/NtupleAnalyzer/test/config/test/data/step4_ntuple_NonThDM_1000_GeV_run_38_v2.root";
-  mydataset["nonTh1TeV_39_v2"]="/lustre/scratch/sundleeb/CMSSW_7_4_0_pre6/src/MonoJetAnalysis/NtupleAnalyzer/test/config/test/data/step4_ntuple_NonThDM_1000_GeV_run_39_v2.root";
-  mydataset["nonTh1TeV_40_v2"]="/lustre/scratch/sundleeb/CMSSW_7_4_0_pre6/src/MonoJetAnalysis/NtupleAnalyzer/test/config/test/data/step4_ntuple_NonThDM_1000_GeV_run_40_v2.root";
-  mydataset["nonTh1TeV_41_v2"]="/lustre/scratch/sundleeb/CMSSW_7_4_0_pre6/src/MonoJetAnalysis/NtupleAnalyzer/test/config/test/data/step4_ntuple_NonThDM_1000_GeV_run_41_v2.root";
-  mydataset["nonTh1TeV_42_v2"]="/lustre/scratch/sundleeb/CMSSW_7_4_0_pre6/src/MonoJetAnalysis/NtupleAnalyzer/test/config/test/data/step4_ntuple_NonThDM_1000_GeV_run_42_v2.root";
-  mydataset["nonTh1TeV_44_v2"]="/lustre/scratch/sundleeb/CMSSW_7_4_0_pre6/src/MonoJetAnalysis/NtupleAnalyzer/test/config/test/data/step4_ntuple_NonThDM_1000_GeV_run_44_v2.root";
-  mydataset["nonTh1TeV_45_v2"]="/lustre/scratch/sundleeb/CMSSW_7_4_0_pre6/src/MonoJetAnalysis/NtupleAnalyzer/test/config/test/data/step4_ntuple_NonThDM_1000_GeV_run_45_v2.root";
-  mydataset["nonTh1TeV_46_v2"]="/lustre/scratch/sundleeb/CMSSW_7_4_0_pre6/src/MonoJetAnalysis/NtupleAnalyzer/test/config/test/data/step4_ntuple_NonThDM_1000_GeV_run_46_v2.root";
-  mydataset["nonTh1TeV_48_v2"]="/lustre/scratch/sundleeb/CMSSW_7_4_0_pre6/src/MonoJetAnalysis/NtupleAnalyzer/test/config/test/data/step4_ntuple_NonThDM_1000_GeV_run_48_v2.root";
-  mydataset["nonTh1TeV_49_v2"]="/lustre/scratch/sundleeb/CMSSW_7_4_0_pre6/src/MonoJetAnalysis/NtupleAnalyzer/test/config/test/data/step4_ntuple_NonThDM_1000_GeV_run_49_v2.root";
-  mydataset["nonTh1TeV_50_v2"]="/lustre/scratch/sundleeb/CMSSW_7_4_0_pre6/src/MonoJetAnalysis/NtupleAnalyzer/test/config/test/data/step4_ntuple_NonThDM_1000_GeV_run_50_v2.root";
-  mydataset["nonTh1TeV_51_v2"]="/lustre/scratch/sundleeb/CMSSW_7_4_0_pre6/src/MonoJetAnalysis/NtupleAnalyzer/test/config/test/data/step4_ntuple_NonThDM_1000_GeV_run_51_v2.root";
-  mydataset["nonTh1TeV_52_v2"]="/lustre/scratch/sundleeb/CMSSW_7_4_0_pre6/src/MonoJetAnalysis/NtupleAnalyzer/test/config/test/data/step4_ntuple_NonThDM_1000_GeV_run_52_v2.root";
-  mydataset["nonTh1TeV_53_v2"]="/lustre/scratch/sundleeb/CMSSW_7_4_0_pre6/src/MonoJetAnalysis/NtupleAnalyzer/test/config/test/data/step4_ntuple_NonThDM_1000_GeV_run_53_v2.root";
-  mydataset["nonTh1TeV_54_v2"]="/lustre/scratch/sundleeb/CMSSW_7_4_0_pre6/src/MonoJetAnalysis/NtupleAnalyzer/test/config/test/data/step4_ntuple_NonThDM_1000_GeV_run_54_v2.root";
-  mydataset["nonTh1TeV_55_v2"]="/lustre/scratch/sundleeb/CMSSW_7_4_0_pre6/src/MonoJetAnalysis/NtupleAnalyzer/test/config/test/data/step4_ntuple_NonThDM_1000_GeV_run_55_v2.root";
-  mydataset["nonTh1TeV_56_v2"]="/lustre/scratch/sundleeb/CMSSW_7_4_0_pre6/src/MonoJetAnalysis/NtupleAnalyzer/test/config/test/data/step4_ntuple_NonThDM_1000_GeV_run_56_v2.root";
-  mydataset["nonTh1TeV_57_v2"]="/lustre/scratch/sundleeb/CMSSW_7_4_0_pre6/src/MonoJetAnalysis/NtupleAnalyzer/test/config/test/data/step4_ntuple_NonThDM_1000_GeV_run_57_v2.root";
-  mydataset["nonTh1TeV_58_v2"]="/lustre/scratch/sundleeb/CMSSW_7_4_0_pre6/src/MonoJetAnalysis/NtupleAnalyzer/test/config/test/data/step4_ntuple_NonThDM_1000_GeV_run_58_v2.root";
-  mydataset["nonTh1TeV_59_v2"]="/lustre/scratch/sundleeb/CMSSW_7_4_0_pre6/src/MonoJetAnalysis/NtupleAnalyzer/test/config/test/data/step4_ntuple_NonThDM_1000_GeV_run_59_v2.root";
-  mydataset["nonTh1TeV_60_v2"]="/lustre/scratch/sundleeb/CMSSW_7_4_0_pre6/src/MonoJetAnalysis/NtupleAnalyzer/test/config/test/data/step4_ntuple_NonThDM_1000_GeV_run_60_v2.root";
-  mydataset["nonTh1TeV_61_v2"]="/lustre/scratch/sundleeb/CMSSW_7_4_0_pre6/src/MonoJetAnalysis/NtupleAnalyzer/test/config/test/data/step4_ntuple_NonThDM_1000_GeV_run_61_v2.root";
-  mydataset["nonTh1TeV_62_v2"]="/lustre/scratch/sundleeb/CMSSW_7_4_0_pre6/src/MonoJetAnalysis/NtupleAnalyzer/test/config/test/data/step4_ntuple_NonThDM_1000_GeV_run_62_v2.root";
-  mydataset["nonTh1TeV_63_v2"]="/lustre/scratch/sundleeb/CMSSW_7_4_0_pre6/src/MonoJetAnalysis/NtupleAnalyzer/test/config/test/data/step4_ntuple_NonThDM_1000_GeV_run_63_v2.root";
-  mydataset["nonTh1TeV_64_v2"]="/lustre/scratch/sundleeb/CMSSW_7_4_0_pre6/src/MonoJetAnalysis/NtupleAnalyzer/test/config/test/data/step4_ntuple_NonThDM_1000_GeV_run_64_v2.root";
-  mydataset["nonTh1TeV_65_v2"]="/lustre/scratch/sundleeb/CMSSW_7_4_0_pre6/src/MonoJetAnalysis/NtupleAnalyzer/test/config/test/data/step4_ntuple_NonThDM_1000_GeV_run_65_v2.root";
-  mydataset["nonTh1TeV_66_v2"]="/lustre/scratch/sundleeb/CMSSW_7_4_0_pre6/src/MonoJetAnalysis/NtupleAnalyzer/test/config/test/data/step4_ntuple_NonThDM_1000_GeV_run_66_v2.root";
-  mydataset["nonTh1TeV_67_v2"]="/lustre/scratch/sundleeb/CMSSW_7_4_0_pre6/src/MonoJetAnalysis/NtupleAnalyzer/test/config/test/data/step4_ntuple_NonThDM_1000_GeV_run_67_v2.root";
-  mydataset["nonTh1TeV_68_v2"]="/lustre/scratch/sundleeb/CMSSW_7_4_0_pre6/src/MonoJetAnalysis/NtupleAnalyzer/test/config/test/data/step4_ntuple_NonThDM_1000_GeV_run_68_v2.root";
-  mydataset["nonTh1TeV_69_v2"]="/lustre/scratch/sundleeb/CMSSW_7_4_0_pre6/src/MonoJetAnalysis/NtupleAnalyzer/test/config/test/data/step4_ntuple_NonThDM_1000_GeV_run_69_v2.root";
-  mydataset["nonTh1TeV_70_v2"]="/lustre/scratch/sundleeb/CMSSW_7_4_0_pre6/src/MonoJetAnalysis/NtupleAnalyzer/test/config/test/data/step4_ntuple_NonThDM_1000_GeV_run_70_v2.root";
-  mydataset["nonTh1TeV_71_v2"]="/lustre/scratch/sundleeb/CMSSW_7_4_0_pre6/src/MonoJetAnalysis/NtupleAnalyzer/test/config/test/data/step4_ntuple_NonThDM_1000_GeV_run_71_v2.root";
-  mydataset["nonTh1TeV_72_v2"]="/lustre/scratch/sundleeb/CMSSW_7_4_0_pre6/src/MonoJetAnalysis/NtupleAnalyzer/test/config/test/data/step4_ntuple_NonThDM_1000_GeV_run_72_v2.root";
-  mydataset["nonTh1TeV_73_v2"]="/lustre/scratch/sundleeb/CMSSW_7_4_0_pre6/src/MonoJetAnalysis/NtupleAnalyzer/test/config/test/data/step4_ntuple_NonThDM_1000_GeV_run_73_v2.root";
-  mydataset["nonTh1TeV_74_v2"]="/lustre/scratch/sundleeb/CMSSW_7_4_0_pre6/src/MonoJetAnalysis/NtupleAnalyzer/test/config/test/data/step4_ntuple_NonThDM_1000_GeV_run_74_v2.root";
-  mydataset["nonTh1TeV_75_v2"]="/lustre/scratch/sundleeb/CMSSW_7_4_0_pre6/src/MonoJetAnalysis/NtupleAnalyzer/test/config/test/data/step4_ntuple_NonThDM_1000_GeV_run_75_v2.root";
-  mydataset["nonTh1TeV_76_v2"]="/lustre/scratch/sundleeb/CMSSW_7_4_0_pre6/src/MonoJetAnalysis/NtupleAnalyzer/test/config/test/data/step4_ntuple_NonThDM_1000_GeV_run_76_v2.root";
-  mydataset["nonTh1TeV_77_v2"]="/lustre/scratch/sundleeb/CMSSW_7_4_0_pre6/src/MonoJetAnalysis/NtupleAnalyzer/test/config/test/data/step4_ntuple_NonThDM_1000_GeV_run_77_v2.root";
-  mydataset["nonTh1TeV_79_v2"]="/lustre/scratch/sundleeb/CMSSW_7_4_0_pre6/src/MonoJetAnalysis/NtupleAnalyzer/test/config/test/data/step4_ntuple_NonThDM_1000_GeV_run_79_v2.root";
-  mydataset["nonTh1TeV_80_v2"]="/lustre/scratch/sundleeb/CMSSW_7_4_0_pre6/src/MonoJetAnalysis/NtupleAnalyzer/test/config/test/data/step4_ntuple_NonThDM_1000_GeV_run_80_v2.root";
-  mydataset["nonTh1TeV_81_v2"]="/lustre/scratch/sundleeb/CMSSW_7_4_0_pre6/src/MonoJetAnalysis/NtupleAnalyzer/test/config/test/data/step4_ntuple_NonThDM_1000_GeV_run_81_v2.root";
-  mydataset["nonTh1TeV_82_v2"]="/lustre/scratch/sundleeb/CMSSW_7_4_0_pre6/src/MonoJetAnalysis/NtupleAnalyzer/test/config/test/data/step4_ntuple_NonThDM_1000_GeV_run_82_v2.root";
-  mydataset["nonTh1TeV_83_v2"]="/lustre/scratch/sundleeb/CMSSW_7_4_0_pre6/src/MonoJetAnalysis/NtupleAnalyzer/test/config/test/data/step4_ntuple_NonThDM_1000_GeV_run_83_v2.root";
-  mydataset["nonTh1TeV_84_v2"]="/lustre/scratch/sundleeb/CMSSW_7_4_0_pre6/src/MonoJetAnalysis/NtupleAnalyzer/test/config/test/data/step4_ntuple_NonThDM_1000_GeV_run_84_v2.root";
-  mydataset["nonTh1TeV_85_v2"]="/lustre/scratch/sundleeb/CMSSW_7_4_0_pre6/src/MonoJetAnalysis/NtupleAnalyzer/test/config/test/data/step4_ntuple_NonThDM_1000_GeV_run_85_v2.root";
-  mydataset["nonTh1TeV_86_v2"]="/lustre/scratch/sundleeb/CMSSW_7_4_0_pre6/src/MonoJetAnalysis/NtupleAnalyzer/test/config/test/data/step4_ntuple_NonThDM_1000_GeV_run_86_v2.root";
-  mydataset["nonTh1TeV_87_v2"]="/lustre/scratch/sundleeb/CMSSW_7_4_0_pre6/src/MonoJetAnalysis/NtupleAnalyzer/test/config/test/data/step4_ntuple_NonThDM_1000_GeV_run_87_v2.root";
-  mydataset["nonTh1TeV_88_v2"]="/lustre/scratch/sundleeb/CMSSW_7_4_0_pre6/src/MonoJetAnalysis/NtupleAnalyzer/test/config/test/data/step4_ntuple_NonThDM_1000_GeV_run_88_v2.root";
-  mydataset["nonTh1TeV_89_v2"]="/lustre/scratch/sundleeb/CMSSW_7_4_0_pre6/src/MonoJetAnalysis/NtupleAnalyzer/test/config/test/data/step4_ntuple_NonThDM_1000_GeV_run_89_v2.root";
-  mydataset["nonTh1TeV_90_v2"]="/lustre/scratch/sundleeb/CMSSW_7_4_0_pre6/src/MonoJetAnalysis/NtupleAnalyzer/test/config/test/data/step4_ntuple_NonThDM_1000_GeV_run_90_v2.root";
-  mydataset["nonTh1TeV_91_v2"]="/lustre/scratch/sundleeb/CMSSW_7_4_0_pre6/src/MonoJetAnalysis/NtupleAnalyzer/test/config/test/data/step4_ntuple_NonThDM_1000_GeV_run_91_v2.root";
-  mydataset["nonTh1TeV_92_v2"]="/lustre/scratch/sundleeb/CMSSW_7_4_0_pre6/src/MonoJetAnalysis/NtupleAnalyzer/test/config/test/data/step4_ntuple_NonThDM_1000_GeV_run_92_v2.root";
-  mydataset["nonTh1TeV_93_v2"]="/lustre/scratch/sundleeb/CMSSW_7_4_0_pre6/src/MonoJetAnalysis/NtupleAnalyzer/test/config/test/data/step4_ntuple_NonThDM_1000_GeV_run_93_v2.root";
-  mydataset["nonTh1TeV_94_v2"]="/lustre/scratch/sundleeb/CMSSW_7_4_0_pre6/src/MonoJetAnalysis/NtupleAnalyzer/test/config/test/data/step4_ntuple_NonThDM_1000_GeV_run_94_v2.root";
-  mydataset["nonTh1TeV_95_v2"]="/lustre/scratch/sundleeb/CMSSW_7_4_0_pre6/src/MonoJetAnalysis/NtupleAnalyzer/test/config/test/data/step4_ntuple_NonThDM_1000_GeV_run_95_v2.root";
-  mydataset["nonTh1TeV_96_v2"]="/lustre/scratch/sundleeb/CMSSW_7_4_0_pre6/src/MonoJetAnalysis/NtupleAnalyzer/test/config/test/data/step4_ntuple_NonThDM_1000_GeV_run_96_v2.root";
-  mydataset["nonTh1TeV_97_v2"]="/lustre/scratch/sundleeb/CMSSW_7_4_0_pre6/src/MonoJetAnalysis/NtupleAnalyzer/test/config/test/data/step4_ntuple_NonThDM_1000_GeV_run_97_v2.root";
-  mydataset["nonTh1TeV_98_v2"]="/lustre/scratch/sundleeb/CMSSW_7_4_0_pre6/src/MonoJetAnalysis/NtupleAnalyzer/test/config/test/data/step4_ntuple_NonThDM_1000_GeV_run_98_v2.root";
-  mydataset["nonTh1TeV_99_v2"]="/lustre/scratch/sundleeb/CMSSW_7_4_0_pre6/src/MonoJetAnalysis/NtupleAnalyzer/test/config/test/data/step4_ntuple_NonThDM_1000_GeV_run_99_v2.root";
-  mydataset["nonTh1TeV_100_v2"]="/lustre/scratch/sundleeb/CMSSW_7_4_0_pre6/src/MonoJetAnalysis/NtupleAnalyzer/test/config/test/data/step4_ntuple_NonThDM_1000_GeV_run_100_v2.root";
-
-
-
-  mydataset["DM_MJ_M_100_AV_local"]="/lustre/hep/ccowden/CMSMonojet/NtupleMaker/ntuples/DarkMatter_Monojet_M_100_AV_local.root";
-
-  mydataset["DM_MJ_M_1000_AV"]="/lustre/hep/ccowden/CMSMonojet/NtupleMaker/ntuples/ntuple_DarkMatter_Monojet_M-1000_AV.root";
-
-  mydataset["DM_MJ_M_1000_V"]="/lustre/hep/ccowden/CMSMonojet/NtupleMaker/ntuples/ntuple_DarkMatter_Monojet_M-1000_V.root";
-
-  mydataset["DM_MJ_M_100_AV"]="/lustre/hep/ccowden/CMSMonojet/NtupleMaker/ntuples/ntuple_DarkMatter_Monojet_M-100_AV.root";
-
-  mydataset["DM_MJ_M_100_V"]="/lustre/hep/ccowden/CMSMonojet/NtupleMaker/ntuples/ntuple_DarkMatter_Monojet_M-100_V.root";
-
-  mydataset["DM_MonoJet_M_10_AV"]="/lustre/hep/ccowden/CMSMonojet/NtupleMaker/ntuples/ntuple_DarkMatter_Monojet_M-10_AV.root";
-
-  mydataset["DM_MonoJet_M_10_V"]="/lustre/hep/ccowden/CMSMonojet/NtupleMaker/ntuples/ntuple_DarkMatter_Monojet_M-10_V.root";
-
-  mydataset["DM_MonoJet_M_1_AV"]="/lustre/hep/ccowden/CMSMonojet/NtupleMaker/ntuples/ntuple_DarkMatter_Monojet_M-1_AV.root";
-
-    mylumi["DM_MonoJet_M_10_V"] =   189400./100.8;
-    mylumi["DM_MonoJet_M_10_AV"] =  191200./100.8;
-
-    mylumi["nonth1TeVrun34"]=1000./0.12579;
-    mylumi["nonth2TeVrun34"]=1000./0.004047;
-    mylumi["nonth2TeVrun56"]=1000./0.14791;
-    mylumi["nonth3TeVrun34"]=1000./0.00036545;
-    mylumi["nonth3TeVrun56"]=1000./0.039131;
-    mylumi["nonth0.5TeVrun34"]=1000./2.2038;
-    mylumi["nonth0.5TeVrun56"]=1000./55.442;
-    mylumi["nonth1TeV1"]=1000./0.0050967;
-    mylumi["nonth1TeV2"]=1000./0.041742;
-    mylumi["nonth1TeV3"]=1000./0.050159;
-    mylumi["nonth1TeV4"]=1000./23.387;
-
-    mylumi["nonth1TeVrun34v2"]=1000./0.12567;
-    mylumi["nonth1TeVrun56v2"]=1000./3.2919;
-    mylumi["nonth2TeVrun34v2"]=1000./0.0004843;
-    mylumi["nonth2TeVrun56v2"]=1000./0.015857;
-    mylumi["nonth3TeVrun34v2"]=1000./0.00032621;
-    mylumi["nonth3TeVrun56v2"]=1000./0.012849;
-    mylumi["nonth0.5TeVrun34v2"]=1000./2.2091;
-    mylumi["nonth0.5TeVrun56v2"]=1000./55.267;
-
-    mylumi["nonTh1TeV_01_v2"]=1000./0.0014597;
-    mylumi["nonTh1TeV_02_v2"]=1000./0.003342;
-    mylumi["nonTh1TeV_03_v2"]=1000./0.005098;
-    mylumi["nonTh1TeV_04_v2"]=1000./0.005565;
-    mylumi["nonTh1TeV_05_v2"]=1000./0.005910;
-    mylumi["nonTh1TeV_06_v2"]=1000./0.008296;
-    mylumi["nonTh1TeV_07_v2"]=1000./0.028019;
-    mylumi["nonTh1TeV_08_v2"]=1000./0.30176;
-    mylumi["nonTh1TeV_09_v2"]=1000./7.7655;
-    mylumi["nonTh1TeV_10_v2"]=1000./33.838;
-    mylumi["nonTh1TeV_11_v2"]=1000./0.0016958;
-    mylumi["nonTh1TeV_12_v2"]=1000./0.0052204;
-    mylumi["nonTh1TeV_13_v2"]=1000./0.012472;
-    mylumi["nonTh1TeV_14_v2"]=1000./0.01561;
-    mylumi["nonTh1TeV_15_v2"]=1000./0.01687;
-    mylumi["nonTh1TeV_16_v2"]=1000./0.019811;
-    mylumi["nonTh1TeV_17_v2"]=1000./0.04037;
-    mylumi["nonTh1TeV_18_v2"]=1000./0.31300;
-    mylumi["nonTh1TeV_19_v2"]=1000./7.8286;
-    mylumi["nonTh1TeV_20_v2"]=1000./34.837;
-    mylumi["nonTh1TeV_21_v2"]=1000./0.0018434;
-    mylumi["nonTh1TeV_22_v2"]=1000./0.0069735;
-    mylumi["nonTh1TeV_23_v2"]=1000./0.031592;
-    mylumi["nonTh1TeV_24_v2"]=1000./0.063548;
-    mylumi["nonTh1TeV_25_v2"]=1000./0.085514;
-    mylumi["nonTh1TeV_26_v2"]=1000./0.098009;
-    mylumi["nonTh1TeV_27_v2"]=1000./0.12401;
-    mylumi["nonTh1TeV_28_v2"]=1000./0.4106;
-    mylumi["nonTh1TeV_29_v2"]=1000./7.9025;
-    mylumi["nonTh1TeV_30_v2"]=1000./34.299;
-    mylumi["nonTh1TeV_31_v2"]=1000./0.0018729;
-    mylumi["nonTh1TeV_32_v2"]=1000./0.0073871;
-    mylumi["nonTh1TeV_33_v2"]=1000./0.041908;
-    mylumi["nonTh1TeV_34_v2"]=1000./0.12567;
-    mylumi["nonTh1TeV_35_v2"]=1000./0.25236;
-    mylumi["nonTh1TeV_36_v2"]=1000./0.35828;
-    mylumi["nonTh1TeV_37_v2"]=1000./0.41531;
-    mylumi["nonTh1TeV_38_v2"]=1000./0.74525;
-    mylumi["nonTh1TeV_39_v2"]=1000./8.0081;
-    mylumi["nonTh1TeV_40_v2"]=1000./33.682;
-    mylumi["nonTh1TeV_41_v2"]=1000./0.0018847;
-    mylumi["nonTh1TeV_42_v2"]=1000./0.0074999;
-    mylumi["nonTh1TeV_44_v2"]=1000./0.16809;
-    mylumi["nonTh1TeV_45_v2"]=1000./0.50567;
-    mylumi["nonTh1TeV_46_v2"]=1000./1.1674;
-    mylumi["nonTh1TeV_48_v2"]=1000./2.0663;
-    mylumi["nonTh1TeV_49_v2"]=1000./8.8381;
-    mylumi["nonTh1TeV_50_v2"]=1000./34.491;
-    mylumi["nonTh1TeV_51_v2"]=1000./0.0019394;
-    mylumi["nonTh1TeV_52_v2"]=1000./0.0077688;
-    mylumi["nonTh1TeV_53_v2"]=1000./0.048299;
-    mylumi["nonTh1TeV_54_v2"]=1000./0.19080;
-    mylumi["nonTh1TeV_55_v2"]=1000./0.72101;
-    mylumi["nonTh1TeV_56_v2"]=1000./3.2919;
-    mylumi["nonTh1TeV_57_v2"]=1000./6.8721;
-    mylumi["nonTh1TeV_58_v2"]=1000./10.452;
-    mylumi["nonTh1TeV_59_v2"]=1000./15.930;
-    mylumi["nonTh1TeV_60_v2"]=1000./33.595;
-    mylumi["nonTh1TeV_61_v2"]=1000./0.0021101;
-    mylumi["nonTh1TeV_62_v2"]=1000./0.0084426;
-    mylumi["nonTh1TeV_63_v2"]=1000./0.052742;
-    mylumi["nonTh1TeV_64_v2"]=1000./0.20995;
-    mylumi["nonTh1TeV_65_v2"]=1000./0.82855;
-    mylumi["nonTh1TeV_66_v2"]=1000./4.7427;
-    mylumi["nonTh1TeV_67_v2"]=1000./14.652;
-    mylumi["nonTh1TeV_68_v2"]=1000./31.533;
-    mylumi["nonTh1TeV_69_v2"]=1000./37.605;
-    mylumi["nonTh1TeV_70_v2"]=1000./44.006;
-    mylumi["nonTh1TeV_71_v2"]=1000./0.0023811;    
-    mylumi["nonTh1TeV_72_v2"]=1000./0.0095567;
-    mylumi["nonTh1TeV_73_v2"]=1000./0.059733;
-    mylumi["nonTh1TeV_74_v2"]=1000./0.23862;
-    mylumi["nonTh1TeV_75_v2"]=1000./0.94736;
-    mylumi["nonTh1TeV_76_v2"]=1000./5.7755;
-    mylumi["nonTh1TeV_77_v2"]=1000./21.207;
-    mylumi["nonTh1TeV_79_v2"]=1000./92.916;
-    mylumi["nonTh1TeV_80_v2"]=1000./66.123;
-    mylumi["nonTh1TeV_81_v2"]=1000./0.0010765;
-    mylumi["nonTh1TeV_82_v2"]=1000./0.0043000;
-    mylumi["nonTh1TeV_83_v2"]=1000./0.026941;
-    mylumi["nonTh1TeV_84_v2"]=1000./0.10761;
-    mylumi["nonTh1TeV_85_v2"]=1000./0.42813;
-    mylumi["nonTh1TeV_86_v2"]=1000./2.6642;
-    mylumi["nonTh1TeV_87_v2"]=1000./10.405;
-    mylumi["nonTh1TeV_88_v2"]=1000./37.581;
-    mylumi["nonTh1TeV_89_v2"]=1000./126.33;
-    mylumi["nonTh1TeV_90_v2"]=1000./141.96;
-    mylumi["nonTh1TeV_91_v2"]=1000./0.00030219;
-    mylumi["nonTh1TeV_92_v2"]=1000./0.0012021;
-    mylumi["nonTh1TeV_93_v2"]=1000./0.0076614;
-    mylumi["nonTh1TeV_94_v2"]=1000./0.030580;
-    mylumi["nonTh1TeV_95_v2"]=1000./0.12239;
-    mylumi["nonTh1TeV_96_v2"]=1000./0.75724;
-    mylumi["nonTh1TeV_97_v2"]=1000./3.0574;
-    mylumi["nonTh1TeV_98_v2"]=1000./11.879;
-    mylumi["nonTh1TeV_99_v2"]=1000./61.650;
-    mylumi["nonTh1TeV_100_v2"]=1000./138.56;
-
-
-  // Phys14DR
-  mydataset["py14Znunu100"] = "file:/lustre/hep/ccowden/CMSMonojet/NtupleMaker/ntuples/ntuple_ZJetsToNuNu_HT_100to200.root";
-  mydataset["py14Znunu200"] = "file:/lustre/hep/ccowden/CMSMonojet/NtupleMaker/ntuples/ntuple_ZJetsToNuNu_HT_200to400.root";
-  mydataset["py14Znunu400"] = "file:/lustre/hep/ccowden/CMSMonojet/NtupleMaker/ntuples/ntuple_ZJetsToNuNu_HT_400to600.root";
-  mydataset["py14Znunu600"] = "file:/lustre/hep/ccowden/CMSMonojet/NtupleMaker/ntuples/ntuple_ZJetsToNuNu_HT_600toInf.root";
-  // mydataset["py14Znunu600"] = "file:
-  mylumi["py14Znunu100"] =  4986424./372.6;
-  mylumi["py14Znunu200"] =  4546470./100.8;
-  mylumi["py14Znunu400"] =  4432800./11.99;
-  mylumi["py14Znunu600"] =  4463806./4.113;
-  // mylumi["py14Znunu600"] =
-
-  mydataset["py14Wjet100"] = "file:/lustre/hep/ccowden/CMSMonojet/NtupleMaker/ntuples/ntuple_WJetsToLN_HT_100to200.root";
-  mydataset["py14Wjet200"] = "file:/lustre/hep/ccowden/CMSMonojet/NtupleMaker/ntuples/ntuple_WJetsToLN_HT_200to400.root";
-  mydataset["py14Wjet400"] = "file:/lustre/hep/ccowden/CMSMonojet/NtupleMaker/ntuples/ntuple_WJetsToLN_HT_400to600.root";
-  mydataset["py14Wjet600"] = "file:/lustre/hep/ccowden/CMSMonojet/NtupleMaker/ntuples/ntuple_WJetsToLN_HT_600toInf.root";
-  mylumi["py14Wjet100"] =  5262265./1817.;
-  mylumi["py14Wjet200"] =  4936077./471.6;
-  mylumi["py14Wjet400"] =  4640594./55.61;
-  mylumi["py14Wjet600"] =  4581841./18.81;
-
-
-
-
-
-
-  // Data
-  mydataset["met1"]       = fileDirectory + "Data_22Jan13_V6D_2012A_part1.root";
-  mydataset["met2"]       = fileDirectory + "Data_22Jan13_V6D_2012A_part2.root";
-  mydataset["met3"]       = fileDirectory + "Data_22Jan13_V6D_2012B_part1.root";
-  mydataset["met4"]       = fileDirectory + "Data_22Jan13_V6D_2012B_part2.root";
-  mydataset["met5"]       = fileDirectory + "Data_22Jan13_V6D_2012B_part3.root";
-  mydataset["met6"]       = fileDirectory + "Data_22Jan13_V6D_2012C_part1.root";
-  mydataset["met7"]       = fileDirectory + "Data_22Jan13_V6D_2012C_part2.root";
-  mydataset["met8"]       = fileDirectory + "Data_22Jan13_V6D_2012C_part3.root";
-  mydataset["met9"]       = fileDirectory + "Data_22Jan13_V6D_2012C_part4.root";
-  mydataset["met10"]      = fileDirectory + "Data_22Jan13_V6D_2012C_part5.root";
-  mydataset["met11"]      = fileDirectory + "Data_22Jan13_V6D_2012C_part6.root";
-  mydataset["met12"]      = fileDirectory + "Data_22Jan13_V6D_2012D_part1.root";
-  mydataset["met13"]      = fileDirectory + "Data_22Jan13_V6D_2012D_part2.root";
-  mydataset["met14"]      = fileDirectory + "Data_22Jan13_V6D_2012D_part3.root";
-  mydataset["met15"]      = fileDirectory + "Data_22Jan13_V6D_2012D_part4.root";
-  mydataset["met16"]      = fileDirectory + "Data_22Jan13_V6D_2012D_part5.root";
-  mylumi["met1"]          = 19712.;
-  mylumi["met2"]          = 19712.;
-  mylumi["met3"]          = 19712.;
-  mylumi["met4"]          = 19712.;
-  mylumi["met5"]          = 19712.;
-  mylumi["met6"]          = 19712.;
-  mylumi["met7"]          = 19712.;   
-  mylumi["met8"]          = 19712.;
-  mylumi["met9"]          = 19712.;
-  mylumi["met10"]         = 19712.;
-  mylumi["met11"]         = 19712.;
-  mylumi["met12"]         = 19712.;
-  mylumi["met13"]         = 19712.;
-  mylumi["met14"]         = 19712.;
-  mylumi["met15"]         = 19712.;
-  mylumi["met16"]         = 19712.;
-  
-  // Znunu S10
-  mydataset["znunu50"]    = fileDirectory + "MC_S10_V6D_ZJetsToNuNu_050_HT_100_10601pb.root";
-  mydataset["znunu100"]   = fileDirectory + "MC_S10_V6D_ZJetsToNuNu_100_HT_200_27552pb.root";
-  mydataset["znunu200p1"] = fileDirectory + "MC_S10_V6D_ZJetsToNuNu_200_HT_400_part1_121858pb.root"; 
-  mydataset["znunu200p2"] = fileDirectory + "MC_S10_V6D_ZJetsToNuNu_200_HT_400_part2_121858pb.root"; 
-  mydataset["znunu400"]   = fileDirectory + "MC_S10_V6D_ZJetsToNuNu_400_HT_inf_190923pb.root";
-  mylumi["znunu50"]       = 10601.;
-  mylumi["znunu100"]      = 27552.;
-  mylumi["znunu200p1"]    = 121858.; 
-  mylumi["znunu200p2"]    = 121858.;
-  mylumi["znunu400"]      = 190923.;
-  
-  // W+Jets S10
-  mydataset["wjets1"]     = fileDirectory + "MC_S10_V6D_WJetsToLNu_PtW-100_part1_55668pb.root";
-  mydataset["wjets2"]     = fileDirectory + "MC_S10_V6D_WJetsToLNu_PtW-100_part2_55668pb.root";
-  mydataset["wjets3"]     = fileDirectory + "MC_S10_V6D_WJetsToLNu_PtW-100_part3_55668pb.root";
-  mydataset["wjets4"]     = fileDirectory + "MC_S10_V6D_WJetsToLNu_PtW-100_part4_55668pb.root";
-  mydataset["wjets5"]     = fileDirectory + "MC_S10_V6D_WJetsToLNu_PtW-100_part5_55668pb.root";
-  mydataset["w4jets"]     = fileDirectory + "MC_S10_V6D_W4JetsToLNu_50692pb.root";
-  mylumi["wjets1"]        = 55668.;
-  mylumi["wjets2"]        = 55668.;
-  mylumi["wjets3"]        = 55668.;
-  mylumi["wjets4"]        = 55668.; 
-  mylumi["wjets5"]        = 55668.;
-  mylumi["w4jets"]        = 50692.;
-  
-  // Z+Jets S10
-  mydataset["zjets"]      = fileDirectory + "MC_S10_V6D_DYJetsToLL_PtZ-100_65732pb.root";
-  mylumi["zjets"]         = 65732.; //NLO
-  mydataset["zmumujets"]  = fileDirectory + "MC_S10_V6D_DYJetsToLL_PtZ-100_Zmumu_NoTrig_65732pb.root";
-  mylumi["zmumujets"]     = 65732.; //NLO
-  
-  // TTbar S10 (NNLO)
-  mydataset["ttbar"]      = fileDirectory + "MC_S10_V6D_TTbar_MassiveBin_29332pb.root";
-  mylumi["ttbar"]         = 29332./0.97;
-  
-  // QCD S10 (use scale factor 1.6 from Robyn study)
-  mydataset["qcd80"]      = fileDirectory + "MC_S10_V6D_QCD_Pt-0080to0120_6p60pb.root";
-  mydataset["qcd120"]     = fileDirectory + "MC_S10_V6D_QCD_Pt-0120to0170_44pb.root";
-  mydataset["qcd170"]     = fileDirectory + "MC_S10_V6D_QCD_Pt-0170to0300_179pb.root"; 
-  mydataset["qcd300"]     = fileDirectory + "MC_S10_V6D_QCD_Pt-0300to0470_3398pb.root"; 
-  mydataset["qcd470"]     = fileDirectory + "MC_S10_V6D_QCD_Pt-0470to0600_35080pb.root"; 
-  mydataset["qcd600"]     = fileDirectory + "MC_S10_V6D_QCD_Pt-0600to0800_148075pb.root";
-  mydataset["qcd800"]     = fileDirectory + "MC_S10_V6D_QCD_Pt-0800to1000_1126344pb.root"; 
-  mydataset["qcd1000"]    = fileDirectory + "MC_S10_V6D_QCD_Pt-1000to1400_2661929pb.root";
-  mydataset["qcd1400"]    = fileDirectory + "MC_S10_V6D_QCD_Pt-1400to1800_59066921pb.root";
-  mydataset["qcd1800"]    = fileDirectory + "MC_S10_V6D_QCD_Pt-1800_534490611pb.root";
-  mylumi["qcd80"]         = 6.60/1.6;
-  mylumi["qcd120"]        = 44./1.6;
-  mylumi["qcd170"]        = 179./1.6;
-  mylumi["qcd300"]        = 3398./1.6;
-  mylumi["qcd470"]        = 35080./1.6;
-  mylumi["qcd600"]        = 148075./1.6;
-  mylumi["qcd800"]        = 1126344./1.6;
-  mylumi["qcd1000"]       = 2661929./1.6;
-  mylumi["qcd1400"]       = 59066921./1.6;
-  mylumi["qcd1800"]       = 534490611./1.6;
-  
-  // Single-t S10 (NLO - No factor need)
-  mydataset["sints"]      = fileDirectory + "MC_S10_V6D_SingleT_s_68591pb.root";
-  mydataset["sintt"]      = fileDirectory + "MC_S10_V6D_SingleT_t_66635pb.root";
-  mydataset["sinttw"]     = fileDirectory + "MC_S10_V6D_SingleT_tw_44834pb.root";
-  mydataset["sintbars"]   = fileDirectory + "MC_S10_V6D_SingleTbar_s_79531pb.root";
-  mydataset["sintbart"]   = fileDirectory + "MC_S10_V6D_SingleTbar_t_62380pb.root";
-  mydataset["sintbartw"]  = fileDirectory + "MC_S10_V6D_SingleTbar_tw_44456pb.root";
-  mylumi["sints"]         = 68591.;
-  mylumi["sintt"]         = 66635.;
-  mylumi["sinttw"]        = 44834.;
-  mylumi["sintbars"]      = 79531.;
-  mylumi["sintbart"]      = 62380.; 
-  mylumi["sintbartw"]     = 44456.;
-  
-  // Diboson (NLO - No factor need)
-  mydataset["dibosonWW"]  = fileDirectory + "MC_S10_V6D_DiBoson_WW_182363pb.root";
-  mydataset["dibosonWZ"]  = fileDirectory + "MC_S10_V6D_DiBoson_WZ_301123pb.root";
-  mydataset["dibosonZZ"]  = fileDirectory + "MC_S10_V6D_DiBoson_ZZ_555110pb.root";
-  mydataset["dibosonWG"]  = fileDirectory + "MC_S10_V6D_DiBoson_WGToLNuG_10404pb.root";
-  mydataset["dibosonZG"]  = fileDirectory + "MC_S10_V6D_DiBoson_ZGInclusive_40471pb.root";
-  mydataset["dibosonZLLG"]= fileDirectory + "MC_S10_V6D_DiBoson_ZGToLLG_42178pb.root";
-  mydataset["dibosonZvvG"]= fileDirectory + "MC_S10_V6D_DiBoson_ZGTovvG_1460804evt.root";
-  mylumi["dibosonWW"]     = 182363.;
-  mylumi["dibosonWZ"]     = 301123.;
-  mylumi["dibosonZZ"]     = 555110.;
-  mylumi["dibosonWG"]     = 10404.;
-  mylumi["dibosonZG"]     = 40471.;
-  mylumi["dibosonZLLG"]   = 42178.;
-  mylumi["dibosonZvvG"]   = 1460804/176.;
-
-  /*
-  // VBF-Invisible Higgs
-  //mydataset["vbf"]    = "file:/data0/srimanob/Data/monojet/ntuple-2012-v2/VBF_InvisibleHiggs.root";
-  //mylumi["vbf"]  = 12100.;
-  
-  // DM-Stop
-  mydataset["dmstop"]     = fileDirectory + "Signal_Stop/Signal_S10_V6B_Stop_72096pb.root";
-  mylumi["dmstop"]        = 72096.;
-  
-  // DM-Higgs
-  mydataset["dmhigggf"]   = fileDirectory + "Signal_HiggsPortal/Signal_S10_V6B_HiggsPortal_58448pb.root";
-  mylumi["dmhigggf"]      = 58448.;
-  
-  // Unparticles
-  mydataset["unp_S0_dU1p5_LU6000"]   = fileDirectory + "Signal_UNP/Signal_S10_V6A_UNP_dU1p5_LU6000_8045pb.root";
-  mydataset["unp_S0_dU1p5_LU7000"]   = fileDirectory + "Signal_UNP/Signal_S10_V6A_UNP_dU1p5_LU7000_9433pb.root";
-  mydataset["unp_S0_dU1p5_LU8000"]   = fileDirectory + "Signal_UNP/Signal_S10_V6A_UNP_dU1p5_LU8000_10902pb.root";
-  mydataset["unp_S0_dU1p5_LU9000"]   = fileDirectory + "Signal_UNP/Signal_S10_V6A_UNP_dU1p5_LU9000_12176pb.root";
-  mydataset["unp_S0_dU1p6_LU4000"]   = fileDirectory + "Signal_UNP/Signal_S10_V6A_UNP_dU1p6_LU4000_15913pb.root";
-  mydataset["unp_S0_dU1p6_LU5000"]   = fileDirectory + "Signal_UNP/Signal_S10_V6A_UNP_dU1p6_LU5000_21272pb.root";
-  mydataset["unp_S0_dU1p6_LU6000"]   = fileDirectory + "Signal_UNP/Signal_S10_V6A_UNP_dU1p6_LU6000_27159pb.root";
-  mydataset["unp_S0_dU1p6_LU7000"]   = fileDirectory + "Signal_UNP/Signal_S10_V6A_UNP_dU1p6_LU7000_33367pb.root";
-  mydataset["unp_S0_dU1p7_LU1000"]   = fileDirectory + "Signal_UNP/Signal_S10_V6A_UNP_dU1p7_LU1000_2784pb.root";
-  mydataset["unp_S0_dU1p7_LU2000"]   = fileDirectory + "Signal_UNP/Signal_S10_V6A_UNP_dU1p7_LU2000_13802pb.root";
-  mydataset["unp_S0_dU1p7_LU3000"]   = fileDirectory + "Signal_UNP/Signal_S10_V6A_UNP_dU1p7_LU3000_29718pb.root"; 
-  mydataset["unp_S0_dU1p8_LU1000"]   = fileDirectory + "Signal_UNP/Signal_S10_V6A_UNP_dU1p8_LU1000_6139pb.root";
-  mydataset["unp_S0_dU1p8_LU2000"]   = fileDirectory + "Signal_UNP/Signal_S10_V6A_UNP_dU1p8_LU2000_35561pb.root";
-  mydataset["unp_S0_dU1p8_LU3000"]   = fileDirectory + "Signal_UNP/Signal_S10_V6A_UNP_dU1p8_LU3000_86132pb.root"; 
-  mydataset["unp_S0_dU1p9_LU1000"]   = fileDirectory + "Signal_UNP/Signal_S10_V6A_UNP_dU1p9_LU1000_13526pb.root";
-  mydataset["unp_S0_dU1p9_LU2000"]   = fileDirectory + "Signal_UNP/Signal_S10_V6A_UNP_dU1p9_LU2000_95602pb.root";
-  mydataset["unp_S0_dU1p9_LU3000"]   = fileDirectory + "Signal_UNP/Signal_S10_V6A_UNP_dU1p9_LU3000_244798pb.root";
-  mylumi["unp_S0_dU1p5_LU6000"]      = 8045.;
-  mylumi["unp_S0_dU1p5_LU7000"]      = 9433.;
-  mylumi["unp_S0_dU1p5_LU8000"]      = 10902.;
-  mylumi["unp_S0_dU1p5_LU9000"]      = 12176.;
-  mylumi["unp_S0_dU1p6_LU4000"]      = 15913.;
-  mylumi["unp_S0_dU1p6_LU5000"]      = 21272.;
-  mylumi["unp_S0_dU1p6_LU6000"]      = 27159.;
-  mylumi["unp_S0_dU1p6_LU7000"]      = 33367.;
-  mylumi["unp_S0_dU1p7_LU1000"]      = 2784.;
-  mylumi["unp_S0_dU1p7_LU2000"]      = 13802.;
-  mylumi["unp_S0_dU1p7_LU3000"]      = 29718.;
-  mylumi["unp_S0_dU1p8_LU1000"]      = 6139.;
-  mylumi["unp_S0_dU1p8_LU2000"]      = 35561.;
-  mylumi["unp_S0_dU1p8_LU3000"]      = 86132.;
-  mylumi["unp_S0_dU1p9_LU1000"]      = 13526.;
-  mylumi["unp_S0_dU1p9_LU2000"]      = 95602.;
-  mylumi["unp_S0_dU1p9_LU3000"]      = 244798.; 
-  
-  // ADD
-  mydataset["d2md3"]    = fileDirectory + "Signal_ADD/Signal_S10_V6A_ADD_D2_MD3000_13065pb.root";
-  mydataset["d2md4"]    = fileDirectory + "Signal_ADD/Signal_S10_V6A_ADD_D2_MD4000_40866pb.root";
-  mydataset["d2md5"]    = fileDirectory + "Signal_ADD/Signal_S10_V6A_ADD_D2_MD5000_101419pb.root";
-  mydataset["d2md6"]    = fileDirectory + "Signal_ADD/Signal_S10_V6A_ADD_D2_MD6000_206611pb.root";
-  mydataset["d3md2"]    = fileDirectory + "Signal_ADD/Signal_S10_V6A_ADD_D3_MD2000_5219pb.root";
-  mydataset["d3md3"]    = fileDirectory + "Signal_ADD/Signal_S10_V6A_ADD_D3_MD3000_37807pb.root";
-  mydataset["d3md4"]    = fileDirectory + "Signal_ADD/Signal_S10_V6A_ADD_D3_MD4000_159438pb.root";
-  mydataset["d3md5"]    = fileDirectory + "Signal_ADD/Signal_S10_V6A_ADD_D3_MD5000_465116pb.root"; 
-  mydataset["d4md2"]    = fileDirectory + "Signal_ADD/Signal_S10_V6A_ADD_D4_MD2000_8045pb.root";
-  mydataset["d4md3"]    = fileDirectory + "Signal_ADD/Signal_S10_V6A_ADD_D4_MD3000_77101pb.root"; 
-  mydataset["d4md4"]    = fileDirectory + "Signal_ADD/Signal_S10_V6A_ADD_D4_MD4000_408163pb.root";
-  mydataset["d4md5"]    = fileDirectory + "Signal_ADD/Signal_S10_V6A_ADD_D4_MD5000_1612903pb.root";
-  mydataset["d5md1"]    = fileDirectory + "Signal_ADD/Signal_S10_V6A_ADD_D5_MD1000_298pb.root";
-  mydataset["d5md2"]    = fileDirectory + "Signal_ADD/Signal_S10_V6A_ADD_D5_MD2000_11222pb.root";
-  mydataset["d5md3"]    = fileDirectory + "Signal_ADD/Signal_S10_V6A_ADD_D5_MD3000_134048pb.root";
-  mydataset["d5md4"]    = fileDirectory + "Signal_ADD/Signal_S10_V6A_ADD_D5_MD4000_937207pb.root";
-  mydataset["d6md1"]    = fileDirectory + "Signal_ADD/Signal_S10_V6A_ADD_D6_MD1000_283pb.root";
-  mydataset["d6md2"]    = fileDirectory + "Signal_ADD/Signal_S10_V6A_ADD_D6_MD2000_12692pb.root"; 
-  mydataset["d6md3"]    = fileDirectory + "Signal_ADD/Signal_S10_V6A_ADD_D6_MD3000_190476pb.root";
-  mydataset["d6md4"]    = fileDirectory + "Signal_ADD/Signal_S10_V6A_ADD_D6_MD4000_1724137pb.root"; 
-  mylumi["d2md3"]       = 13065.;
-  mylumi["d2md4"]       = 40866.;
-  mylumi["d2md5"]       = 101419.;
-  mylumi["d2md6"]       = 206611.;
-  mylumi["d3md2"]       = 5219.;
-  mylumi["d3md3"]       = 37807.;
-  mylumi["d3md4"]       = 159438.;
-  mylumi["d3md5"]       = 465116.; 
-  mylumi["d4md2"]       = 8045.;
-  mylumi["d4md3"]       = 77101.; 
-  mylumi["d4md4"]       = 408163.;
-  mylumi["d4md5"]       = 1612903.;
-  mylumi["d5md1"]       = 298.;
-  mylumi["d5md2"]       = 11222.;
-  mylumi["d5md3"]       = 134048.;
-  mylumi["d5md4"]       = 937207.;
-  mylumi["d6md1"]       = 283.;
-  mylumi["d6md2"]       = 12692.; 
-  mylumi["d6md3"]       = 190476.;
-  mylumi["d6md4"]       = 1724137.;
-  
-  //Dark Matter
-  mydataset["dmav01"]    = fileDirectory + "Signal_DM/Signal_S10_V6A_DM_40TeV_AV_0p1.root";
-  mydataset["dmav1"]     = fileDirectory + "Signal_DM/Signal_S10_V6A_DM_40TeV_AV_1.root";
-  mydataset["dmav10"]    = fileDirectory + "Signal_DM/Signal_S10_V6A_DM_40TeV_AV_10.root";
-  mydataset["dmav100"]   = fileDirectory + "Signal_DM/Signal_S10_V6A_DM_40TeV_AV_100.root";
-  mydataset["dmav200"]   = fileDirectory + "Signal_DM/Signal_S10_V6A_DM_40TeV_AV_200.root";
-  mydataset["dmav300"]   = fileDirectory + "Signal_DM/Signal_S10_V6A_DM_40TeV_AV_300.root";
-  mydataset["dmav400"]   = fileDirectory + "Signal_DM/Signal_S10_V6A_DM_40TeV_AV_400.root";
-  mydataset["dmav700"]   = fileDirectory + "Signal_DM/Signal_S10_V6A_DM_40TeV_AV_700.root";
-  mydataset["dmav1000"]  = fileDirectory + "Signal_DM/Signal_S10_V6A_DM_40TeV_AV_1000.root";
-  mydataset["dmv01"]     = fileDirectory + "Signal_DM/Signal_S10_V6A_DM_40TeV_V_0p1.root";
-  mydataset["dmv1"]      = fileDirectory + "Signal_DM/Signal_S10_V6A_DM_40TeV_V_1.root";
-  mydataset["dmv10"]     = fileDirectory + "Signal_DM/Signal_S10_V6A_DM_40TeV_V_10.root";
-  mydataset["dmv100"]    = fileDirectory + "Signal_DM/Signal_S10_V6A_DM_40TeV_V_100.root";
-  mydataset["dmv200"]    = fileDirectory + "Signal_DM/Signal_S10_V6A_DM_40TeV_V_200.root";
-  mydataset["dmv300"]    = fileDirectory + "Signal_DM/Signal_S10_V6A_DM_40TeV_V_300.root";
-  mydataset["dmv400"]    = fileDirectory + "Signal_DM/Signal_S10_V6A_DM_40TeV_V_400.root";
-  mydataset["dmv700"]    = fileDirectory + "Signal_DM/Signal_S10_V6A_DM_40TeV_V_700.root";
-  mydataset["dmv1000"]   = fileDirectory + "Signal_DM/Signal_S10_V6A_DM_40TeV_V_1000.root";
-  mylumi["dmav01"]       = 19712.;  
-  mylumi["dmav1"]        = 19712.; 
-  mylumi["dmav10"]       = 19712.;
-  mylumi["dmav100"]      = 19712.;
-  mylumi["dmav200"]      = 19712.;
-  mylumi["dmav300"]      = 19712.;
-  mylumi["dmav400"]      = 19712.;
-  mylumi["dmav700"]      = 19712.;
-  mylumi["dmav1000"]     = 19712.;
-  mylumi["dmv01"]        = 19712.;
-  mylumi["dmv1"]         = 19712.;
-  mylumi["dmv10"]        = 19712.;
-  mylumi["dmv100"]       = 19712.;
-  mylumi["dmv200"]       = 19712.;
-  mylumi["dmv300"]       = 19712.;
-  mylumi["dmv400"]       = 19712.;
-  mylumi["dmv700"]       = 19712.;
-  mylumi["dmv1000"]      = 19712.;
-  */
-  mydataset["dmav100old"]       = "file:/afs/cern.ch/work/s/srimanob/Monojet/Matching/CMSSW_5_3_22_patch1/src/ntuple/Signal_S10_DMAV100_oldNoMatching.root"; 
-  mydataset["dmav100new"]       = "file:/afs/cern.ch/work/s/srimanob/Monojet/Matching/CMSSW_5_3_22_patch1/src/ntuple/Signal_S10_DMAV100_newMatching.root"; 
-  mydataset["dmav100newJet1"]   = "file:/afs/cern.ch/work/s/srimanob/Monojet/Matching/CMSSW_5_3_22_patch1/src/ntuple/Signal_S10_DMAV100_newMatchingJet1.root";
-  mylumi["dmav100old"]          = 19712.;  
-  mylumi["dmav100new"]          = 19712.;
-  mylumi["dmav100newJet1"]      = 19712.;  
+  mLazyLoad    = true;
+  mEntry       = -1;
+  mColumnar    = false;
+  mColumnEntries = 0;
+  mCacheLearn  = 0;
+  mEventsRead  = 0;
+  mChain       = 0;
+  mTreeNumber  = -1;
+  mFileWeight  = 1.;
+  ClearCache();
   
   /*TFile f1( mydataset["pileup"].c_str()  );
   TH1D *his = (TH1D*) f1.Get("pileup")->Clone();
@@ -641,608 +92,673 @@ EventData::EventData(const string &  fileName, UInt_t maxEvents, int isMC) : mDa
   }
   mPileUpWeights = generate_flat10_weights(his,puVersion);*/
   
-  //setPDFPath("/uscmst1/prod/sw/cms/slc5_amd64_gcc434/external/lhapdf/5.6.0-cms4/share/lhapdf/PDFsets");
-  //initPDFSet(1, "cteq66.LHgrid");
-  //initPDFSet(2, "cteq66alphas.LHgrid"); //  alphaS uncert +/-
-  
-  //initPDFSet(3, "MSTW2008nlo68cl.LHgrid");
-  //initPDFSet(2, "MSTW2008nlo68cl_asmz-68cl.LHgrid"); // alphaS uncert +
-  //initPDFSet(3, "MSTW2008nlo68cl_asmz+68cl.LHgrid");  // alphaS uncert -
-  
-  //initPDFSet(1, "NNPDF20_100.LHgrid");
-  //initPDFSet(2, "NNPDF20_100.LHgrid");
-  //initPDFSet(3, "NNPDF20_100.LHgrid");
+  // PDF sets, e.g. EventData::SetPDFSets("cteq66", "cteq66", "cteq66alphas"), or for
+  // the MSTW alphaS uncertainty ("", "MSTW2008nlo68cl_asmz+68cl", "MSTW2008nlo68cl_asmz-68cl")
+  mPDFReference = 0;
+  if ( !mPDFSetNames[0].empty() ) mPDFMembers = LHAPDF::mkPDFs( mPDFSetNames[0] );
+  if ( !mPDFSetNames[1].empty() ) mPDFReference = LHAPDF::mkPDF( mPDFSetNames[1], 0 );
+  if ( !mPDFSetNames[2].empty() ) mPDFAlphaS = LHAPDF::mkPDFs( mPDFSetNames[2] );
   
   ///-------------Ntuple Variables --------------------------------------------------------------------------
-  TFile* file = TFile::Open( mydataset[fileName].c_str() );
-  TDirectory* myDir = (TDirectory*)file->Get("NtupleAnalyzer");
-  mDataTree = (TTree*) myDir->Get("ntuple");
+  if ( dataset.compare(0, 4, "col:") == 0 ){
+    // Column cache from WriteColumns, the dataset name is the last directory of the path
+    mColumnar  = true;
+    mLazyLoad  = true;
+    mColumnDir = dataset.substr(4);
+    while ( mColumnDir.size()>1 && mColumnDir[mColumnDir.size()-1]=='/' ) mColumnDir.erase(mColumnDir.size()-1);
+    mFileName  = mColumnDir.substr(mColumnDir.rfind('/')+1);
+    
+    TFile* file = TFile::Open( (mColumnDir+"/schema.root").c_str() );
+    mDataTree = (TTree*) file->Get("ntuple");
+  }
+  else {
+    // a sample of the catalog, or a comma separated list of files
+    DatasetCatalog::Sample sample;
+    const DatasetCatalog::Sample * known = DatasetCatalog::Default().Find(dataset);
+    if ( known ) sample = *known;
+    else if ( dataset.find(".root") != string::npos ) sample = DatasetCatalog::FileList(dataset);
+    if ( sample.files.empty() ){
+      cerr << "EventData: sample " << dataset << " is not in the dataset catalog " << DatasetCatalog::Default().FileName() << endl;
+      exit(1);
+    }
+    
+    // Remote files prefetch the next block of the read cache in a separate thread
+    if ( sample.files[0].compare(0, 7, "root://") == 0 ) gEnv->SetValue("TFile.AsyncPrefetching", 1);
+    
+    // The chain moves the branch addresses (and the b_ branch pointers) to each new file,
+    // a pattern can add several files which all get its weight
+    mChain = new TChain("NtupleAnalyzer/ntuple");
+    for(size_t i=0; i<sample.files.size(); i++){
+      int before = mChain->GetListOfFiles()->GetEntries();
+      if ( mChain->Add( sample.files[i].c_str() ) <= 0 ) cerr << "EventData: no file for " << sample.files[i] << endl;
+      int added = mChain->GetListOfFiles()->GetEntries() - before;
+      for(int k=0; k<added; k++) mFileWeights.push_back( sample.weights[i] );
+    }
+    mChain->LoadTree(0);
+    mDataTree = mChain;
+  }
+  
+  // Event weight of the sample, looked up once here instead of in Weight()
+  mNormalization = DatasetCatalog::Default().Normalization(mFileName, "met1");
   
   //PDFWeight
-  mDataTree->SetBranchAddress("PDFWeights1", &mPDFWeights);
+  BranchAddress("PDFWeights1", mPDFWeights, &b_PDFWeights1);
   
   //Event information
-  mDataTree->SetBranchAddress("run"                                   ,&mrun                        );
-  mDataTree->SetBranchAddress("event"                                 ,&mevent                      );
-  mDataTree->SetBranchAddress("lumi"                                  ,&mlumi                       );
-  mDataTree->SetBranchAddress("bx"                                    ,&mbx                         );
-  mDataTree->SetBranchAddress("npvm1"                                 ,&mnpvm1                      );
-  mDataTree->SetBranchAddress("npv0"                                  ,&mnpv0                       );
-  mDataTree->SetBranchAddress("npvp1"                                 ,&mnpvp1                      );
-  mDataTree->SetBranchAddress("ptHat"                                 ,&mptHat                      );
-  mDataTree->SetBranchAddress("fastJetRho"                            ,&mfastJetRho                 );  
+  BranchAddress("run"                                   ,&mrun                        , &b_run);
+  BranchAddress("event"                                 ,&mevent                      , &b_event);
+  BranchAddress("lumi"                                  ,&mlumi                       , &b_lumi);
+  BranchAddress("bx"                                    ,&mbx                         , &b_bx);
+  BranchAddress("npvm1"                                 ,&mnpvm1                      , &b_npvm1);
+  BranchAddress("npv0"                                  ,&mnpv0                       , &b_npv0);
+  BranchAddress("npvp1"                                 ,&mnpvp1                      , &b_npvp1);
+  BranchAddress("ptHat"                                 ,&mptHat                      , &b_ptHat);
+  BranchAddress("fastJetRho"                            ,&mfastJetRho                 , &b_fastJetRho);  
   
   //NoiseFlag
-  mDataTree->SetBranchAddress("NoiseFlag"                             ,mNoiseFlag                   );
+  BranchAddress("NoiseFlag"                             ,mNoiseFlag                   , &b_NoiseFlag);
   
   //CaloTower
-  mDataTree->SetBranchAddress("CaloTowerdEx"                          ,&mCaloTowerdEx               );
-  mDataTree->SetBranchAddress("CaloTowerdEy"                          ,&mCaloTowerdEy               );
+  BranchAddress("CaloTowerdEx"                          ,&mCaloTowerdEx               , &b_CaloTowerdEx);
+  BranchAddress("CaloTowerdEy"                          ,&mCaloTowerdEy               , &b_CaloTowerdEy);
   
   //AK4CaloJets
-  mDataTree->SetBranchAddress("NCaloAK4Jets"                          ,&mNCaloAK4Jets               );
-  mDataTree->SetBranchAddress("CaloAK4JetE"                           ,mCaloAK4JetE                 );
-  mDataTree->SetBranchAddress("CaloAK4JetPt"                          ,mCaloAK4JetPt                );
-  mDataTree->SetBranchAddress("CaloAK4JetPx"                          ,mCaloAK4JetPx                );
-  mDataTree->SetBranchAddress("CaloAK4JetPy"                          ,mCaloAK4JetPy                );
-  mDataTree->SetBranchAddress("CaloAK4JetPz"                          ,mCaloAK4JetPz                );
-  mDataTree->SetBranchAddress("CaloAK4JetEta"                         ,mCaloAK4JetEta               );
-  mDataTree->SetBranchAddress("CaloAK4JetPhi"                         ,mCaloAK4JetPhi               );
-  mDataTree->SetBranchAddress("CaloAK4JetEmf"                         ,mCaloAK4JetEmf               );
-  mDataTree->SetBranchAddress("CaloAK4JetfHPD"                        ,mCaloAK4JetfHPD              );
-  mDataTree->SetBranchAddress("CaloAK4JetfRBX"                        ,mCaloAK4JetfRBX              );
-  mDataTree->SetBranchAddress("CaloAK4JetN90Hits"                     ,mCaloAK4JetN90Hits           );
-  mDataTree->SetBranchAddress("CaloAK4JetN90"                         ,mCaloAK4JetN90               );
-  mDataTree->SetBranchAddress("CaloAK4JetSigEta"                      ,mCaloAK4JetSigEta            );
-  mDataTree->SetBranchAddress("CaloAK4JetSigPhi"                      ,mCaloAK4JetSigPhi            );
-  mDataTree->SetBranchAddress("CaloAK4JetIDEmf"                       ,mCaloAK4JetIDEmf             );
-  mDataTree->SetBranchAddress("CaloAK4JetECor"                        ,mCaloAK4JetECor              );
-  mDataTree->SetBranchAddress("CaloAK4JetPtCor"                       ,mCaloAK4JetPtCor             );
-  mDataTree->SetBranchAddress("CaloAK4JetPxCor"                       ,mCaloAK4JetPxCor             );
-  mDataTree->SetBranchAddress("CaloAK4JetPyCor"                       ,mCaloAK4JetPyCor             );
-  mDataTree->SetBranchAddress("CaloAK4JetPzCor"                       ,mCaloAK4JetPzCor             );
-  mDataTree->SetBranchAddress("CaloAK4JetBtagTkCountHighEff"          ,mCaloAK4JetBtagTkCountHighEff);
-  mDataTree->SetBranchAddress("CaloAK4JetBTagSimpleSecVtx"            ,mCaloAK4JetBTagSimpleSecVtx  );
-  mDataTree->SetBranchAddress("CaloAK4JetBTagCombSecVtx"              ,mCaloAK4JetBTagCombSecVtx    );
-  mDataTree->SetBranchAddress("CaloAK4TrackPt"                        ,mCaloAK4TrackPt              );
-  mDataTree->SetBranchAddress("CaloAK4JetIDLOOSE"                     ,mCaloAK4JetIDLOOSE           );
-  mDataTree->SetBranchAddress("CaloAK4JetIDTIGHT"                     ,mCaloAK4JetIDTIGHT           );
+  BranchAddress("NCaloAK4Jets"                          ,&mNCaloAK4Jets               , &b_NCaloAK4Jets);
+  SetBufferAddress("CaloAK4JetE"                           ,mCaloAK4JetE                 , MAXJET, &b_CaloAK4JetE);
+  SetBufferAddress("CaloAK4JetPt"                          ,mCaloAK4JetPt                , MAXJET, &b_CaloAK4JetPt);
+  SetBufferAddress("CaloAK4JetPx"                          ,mCaloAK4JetPx                , MAXJET, &b_CaloAK4JetPx);
+  SetBufferAddress("CaloAK4JetPy"                          ,mCaloAK4JetPy                , MAXJET, &b_CaloAK4JetPy);
+  SetBufferAddress("CaloAK4JetPz"                          ,mCaloAK4JetPz                , MAXJET, &b_CaloAK4JetPz);
+  SetBufferAddress("CaloAK4JetEta"                         ,mCaloAK4JetEta               , MAXJET, &b_CaloAK4JetEta);
+  SetBufferAddress("CaloAK4JetPhi"                         ,mCaloAK4JetPhi               , MAXJET, &b_CaloAK4JetPhi);
+  SetBufferAddress("CaloAK4JetEmf"                         ,mCaloAK4JetEmf               , MAXJET, &b_CaloAK4JetEmf);
+  SetBufferAddress("CaloAK4JetfHPD"                        ,mCaloAK4JetfHPD              , MAXJET, &b_CaloAK4JetfHPD);
+  SetBufferAddress("CaloAK4JetfRBX"                        ,mCaloAK4JetfRBX              , MAXJET, &b_CaloAK4JetfRBX);
+  SetBufferAddress("CaloAK4JetN90Hits"                     ,mCaloAK4JetN90Hits           , MAXJET, &b_CaloAK4JetN90Hits);
+  SetBufferAddress("CaloAK4JetN90"                         ,mCaloAK4JetN90               , MAXJET, &b_CaloAK4JetN90);
+  SetBufferAddress("CaloAK4JetSigEta"                      ,mCaloAK4JetSigEta            , MAXJET, &b_CaloAK4JetSigEta);
+  SetBufferAddress("CaloAK4JetSigPhi"                      ,mCaloAK4JetSigPhi            , MAXJET, &b_CaloAK4JetSigPhi);
+  SetBufferAddress("CaloAK4JetIDEmf"                       ,mCaloAK4JetIDEmf             , MAXJET, &b_CaloAK4JetIDEmf);
+  SetBufferAddress("CaloAK4JetECor"                        ,mCaloAK4JetECor              , MAXJET, &b_CaloAK4JetECor);
+  SetBufferAddress("CaloAK4JetPtCor"                       ,mCaloAK4JetPtCor             , MAXJET, &b_CaloAK4JetPtCor);
+  SetBufferAddress("CaloAK4JetPxCor"                       ,mCaloAK4JetPxCor             , MAXJET, &b_CaloAK4JetPxCor);
+  SetBufferAddress("CaloAK4JetPyCor"                       ,mCaloAK4JetPyCor             , MAXJET, &b_CaloAK4JetPyCor);
+  SetBufferAddress("CaloAK4JetPzCor"                       ,mCaloAK4JetPzCor             , MAXJET, &b_CaloAK4JetPzCor);
+  SetBufferAddress("CaloAK4JetBtagTkCountHighEff"          ,mCaloAK4JetBtagTkCountHighEff, MAXJET, &b_CaloAK4JetBtagTkCountHighEff);
+  SetBufferAddress("CaloAK4JetBTagSimpleSecVtx"            ,mCaloAK4JetBTagSimpleSecVtx  , MAXJET, &b_CaloAK4JetBTagSimpleSecVtx);
+  SetBufferAddress("CaloAK4JetBTagCombSecVtx"              ,mCaloAK4JetBTagCombSecVtx    , MAXJET, &b_CaloAK4JetBTagCombSecVtx);
+  SetBufferAddress("CaloAK4TrackPt"                        ,mCaloAK4TrackPt              , MAXJET, &b_CaloAK4TrackPt);
+  SetBufferAddress("CaloAK4JetIDLOOSE"                     ,mCaloAK4JetIDLOOSE           , MAXJET, &b_CaloAK4JetIDLOOSE);
+  SetBufferAddress("CaloAK4JetIDTIGHT"                     ,mCaloAK4JetIDTIGHT           , MAXJET, &b_CaloAK4JetIDTIGHT);
   
   //AK4PFJets
-  mDataTree->SetBranchAddress("NPFAK4Jets"                            ,&mNPFAK4Jets                ); 
-  mDataTree->SetBranchAddress("PFAK4JetE"                             ,mPFAK4JetE                  ); 
-  mDataTree->SetBranchAddress("PFAK4JetPt"                            ,mPFAK4JetPt                 ); 
-  mDataTree->SetBranchAddress("PFAK4JetPx"                            ,mPFAK4JetPx                 ); 
-  mDataTree->SetBranchAddress("PFAK4JetPy"                            ,mPFAK4JetPy                 ); 
-  mDataTree->SetBranchAddress("PFAK4JetPz"                            ,mPFAK4JetPz                 ); 
-  mDataTree->SetBranchAddress("PFAK4JetEta"                           ,mPFAK4JetEta                ); 
-  mDataTree->SetBranchAddress("PFAK4JetPhi"                           ,mPFAK4JetPhi                ); 
-  mDataTree->SetBranchAddress("PFAK4JetfHPD"                          ,mPFAK4JetfHPD               ); 
-  mDataTree->SetBranchAddress("PFAK4JetfRBX"                          ,mPFAK4JetfRBX               ); 
-  mDataTree->SetBranchAddress("PFAK4JetN90Hits"                       ,mPFAK4JetN90Hits            ); 
-  mDataTree->SetBranchAddress("PFAK4JetN90"                           ,mPFAK4JetN90                ); 
-  mDataTree->SetBranchAddress("PFAK4JetSigEta"                        ,mPFAK4JetSigEta             ); 
-  mDataTree->SetBranchAddress("PFAK4JetSigPhi"                        ,mPFAK4JetSigPhi             ); 
-  mDataTree->SetBranchAddress("PFAK4JetIDEmf"                         ,mPFAK4JetIDEmf              ); 
-  mDataTree->SetBranchAddress("PFAK4JetECor"                          ,mPFAK4JetECor               ); 
-  mDataTree->SetBranchAddress("PFAK4JetPtCor"                         ,mPFAK4JetPtCor              ); 
-  mDataTree->SetBranchAddress("PFAK4JetPxCor"                         ,mPFAK4JetPxCor              ); 
-  mDataTree->SetBranchAddress("PFAK4JetPyCor"                         ,mPFAK4JetPyCor              ); 
-  mDataTree->SetBranchAddress("PFAK4JetPzCor"                         ,mPFAK4JetPzCor              ); 
-  mDataTree->SetBranchAddress("PFAK4JetBtagTkCountHighEff"            ,mPFAK4JetBtagTkCountHighEff ); 
-  mDataTree->SetBranchAddress("PFAK4JetBTagSimpleSecVtx"              ,mPFAK4JetBTagSimpleSecVtx   ); 
-  mDataTree->SetBranchAddress("PFAK4JetBTagCombSecVtx"                ,mPFAK4JetBTagCombSecVtx     ); 
-  mDataTree->SetBranchAddress("PFAK4JetNeuEmEngFrac"                  ,mPFAK4JetNeuEmEngFrac       ); 
-  mDataTree->SetBranchAddress("PFAK4JetChaEmEngFrac"                  ,mPFAK4JetChaEmEngFrac       ); 
-  mDataTree->SetBranchAddress("PFAK4JetChaHadEngFrac"                 ,mPFAK4JetChaHadEngFrac      ); 
-  mDataTree->SetBranchAddress("PFAK4JetNeuHadEngFrac"                 ,mPFAK4JetNeuHadEngFrac      ); 
-  mDataTree->SetBranchAddress("PFAK4JetChaMuEng"                      ,mPFAK4JetChaMuEng           ); 
-  mDataTree->SetBranchAddress("PFAK4JetMuonEng"                       ,mPFAK4JetMuonEng            ); 
-  mDataTree->SetBranchAddress("PFAK4JetPhotEng"                       ,mPFAK4JetPhotEng            ); 
-  mDataTree->SetBranchAddress("PFAK4JetElecEng"                       ,mPFAK4JetElecEng            ); 
-  mDataTree->SetBranchAddress("PFAK4JetNumOfChaMu"                    ,mPFAK4JetNumOfChaMu         ); 
-  mDataTree->SetBranchAddress("PFAK4JetNumOfMuon"                     ,mPFAK4JetNumOfMuon          ); 
-  mDataTree->SetBranchAddress("PFAK4JetNumOfPhot"                     ,mPFAK4JetNumOfPhot          ); 
-  mDataTree->SetBranchAddress("PFAK4JetNumOfElec"                     ,mPFAK4JetNumOfElec          ); 
-  mDataTree->SetBranchAddress("PFAK4JetNumOfNeu"                      ,mPFAK4JetNumOfNeu           ); 
-  mDataTree->SetBranchAddress("PFAK4JetNumOfCha"                      ,mPFAK4JetNumOfCha           ); 
-  mDataTree->SetBranchAddress("PFAK4JetNumOfNeuHad"                   ,mPFAK4JetNumOfNeuHad        ); 
-  mDataTree->SetBranchAddress("PFAK4JetNumOfChaHad"                   ,mPFAK4JetNumOfChaHad        ); 
-  mDataTree->SetBranchAddress("PFAK4JetNumOfDaughters"                ,mPFAK4JetNumOfDaughters     ); 
-  mDataTree->SetBranchAddress("PFAK4JetIDLOOSE"                       ,mPFAK4JetIDLOOSE            ); 
-  mDataTree->SetBranchAddress("PFAK4JetIDTIGHT"                       ,mPFAK4JetIDTIGHT            ); 
-  mDataTree->SetBranchAddress("PFAK4JetPUFullJetId"                   ,mPFAK4JetPUFullJetId        );
-  mDataTree->SetBranchAddress("PFAK4uncer"                            ,mPFAK4uncer                 );
+  BranchAddress("NPFAK4Jets"                            ,&mNPFAK4Jets                , &b_NPFAK4Jets); 
+  SetBufferAddress("PFAK4JetE"                             ,mPFAK4JetE                  , MAXJET, &b_PFAK4JetE); 
+  SetBufferAddress("PFAK4JetPt"                            ,mPFAK4JetPt                 , MAXJET, &b_PFAK4JetPt); 
+  SetBufferAddress("PFAK4JetPx"                            ,mPFAK4JetPx                 , MAXJET, &b_PFAK4JetPx); 
+  SetBufferAddress("PFAK4JetPy"                            ,mPFAK4JetPy                 , MAXJET, &b_PFAK4JetPy); 
+  SetBufferAddress("PFAK4JetPz"                            ,mPFAK4JetPz                 , MAXJET, &b_PFAK4JetPz); 
+  SetBufferAddress("PFAK4JetEta"                           ,mPFAK4JetEta                , MAXJET, &b_PFAK4JetEta); 
+  SetBufferAddress("PFAK4JetPhi"                           ,mPFAK4JetPhi                , MAXJET, &b_PFAK4JetPhi); 
+  SetBufferAddress("PFAK4JetfHPD"                          ,mPFAK4JetfHPD               , MAXJET, &b_PFAK4JetfHPD); 
+  SetBufferAddress("PFAK4JetfRBX"                          ,mPFAK4JetfRBX               , MAXJET, &b_PFAK4JetfRBX); 
+  SetBufferAddress("PFAK4JetN90Hits"                       ,mPFAK4JetN90Hits            , MAXJET, &b_PFAK4JetN90Hits); 
+  SetBufferAddress("PFAK4JetN90"                           ,mPFAK4JetN90                , MAXJET, &b_PFAK4JetN90); 
+  SetBufferAddress("PFAK4JetSigEta"                        ,mPFAK4JetSigEta             , MAXJET, &b_PFAK4JetSigEta); 
+  SetBufferAddress("PFAK4JetSigPhi"                        ,mPFAK4JetSigPhi             , MAXJET, &b_PFAK4JetSigPhi); 
+  SetBufferAddress("PFAK4JetIDEmf"                         ,mPFAK4JetIDEmf              , MAXJET, &b_PFAK4JetIDEmf); 
+  SetBufferAddress("PFAK4JetECor"                          ,mPFAK4JetECor               , MAXJET, &b_PFAK4JetECor); 
+  SetBufferAddress("PFAK4JetPtCor"                         ,mPFAK4JetPtCor              , MAXJET, &b_PFAK4JetPtCor); 
+  SetBufferAddress("PFAK4JetPxCor"                         ,mPFAK4JetPxCor              , MAXJET, &b_PFAK4JetPxCor); 
+  SetBufferAddress("PFAK4JetPyCor"                         ,mPFAK4JetPyCor              , MAXJET, &b_PFAK4JetPyCor); 
+  SetBufferAddress("PFAK4JetPzCor"                         ,mPFAK4JetPzCor              , MAXJET, &b_PFAK4JetPzCor); 
+  SetBufferAddress("PFAK4JetBtagTkCountHighEff"            ,mPFAK4JetBtagTkCountHighEff , MAXJET, &b_PFAK4JetBtagTkCountHighEff); 
+  SetBufferAddress("PFAK4JetBTagSimpleSecVtx"              ,mPFAK4JetBTagSimpleSecVtx   , MAXJET, &b_PFAK4JetBTagSimpleSecVtx); 
+  SetBufferAddress("PFAK4JetBTagCombSecVtx"                ,mPFAK4JetBTagCombSecVtx     , MAXJET, &b_PFAK4JetBTagCombSecVtx); 
+  SetBufferAddress("PFAK4JetNeuEmEngFrac"                  ,mPFAK4JetNeuEmEngFrac       , MAXJET, &b_PFAK4JetNeuEmEngFrac); 
+  SetBufferAddress("PFAK4JetChaEmEngFrac"                  ,mPFAK4JetChaEmEngFrac       , MAXJET, &b_PFAK4JetChaEmEngFrac); 
+  SetBufferAddress("PFAK4JetChaHadEngFrac"                 ,mPFAK4JetChaHadEngFrac      , MAXJET, &b_PFAK4JetChaHadEngFrac); 
+  SetBufferAddress("PFAK4JetNeuHadEngFrac"                 ,mPFAK4JetNeuHadEngFrac      , MAXJET, &b_PFAK4JetNeuHadEngFrac); 
+  SetBufferAddress("PFAK4JetChaMuEng"                      ,mPFAK4JetChaMuEng           , MAXJET, &b_PFAK4JetChaMuEng); 
+  SetBufferAddress("PFAK4JetMuonEng"                       ,mPFAK4JetMuonEng            , MAXJET, &b_PFAK4JetMuonEng); 
+  SetBufferAddress("PFAK4JetPhotEng"                       ,mPFAK4JetPhotEng            , MAXJET, &b_PFAK4JetPhotEng); 
+  SetBufferAddress("PFAK4JetElecEng"                       ,mPFAK4JetElecEng            , MAXJET, &b_PFAK4JetElecEng); 
+  SetBufferAddress("PFAK4JetNumOfChaMu"                    ,mPFAK4JetNumOfChaMu         , MAXJET, &b_PFAK4JetNumOfChaMu); 
+  SetBufferAddress("PFAK4JetNumOfMuon"                     ,mPFAK4JetNumOfMuon          , MAXJET, &b_PFAK4JetNumOfMuon); 
+  SetBufferAddress("PFAK4JetNumOfPhot"                     ,mPFAK4JetNumOfPhot          , MAXJET, &b_PFAK4JetNumOfPhot); 
+  SetBufferAddress("PFAK4JetNumOfElec"                     ,mPFAK4JetNumOfElec          , MAXJET, &b_PFAK4JetNumOfElec); 
+  SetBufferAddress("PFAK4JetNumOfNeu"                      ,mPFAK4JetNumOfNeu           , MAXJET, &b_PFAK4JetNumOfNeu); 
+  SetBufferAddress("PFAK4JetNumOfCha"                      ,mPFAK4JetNumOfCha           , MAXJET, &b_PFAK4JetNumOfCha); 
+  SetBufferAddress("PFAK4JetNumOfNeuHad"                   ,mPFAK4JetNumOfNeuHad        , MAXJET, &b_PFAK4JetNumOfNeuHad); 
+  SetBufferAddress("PFAK4JetNumOfChaHad"                   ,mPFAK4JetNumOfChaHad        , MAXJET, &b_PFAK4JetNumOfChaHad); 
+  SetBufferAddress("PFAK4JetNumOfDaughters"                ,mPFAK4JetNumOfDaughters     , MAXJET, &b_PFAK4JetNumOfDaughters); 
+  SetBufferAddress("PFAK4JetIDLOOSE"                       ,mPFAK4JetIDLOOSE            , MAXJET, &b_PFAK4JetIDLOOSE); 
+  SetBufferAddress("PFAK4JetIDTIGHT"                       ,mPFAK4JetIDTIGHT            , MAXJET, &b_PFAK4JetIDTIGHT); 
+  SetBufferAddress("PFAK4JetPUFullJetId"                   ,mPFAK4JetPUFullJetId        , MAXJET, &b_PFAK4JetPUFullJetId);
+  SetBufferAddress("PFAK4uncer"                            ,mPFAK4uncer                 , MAXJET, &b_PFAK4uncer);
+  SetBufferAddress("GenPFAK4JetPt"                         ,mGenPFAK4JetPt              , MAXJET, &b_GenPFAK4JetPt);
+  SetBufferAddress("PFAK4JERCentral"                       ,mPFAK4JERCentral            , MAXJET, &b_PFAK4JERCentral);
+  SetBufferAddress("PFAK4JERUp"                            ,mPFAK4JERUp                 , MAXJET, &b_PFAK4JERUp);
+  SetBufferAddress("PFAK4JERDown"                          ,mPFAK4JERDown               , MAXJET, &b_PFAK4JERDown);
   
   //MET
-  mDataTree->SetBranchAddress("NMet"                                  ,&mNMet                      ); 
-  mDataTree->SetBranchAddress("MetPt"                                 ,mMetPt                      ); 
-  mDataTree->SetBranchAddress("MetPx"                                 ,mMetPx                      ); 
-  mDataTree->SetBranchAddress("MetPy"                                 ,mMetPy                      ); 
-  mDataTree->SetBranchAddress("MetPhi"                                ,mMetPhi                     ); 
-  mDataTree->SetBranchAddress("MetSumEt"                              ,mMetSumEt                   ); 
-  mDataTree->SetBranchAddress("MetSign"                               ,mMetSign                    ); 
+  BranchAddress("NMet"                                  ,&mNMet                      , &b_NMet); 
+  BranchAddress("MetPt"                                 ,mMetPt                      , &b_MetPt); 
+  BranchAddress("MetPx"                                 ,mMetPx                      , &b_MetPx); 
+  BranchAddress("MetPy"                                 ,mMetPy                      , &b_MetPy); 
+  BranchAddress("MetPhi"                                ,mMetPhi                     , &b_MetPhi); 
+  BranchAddress("MetSumEt"                              ,mMetSumEt                   , &b_MetSumEt); 
+  BranchAddress("MetSign"                               ,mMetSign                    , &b_MetSign); 
   
   //Muons
-  mDataTree->SetBranchAddress("NMuon"                                 ,&mNMuon                     ); 
-  mDataTree->SetBranchAddress("MuonPt"                                ,mMuonPt                     ); 
-  mDataTree->SetBranchAddress("MuonEt"                                ,mMuonEt                     ); 
-  mDataTree->SetBranchAddress("MuonE"                                 ,mMuonE                      ); 
-  mDataTree->SetBranchAddress("MuonPx"                                ,mMuonPx                     ); 
-  mDataTree->SetBranchAddress("MuonPy"                                ,mMuonPy                     ); 
-  mDataTree->SetBranchAddress("MuonPz"                                ,mMuonPz                     ); 
-  mDataTree->SetBranchAddress("MuonEta"                               ,mMuonEta                    ); 
-  mDataTree->SetBranchAddress("MuonPhi"                               ,mMuonPhi                    ); 
-  mDataTree->SetBranchAddress("MuonCharge"                            ,mMuonCharge                 ); 
-  mDataTree->SetBranchAddress("MuonIsGlobal"                          ,mMuonIsGlobal               ); 
-  mDataTree->SetBranchAddress("MuonIsStandAlone"                      ,mMuonIsStandAlone           ); 
-  mDataTree->SetBranchAddress("MuonIsTracker"                         ,mMuonIsTracker              ); 
-  mDataTree->SetBranchAddress("MuonSumPtDR03"                         ,mMuonSumPtDR03              ); 
-  mDataTree->SetBranchAddress("MuonSumPtDR05"                         ,mMuonSumPtDR05              ); 
-  mDataTree->SetBranchAddress("MuonEmEtDR03"                          ,mMuonEmEtDR03               ); 
-  mDataTree->SetBranchAddress("MuonHadEtDR03"                         ,mMuonHadEtDR03              ); 
-  mDataTree->SetBranchAddress("MuonNumOfMatches"                      ,mMuonNumOfMatches           ); 
-  mDataTree->SetBranchAddress("MuonCombChi2Norm"                      ,mMuonCombChi2Norm           ); 
-  mDataTree->SetBranchAddress("MuonCombValidHits"                     ,mMuonCombValidHits          ); 
-  mDataTree->SetBranchAddress("MuonCombLostHits"                      ,mMuonCombLostHits           ); 
-  mDataTree->SetBranchAddress("MuonCombPt"                            ,mMuonCombPt                 ); 
-  mDataTree->SetBranchAddress("MuonCombPz"                            ,mMuonCombPz                 ); 
-  mDataTree->SetBranchAddress("MuonCombP"                             ,mMuonCombP                  ); 
-  mDataTree->SetBranchAddress("MuonCombEta"                           ,mMuonCombEta                ); 
-  mDataTree->SetBranchAddress("MuonCombPhi"                           ,mMuonCombPhi                ); 
-  mDataTree->SetBranchAddress("MuonCombChi2"                          ,mMuonCombChi2               ); 
-  mDataTree->SetBranchAddress("MuonCombCharge"                        ,mMuonCombCharge             ); 
-  mDataTree->SetBranchAddress("MuonCombQOverPError"                   ,mMuonCombQOverPError        ); 
-  mDataTree->SetBranchAddress("MuonCombNdof"                          ,mMuonCombNdof               ); 
-  mDataTree->SetBranchAddress("MuonCombVx"                            ,mMuonCombVx                 ); 
-  mDataTree->SetBranchAddress("MuonCombVy"                            ,mMuonCombVy                 ); 
-  mDataTree->SetBranchAddress("MuonCombVz"                            ,mMuonCombVz                 ); 
-  mDataTree->SetBranchAddress("MuonCombD0"                            ,mMuonCombD0                 ); 
-  mDataTree->SetBranchAddress("MuonCombDz"                            ,mMuonCombDz                 ); 
-  mDataTree->SetBranchAddress("MuonStandChi2Norm"                     ,mMuonStandChi2Norm          ); 
-  mDataTree->SetBranchAddress("MuonStandValidHits"                    ,mMuonStandValidHits         ); 
-  mDataTree->SetBranchAddress("MuonStandLostHits"                     ,mMuonStandLostHits          ); 
-  mDataTree->SetBranchAddress("MuonStandPt"                           ,mMuonStandPt                ); 
-  mDataTree->SetBranchAddress("MuonStandPz"                           ,mMuonStandPz                ); 
-  mDataTree->SetBranchAddress("MuonStandP"                            ,mMuonStandP                 ); 
-  mDataTree->SetBranchAddress("MuonStandEta"                          ,mMuonStandEta               ); 
-  mDataTree->SetBranchAddress("MuonStandPhi"                          ,mMuonStandPhi               ); 
-  mDataTree->SetBranchAddress("MuonStandChi2"                         ,mMuonStandChi2              ); 
-  mDataTree->SetBranchAddress("MuonStandCharge"                       ,mMuonStandCharge            ); 
-  mDataTree->SetBranchAddress("MuonStandQOverPError"                  ,mMuonStandQOverPError       ); 
-  mDataTree->SetBranchAddress("MuonTrkChi2Norm"                       ,mMuonTrkChi2Norm            ); 
-  mDataTree->SetBranchAddress("MuonTrkValidHits"                      ,mMuonTrkValidHits           ); 
-  mDataTree->SetBranchAddress("MuonTrkLostHits"                       ,mMuonTrkLostHits            ); 
-  mDataTree->SetBranchAddress("MuonTrkPt"                             ,mMuonTrkPt                  ); 
-  mDataTree->SetBranchAddress("MuonTrkPz"                             ,mMuonTrkPz                  ); 
-  mDataTree->SetBranchAddress("MuonTrkP"                              ,mMuonTrkP                   ); 
-  mDataTree->SetBranchAddress("MuonTrkEta"                            ,mMuonTrkEta                 ); 
-  mDataTree->SetBranchAddress("MuonTrkPhi"                            ,mMuonTrkPhi                 ); 
-  mDataTree->SetBranchAddress("MuonTrkChi2"                           ,mMuonTrkChi2                ); 
-  mDataTree->SetBranchAddress("MuonTrkCharge"                         ,mMuonTrkCharge              ); 
-  mDataTree->SetBranchAddress("MuonTrkQOverPError"                    ,mMuonTrkQOverPError         ); 
-  mDataTree->SetBranchAddress("MuonTrkDxy"                            ,mMuonTrkDxy                 ); 
-  mDataTree->SetBranchAddress("MuonTrkNumOfValidPixHits"              ,mMuonTrkNumOfValidPixHits   ); 
+  BranchAddress("NMuon"                                 ,&mNMuon                     , &b_NMuon); 
+  SetBufferAddress("MuonPt"                                ,mMuonPt                     , MAXMUON, &b_MuonPt); 
+  SetBufferAddress("MuonEt"                                ,mMuonEt                     , MAXMUON, &b_MuonEt); 
+  SetBufferAddress("MuonE"                                 ,mMuonE                      , MAXMUON, &b_MuonE); 
+  SetBufferAddress("MuonPx"                                ,mMuonPx                     , MAXMUON, &b_MuonPx); 
+  SetBufferAddress("MuonPy"                                ,mMuonPy                     , MAXMUON, &b_MuonPy); 
+  SetBufferAddress("MuonPz"                                ,mMuonPz                     , MAXMUON, &b_MuonPz); 
+  SetBufferAddress("MuonEta"                               ,mMuonEta                    , MAXMUON, &b_MuonEta); 
+  SetBufferAddress("MuonPhi"                               ,mMuonPhi                    , MAXMUON, &b_MuonPhi); 
+  SetBufferAddress("MuonCharge"                            ,mMuonCharge                 , MAXMUON, &b_MuonCharge); 
+  SetBufferAddress("MuonIsGlobal"                          ,mMuonIsGlobal               , MAXMUON, &b_MuonIsGlobal); 
+  SetBufferAddress("MuonIsStandAlone"                      ,mMuonIsStandAlone           , MAXMUON, &b_MuonIsStandAlone); 
+  SetBufferAddress("MuonIsTracker"                         ,mMuonIsTracker              , MAXMUON, &b_MuonIsTracker); 
+  SetBufferAddress("MuonSumPtDR03"                         ,mMuonSumPtDR03              , MAXMUON, &b_MuonSumPtDR03); 
+  SetBufferAddress("MuonSumPtDR05"                         ,mMuonSumPtDR05              , MAXMUON, &b_MuonSumPtDR05); 
+  SetBufferAddress("MuonEmEtDR03"                          ,mMuonEmEtDR03               , MAXMUON, &b_MuonEmEtDR03); 
+  SetBufferAddress("MuonHadEtDR03"                         ,mMuonHadEtDR03              , MAXMUON, &b_MuonHadEtDR03); 
+  SetBufferAddress("MuonNumOfMatches"                      ,mMuonNumOfMatches           , MAXMUON, &b_MuonNumOfMatches); 
+  SetBufferAddress("MuonCombChi2Norm"                      ,mMuonCombChi2Norm           , MAXMUON, &b_MuonCombChi2Norm); 
+  SetBufferAddress("MuonCombValidHits"                     ,mMuonCombValidHits          , MAXMUON, &b_MuonCombValidHits); 
+  SetBufferAddress("MuonCombLostHits"                      ,mMuonCombLostHits           , MAXMUON, &b_MuonCombLostHits); 
+  SetBufferAddress("MuonCombPt"                            ,mMuonCombPt                 , MAXMUON, &b_MuonCombPt); 
+  SetBufferAddress("MuonCombPz"                            ,mMuonCombPz                 , MAXMUON, &b_MuonCombPz); 
+  SetBufferAddress("MuonCombP"                             ,mMuonCombP                  , MAXMUON, &b_MuonCombP); 
+  SetBufferAddress("MuonCombEta"                           ,mMuonCombEta                , MAXMUON, &b_MuonCombEta); 
+  SetBufferAddress("MuonCombPhi"                           ,mMuonCombPhi                , MAXMUON, &b_MuonCombPhi); 
+  SetBufferAddress("MuonCombChi2"                          ,mMuonCombChi2               , MAXMUON, &b_MuonCombChi2); 
+  SetBufferAddress("MuonCombCharge"                        ,mMuonCombCharge             , MAXMUON, &b_MuonCombCharge); 
+  SetBufferAddress("MuonCombQOverPError"                   ,mMuonCombQOverPError        , MAXMUON, &b_MuonCombQOverPError); 
+  SetBufferAddress("MuonCombNdof"                          ,mMuonCombNdof               , MAXMUON, &b_MuonCombNdof); 
+  SetBufferAddress("MuonCombVx"                            ,mMuonCombVx                 , MAXMUON, &b_MuonCombVx); 
+  SetBufferAddress("MuonCombVy"                            ,mMuonCombVy                 , MAXMUON, &b_MuonCombVy); 
+  SetBufferAddress("MuonCombVz"                            ,mMuonCombVz                 , MAXMUON, &b_MuonCombVz); 
+  SetBufferAddress("MuonCombD0"                            ,mMuonCombD0                 , MAXMUON, &b_MuonCombD0); 
+  SetBufferAddress("MuonCombDz"                            ,mMuonCombDz                 , MAXMUON, &b_MuonCombDz); 
+  SetBufferAddress("MuonStandChi2Norm"                     ,mMuonStandChi2Norm          , MAXMUON, &b_MuonStandChi2Norm); 
+  SetBufferAddress("MuonStandValidHits"                    ,mMuonStandValidHits         , MAXMUON, &b_MuonStandValidHits); 
+  SetBufferAddress("MuonStandLostHits"                     ,mMuonStandLostHits          , MAXMUON, &b_MuonStandLostHits); 
+  SetBufferAddress("MuonStandPt"                           ,mMuonStandPt                , MAXMUON, &b_MuonStandPt); 
+  SetBufferAddress("MuonStandPz"                           ,mMuonStandPz                , MAXMUON, &b_MuonStandPz); 
+  SetBufferAddress("MuonStandP"                            ,mMuonStandP                 , MAXMUON, &b_MuonStandP); 
+  SetBufferAddress("MuonStandEta"                          ,mMuonStandEta               , MAXMUON, &b_MuonStandEta); 
+  SetBufferAddress("MuonStandPhi"                          ,mMuonStandPhi               , MAXMUON, &b_MuonStandPhi); 
+  SetBufferAddress("MuonStandChi2"                         ,mMuonStandChi2              , MAXMUON, &b_MuonStandChi2); 
+  SetBufferAddress("MuonStandCharge"                       ,mMuonStandCharge            , MAXMUON, &b_MuonStandCharge); 
+  SetBufferAddress("MuonStandQOverPError"                  ,mMuonStandQOverPError       , MAXMUON, &b_MuonStandQOverPError); 
+  SetBufferAddress("MuonTrkChi2Norm"                       ,mMuonTrkChi2Norm            , MAXMUON, &b_MuonTrkChi2Norm); 
+  SetBufferAddress("MuonTrkValidHits"                      ,mMuonTrkValidHits           , MAXMUON, &b_MuonTrkValidHits); 
+  SetBufferAddress("MuonTrkLostHits"                       ,mMuonTrkLostHits            , MAXMUON, &b_MuonTrkLostHits); 
+  SetBufferAddress("MuonTrkPt"                             ,mMuonTrkPt                  , MAXMUON, &b_MuonTrkPt); 
+  SetBufferAddress("MuonTrkPz"                             ,mMuonTrkPz                  , MAXMUON, &b_MuonTrkPz); 
+  SetBufferAddress("MuonTrkP"                              ,mMuonTrkP                   , MAXMUON, &b_MuonTrkP); 
+  SetBufferAddress("MuonTrkEta"                            ,mMuonTrkEta                 , MAXMUON, &b_MuonTrkEta); 
+  SetBufferAddress("MuonTrkPhi"                            ,mMuonTrkPhi                 , MAXMUON, &b_MuonTrkPhi); 
+  SetBufferAddress("MuonTrkChi2"                           ,mMuonTrkChi2                , MAXMUON, &b_MuonTrkChi2); 
+  SetBufferAddress("MuonTrkCharge"                         ,mMuonTrkCharge              , MAXMUON, &b_MuonTrkCharge); 
+  SetBufferAddress("MuonTrkQOverPError"                    ,mMuonTrkQOverPError         , MAXMUON, &b_MuonTrkQOverPError); 
+  SetBufferAddress("MuonTrkDxy"                            ,mMuonTrkDxy                 , MAXMUON, &b_MuonTrkDxy); 
+  SetBufferAddress("MuonTrkNumOfValidPixHits"              ,mMuonTrkNumOfValidPixHits   , MAXMUON, &b_MuonTrkNumOfValidPixHits); 
   
   //PFMuons
-  mDataTree->SetBranchAddress("NPFMuon"                               ,&mNPFMuon                  );  
-  mDataTree->SetBranchAddress("PFMuonPt"                              ,mPFMuonPt                  );  
-  mDataTree->SetBranchAddress("PFMuonEt"                              ,mPFMuonEt                  );  
-  mDataTree->SetBranchAddress("PFMuonE"                               ,mPFMuonE                   );  
-  mDataTree->SetBranchAddress("PFMuonPx"                              ,mPFMuonPx                  );  
-  mDataTree->SetBranchAddress("PFMuonPy"                              ,mPFMuonPy                  );  
-  mDataTree->SetBranchAddress("PFMuonPz"                              ,mPFMuonPz                  );  
-  mDataTree->SetBranchAddress("PFMuonEta"                             ,mPFMuonEta                 );  
-  mDataTree->SetBranchAddress("PFMuonPhi"                             ,mPFMuonPhi                 );  
-  mDataTree->SetBranchAddress("PFMuonCharge"                          ,mPFMuonCharge              );  
-  mDataTree->SetBranchAddress("PFMuonIsGlobal"                        ,mPFMuonIsGlobal            );  
-  mDataTree->SetBranchAddress("PFMuonIsStandAlone"                    ,mPFMuonIsStandAlone        );  
-  mDataTree->SetBranchAddress("PFMuonIsTracker"                       ,mPFMuonIsTracker           );
-  mDataTree->SetBranchAddress("PFMuonIsTight"                         ,mPFMuonIsTight             );     
-  mDataTree->SetBranchAddress("PFMuonIsLoose"                         ,mPFMuonIsLoose             );
-  mDataTree->SetBranchAddress("PFMuonChargedHadronIso"                ,mPFMuonChargedHadronIso    );  
-  mDataTree->SetBranchAddress("PFMuonPhotonIso"                       ,mPFMuonPhotonIso           );  
-  mDataTree->SetBranchAddress("PFMuonNeutralHadronIso"                ,mPFMuonNeutralHadronIso    );  
-  mDataTree->SetBranchAddress("PFMuonisGMPT"                          ,mPFMuonisGMPT              );  
-  mDataTree->SetBranchAddress("PFMuonNumOfMatches"                    ,mPFMuonNumOfMatches        );  
-  mDataTree->SetBranchAddress("PFMuoninnertrackPt"                    ,mPFMuoninnertrackPt        );  
-  mDataTree->SetBranchAddress("PFMuonnValidHits"                      ,mPFMuonnValidHits          );  
-  mDataTree->SetBranchAddress("PFMuonnValidPixelHits"                 ,mPFMuonnValidPixelHits     );  
-  mDataTree->SetBranchAddress("PFMuondxy"                             ,mPFMuondxy                 );  
-  mDataTree->SetBranchAddress("PFMuondz"                              ,mPFMuondz                  );  
-  mDataTree->SetBranchAddress("PFMuonCombChi2Norm"                    ,mPFMuonCombChi2Norm        );  
-  mDataTree->SetBranchAddress("PFMuonCombValidHits"                   ,mPFMuonCombValidHits       );  
-  mDataTree->SetBranchAddress("PFMuonCombLostHits"                    ,mPFMuonCombLostHits        );  
-  mDataTree->SetBranchAddress("PFMuonCombPt"                          ,mPFMuonCombPt              );  
-  mDataTree->SetBranchAddress("PFMuonCombPz"                          ,mPFMuonCombPz              );  
-  mDataTree->SetBranchAddress("PFMuonCombP"                           ,mPFMuonCombP               );  
-  mDataTree->SetBranchAddress("PFMuonCombEta"                         ,mPFMuonCombEta             );  
-  mDataTree->SetBranchAddress("PFMuonCombPhi"                         ,mPFMuonCombPhi             );  
-  mDataTree->SetBranchAddress("PFMuonCombChi2"                        ,mPFMuonCombChi2            );  
-  mDataTree->SetBranchAddress("PFMuonCombCharge"                      ,mPFMuonCombCharge          );  
-  mDataTree->SetBranchAddress("PFMuonCombQOverPError"                 ,mPFMuonCombQOverPError     );  
-  mDataTree->SetBranchAddress("PFMuonCombNdof"                        ,mPFMuonCombNdof            );  
-  mDataTree->SetBranchAddress("PFMuonCombVx"                          ,mPFMuonCombVx              );  
-  mDataTree->SetBranchAddress("PFMuonCombVy"                          ,mPFMuonCombVy              );  
-  mDataTree->SetBranchAddress("PFMuonCombVz"                          ,mPFMuonCombVz              );  
-  mDataTree->SetBranchAddress("PFMuonCombD0"                          ,mPFMuonCombD0              );  
-  mDataTree->SetBranchAddress("PFMuonCombDz"                          ,mPFMuonCombDz              );  
-  mDataTree->SetBranchAddress("PFMuonStandChi2Norm"                   ,mPFMuonStandChi2Norm       );  
-  mDataTree->SetBranchAddress("PFMuonStandValidHits"                  ,mPFMuonStandValidHits      );  
-  mDataTree->SetBranchAddress("PFMuonStandLostHits"                   ,mPFMuonStandLostHits       );  
-  mDataTree->SetBranchAddress("PFMuonStandPt"                         ,mPFMuonStandPt             );  
-  mDataTree->SetBranchAddress("PFMuonStandPz"                         ,mPFMuonStandPz             );  
-  mDataTree->SetBranchAddress("PFMuonStandP"                          ,mPFMuonStandP              );  
-  mDataTree->SetBranchAddress("PFMuonStandEta"                        ,mPFMuonStandEta            );  
-  mDataTree->SetBranchAddress("PFMuonStandPhi"                        ,mPFMuonStandPhi            );  
-  mDataTree->SetBranchAddress("PFMuonStandChi2"                       ,mPFMuonStandChi2           );  
-  mDataTree->SetBranchAddress("PFMuonStandCharge"                     ,mPFMuonStandCharge         );  
-  mDataTree->SetBranchAddress("PFMuonStandQOverPError"                ,mPFMuonStandQOverPError    );  
-  mDataTree->SetBranchAddress("PFMuonTrkChi2Norm"                     ,mPFMuonTrkChi2Norm         );  
-  mDataTree->SetBranchAddress("PFMuonTrkValidHits"                    ,mPFMuonTrkValidHits        );  
-  mDataTree->SetBranchAddress("PFMuonTrkLostHits"                     ,mPFMuonTrkLostHits         );  
-  mDataTree->SetBranchAddress("PFMuonTrkPt"                           ,mPFMuonTrkPt               );  
-  mDataTree->SetBranchAddress("PFMuonTrkPz"                           ,mPFMuonTrkPz               );  
-  mDataTree->SetBranchAddress("PFMuonTrkP"                            ,mPFMuonTrkP                );  
-  mDataTree->SetBranchAddress("PFMuonTrkEta"                          ,mPFMuonTrkEta              );  
-  mDataTree->SetBranchAddress("PFMuonTrkPhi"                          ,mPFMuonTrkPhi              );  
-  mDataTree->SetBranchAddress("PFMuonTrkChi2"                         ,mPFMuonTrkChi2             );  
-  mDataTree->SetBranchAddress("PFMuonTrkCharge"                       ,mPFMuonTrkCharge           );  
-  mDataTree->SetBranchAddress("PFMuonTrkQOverPError"                  ,mPFMuonTrkQOverPError      );  
-  mDataTree->SetBranchAddress("PFMuonTrkDxy"                          ,mPFMuonTrkDxy              );  
-  mDataTree->SetBranchAddress("PFMuonTrkNumOfValidPixHits"            ,mPFMuonTrkNumOfValidPixHits);
-  mDataTree->SetBranchAddress("PFMuonR04ChargedHadronPt"              ,mPFMuonR04ChargedHadronPt  );
-  mDataTree->SetBranchAddress("PFMuonR04NeutralHadronEt"              ,mPFMuonR04NeutralHadronEt  );
-  mDataTree->SetBranchAddress("PFMuonR04PhotonEt"                     ,mPFMuonR04PhotonEt         );
-  mDataTree->SetBranchAddress("PFMuonR04PUPt"                         ,mPFMuonR04PUPt             ); 
+  BranchAddress("NPFMuon"                               ,&mNPFMuon                  , &b_NPFMuon);  
+  SetBufferAddress("PFMuonPt"                              ,mPFMuonPt                  , MAXMUON, &b_PFMuonPt);  
+  SetBufferAddress("PFMuonEt"                              ,mPFMuonEt                  , MAXMUON, &b_PFMuonEt);  
+  SetBufferAddress("PFMuonE"                               ,mPFMuonE                   , MAXMUON, &b_PFMuonE);  
+  SetBufferAddress("PFMuonPx"                              ,mPFMuonPx                  , MAXMUON, &b_PFMuonPx);  
+  SetBufferAddress("PFMuonPy"                              ,mPFMuonPy                  , MAXMUON, &b_PFMuonPy);  
+  SetBufferAddress("PFMuonPz"                              ,mPFMuonPz                  , MAXMUON, &b_PFMuonPz);  
+  SetBufferAddress("PFMuonEta"                             ,mPFMuonEta                 , MAXMUON, &b_PFMuonEta);  
+  SetBufferAddress("PFMuonPhi"                             ,mPFMuonPhi                 , MAXMUON, &b_PFMuonPhi);  
+  SetBufferAddress("PFMuonCharge"                          ,mPFMuonCharge              , MAXMUON, &b_PFMuonCharge);  
+  SetBufferAddress("PFMuonIsGlobal"                        ,mPFMuonIsGlobal            , MAXMUON, &b_PFMuonIsGlobal);  
+  SetBufferAddress("PFMuonIsStandAlone"                    ,mPFMuonIsStandAlone        , MAXMUON, &b_PFMuonIsStandAlone);  
+  SetBufferAddress("PFMuonIsTracker"                       ,mPFMuonIsTracker           , MAXMUON, &b_PFMuonIsTracker);
+  SetBufferAddress("PFMuonIsTight"                         ,mPFMuonIsTight             , MAXMUON, &b_PFMuonIsTight);     
+  SetBufferAddress("PFMuonIsLoose"                         ,mPFMuonIsLoose             , MAXMUON, &b_PFMuonIsLoose);
+  SetBufferAddress("PFMuonChargedHadronIso"                ,mPFMuonChargedHadronIso    , MAXMUON, &b_PFMuonChargedHadronIso);  
+  SetBufferAddress("PFMuonPhotonIso"                       ,mPFMuonPhotonIso           , MAXMUON, &b_PFMuonPhotonIso);  
+  SetBufferAddress("PFMuonNeutralHadronIso"                ,mPFMuonNeutralHadronIso    , MAXMUON, &b_PFMuonNeutralHadronIso);  
+  SetBufferAddress("PFMuonisGMPT"                          ,mPFMuonisGMPT              , MAXMUON, &b_PFMuonisGMPT);  
+  SetBufferAddress("PFMuonNumOfMatches"                    ,mPFMuonNumOfMatches        , MAXMUON, &b_PFMuonNumOfMatches);  
+  SetBufferAddress("PFMuoninnertrackPt"                    ,mPFMuoninnertrackPt        , MAXMUON, &b_PFMuoninnertrackPt);  
+  SetBufferAddress("PFMuonnValidHits"                      ,mPFMuonnValidHits          , MAXMUON, &b_PFMuonnValidHits);  
+  SetBufferAddress("PFMuonnValidPixelHits"                 ,mPFMuonnValidPixelHits     , MAXMUON, &b_PFMuonnValidPixelHits);  
+  SetBufferAddress("PFMuondxy"                             ,mPFMuondxy                 , MAXMUON, &b_PFMuondxy);  
+  SetBufferAddress("PFMuondz"                              ,mPFMuondz                  , MAXMUON, &b_PFMuondz);  
+  SetBufferAddress("PFMuonCombChi2Norm"                    ,mPFMuonCombChi2Norm        , MAXMUON, &b_PFMuonCombChi2Norm);  
+  SetBufferAddress("PFMuonCombValidHits"                   ,mPFMuonCombValidHits       , MAXMUON, &b_PFMuonCombValidHits);  
+  SetBufferAddress("PFMuonCombLostHits"                    ,mPFMuonCombLostHits        , MAXMUON, &b_PFMuonCombLostHits);  
+  SetBufferAddress("PFMuonCombPt"                          ,mPFMuonCombPt              , MAXMUON, &b_PFMuonCombPt);  
+  SetBufferAddress("PFMuonCombPz"                          ,mPFMuonCombPz              , MAXMUON, &b_PFMuonCombPz);  
+  SetBufferAddress("PFMuonCombP"                           ,mPFMuonCombP               , MAXMUON, &b_PFMuonCombP);  
+  SetBufferAddress("PFMuonCombEta"                         ,mPFMuonCombEta             , MAXMUON, &b_PFMuonCombEta);  
+  SetBufferAddress("PFMuonCombPhi"                         ,mPFMuonCombPhi             , MAXMUON, &b_PFMuonCombPhi);  
+  SetBufferAddress("PFMuonCombChi2"                        ,mPFMuonCombChi2            , MAXMUON, &b_PFMuonCombChi2);  
+  SetBufferAddress("PFMuonCombCharge"                      ,mPFMuonCombCharge          , MAXMUON, &b_PFMuonCombCharge);  
+  SetBufferAddress("PFMuonCombQOverPError"                 ,mPFMuonCombQOverPError     , MAXMUON, &b_PFMuonCombQOverPError);  
+  SetBufferAddress("PFMuonCombNdof"                        ,mPFMuonCombNdof            , MAXMUON, &b_PFMuonCombNdof);  
+  SetBufferAddress("PFMuonCombVx"                          ,mPFMuonCombVx              , MAXMUON, &b_PFMuonCombVx);  
+  SetBufferAddress("PFMuonCombVy"                          ,mPFMuonCombVy              , MAXMUON, &b_PFMuonCombVy);  
+  SetBufferAddress("PFMuonCombVz"                          ,mPFMuonCombVz              , MAXMUON, &b_PFMuonCombVz);  
+  SetBufferAddress("PFMuonCombD0"                          ,mPFMuonCombD0              , MAXMUON, &b_PFMuonCombD0);  
+  SetBufferAddress("PFMuonCombDz"                          ,mPFMuonCombDz              , MAXMUON, &b_PFMuonCombDz);  
+  SetBufferAddress("PFMuonStandChi2Norm"                   ,mPFMuonStandChi2Norm       , MAXMUON, &b_PFMuonStandChi2Norm);  
+  SetBufferAddress("PFMuonStandValidHits"                  ,mPFMuonStandValidHits      , MAXMUON, &b_PFMuonStandValidHits);  
+  SetBufferAddress("PFMuonStandLostHits"                   ,mPFMuonStandLostHits       , MAXMUON, &b_PFMuonStandLostHits);  
+  SetBufferAddress("PFMuonStandPt"                         ,mPFMuonStandPt             , MAXMUON, &b_PFMuonStandPt);  
+  SetBufferAddress("PFMuonStandPz"                         ,mPFMuonStandPz             , MAXMUON, &b_PFMuonStandPz);  
+  SetBufferAddress("PFMuonStandP"                          ,mPFMuonStandP              , MAXMUON, &b_PFMuonStandP);  
+  SetBufferAddress("PFMuonStandEta"                        ,mPFMuonStandEta            , MAXMUON, &b_PFMuonStandEta);  
+  SetBufferAddress("PFMuonStandPhi"                        ,mPFMuonStandPhi            , MAXMUON, &b_PFMuonStandPhi);  
+  SetBufferAddress("PFMuonStandChi2"                       ,mPFMuonStandChi2           , MAXMUON, &b_PFMuonStandChi2);  
+  SetBufferAddress("PFMuonStandCharge"                     ,mPFMuonStandCharge         , MAXMUON, &b_PFMuonStandCharge);  
+  SetBufferAddress("PFMuonStandQOverPError"                ,mPFMuonStandQOverPError    , MAXMUON, &b_PFMuonStandQOverPError);  
+  SetBufferAddress("PFMuonTrkChi2Norm"                     ,mPFMuonTrkChi2Norm         , MAXMUON, &b_PFMuonTrkChi2Norm);  
+  SetBufferAddress("PFMuonTrkValidHits"                    ,mPFMuonTrkValidHits        , MAXMUON, &b_PFMuonTrkValidHits);  
+  SetBufferAddress("PFMuonTrkLostHits"                     ,mPFMuonTrkLostHits         , MAXMUON, &b_PFMuonTrkLostHits);  
+  SetBufferAddress("PFMuonTrkPt"                           ,mPFMuonTrkPt               , MAXMUON, &b_PFMuonTrkPt);  
+  SetBufferAddress("PFMuonTrkPz"                           ,mPFMuonTrkPz               , MAXMUON, &b_PFMuonTrkPz);  
+  SetBufferAddress("PFMuonTrkP"                            ,mPFMuonTrkP                , MAXMUON, &b_PFMuonTrkP);  
+  SetBufferAddress("PFMuonTrkEta"                          ,mPFMuonTrkEta              , MAXMUON, &b_PFMuonTrkEta);  
+  SetBufferAddress("PFMuonTrkPhi"                          ,mPFMuonTrkPhi              , MAXMUON, &b_PFMuonTrkPhi);  
+  SetBufferAddress("PFMuonTrkChi2"                         ,mPFMuonTrkChi2             , MAXMUON, &b_PFMuonTrkChi2);  
+  SetBufferAddress("PFMuonTrkCharge"                       ,mPFMuonTrkCharge           , MAXMUON, &b_PFMuonTrkCharge);  
+  SetBufferAddress("PFMuonTrkQOverPError"                  ,mPFMuonTrkQOverPError      , MAXMUON, &b_PFMuonTrkQOverPError);  
+  SetBufferAddress("PFMuonTrkDxy"                          ,mPFMuonTrkDxy              , MAXMUON, &b_PFMuonTrkDxy);  
+  SetBufferAddress("PFMuonTrkNumOfValidPixHits"            ,mPFMuonTrkNumOfValidPixHits, MAXMUON, &b_PFMuonTrkNumOfValidPixHits);
+  SetBufferAddress("PFMuonR04ChargedHadronPt"              ,mPFMuonR04ChargedHadronPt  , MAXMUON, &b_PFMuonR04ChargedHadronPt);
+  SetBufferAddress("PFMuonR04NeutralHadronEt"              ,mPFMuonR04NeutralHadronEt  , MAXMUON, &b_PFMuonR04NeutralHadronEt);
+  SetBufferAddress("PFMuonR04PhotonEt"                     ,mPFMuonR04PhotonEt         , MAXMUON, &b_PFMuonR04PhotonEt);
+  SetBufferAddress("PFMuonR04PUPt"                         ,mPFMuonR04PUPt             , MAXMUON, &b_PFMuonR04PUPt); 
   
   //Electrons
-  mDataTree->SetBranchAddress("NElec"                                 ,&mNElec                   );   
-  mDataTree->SetBranchAddress("ElecE"                                 ,mElecE                    );   
-  mDataTree->SetBranchAddress("ElecPt"                                ,mElecPt                   );   
-  mDataTree->SetBranchAddress("ElecPx"                                ,mElecPx                   );   
-  mDataTree->SetBranchAddress("ElecPy"                                ,mElecPy                   );   
-  mDataTree->SetBranchAddress("ElecPz"                                ,mElecPz                   );   
-  mDataTree->SetBranchAddress("ElecEcalseed"                          ,mElecEcalseed             );   
-  mDataTree->SetBranchAddress("ElecID80"                              ,mElecID80                 );   
-  mDataTree->SetBranchAddress("ElecID95"                              ,mElecID95                 );   
-  mDataTree->SetBranchAddress("ElecEta"                               ,mElecEta                  );   
-  mDataTree->SetBranchAddress("ElecPhi"                               ,mElecPhi                  );   
-  mDataTree->SetBranchAddress("ElecCharge"                            ,mElecCharge               );   
-  mDataTree->SetBranchAddress("Elecdr03HcalTowerSumEt"                ,mElecdr03HcalTowerSumEt   );   
-  mDataTree->SetBranchAddress("Elecdr03EcalRecHitSumEt"               ,mElecdr03EcalRecHitSumEt  );   
-  mDataTree->SetBranchAddress("Elecdr03TkSumPt"                       ,mElecdr03TkSumPt          );   
-  mDataTree->SetBranchAddress("ElecNumOfValidHits"                    ,mElecNumOfValidHits       );   
-  mDataTree->SetBranchAddress("ElecInnerNumOfHits"                    ,mElecInnerNumOfHits       );   
-  mDataTree->SetBranchAddress("Elecdist"                              ,mElecdist                 );   
-  mDataTree->SetBranchAddress("Elecdcot"                              ,mElecdcot                 );   
-  mDataTree->SetBranchAddress("ElecNormChi2"                          ,mElecNormChi2             );   
-  mDataTree->SetBranchAddress("Elecdxy"                               ,mElecdxy                  );   
-  mDataTree->SetBranchAddress("Elecdz"                                ,mElecdz                   );   
-  mDataTree->SetBranchAddress("ElecdB"                                ,mElecdB                   );   
-  mDataTree->SetBranchAddress("ElecIsEB"                              ,mElecIsEB                 );   
-  mDataTree->SetBranchAddress("Elecfbrem"                             ,mElecfbrem                );   
-  mDataTree->SetBranchAddress("ElecDEtaSuTrAtVtx"                     ,mElecDEtaSuTrAtVtx        );   
-  mDataTree->SetBranchAddress("ElecDPhiSuTrAtVtx"                     ,mElecDPhiSuTrAtVtx        );   
-  mDataTree->SetBranchAddress("ElecHadronicOverEm"                    ,mElecHadronicOverEm       );   
-  mDataTree->SetBranchAddress("ElecHcalOverEcal"                      ,mElecHcalOverEcal         );   
-  mDataTree->SetBranchAddress("ElecSuperClusOverP"                    ,mElecSuperClusOverP       );   
-  mDataTree->SetBranchAddress("Elecetaeta"                            ,mElecetaeta               );   
-  mDataTree->SetBranchAddress("Elecietaieta"                          ,mElecietaieta             );
+  BranchAddress("NElec"                                 ,&mNElec                   , &b_NElec);   
+  SetBufferAddress("ElecE"                                 ,mElecE                    , MAXELEC, &b_ElecE);   
+  SetBufferAddress("ElecPt"                                ,mElecPt                   , MAXELEC, &b_ElecPt);   
+  SetBufferAddress("ElecPx"                                ,mElecPx                   , MAXELEC, &b_ElecPx);   
+  SetBufferAddress("ElecPy"                                ,mElecPy                   , MAXELEC, &b_ElecPy);   
+  SetBufferAddress("ElecPz"                                ,mElecPz                   , MAXELEC, &b_ElecPz);   
+  SetBufferAddress("ElecEcalseed"                          ,mElecEcalseed             , MAXELEC, &b_ElecEcalseed);   
+  SetBufferAddress("ElecID80"                              ,mElecID80                 , MAXELEC, &b_ElecID80);   
+  SetBufferAddress("ElecID95"                              ,mElecID95                 , MAXELEC, &b_ElecID95);   
+  SetBufferAddress("ElecEta"                               ,mElecEta                  , MAXELEC, &b_ElecEta);   
+  SetBufferAddress("ElecPhi"                               ,mElecPhi                  , MAXELEC, &b_ElecPhi);   
+  SetBufferAddress("ElecCharge"                            ,mElecCharge               , MAXELEC, &b_ElecCharge);   
+  SetBufferAddress("Elecdr03HcalTowerSumEt"                ,mElecdr03HcalTowerSumEt   , MAXELEC, &b_Elecdr03HcalTowerSumEt);   
+  SetBufferAddress("Elecdr03EcalRecHitSumEt"               ,mElecdr03EcalRecHitSumEt  , MAXELEC, &b_Elecdr03EcalRecHitSumEt);   
+  SetBufferAddress("Elecdr03TkSumPt"                       ,mElecdr03TkSumPt          , MAXELEC, &b_Elecdr03TkSumPt);   
+  SetBufferAddress("ElecNumOfValidHits"                    ,mElecNumOfValidHits       , MAXELEC, &b_ElecNumOfValidHits);   
+  SetBufferAddress("ElecInnerNumOfHits"                    ,mElecInnerNumOfHits       , MAXELEC, &b_ElecInnerNumOfHits);   
+  SetBufferAddress("Elecdist"                              ,mElecdist                 , MAXELEC, &b_Elecdist);   
+  SetBufferAddress("Elecdcot"                              ,mElecdcot                 , MAXELEC, &b_Elecdcot);   
+  SetBufferAddress("ElecNormChi2"                          ,mElecNormChi2             , MAXELEC, &b_ElecNormChi2);   
+  SetBufferAddress("Elecdxy"                               ,mElecdxy                  , MAXELEC, &b_Elecdxy);   
+  SetBufferAddress("Elecdz"                                ,mElecdz                   , MAXELEC, &b_Elecdz);   
+  SetBufferAddress("ElecdB"                                ,mElecdB                   , MAXELEC, &b_ElecdB);   
+  SetBufferAddress("ElecIsEB"                              ,mElecIsEB                 , MAXELEC, &b_ElecIsEB);   
+  SetBufferAddress("Elecfbrem"                             ,mElecfbrem                , MAXELEC, &b_Elecfbrem);   
+  SetBufferAddress("ElecDEtaSuTrAtVtx"                     ,mElecDEtaSuTrAtVtx        , MAXELEC, &b_ElecDEtaSuTrAtVtx);   
+  SetBufferAddress("ElecDPhiSuTrAtVtx"                     ,mElecDPhiSuTrAtVtx        , MAXELEC, &b_ElecDPhiSuTrAtVtx);   
+  SetBufferAddress("ElecHadronicOverEm"                    ,mElecHadronicOverEm       , MAXELEC, &b_ElecHadronicOverEm);   
+  SetBufferAddress("ElecHcalOverEcal"                      ,mElecHcalOverEcal         , MAXELEC, &b_ElecHcalOverEcal);   
+  SetBufferAddress("ElecSuperClusOverP"                    ,mElecSuperClusOverP       , MAXELEC, &b_ElecSuperClusOverP);   
+  SetBufferAddress("Elecetaeta"                            ,mElecetaeta               , MAXELEC, &b_Elecetaeta);   
+  SetBufferAddress("Elecietaieta"                          ,mElecietaieta             , MAXELEC, &b_Elecietaieta);
   
   //PFElectrons
-  mDataTree->SetBranchAddress("NPFElec"                               ,&mNPFElec                  );  
-  mDataTree->SetBranchAddress("PFElecCharge"                          ,mPFElecCharge              );  
-  mDataTree->SetBranchAddress("PFElecIsEB"                            ,mPFElecIsEB                );  
-  mDataTree->SetBranchAddress("PFElecPassTight"                       ,mPFElecPassTight           );  
-  mDataTree->SetBranchAddress("PFElecE"                               ,mPFElecE                   );  
-  mDataTree->SetBranchAddress("PFElecPt"                              ,mPFElecPt                  );  
-  mDataTree->SetBranchAddress("PFElecPx"                              ,mPFElecPx                  );  
-  mDataTree->SetBranchAddress("PFElecPy"                              ,mPFElecPy                  );  
-  mDataTree->SetBranchAddress("PFElecPz"                              ,mPFElecPz                  );  
-  mDataTree->SetBranchAddress("PFElecEta"                             ,mPFElecEta                 );  
-  mDataTree->SetBranchAddress("PFElecPhi"                             ,mPFElecPhi                 );  
-  mDataTree->SetBranchAddress("PFElecCharHadIso"                      ,mPFElecCharHadIso          );  
-  mDataTree->SetBranchAddress("PFElecPhoIso"                          ,mPFElecPhoIso              );  
-  mDataTree->SetBranchAddress("PFElecNeuHadIso"                       ,mPFElecNeuHadIso           );  
-  mDataTree->SetBranchAddress("PFElecMva"                             ,mPFElecMva                 );  
-  mDataTree->SetBranchAddress("PFElecdxy"                             ,mPFElecdxy                 );  
-  mDataTree->SetBranchAddress("PFElecdz"                              ,mPFElecdz                  );  
-  mDataTree->SetBranchAddress("PFElecHadOverEm"                       ,mPFElecHadOverEm           );  
-  mDataTree->SetBranchAddress("PFElecHcalOverEm"                      ,mPFElecHcalOverEm          );  
-  mDataTree->SetBranchAddress("PFElecSupClusOverP"                    ,mPFElecSupClusOverP        );  
-  mDataTree->SetBranchAddress("PFElecInnerHits"                       ,mPFElecInnerHits           );  
-  mDataTree->SetBranchAddress("PFElecConvDist"                        ,mPFElecConvDist            );  
-  mDataTree->SetBranchAddress("PFElecConvDcot"                        ,mPFElecConvDcot            );
-  mDataTree->SetBranchAddress("PFElecDEtaSuTrAtVtx"                   ,mPFElecDEtaSuTrAtVtx       );   
-  mDataTree->SetBranchAddress("PFElecDPhiSuTrAtVtx"                   ,mPFElecDPhiSuTrAtVtx       );   
-  mDataTree->SetBranchAddress("PFElecHadronicOverEm"                  ,mPFElecHadronicOverEm      );   
-  mDataTree->SetBranchAddress("PFElecHcalOverEcal"                    ,mPFElecHcalOverEcal        );   
-  mDataTree->SetBranchAddress("PFElecetaeta"                          ,mPFElecetaeta              );   
-  mDataTree->SetBranchAddress("PFElecietaieta"                        ,mPFElecietaieta            );
-  mDataTree->SetBranchAddress("PFElecIsTight"                         ,mPFElecIsTight             );     
-  mDataTree->SetBranchAddress("PFElecIsMedium"                        ,mPFElecIsMedium            );
-  mDataTree->SetBranchAddress("PFElecIsLoose"                         ,mPFElecIsLoose             );     
-  mDataTree->SetBranchAddress("PFElecIsVeto"                          ,mPFElecIsVeto              );
-  mDataTree->SetBranchAddress("PFElecEffArea"                         ,mPFElecEffArea             );  
+  BranchAddress("NPFElec"                               ,&mNPFElec                  , &b_NPFElec);  
+  SetBufferAddress("PFElecCharge"                          ,mPFElecCharge              , MAXELEC, &b_PFElecCharge);  
+  SetBufferAddress("PFElecIsEB"                            ,mPFElecIsEB                , MAXELEC, &b_PFElecIsEB);  
+  SetBufferAddress("PFElecPassTight"                       ,mPFElecPassTight           , MAXELEC, &b_PFElecPassTight);  
+  SetBufferAddress("PFElecE"                               ,mPFElecE                   , MAXELEC, &b_PFElecE);  
+  SetBufferAddress("PFElecPt"                              ,mPFElecPt                  , MAXELEC, &b_PFElecPt);  
+  SetBufferAddress("PFElecPx"                              ,mPFElecPx                  , MAXELEC, &b_PFElecPx);  
+  SetBufferAddress("PFElecPy"                              ,mPFElecPy                  , MAXELEC, &b_PFElecPy);  
+  SetBufferAddress("PFElecPz"                              ,mPFElecPz                  , MAXELEC, &b_PFElecPz);  
+  SetBufferAddress("PFElecEta"                             ,mPFElecEta                 , MAXELEC, &b_PFElecEta);  
+  SetBufferAddress("PFElecPhi"                             ,mPFElecPhi                 , MAXELEC, &b_PFElecPhi);  
+  SetBufferAddress("PFElecCharHadIso"                      ,mPFElecCharHadIso          , MAXELEC, &b_PFElecCharHadIso);  
+  SetBufferAddress("PFElecPhoIso"                          ,mPFElecPhoIso              , MAXELEC, &b_PFElecPhoIso);  
+  SetBufferAddress("PFElecNeuHadIso"                       ,mPFElecNeuHadIso           , MAXELEC, &b_PFElecNeuHadIso);  
+  SetBufferAddress("PFElecMva"                             ,mPFElecMva                 , MAXELEC, &b_PFElecMva);  
+  SetBufferAddress("PFElecdxy"                             ,mPFElecdxy                 , MAXELEC, &b_PFElecdxy);  
+  SetBufferAddress("PFElecdz"                              ,mPFElecdz                  , MAXELEC, &b_PFElecdz);  
+  SetBufferAddress("PFElecHadOverEm"                       ,mPFElecHadOverEm           , MAXELEC, &b_PFElecHadOverEm);  
+  SetBufferAddress("PFElecHcalOverEm"                      ,mPFElecHcalOverEm          , MAXELEC, &b_PFElecHcalOverEm);  
+  SetBufferAddress("PFElecSupClusOverP"                    ,mPFElecSupClusOverP        , MAXELEC, &b_PFElecSupClusOverP);  
+  SetBufferAddress("PFElecInnerHits"                       ,mPFElecInnerHits           , MAXELEC, &b_PFElecInnerHits);  
+  SetBufferAddress("PFElecConvDist"                        ,mPFElecConvDist            , MAXELEC, &b_PFElecConvDist);  
+  SetBufferAddress("PFElecConvDcot"                        ,mPFElecConvDcot            , MAXELEC, &b_PFElecConvDcot);
+  SetBufferAddress("PFElecDEtaSuTrAtVtx"                   ,mPFElecDEtaSuTrAtVtx       , MAXELEC, &b_PFElecDEtaSuTrAtVtx);   
+  SetBufferAddress("PFElecDPhiSuTrAtVtx"                   ,mPFElecDPhiSuTrAtVtx       , MAXELEC, &b_PFElecDPhiSuTrAtVtx);   
+  SetBufferAddress("PFElecHadronicOverEm"                  ,mPFElecHadronicOverEm      , MAXELEC, &b_PFElecHadronicOverEm);   
+  SetBufferAddress("PFElecHcalOverEcal"                    ,mPFElecHcalOverEcal        , MAXELEC, &b_PFElecHcalOverEcal);   
+  SetBufferAddress("PFElecetaeta"                          ,mPFElecetaeta              , MAXELEC, &b_PFElecetaeta);   
+  SetBufferAddress("PFElecietaieta"                        ,mPFElecietaieta            , MAXELEC, &b_PFElecietaieta);
+  SetBufferAddress("PFElecIsTight"                         ,mPFElecIsTight             , MAXELEC, &b_PFElecIsTight);     
+  SetBufferAddress("PFElecIsMedium"                        ,mPFElecIsMedium            , MAXELEC, &b_PFElecIsMedium);
+  SetBufferAddress("PFElecIsLoose"                         ,mPFElecIsLoose             , MAXELEC, &b_PFElecIsLoose);     
+  SetBufferAddress("PFElecIsVeto"                          ,mPFElecIsVeto              , MAXELEC, &b_PFElecIsVeto);
+  SetBufferAddress("PFElecEffArea"                         ,mPFElecEffArea             , MAXELEC, &b_PFElecEffArea);  
 
   //Tau
-  mDataTree->SetBranchAddress("NTau"                                               ,&mNTau);
-  mDataTree->SetBranchAddress("TauE"                                               ,mTauE);
-  mDataTree->SetBranchAddress("TauPt"                                              ,mTauPt);
-  mDataTree->SetBranchAddress("TauPx"                                              ,mTauPx);
-  mDataTree->SetBranchAddress("TauPy"                                              ,mTauPy);
-  mDataTree->SetBranchAddress("TauPz"                                              ,mTauPz);
-  mDataTree->SetBranchAddress("TauEta"                                             ,mTauEta);
-  mDataTree->SetBranchAddress("TauPhi"                                             ,mTauPhi);
-  mDataTree->SetBranchAddress("TauCharge"                                          ,mTauCharge);
-  mDataTree->SetBranchAddress("TauEtaEtaMoment"                                    ,mTauEtaEtaMoment);
-  mDataTree->SetBranchAddress("TauPhiPhiMoment"                                    ,mTauPhiPhiMoment);
-  mDataTree->SetBranchAddress("TauEtaPhiMoment"                                    ,mTauEtaPhiMoment);
-  mDataTree->SetBranchAddress("TauLeadPFChargedHadrCandsignedSipt"                 ,mTauLeadPFChargedHadrCandsignedSipt);
-  mDataTree->SetBranchAddress("TauIsoPFChargedHadrCandsPtSum"                      ,mTauIsoPFChargedHadrCandsPtSum);
-  mDataTree->SetBranchAddress("TauIsoPFGammaCandsEtSum"                            ,mTauIsoPFGammaCandsEtSum);
-  mDataTree->SetBranchAddress("TauMaximumHCALPFClusterEt"                          ,mTauMaximumHCALPFClusterEt);
-  mDataTree->SetBranchAddress("TauEmFraction"                                      ,mTauEmFraction);
-  mDataTree->SetBranchAddress("TauHcalTotOverPLead"                                ,mTauHcalTotOverPLead);
-  mDataTree->SetBranchAddress("TauHcalMaxOverPLead"                                ,mTauHcalMaxOverPLead);
-  mDataTree->SetBranchAddress("TauHcal3x3OverPLead"                                ,mTauHcal3x3OverPLead);
-  mDataTree->SetBranchAddress("TauEcalStripSumEOverPLead"                          ,mTauEcalStripSumEOverPLead);
-  mDataTree->SetBranchAddress("TauBremsRecoveryEOverPLead"                         ,mTauBremsRecoveryEOverPLead);
-  mDataTree->SetBranchAddress("TauElectronPreIDOutput"                             ,mTauElectronPreIDOutput);
-  mDataTree->SetBranchAddress("TauElectronPreIDDecision"                           ,mTauElectronPreIDDecision);
-  mDataTree->SetBranchAddress("TauCaloComp"                                        ,mTauCaloComp);
-  mDataTree->SetBranchAddress("TauSegComp"                                         ,mTauSegComp);
-  mDataTree->SetBranchAddress("TauMuonDecision"                                    ,mTauMuonDecision);
-  mDataTree->SetBranchAddress("TausignalPFChargedHadrCands"                        ,mTausignalPFChargedHadrCands);
-  mDataTree->SetBranchAddress("TausignalPFGammaCands"                              ,mTausignalPFGammaCands);
-  mDataTree->SetBranchAddress("TauDisAgainstElectronDeadECAL"                      ,mTauDisAgainstElectronDeadECAL);
-  mDataTree->SetBranchAddress("TauDisAgainstElectronLoose"                         ,mTauDisAgainstElectronLoose);
-  mDataTree->SetBranchAddress("TauDisAgainstElectronLooseMVA2"                     ,mTauDisAgainstElectronLooseMVA2);
-  mDataTree->SetBranchAddress("TauDisAgainstElectronLooseMVA3"                     ,mTauDisAgainstElectronLooseMVA3);
-  mDataTree->SetBranchAddress("TauDisAgainstElectronMVA2category"                  ,mTauDisAgainstElectronMVA2category);
-  mDataTree->SetBranchAddress("TauDisAgainstElectronMVA2raw"                       ,mTauDisAgainstElectronMVA2raw);
-  mDataTree->SetBranchAddress("TauDisAgainstElectronMVA3category"                  ,mTauDisAgainstElectronMVA3category);
-  mDataTree->SetBranchAddress("TauDisAgainstElectronMVA3raw"                       ,mTauDisAgainstElectronMVA3raw);
-  mDataTree->SetBranchAddress("TauDisAgainstElectronMVA"                           ,mTauDisAgainstElectronMVA);
-  mDataTree->SetBranchAddress("TauDisAgainstElectronMedium"                        ,mTauDisAgainstElectronMedium);
-  mDataTree->SetBranchAddress("TauDisAgainstElectronMediumMVA2"                    ,mTauDisAgainstElectronMediumMVA2);
-  mDataTree->SetBranchAddress("TauDisAgainstElectronMediumMVA3"                    ,mTauDisAgainstElectronMediumMVA3);
-  mDataTree->SetBranchAddress("TauDisAgainstElectronTight"                         ,mTauDisAgainstElectronTight);
-  mDataTree->SetBranchAddress("TauDisAgainstElectronTightMVA2"                     ,mTauDisAgainstElectronTightMVA2);
-  mDataTree->SetBranchAddress("TauDisAgainstElectronTightMVA3"                     ,mTauDisAgainstElectronTightMVA3);
-  mDataTree->SetBranchAddress("TauDisAgainstElectronVLooseMVA2"                    ,mTauDisAgainstElectronVLooseMVA2);
-  mDataTree->SetBranchAddress("TauDisAgainstElectronVTightMVA3"                    ,mTauDisAgainstElectronVTightMVA3);
-  mDataTree->SetBranchAddress("TauDisAgainstMuonLoose2"                            ,mTauDisAgainstMuonLoose2);
-  mDataTree->SetBranchAddress("TauDisAgainstMuonLoose"                             ,mTauDisAgainstMuonLoose);
-  mDataTree->SetBranchAddress("TauDisAgainstMuonMedium2"                           ,mTauDisAgainstMuonMedium2);
-  mDataTree->SetBranchAddress("TauDisAgainstMuonMedium"                            ,mTauDisAgainstMuonMedium);
-  mDataTree->SetBranchAddress("TauDisAgainstMuonTight2"                            ,mTauDisAgainstMuonTight2);
-  mDataTree->SetBranchAddress("TauDisAgainstMuonTight"                             ,mTauDisAgainstMuonTight);
-  mDataTree->SetBranchAddress("TauDisByCombinedIsolationDeltaBetaCorrRaw3Hits"     ,mTauDisByCombinedIsolationDeltaBetaCorrRaw3Hits);
-  mDataTree->SetBranchAddress("TauDisByCombinedIsolationDeltaBetaCorrRaw"          ,mTauDisByCombinedIsolationDeltaBetaCorrRaw);
-  mDataTree->SetBranchAddress("TauDisByIsolationMVA2raw"                           ,mTauDisByIsolationMVA2raw);
-  mDataTree->SetBranchAddress("TauDisByIsolationMVAraw"                            ,mTauDisByIsolationMVAraw);
-  mDataTree->SetBranchAddress("TauDisByLooseCombinedIsolationDeltaBetaCorr3Hits"   ,mTauDisByLooseCombinedIsolationDeltaBetaCorr3Hits);
-  mDataTree->SetBranchAddress("TauDisByLooseCombinedIsolationDeltaBetaCorr"        ,mTauDisByLooseCombinedIsolationDeltaBetaCorr);
-  mDataTree->SetBranchAddress("TauDisByLooseIsolationMVA2"                         ,mTauDisByLooseIsolationMVA2);
-  mDataTree->SetBranchAddress("TauDisByLooseIsolationMVA"                          ,mTauDisByLooseIsolationMVA);
-  mDataTree->SetBranchAddress("TauDisByMediumCombinedIsolationDeltaBetaCorr3Hits"  ,mTauDisByMediumCombinedIsolationDeltaBetaCorr3Hits);
-  mDataTree->SetBranchAddress("TauDisByMediumCombinedIsolationDeltaBetaCorr"       ,mTauDisByMediumCombinedIsolationDeltaBetaCorr);
-  mDataTree->SetBranchAddress("TauDisByMediumIsolationMVA2"                        ,mTauDisByMediumIsolationMVA2);
-  mDataTree->SetBranchAddress("TauDisByMediumIsolationMVA"                         ,mTauDisByMediumIsolationMVA);
-  mDataTree->SetBranchAddress("TauDisByTightCombinedIsolationDeltaBetaCorr3Hits"   ,mTauDisByTightCombinedIsolationDeltaBetaCorr3Hits);
-  mDataTree->SetBranchAddress("TauDisByTightCombinedIsolationDeltaBetaCorr"        ,mTauDisByTightCombinedIsolationDeltaBetaCorr);
-  mDataTree->SetBranchAddress("TauDisByTightIsolationMVA2"                         ,mTauDisByTightIsolationMVA2);
-  mDataTree->SetBranchAddress("TauDisByTightIsolationMVA"                          ,mTauDisByTightIsolationMVA);
-  mDataTree->SetBranchAddress("TauDisByVLooseCombinedIsolationDeltaBetaCorr"       ,mTauDisByVLooseCombinedIsolationDeltaBetaCorr);
-  mDataTree->SetBranchAddress("TauDisDecayModeFinding"                             ,mTauDisDecayModeFinding);
-  mDataTree->SetBranchAddress("TauJetPt"                                           ,mTauJetPt);
-  mDataTree->SetBranchAddress("TauJetEta"                                          ,mTauJetEta);
-  mDataTree->SetBranchAddress("TauJetPhi"                                          ,mTauJetPhi);
+  BranchAddress("NTau"                                               ,&mNTau, &b_NTau);
+  SetBufferAddress("TauE"                                               ,mTauE, MAXTAU, &b_TauE);
+  SetBufferAddress("TauPt"                                              ,mTauPt, MAXTAU, &b_TauPt);
+  SetBufferAddress("TauPx"                                              ,mTauPx, MAXTAU, &b_TauPx);
+  SetBufferAddress("TauPy"                                              ,mTauPy, MAXTAU, &b_TauPy);
+  SetBufferAddress("TauPz"                                              ,mTauPz, MAXTAU, &b_TauPz);
+  SetBufferAddress("TauEta"                                             ,mTauEta, MAXTAU, &b_TauEta);
+  SetBufferAddress("TauPhi"                                             ,mTauPhi, MAXTAU, &b_TauPhi);
+  SetBufferAddress("TauCharge"                                          ,mTauCharge, MAXTAU, &b_TauCharge);
+  SetBufferAddress("TauEtaEtaMoment"                                    ,mTauEtaEtaMoment, MAXTAU, &b_TauEtaEtaMoment);
+  SetBufferAddress("TauPhiPhiMoment"                                    ,mTauPhiPhiMoment, MAXTAU, &b_TauPhiPhiMoment);
+  SetBufferAddress("TauEtaPhiMoment"                                    ,mTauEtaPhiMoment, MAXTAU, &b_TauEtaPhiMoment);
+  SetBufferAddress("TauLeadPFChargedHadrCandsignedSipt"                 ,mTauLeadPFChargedHadrCandsignedSipt, MAXTAU, &b_TauLeadPFChargedHadrCandsignedSipt);
+  SetBufferAddress("TauIsoPFChargedHadrCandsPtSum"                      ,mTauIsoPFChargedHadrCandsPtSum, MAXTAU, &b_TauIsoPFChargedHadrCandsPtSum);
+  SetBufferAddress("TauIsoPFGammaCandsEtSum"                            ,mTauIsoPFGammaCandsEtSum, MAXTAU, &b_TauIsoPFGammaCandsEtSum);
+  SetBufferAddress("TauMaximumHCALPFClusterEt"                          ,mTauMaximumHCALPFClusterEt, MAXTAU, &b_TauMaximumHCALPFClusterEt);
+  SetBufferAddress("TauEmFraction"                                      ,mTauEmFraction, MAXTAU, &b_TauEmFraction);
+  SetBufferAddress("TauHcalTotOverPLead"                                ,mTauHcalTotOverPLead, MAXTAU, &b_TauHcalTotOverPLead);
+  SetBufferAddress("TauHcalMaxOverPLead"                                ,mTauHcalMaxOverPLead, MAXTAU, &b_TauHcalMaxOverPLead);
+  SetBufferAddress("TauHcal3x3OverPLead"                                ,mTauHcal3x3OverPLead, MAXTAU, &b_TauHcal3x3OverPLead);
+  SetBufferAddress("TauEcalStripSumEOverPLead"                          ,mTauEcalStripSumEOverPLead, MAXTAU, &b_TauEcalStripSumEOverPLead);
+  SetBufferAddress("TauBremsRecoveryEOverPLead"                         ,mTauBremsRecoveryEOverPLead, MAXTAU, &b_TauBremsRecoveryEOverPLead);
+  SetBufferAddress("TauElectronPreIDOutput"                             ,mTauElectronPreIDOutput, MAXTAU, &b_TauElectronPreIDOutput);
+  SetBufferAddress("TauElectronPreIDDecision"                           ,mTauElectronPreIDDecision, MAXTAU, &b_TauElectronPreIDDecision);
+  SetBufferAddress("TauCaloComp"                                        ,mTauCaloComp, MAXTAU, &b_TauCaloComp);
+  SetBufferAddress("TauSegComp"                                         ,mTauSegComp, MAXTAU, &b_TauSegComp);
+  SetBufferAddress("TauMuonDecision"                                    ,mTauMuonDecision, MAXTAU, &b_TauMuonDecision);
+  SetBufferAddress("TausignalPFChargedHadrCands"                        ,mTausignalPFChargedHadrCands, MAXTAU, &b_TausignalPFChargedHadrCands);
+  SetBufferAddress("TausignalPFGammaCands"                              ,mTausignalPFGammaCands, MAXTAU, &b_TausignalPFGammaCands);
+  SetBufferAddress("TauDisAgainstElectronDeadECAL"                      ,mTauDisAgainstElectronDeadECAL, MAXTAU, &b_TauDisAgainstElectronDeadECAL);
+  SetBufferAddress("TauDisAgainstElectronLoose"                         ,mTauDisAgainstElectronLoose, MAXTAU, &b_TauDisAgainstElectronLoose);
+  SetBufferAddress("TauDisAgainstElectronLooseMVA2"                     ,mTauDisAgainstElectronLooseMVA2, MAXTAU, &b_TauDisAgainstElectronLooseMVA2);
+  SetBufferAddress("TauDisAgainstElectronLooseMVA3"                     ,mTauDisAgainstElectronLooseMVA3, MAXTAU, &b_TauDisAgainstElectronLooseMVA3);
+  SetBufferAddress("TauDisAgainstElectronMVA2category"                  ,mTauDisAgainstElectronMVA2category, MAXTAU, &b_TauDisAgainstElectronMVA2category);
+  SetBufferAddress("TauDisAgainstElectronMVA2raw"                       ,mTauDisAgainstElectronMVA2raw, MAXTAU, &b_TauDisAgainstElectronMVA2raw);
+  SetBufferAddress("TauDisAgainstElectronMVA3category"                  ,mTauDisAgainstElectronMVA3category, MAXTAU, &b_TauDisAgainstElectronMVA3category);
+  SetBufferAddress("TauDisAgainstElectronMVA3raw"                       ,mTauDisAgainstElectronMVA3raw, MAXTAU, &b_TauDisAgainstElectronMVA3raw);
+  SetBufferAddress("TauDisAgainstElectronMVA"                           ,mTauDisAgainstElectronMVA, MAXTAU, &b_TauDisAgainstElectronMVA);
+  SetBufferAddress("TauDisAgainstElectronMedium"                        ,mTauDisAgainstElectronMedium, MAXTAU, &b_TauDisAgainstElectronMedium);
+  SetBufferAddress("TauDisAgainstElectronMediumMVA2"                    ,mTauDisAgainstElectronMediumMVA2, MAXTAU, &b_TauDisAgainstElectronMediumMVA2);
+  SetBufferAddress("TauDisAgainstElectronMediumMVA3"                    ,mTauDisAgainstElectronMediumMVA3, MAXTAU, &b_TauDisAgainstElectronMediumMVA3);
+  SetBufferAddress("TauDisAgainstElectronTight"                         ,mTauDisAgainstElectronTight, MAXTAU, &b_TauDisAgainstElectronTight);
+  SetBufferAddress("TauDisAgainstElectronTightMVA2"                     ,mTauDisAgainstElectronTightMVA2, MAXTAU, &b_TauDisAgainstElectronTightMVA2);
+  SetBufferAddress("TauDisAgainstElectronTightMVA3"                     ,mTauDisAgainstElectronTightMVA3, MAXTAU, &b_TauDisAgainstElectronTightMVA3);
+  SetBufferAddress("TauDisAgainstElectronVLooseMVA2"                    ,mTauDisAgainstElectronVLooseMVA2, MAXTAU, &b_TauDisAgainstElectronVLooseMVA2);
+  SetBufferAddress("TauDisAgainstElectronVTightMVA3"                    ,mTauDisAgainstElectronVTightMVA3, MAXTAU, &b_TauDisAgainstElectronVTightMVA3);
+  SetBufferAddress("TauDisAgainstMuonLoose2"                            ,mTauDisAgainstMuonLoose2, MAXTAU, &b_TauDisAgainstMuonLoose2);
+  SetBufferAddress("TauDisAgainstMuonLoose"                             ,mTauDisAgainstMuonLoose, MAXTAU, &b_TauDisAgainstMuonLoose);
+  SetBufferAddress("TauDisAgainstMuonMedium2"                           ,mTauDisAgainstMuonMedium2, MAXTAU, &b_TauDisAgainstMuonMedium2);
+  SetBufferAddress("TauDisAgainstMuonMedium"                            ,mTauDisAgainstMuonMedium, MAXTAU, &b_TauDisAgainstMuonMedium);
+  SetBufferAddress("TauDisAgainstMuonTight2"                            ,mTauDisAgainstMuonTight2, MAXTAU, &b_TauDisAgainstMuonTight2);
+  SetBufferAddress("TauDisAgainstMuonTight"                             ,mTauDisAgainstMuonTight, MAXTAU, &b_TauDisAgainstMuonTight);
+  SetBufferAddress("TauDisByCombinedIsolationDeltaBetaCorrRaw3Hits"     ,mTauDisByCombinedIsolationDeltaBetaCorrRaw3Hits, MAXTAU, &b_TauDisByCombinedIsolationDeltaBetaCorrRaw3Hits);
+  SetBufferAddress("TauDisByCombinedIsolationDeltaBetaCorrRaw"          ,mTauDisByCombinedIsolationDeltaBetaCorrRaw, MAXTAU, &b_TauDisByCombinedIsolationDeltaBetaCorrRaw);
+  SetBufferAddress("TauDisByIsolationMVA2raw"                           ,mTauDisByIsolationMVA2raw, MAXTAU, &b_TauDisByIsolationMVA2raw);
+  SetBufferAddress("TauDisByIsolationMVAraw"                            ,mTauDisByIsolationMVAraw, MAXTAU, &b_TauDisByIsolationMVAraw);
+  SetBufferAddress("TauDisByLooseCombinedIsolationDeltaBetaCorr3Hits"   ,mTauDisByLooseCombinedIsolationDeltaBetaCorr3Hits, MAXTAU, &b_TauDisByLooseCombinedIsolationDeltaBetaCorr3Hits);
+  SetBufferAddress("TauDisByLooseCombinedIsolationDeltaBetaCorr"        ,mTauDisByLooseCombinedIsolationDeltaBetaCorr, MAXTAU, &b_TauDisByLooseCombinedIsolationDeltaBetaCorr);
+  SetBufferAddress("TauDisByLooseIsolationMVA2"                         ,mTauDisByLooseIsolationMVA2, MAXTAU, &b_TauDisByLooseIsolationMVA2);
+  SetBufferAddress("TauDisByLooseIsolationMVA"                          ,mTauDisByLooseIsolationMVA, MAXTAU, &b_TauDisByLooseIsolationMVA);
+  SetBufferAddress("TauDisByMediumCombinedIsolationDeltaBetaCorr3Hits"  ,mTauDisByMediumCombinedIsolationDeltaBetaCorr3Hits, MAXTAU, &b_TauDisByMediumCombinedIsolationDeltaBetaCorr3Hits);
+  SetBufferAddress("TauDisByMediumCombinedIsolationDeltaBetaCorr"       ,mTauDisByMediumCombinedIsolationDeltaBetaCorr, MAXTAU, &b_TauDisByMediumCombinedIsolationDeltaBetaCorr);
+  SetBufferAddress("TauDisByMediumIsolationMVA2"                        ,mTauDisByMediumIsolationMVA2, MAXTAU, &b_TauDisByMediumIsolationMVA2);
+  SetBufferAddress("TauDisByMediumIsolationMVA"                         ,mTauDisByMediumIsolationMVA, MAXTAU, &b_TauDisByMediumIsolationMVA);
+  SetBufferAddress("TauDisByTightCombinedIsolationDeltaBetaCorr3Hits"   ,mTauDisByTightCombinedIsolationDeltaBetaCorr3Hits, MAXTAU, &b_TauDisByTightCombinedIsolationDeltaBetaCorr3Hits);
+  SetBufferAddress("TauDisByTightCombinedIsolationDeltaBetaCorr"        ,mTauDisByTightCombinedIsolationDeltaBetaCorr, MAXTAU, &b_TauDisByTightCombinedIsolationDeltaBetaCorr);
+  SetBufferAddress("TauDisByTightIsolationMVA2"                         ,mTauDisByTightIsolationMVA2, MAXTAU, &b_TauDisByTightIsolationMVA2);
+  SetBufferAddress("TauDisByTightIsolationMVA"                          ,mTauDisByTightIsolationMVA, MAXTAU, &b_TauDisByTightIsolationMVA);
+  SetBufferAddress("TauDisByVLooseCombinedIsolationDeltaBetaCorr"       ,mTauDisByVLooseCombinedIsolationDeltaBetaCorr, MAXTAU, &b_TauDisByVLooseCombinedIsolationDeltaBetaCorr);
+  SetBufferAddress("TauDisDecayModeFinding"                             ,mTauDisDecayModeFinding, MAXTAU, &b_TauDisDecayModeFinding);
+  SetBufferAddress("TauJetPt"                                           ,mTauJetPt, MAXTAU, &b_TauJetPt);
+  SetBufferAddress("TauJetEta"                                          ,mTauJetEta, MAXTAU, &b_TauJetEta);
+  SetBufferAddress("TauJetPhi"                                          ,mTauJetPhi, MAXTAU, &b_TauJetPhi);
 
   //PFTau
-  mDataTree->SetBranchAddress("NPFTau"                                             ,&mNPFTau);
-  mDataTree->SetBranchAddress("PFTauE"                                             ,mPFTauE);
-  mDataTree->SetBranchAddress("PFTauPt"                                            ,mPFTauPt);
-  mDataTree->SetBranchAddress("PFTauPx"                                            ,mPFTauPx);
-  mDataTree->SetBranchAddress("PFTauPy"                                            ,mPFTauPy);
-  mDataTree->SetBranchAddress("PFTauPz"                                            ,mPFTauPz);
-  mDataTree->SetBranchAddress("PFTauEta"                                           ,mPFTauEta);
-  mDataTree->SetBranchAddress("PFTauPhi"                                           ,mPFTauPhi);
-  mDataTree->SetBranchAddress("PFTauCharge"                                        ,mPFTauCharge);
-  mDataTree->SetBranchAddress("PFTauEtaEtaMoment"                                  ,mPFTauEtaEtaMoment);
-  mDataTree->SetBranchAddress("PFTauPhiPhiMoment"                                  ,mPFTauPhiPhiMoment);
-  mDataTree->SetBranchAddress("PFTauEtaPhiMoment"                                  ,mPFTauEtaPhiMoment);
-  mDataTree->SetBranchAddress("PFTauLeadPFChargedHadrCandsignedSipt"               ,mPFTauLeadPFChargedHadrCandsignedSipt);
-  mDataTree->SetBranchAddress("PFTauIsoPFChargedHadrCandsPtSum"                    ,mPFTauIsoPFChargedHadrCandsPtSum);
-  mDataTree->SetBranchAddress("PFTauIsoPFGammaCandsEtSum"                          ,mPFTauIsoPFGammaCandsEtSum);
-  mDataTree->SetBranchAddress("PFTauMaximumHCALPFClusterEt"                        ,mPFTauMaximumHCALPFClusterEt);
-  mDataTree->SetBranchAddress("PFTauEmFraction"                                    ,mPFTauEmFraction);
-  mDataTree->SetBranchAddress("PFTauHcalTotOverPLead"                              ,mPFTauHcalTotOverPLead);
-  mDataTree->SetBranchAddress("PFTauHcalMaxOverPLead"                              ,mPFTauHcalMaxOverPLead);
-  mDataTree->SetBranchAddress("PFTauHcal3x3OverPLead"                              ,mPFTauHcal3x3OverPLead);
-  mDataTree->SetBranchAddress("PFTauEcalStripSumEOverPLead"                        ,mPFTauEcalStripSumEOverPLead);
-  mDataTree->SetBranchAddress("PFTauBremsRecoveryEOverPLead"                       ,mPFTauBremsRecoveryEOverPLead);
-  mDataTree->SetBranchAddress("PFTauElectronPreIDOutput"                           ,mPFTauElectronPreIDOutput);
-  mDataTree->SetBranchAddress("PFTauElectronPreIDDecision"                         ,mPFTauElectronPreIDDecision);
-  mDataTree->SetBranchAddress("PFTauCaloComp"                                      ,mPFTauCaloComp);
-  mDataTree->SetBranchAddress("PFTauSegComp"                                       ,mPFTauSegComp);
-  mDataTree->SetBranchAddress("PFTauMuonDecision"                                  ,mPFTauMuonDecision);
-  mDataTree->SetBranchAddress("PFTausignalPFChargedHadrCands"                      ,mPFTausignalPFChargedHadrCands);
-  mDataTree->SetBranchAddress("PFTausignalPFGammaCands"                            ,mPFTausignalPFGammaCands);
-  mDataTree->SetBranchAddress("PFTauDisAgainstElectronDeadECAL"                    ,mPFTauDisAgainstElectronDeadECAL);
-  mDataTree->SetBranchAddress("PFTauDisAgainstElectronLoose"                       ,mPFTauDisAgainstElectronLoose);
-  mDataTree->SetBranchAddress("PFTauDisAgainstElectronLooseMVA2"                   ,mPFTauDisAgainstElectronLooseMVA2);
-  mDataTree->SetBranchAddress("PFTauDisAgainstElectronLooseMVA3"                   ,mPFTauDisAgainstElectronLooseMVA3);
-  mDataTree->SetBranchAddress("PFTauDisAgainstElectronMVA2category"                ,mPFTauDisAgainstElectronMVA2category);
-  mDataTree->SetBranchAddress("PFTauDisAgainstElectronMVA2raw"                     ,mPFTauDisAgainstElectronMVA2raw);
-  mDataTree->SetBranchAddress("PFTauDisAgainstElectronMVA3category"                ,mPFTauDisAgainstElectronMVA3category);
-  mDataTree->SetBranchAddress("PFTauDisAgainstElectronMVA3raw"                     ,mPFTauDisAgainstElectronMVA3raw);
-  mDataTree->SetBranchAddress("PFTauDisAgainstElectronMVA"                         ,mPFTauDisAgainstElectronMVA);
-  mDataTree->SetBranchAddress("PFTauDisAgainstElectronMedium"                      ,mPFTauDisAgainstElectronMedium);
-  mDataTree->SetBranchAddress("PFTauDisAgainstElectronMediumMVA2"                  ,mPFTauDisAgainstElectronMediumMVA2);
-  mDataTree->SetBranchAddress("PFTauDisAgainstElectronMediumMVA3"                  ,mPFTauDisAgainstElectronMediumMVA3);
-  mDataTree->SetBranchAddress("PFTauDisAgainstElectronTight"                       ,mPFTauDisAgainstElectronTight);
-  mDataTree->SetBranchAddress("PFTauDisAgainstElectronTightMVA2"                   ,mPFTauDisAgainstElectronTightMVA2);
-  mDataTree->SetBranchAddress("PFTauDisAgainstElectronTightMVA3"                   ,mPFTauDisAgainstElectronTightMVA3);
-  mDataTree->SetBranchAddress("PFTauDisAgainstElectronVLooseMVA2"                  ,mPFTauDisAgainstElectronVLooseMVA2);
-  mDataTree->SetBranchAddress("PFTauDisAgainstElectronVTightMVA3"                  ,mPFTauDisAgainstElectronVTightMVA3);
-  mDataTree->SetBranchAddress("PFTauDisAgainstMuonLoose2"                          ,mPFTauDisAgainstMuonLoose2);
-  mDataTree->SetBranchAddress("PFTauDisAgainstMuonLoose"                           ,mPFTauDisAgainstMuonLoose);
-  mDataTree->SetBranchAddress("PFTauDisAgainstMuonMedium2"                         ,mPFTauDisAgainstMuonMedium2);
-  mDataTree->SetBranchAddress("PFTauDisAgainstMuonMedium"                          ,mPFTauDisAgainstMuonMedium);
-  mDataTree->SetBranchAddress("PFTauDisAgainstMuonTight2"                          ,mPFTauDisAgainstMuonTight2);
-  mDataTree->SetBranchAddress("PFTauDisAgainstMuonTight"                           ,mPFTauDisAgainstMuonTight);
-  mDataTree->SetBranchAddress("PFTauDisByCombinedIsolationDeltaBetaCorrRaw3Hits"   ,mPFTauDisByCombinedIsolationDeltaBetaCorrRaw3Hits);
-  mDataTree->SetBranchAddress("PFTauDisByCombinedIsolationDeltaBetaCorrRaw"        ,mPFTauDisByCombinedIsolationDeltaBetaCorrRaw);
-  mDataTree->SetBranchAddress("PFTauDisByIsolationMVA2raw"                         ,mPFTauDisByIsolationMVA2raw);
-  mDataTree->SetBranchAddress("PFTauDisByIsolationMVAraw"                          ,mPFTauDisByIsolationMVAraw);
-  mDataTree->SetBranchAddress("PFTauDisByLooseCombinedIsolationDeltaBetaCorr3Hits" ,mPFTauDisByLooseCombinedIsolationDeltaBetaCorr3Hits);
-  mDataTree->SetBranchAddress("PFTauDisByLooseCombinedIsolationDeltaBetaCorr"      ,mPFTauDisByLooseCombinedIsolationDeltaBetaCorr);
-  mDataTree->SetBranchAddress("PFTauDisByLooseIsolationDeltaBetaCorr"              ,mPFTauDisByLooseIsolationDeltaBetaCorr);
-  mDataTree->SetBranchAddress("PFTauDisByLooseIsolation"                           ,mPFTauDisByLooseIsolation);
-  mDataTree->SetBranchAddress("PFTauDisByLooseIsolationMVA2"                       ,mPFTauDisByLooseIsolationMVA2);
-  mDataTree->SetBranchAddress("PFTauDisByLooseIsolationMVA"                        ,mPFTauDisByLooseIsolationMVA);
-  mDataTree->SetBranchAddress("PFTauDisByMediumCombinedIsolationDeltaBetaCorr3Hits",mPFTauDisByMediumCombinedIsolationDeltaBetaCorr3Hits);
-  mDataTree->SetBranchAddress("PFTauDisByMediumCombinedIsolationDeltaBetaCorr"     ,mPFTauDisByMediumCombinedIsolationDeltaBetaCorr);
-  mDataTree->SetBranchAddress("PFTauDisByMediumIsolationDeltaBetaCorr"             ,mPFTauDisByMediumIsolationDeltaBetaCorr);
-  mDataTree->SetBranchAddress("PFTauDisByMediumIsolation"                          ,mPFTauDisByMediumIsolation);
-  mDataTree->SetBranchAddress("PFTauDisByMediumIsolationMVA2"                      ,mPFTauDisByMediumIsolationMVA2);
-  mDataTree->SetBranchAddress("PFTauDisByMediumIsolationMVA"                       ,mPFTauDisByMediumIsolationMVA);
-  mDataTree->SetBranchAddress("PFTauDisByTightCombinedIsolationDeltaBetaCorr3Hits" ,mPFTauDisByTightCombinedIsolationDeltaBetaCorr3Hits);
-  mDataTree->SetBranchAddress("PFTauDisByTightCombinedIsolationDeltaBetaCorr"      ,mPFTauDisByTightCombinedIsolationDeltaBetaCorr);
-  mDataTree->SetBranchAddress("PFTauDisByTightIsolationDeltaBetaCorr"              ,mPFTauDisByTightIsolationDeltaBetaCorr);
-  mDataTree->SetBranchAddress("PFTauDisByTightIsolation"                           ,mPFTauDisByTightIsolation);
-  mDataTree->SetBranchAddress("PFTauDisByTightIsolationMVA2"                       ,mPFTauDisByTightIsolationMVA2);
-  mDataTree->SetBranchAddress("PFTauDisByTightIsolationMVA"                        ,mPFTauDisByTightIsolationMVA);
-  mDataTree->SetBranchAddress("PFTauDisByVLooseCombinedIsolationDeltaBetaCorr"     ,mPFTauDisByVLooseCombinedIsolationDeltaBetaCorr);
-  mDataTree->SetBranchAddress("PFTauDisByVLooseIsolationDeltaBetaCorr"             ,mPFTauDisByVLooseIsolationDeltaBetaCorr);
-  mDataTree->SetBranchAddress("PFTauDisByVLooseIsolation"                          ,mPFTauDisByVLooseIsolation);
-  mDataTree->SetBranchAddress("PFTauDisDecayModeFinding"                           ,mPFTauDisDecayModeFinding);
-  mDataTree->SetBranchAddress("PFTauJetPt"                                         ,mPFTauJetPt);
-  mDataTree->SetBranchAddress("PFTauJetEta"                                        ,mPFTauJetEta);
-  mDataTree->SetBranchAddress("PFTauJetPhi"                                        ,mPFTauJetPhi);
+  BranchAddress("NPFTau"                                             ,&mNPFTau, &b_NPFTau);
+  SetBufferAddress("PFTauE"                                             ,mPFTauE, MAXTAU, &b_PFTauE);
+  SetBufferAddress("PFTauPt"                                            ,mPFTauPt, MAXTAU, &b_PFTauPt);
+  SetBufferAddress("PFTauPx"                                            ,mPFTauPx, MAXTAU, &b_PFTauPx);
+  SetBufferAddress("PFTauPy"                                            ,mPFTauPy, MAXTAU, &b_PFTauPy);
+  SetBufferAddress("PFTauPz"                                            ,mPFTauPz, MAXTAU, &b_PFTauPz);
+  SetBufferAddress("PFTauEta"                                           ,mPFTauEta, MAXTAU, &b_PFTauEta);
+  SetBufferAddress("PFTauPhi"                                           ,mPFTauPhi, MAXTAU, &b_PFTauPhi);
+  SetBufferAddress("PFTauCharge"                                        ,mPFTauCharge, MAXTAU, &b_PFTauCharge);
+  SetBufferAddress("PFTauEtaEtaMoment"                                  ,mPFTauEtaEtaMoment, MAXTAU, &b_PFTauEtaEtaMoment);
+  SetBufferAddress("PFTauPhiPhiMoment"                                  ,mPFTauPhiPhiMoment, MAXTAU, &b_PFTauPhiPhiMoment);
+  SetBufferAddress("PFTauEtaPhiMoment"                                  ,mPFTauEtaPhiMoment, MAXTAU, &b_PFTauEtaPhiMoment);
+  SetBufferAddress("PFTauLeadPFChargedHadrCandsignedSipt"               ,mPFTauLeadPFChargedHadrCandsignedSipt, MAXTAU, &b_PFTauLeadPFChargedHadrCandsignedSipt);
+  SetBufferAddress("PFTauIsoPFChargedHadrCandsPtSum"                    ,mPFTauIsoPFChargedHadrCandsPtSum, MAXTAU, &b_PFTauIsoPFChargedHadrCandsPtSum);
+  SetBufferAddress("PFTauIsoPFGammaCandsEtSum"                          ,mPFTauIsoPFGammaCandsEtSum, MAXTAU, &b_PFTauIsoPFGammaCandsEtSum);
+  SetBufferAddress("PFTauMaximumHCALPFClusterEt"                        ,mPFTauMaximumHCALPFClusterEt, MAXTAU, &b_PFTauMaximumHCALPFClusterEt);
+  SetBufferAddress("PFTauEmFraction"                                    ,mPFTauEmFraction, MAXTAU, &b_PFTauEmFraction);
+  SetBufferAddress("PFTauHcalTotOverPLead"                              ,mPFTauHcalTotOverPLead, MAXTAU, &b_PFTauHcalTotOverPLead);
+  SetBufferAddress("PFTauHcalMaxOverPLead"                              ,mPFTauHcalMaxOverPLead, MAXTAU, &b_PFTauHcalMaxOverPLead);
+  SetBufferAddress("PFTauHcal3x3OverPLead"                              ,mPFTauHcal3x3OverPLead, MAXTAU, &b_PFTauHcal3x3OverPLead);
+  SetBufferAddress("PFTauEcalStripSumEOverPLead"                        ,mPFTauEcalStripSumEOverPLead, MAXTAU, &b_PFTauEcalStripSumEOverPLead);
+  SetBufferAddress("PFTauBremsRecoveryEOverPLead"                       ,mPFTauBremsRecoveryEOverPLead, MAXTAU, &b_PFTauBremsRecoveryEOverPLead);
+  SetBufferAddress("PFTauElectronPreIDOutput"                           ,mPFTauElectronPreIDOutput, MAXTAU, &b_PFTauElectronPreIDOutput);
+  SetBufferAddress("PFTauElectronPreIDDecision"                         ,mPFTauElectronPreIDDecision, MAXTAU, &b_PFTauElectronPreIDDecision);
+  SetBufferAddress("PFTauCaloComp"                                      ,mPFTauCaloComp, MAXTAU, &b_PFTauCaloComp);
+  SetBufferAddress("PFTauSegComp"                                       ,mPFTauSegComp, MAXTAU, &b_PFTauSegComp);
+  SetBufferAddress("PFTauMuonDecision"                                  ,mPFTauMuonDecision, MAXTAU, &b_PFTauMuonDecision);
+  SetBufferAddress("PFTausignalPFChargedHadrCands"                      ,mPFTausignalPFChargedHadrCands, MAXTAU, &b_PFTausignalPFChargedHadrCands);
+  SetBufferAddress("PFTausignalPFGammaCands"                            ,mPFTausignalPFGammaCands, MAXTAU, &b_PFTausignalPFGammaCands);
+  SetBufferAddress("PFTauDisAgainstElectronDeadECAL"                    ,mPFTauDisAgainstElectronDeadECAL, MAXTAU, &b_PFTauDisAgainstElectronDeadECAL);
+  SetBufferAddress("PFTauDisAgainstElectronLoose"                       ,mPFTauDisAgainstElectronLoose, MAXTAU, &b_PFTauDisAgainstElectronLoose);
+  SetBufferAddress("PFTauDisAgainstElectronLooseMVA2"                   ,mPFTauDisAgainstElectronLooseMVA2, MAXTAU, &b_PFTauDisAgainstElectronLooseMVA2);
+  SetBufferAddress("PFTauDisAgainstElectronLooseMVA3"                   ,mPFTauDisAgainstElectronLooseMVA3, MAXTAU, &b_PFTauDisAgainstElectronLooseMVA3);
+  SetBufferAddress("PFTauDisAgainstElectronMVA2category"                ,mPFTauDisAgainstElectronMVA2category, MAXTAU, &b_PFTauDisAgainstElectronMVA2category);
+  SetBufferAddress("PFTauDisAgainstElectronMVA2raw"                     ,mPFTauDisAgainstElectronMVA2raw, MAXTAU, &b_PFTauDisAgainstElectronMVA2raw);
+  SetBufferAddress("PFTauDisAgainstElectronMVA3category"                ,mPFTauDisAgainstElectronMVA3category, MAXTAU, &b_PFTauDisAgainstElectronMVA3category);
+  SetBufferAddress("PFTauDisAgainstElectronMVA3raw"                     ,mPFTauDisAgainstElectronMVA3raw, MAXTAU, &b_PFTauDisAgainstElectronMVA3raw);
+  SetBufferAddress("PFTauDisAgainstElectronMVA"                         ,mPFTauDisAgainstElectronMVA, MAXTAU, &b_PFTauDisAgainstElectronMVA);
+  SetBufferAddress("PFTauDisAgainstElectronMedium"                      ,mPFTauDisAgainstElectronMedium, MAXTAU, &b_PFTauDisAgainstElectronMedium);
+  SetBufferAddress("PFTauDisAgainstElectronMediumMVA2"                  ,mPFTauDisAgainstElectronMediumMVA2, MAXTAU, &b_PFTauDisAgainstElectronMediumMVA2);
+  SetBufferAddress("PFTauDisAgainstElectronMediumMVA3"                  ,mPFTauDisAgainstElectronMediumMVA3, MAXTAU, &b_PFTauDisAgainstElectronMediumMVA3);
+  SetBufferAddress("PFTauDisAgainstElectronTight"                       ,mPFTauDisAgainstElectronTight, MAXTAU, &b_PFTauDisAgainstElectronTight);
+  SetBufferAddress("PFTauDisAgainstElectronTightMVA2"                   ,mPFTauDisAgainstElectronTightMVA2, MAXTAU, &b_PFTauDisAgainstElectronTightMVA2);
+  SetBufferAddress("PFTauDisAgainstElectronTightMVA3"                   ,mPFTauDisAgainstElectronTightMVA3, MAXTAU, &b_PFTauDisAgainstElectronTightMVA3);
+  SetBufferAddress("PFTauDisAgainstElectronVLooseMVA2"                  ,mPFTauDisAgainstElectronVLooseMVA2, MAXTAU, &b_PFTauDisAgainstElectronVLooseMVA2);
+  SetBufferAddress("PFTauDisAgainstElectronVTightMVA3"                  ,mPFTauDisAgainstElectronVTightMVA3, MAXTAU, &b_PFTauDisAgainstElectronVTightMVA3);
+  SetBufferAddress("PFTauDisAgainstMuonLoose2"                          ,mPFTauDisAgainstMuonLoose2, MAXTAU, &b_PFTauDisAgainstMuonLoose2);
+  SetBufferAddress("PFTauDisAgainstMuonLoose"                           ,mPFTauDisAgainstMuonLoose, MAXTAU, &b_PFTauDisAgainstMuonLoose);
+  SetBufferAddress("PFTauDisAgainstMuonMedium2"                         ,mPFTauDisAgainstMuonMedium2, MAXTAU, &b_PFTauDisAgainstMuonMedium2);
+  SetBufferAddress("PFTauDisAgainstMuonMedium"                          ,mPFTauDisAgainstMuonMedium, MAXTAU, &b_PFTauDisAgainstMuonMedium);
+  SetBufferAddress("PFTauDisAgainstMuonTight2"                          ,mPFTauDisAgainstMuonTight2, MAXTAU, &b_PFTauDisAgainstMuonTight2);
+  SetBufferAddress("PFTauDisAgainstMuonTight"                           ,mPFTauDisAgainstMuonTight, MAXTAU, &b_PFTauDisAgainstMuonTight);
+  SetBufferAddress("PFTauDisByCombinedIsolationDeltaBetaCorrRaw3Hits"   ,mPFTauDisByCombinedIsolationDeltaBetaCorrRaw3Hits, MAXTAU, &b_PFTauDisByCombinedIsolationDeltaBetaCorrRaw3Hits);
+  SetBufferAddress("PFTauDisByCombinedIsolationDeltaBetaCorrRaw"        ,mPFTauDisByCombinedIsolationDeltaBetaCorrRaw, MAXTAU, &b_PFTauDisByCombinedIsolationDeltaBetaCorrRaw);
+  SetBufferAddress("PFTauDisByIsolationMVA2raw"                         ,mPFTauDisByIsolationMVA2raw, MAXTAU, &b_PFTauDisByIsolationMVA2raw);
+  SetBufferAddress("PFTauDisByIsolationMVAraw"                          ,mPFTauDisByIsolationMVAraw, MAXTAU, &b_PFTauDisByIsolationMVAraw);
+  SetBufferAddress("PFTauDisByLooseCombinedIsolationDeltaBetaCorr3Hits" ,mPFTauDisByLooseCombinedIsolationDeltaBetaCorr3Hits, MAXTAU, &b_PFTauDisByLooseCombinedIsolationDeltaBetaCorr3Hits);
+  SetBufferAddress("PFTauDisByLooseCombinedIsolationDeltaBetaCorr"      ,mPFTauDisByLooseCombinedIsolationDeltaBetaCorr, MAXTAU, &b_PFTauDisByLooseCombinedIsolationDeltaBetaCorr);
+  SetBufferAddress("PFTauDisByLooseIsolationDeltaBetaCorr"              ,mPFTauDisByLooseIsolationDeltaBetaCorr, MAXTAU, &b_PFTauDisByLooseIsolationDeltaBetaCorr);
+  SetBufferAddress("PFTauDisByLooseIsolation"                           ,mPFTauDisByLooseIsolation, MAXTAU, &b_PFTauDisByLooseIsolation);
+  SetBufferAddress("PFTauDisByLooseIsolationMVA2"                       ,mPFTauDisByLooseIsolationMVA2, MAXTAU, &b_PFTauDisByLooseIsolationMVA2);
+  SetBufferAddress("PFTauDisByLooseIsolationMVA"                        ,mPFTauDisByLooseIsolationMVA, MAXTAU, &b_PFTauDisByLooseIsolationMVA);
+  SetBufferAddress("PFTauDisByMediumCombinedIsolationDeltaBetaCorr3Hits",mPFTauDisByMediumCombinedIsolationDeltaBetaCorr3Hits, MAXTAU, &b_PFTauDisByMediumCombinedIsolationDeltaBetaCorr3Hits);
+  SetBufferAddress("PFTauDisByMediumCombinedIsolationDeltaBetaCorr"     ,mPFTauDisByMediumCombinedIsolationDeltaBetaCorr, MAXTAU, &b_PFTauDisByMediumCombinedIsolationDeltaBetaCorr);
+  SetBufferAddress("PFTauDisByMediumIsolationDeltaBetaCorr"             ,mPFTauDisByMediumIsolationDeltaBetaCorr, MAXTAU, &b_PFTauDisByMediumIsolationDeltaBetaCorr);
+  SetBufferAddress("PFTauDisByMediumIsolation"                          ,mPFTauDisByMediumIsolation, MAXTAU, &b_PFTauDisByMediumIsolation);
+  SetBufferAddress("PFTauDisByMediumIsolationMVA2"                      ,mPFTauDisByMediumIsolationMVA2, MAXTAU, &b_PFTauDisByMediumIsolationMVA2);
+  SetBufferAddress("PFTauDisByMediumIsolationMVA"                       ,mPFTauDisByMediumIsolationMVA, MAXTAU, &b_PFTauDisByMediumIsolationMVA);
+  SetBufferAddress("PFTauDisByTightCombinedIsolationDeltaBetaCorr3Hits" ,mPFTauDisByTightCombinedIsolationDeltaBetaCorr3Hits, MAXTAU, &b_PFTauDisByTightCombinedIsolationDeltaBetaCorr3Hits);
+  SetBufferAddress("PFTauDisByTightCombinedIsolationDeltaBetaCorr"      ,mPFTauDisByTightCombinedIsolationDeltaBetaCorr, MAXTAU, &b_PFTauDisByTightCombinedIsolationDeltaBetaCorr);
+  SetBufferAddress("PFTauDisByTightIsolationDeltaBetaCorr"              ,mPFTauDisByTightIsolationDeltaBetaCorr, MAXTAU, &b_PFTauDisByTightIsolationDeltaBetaCorr);
+  SetBufferAddress("PFTauDisByTightIsolation"                           ,mPFTauDisByTightIsolation, MAXTAU, &b_PFTauDisByTightIsolation);
+  SetBufferAddress("PFTauDisByTightIsolationMVA2"                       ,mPFTauDisByTightIsolationMVA2, MAXTAU, &b_PFTauDisByTightIsolationMVA2);
+  SetBufferAddress("PFTauDisByTightIsolationMVA"                        ,mPFTauDisByTightIsolationMVA, MAXTAU, &b_PFTauDisByTightIsolationMVA);
+  SetBufferAddress("PFTauDisByVLooseCombinedIsolationDeltaBetaCorr"     ,mPFTauDisByVLooseCombinedIsolationDeltaBetaCorr, MAXTAU, &b_PFTauDisByVLooseCombinedIsolationDeltaBetaCorr);
+  SetBufferAddress("PFTauDisByVLooseIsolationDeltaBetaCorr"             ,mPFTauDisByVLooseIsolationDeltaBetaCorr, MAXTAU, &b_PFTauDisByVLooseIsolationDeltaBetaCorr);
+  SetBufferAddress("PFTauDisByVLooseIsolation"                          ,mPFTauDisByVLooseIsolation, MAXTAU, &b_PFTauDisByVLooseIsolation);
+  SetBufferAddress("PFTauDisDecayModeFinding"                           ,mPFTauDisDecayModeFinding, MAXTAU, &b_PFTauDisDecayModeFinding);
+  SetBufferAddress("PFTauJetPt"                                         ,mPFTauJetPt, MAXTAU, &b_PFTauJetPt);
+  SetBufferAddress("PFTauJetEta"                                        ,mPFTauJetEta, MAXTAU, &b_PFTauJetEta);
+  SetBufferAddress("PFTauJetPhi"                                        ,mPFTauJetPhi, MAXTAU, &b_PFTauJetPhi);
   
   //Gen-daughter of W
-  mDataTree->SetBranchAddress("WTauDecayMode"                         ,&mWTauDecayMode            );
-  mDataTree->SetBranchAddress("WTauN"                                 ,&mWTauN                    );
-  mDataTree->SetBranchAddress("WTauDecayId"                           ,mWTauDecayId               );
-  mDataTree->SetBranchAddress("WTauDecayPt"                           ,mWTauDecayPt               );
-  mDataTree->SetBranchAddress("WTauDecayEta"                          ,mWTauDecayEta              );
-  mDataTree->SetBranchAddress("WTauDecayPhi"                          ,mWTauDecayPhi              ); 
-  mDataTree->SetBranchAddress("WTauDecayMass"                         ,mWTauDecayMass             );
+  BranchAddress("WTauDecayMode"                         ,&mWTauDecayMode            , &b_WTauDecayMode);
+  BranchAddress("WTauN"                                 ,&mWTauN                    , &b_WTauN);
+  SetBufferAddress("WTauDecayId"                           ,mWTauDecayId               , MAXGENTAU, &b_WTauDecayId);
+  SetBufferAddress("WTauDecayPt"                           ,mWTauDecayPt               , MAXGENTAU, &b_WTauDecayPt);
+  SetBufferAddress("WTauDecayEta"                          ,mWTauDecayEta              , MAXGENTAU, &b_WTauDecayEta);
+  SetBufferAddress("WTauDecayPhi"                          ,mWTauDecayPhi              , MAXGENTAU, &b_WTauDecayPhi); 
+  SetBufferAddress("WTauDecayMass"                         ,mWTauDecayMass             , MAXGENTAU, &b_WTauDecayMass);
 
   //Photons
-  mDataTree->SetBranchAddress("NPhot"                                 ,&mNPhot                    ); 
-  mDataTree->SetBranchAddress("PhotE"                                 ,mPhotE                     ); 
-  mDataTree->SetBranchAddress("PhotPt"                                ,mPhotPt                    ); 
-  mDataTree->SetBranchAddress("PhotPx"                                ,mPhotPx                    ); 
-  mDataTree->SetBranchAddress("PhotPy"                                ,mPhotPy                    ); 
-  mDataTree->SetBranchAddress("PhotPz"                                ,mPhotPz                    ); 
-  mDataTree->SetBranchAddress("PhotEta"                               ,mPhotEta                   ); 
-  mDataTree->SetBranchAddress("PhotPhi"                               ,mPhotPhi                   );   
-  mDataTree->SetBranchAddress("PhotE1x5"                              ,mPhotE1x5                  ); 
-  mDataTree->SetBranchAddress("PhotE2x5"                              ,mPhotE2x5                  ); 
-  mDataTree->SetBranchAddress("PhotE5x5"                              ,mPhotE5x5                  ); 
-  mDataTree->SetBranchAddress("PhotSigEta"                            ,mPhotSigEta                ); 
-  mDataTree->SetBranchAddress("PhotSigPhi"                            ,mPhotSigPhi                ); 
-  mDataTree->SetBranchAddress("PhotEcalIso04"                         ,mPhotEcalIso04             ); 
-  mDataTree->SetBranchAddress("PhotHcalIso04"                         ,mPhotHcalIso04             ); 
-  mDataTree->SetBranchAddress("PhotTrackIso04"                        ,mPhotTrackIso04            ); 
-  mDataTree->SetBranchAddress("PhotHasPixSeed"                        ,mPhotHasPixSeed            ); 
-  mDataTree->SetBranchAddress("PhotIsPhot"                            ,mPhotIsPhot                ); 
+  BranchAddress("NPhot"                                 ,&mNPhot                    , &b_NPhot); 
+  SetBufferAddress("PhotE"                                 ,mPhotE                     , MAXPHOT, &b_PhotE); 
+  SetBufferAddress("PhotPt"                                ,mPhotPt                    , MAXPHOT, &b_PhotPt); 
+  SetBufferAddress("PhotPx"                                ,mPhotPx                    , MAXPHOT, &b_PhotPx); 
+  SetBufferAddress("PhotPy"                                ,mPhotPy                    , MAXPHOT, &b_PhotPy); 
+  SetBufferAddress("PhotPz"                                ,mPhotPz                    , MAXPHOT, &b_PhotPz); 
+  SetBufferAddress("PhotEta"                               ,mPhotEta                   , MAXPHOT, &b_PhotEta); 
+  SetBufferAddress("PhotPhi"                               ,mPhotPhi                   , MAXPHOT, &b_PhotPhi);   
+  SetBufferAddress("PhotE1x5"                              ,mPhotE1x5                  , MAXPHOT, &b_PhotE1x5); 
+  SetBufferAddress("PhotE2x5"                              ,mPhotE2x5                  , MAXPHOT, &b_PhotE2x5); 
+  SetBufferAddress("PhotE5x5"                              ,mPhotE5x5                  , MAXPHOT, &b_PhotE5x5); 
+  SetBufferAddress("PhotSigEta"                            ,mPhotSigEta                , MAXPHOT, &b_PhotSigEta); 
+  SetBufferAddress("PhotSigPhi"                            ,mPhotSigPhi                , MAXPHOT, &b_PhotSigPhi); 
+  SetBufferAddress("PhotEcalIso04"                         ,mPhotEcalIso04             , MAXPHOT, &b_PhotEcalIso04); 
+  SetBufferAddress("PhotHcalIso04"                         ,mPhotHcalIso04             , MAXPHOT, &b_PhotHcalIso04); 
+  SetBufferAddress("PhotTrackIso04"                        ,mPhotTrackIso04            , MAXPHOT, &b_PhotTrackIso04); 
+  SetBufferAddress("PhotHasPixSeed"                        ,mPhotHasPixSeed            , MAXPHOT, &b_PhotHasPixSeed); 
+  SetBufferAddress("PhotIsPhot"                            ,mPhotIsPhot                , MAXPHOT, &b_PhotIsPhot); 
   
   //NPV
-  mDataTree->SetBranchAddress("NPV"                                   ,&mNPV                      ); 
-  mDataTree->SetBranchAddress("PVx"                                   ,mPVx                       ); 
-  mDataTree->SetBranchAddress("PVy"                                   ,mPVy                       ); 
-  mDataTree->SetBranchAddress("PVz"                                   ,mPVz                       ); 
-  mDataTree->SetBranchAddress("PVchi2"                                ,mPVchi2                    ); 
-  mDataTree->SetBranchAddress("PVndof"                                ,mPVndof                    ); 
-  mDataTree->SetBranchAddress("PVntracks"                             ,mPVntracks                 ); 
+  BranchAddress("NPV"                                   ,&mNPV                      , &b_NPV); 
+  BranchAddress("PVx"                                   ,mPVx                       , &b_PVx); 
+  BranchAddress("PVy"                                   ,mPVy                       , &b_PVy); 
+  BranchAddress("PVz"                                   ,mPVz                       , &b_PVz); 
+  BranchAddress("PVchi2"                                ,mPVchi2                    , &b_PVchi2); 
+  BranchAddress("PVndof"                                ,mPVndof                    , &b_PVndof); 
+  BranchAddress("PVntracks"                             ,mPVntracks                 , &b_PVntracks); 
 	
   //HLT
-  mDataTree->SetBranchAddress("nHLT"                                  ,&mnHLT                     ); 
-  mDataTree->SetBranchAddress("HLTArray"                              ,mHLTArray                  ); 
-  mDataTree->SetBranchAddress("HLTArray2"                             ,mHLTArray2                 ); 
-  mDataTree->SetBranchAddress("HLTNames"                              ,mHLTNames                  ); 
-  mDataTree->SetBranchAddress("HLTPreScale2"                          ,mHLTPreScale2              ); 
+  BranchAddress("nHLT"                                  ,&mnHLT                     , &b_nHLT); 
+  BranchAddress("HLTArray"                              ,mHLTArray                  , &b_HLTArray); 
+  BranchAddress("HLTArray2"                             ,mHLTArray2                 , &b_HLTArray2); 
+  BranchAddress("HLTNames"                              ,mHLTNames                  , &b_HLTNames); 
+  BranchAddress("HLTPreScale2"                          ,mHLTPreScale2              , &b_HLTPreScale2); 
 	
   //L1
-  mDataTree->SetBranchAddress("nL1"                                   ,&mnL1                      ); 
-  mDataTree->SetBranchAddress("L1Array"                               ,mL1Array                   ); 
-  mDataTree->SetBranchAddress("nL1T"                                  ,&mnL1T                     ); 
-  mDataTree->SetBranchAddress("L1TArray"                              ,mL1TArray                  ); 
+  BranchAddress("nL1"                                   ,&mnL1                      , &b_nL1); 
+  BranchAddress("L1Array"                               ,mL1Array                   , &b_L1Array); 
+  BranchAddress("nL1T"                                  ,&mnL1T                     , &b_nL1T); 
+  BranchAddress("L1TArray"                              ,mL1TArray                  , &b_L1TArray); 
 	
   //BeamHalo
-  mDataTree->SetBranchAddress("BeamHaloTight"                         ,&mBeamHaloTight            ); 
-  mDataTree->SetBranchAddress("BeamHaloLoose"                         ,&mBeamHaloLoose            ); 
+  BranchAddress("BeamHaloTight"                         ,&mBeamHaloTight            , &b_BeamHaloTight); 
+  BranchAddress("BeamHaloLoose"                         ,&mBeamHaloLoose            , &b_BeamHaloLoose); 
 	
   //TIV
-  mDataTree->SetBranchAddress("TIV_N"                                 ,&mTIV_N                     ); 
-  mDataTree->SetBranchAddress("TIV"                                   ,mTIV                       ); 
-  mDataTree->SetBranchAddress("TIV_pt"                                ,mTIV_pt                    ); 
-  mDataTree->SetBranchAddress("TIV_px"                                ,mTIV_px                    ); 
-  mDataTree->SetBranchAddress("TIV_py"                                ,mTIV_py                    ); 
-  mDataTree->SetBranchAddress("TIV_pz"                                ,mTIV_pz                    ); 
-  mDataTree->SetBranchAddress("TIV_phi"                               ,mTIV_phi                   ); 
-  mDataTree->SetBranchAddress("TIV_eta"                               ,mTIV_eta                   ); 
-  mDataTree->SetBranchAddress("TIV_dsz"                               ,mTIV_dsz                   ); 
-  mDataTree->SetBranchAddress("TIV_dxy"                               ,mTIV_dxy                   ); 
-  mDataTree->SetBranchAddress("TIV_d0"                                ,mTIV_d0                    ); 
-  mDataTree->SetBranchAddress("TIV_dz"                                ,mTIV_dz                    ); 
-  mDataTree->SetBranchAddress("TIV_dsz_corr"                          ,mTIV_dsz_corr              ); 
-  mDataTree->SetBranchAddress("TIV_dxy_corr"                          ,mTIV_dxy_corr              ); 
-  mDataTree->SetBranchAddress("TIV_d0_corr"                           ,mTIV_d0_corr               ); 
-  mDataTree->SetBranchAddress("TIV_dz_corr"                           ,mTIV_dz_corr               ); 
-  mDataTree->SetBranchAddress("TIV_dR"                                ,mTIV_dR                    ); 
-  mDataTree->SetBranchAddress("TIV_lead"                              ,mTIV_lead                  ); 
-  mDataTree->SetBranchAddress("LowTIV"                                ,&mLowTIV                   ); 
+  BranchAddress("TIV_N"                                 ,&mTIV_N                     , &b_TIV_N); 
+  SetBufferAddress("TIV"                                   ,mTIV                       , TIVMAX, &b_TIV); 
+  SetBufferAddress("TIV_pt"                                ,mTIV_pt                    , TIVMAX, &b_TIV_pt); 
+  SetBufferAddress("TIV_px"                                ,mTIV_px                    , TIVMAX, &b_TIV_px); 
+  SetBufferAddress("TIV_py"                                ,mTIV_py                    , TIVMAX, &b_TIV_py); 
+  SetBufferAddress("TIV_pz"                                ,mTIV_pz                    , TIVMAX, &b_TIV_pz); 
+  SetBufferAddress("TIV_phi"                               ,mTIV_phi                   , TIVMAX, &b_TIV_phi); 
+  SetBufferAddress("TIV_eta"                               ,mTIV_eta                   , TIVMAX, &b_TIV_eta); 
+  SetBufferAddress("TIV_dsz"                               ,mTIV_dsz                   , TIVMAX, &b_TIV_dsz); 
+  SetBufferAddress("TIV_dxy"                               ,mTIV_dxy                   , TIVMAX, &b_TIV_dxy); 
+  SetBufferAddress("TIV_d0"                                ,mTIV_d0                    , TIVMAX, &b_TIV_d0); 
+  SetBufferAddress("TIV_dz"                                ,mTIV_dz                    , TIVMAX, &b_TIV_dz); 
+  SetBufferAddress("TIV_dsz_corr"                          ,mTIV_dsz_corr              , TIVMAX, &b_TIV_dsz_corr); 
+  SetBufferAddress("TIV_dxy_corr"                          ,mTIV_dxy_corr              , TIVMAX, &b_TIV_dxy_corr); 
+  SetBufferAddress("TIV_d0_corr"                           ,mTIV_d0_corr               , TIVMAX, &b_TIV_d0_corr); 
+  SetBufferAddress("TIV_dz_corr"                           ,mTIV_dz_corr               , TIVMAX, &b_TIV_dz_corr); 
+  SetBufferAddress("TIV_dR"                                ,mTIV_dR                    , TIVMAX, &b_TIV_dR); 
+  SetBufferAddress("TIV_lead"                              ,mTIV_lead                  , TIVMAX, &b_TIV_lead); 
+  BranchAddress("LowTIV"                                ,&mLowTIV                   , &b_LowTIV); 
 	
   //GenPar
-  mDataTree->SetBranchAddress("NGenPar"                               ,&mNGenPar                  );
-  mDataTree->SetBranchAddress("GenParId"                              ,mGenParId                  );
-  mDataTree->SetBranchAddress("GenParStatus"                          ,mGenParStatus              );
-  mDataTree->SetBranchAddress("GenParE"                               ,mGenParE                   );
-  mDataTree->SetBranchAddress("GenParPx"                              ,mGenParPx                  );
-  mDataTree->SetBranchAddress("GenParPy"                              ,mGenParPy                  );
-  mDataTree->SetBranchAddress("GenParPz"                              ,mGenParPz                  );
-  mDataTree->SetBranchAddress("GenParEta"                             ,mGenParEta                 );
-  mDataTree->SetBranchAddress("GenParPhi"                             ,mGenParPhi                 );
-  mDataTree->SetBranchAddress("GenParCharge"                          ,mGenParCharge              );
-  mDataTree->SetBranchAddress("GenParPt"                              ,mGenParPt                  );
-  mDataTree->SetBranchAddress("GenParMass"                            ,mGenParMass                );
-  mDataTree->SetBranchAddress("GenParMother1"                         ,mGenParMother1             );
-  mDataTree->SetBranchAddress("GenParMother2"                         ,mGenParMother2             );
-  mDataTree->SetBranchAddress("GenParDoughterOf"                      ,mGenParDoughterOf          );
+  BranchAddress("NGenPar"                               ,&mNGenPar                  , &b_NGenPar);
+  SetBufferAddress("GenParId"                              ,mGenParId                  , MAXGENPAR, &b_GenParId);
+  SetBufferAddress("GenParStatus"                          ,mGenParStatus              , MAXGENPAR, &b_GenParStatus);
+  SetBufferAddress("GenParE"                               ,mGenParE                   , MAXGENPAR, &b_GenParE);
+  SetBufferAddress("GenParPx"                              ,mGenParPx                  , MAXGENPAR, &b_GenParPx);
+  SetBufferAddress("GenParPy"                              ,mGenParPy                  , MAXGENPAR, &b_GenParPy);
+  SetBufferAddress("GenParPz"                              ,mGenParPz                  , MAXGENPAR, &b_GenParPz);
+  SetBufferAddress("GenParEta"                             ,mGenParEta                 , MAXGENPAR, &b_GenParEta);
+  SetBufferAddress("GenParPhi"                             ,mGenParPhi                 , MAXGENPAR, &b_GenParPhi);
+  SetBufferAddress("GenParCharge"                          ,mGenParCharge              , MAXGENPAR, &b_GenParCharge);
+  SetBufferAddress("GenParPt"                              ,mGenParPt                  , MAXGENPAR, &b_GenParPt);
+  SetBufferAddress("GenParMass"                            ,mGenParMass                , MAXGENPAR, &b_GenParMass);
+  SetBufferAddress("GenParMother1"                         ,mGenParMother1             , MAXGENPAR, &b_GenParMother1);
+  SetBufferAddress("GenParMother2"                         ,mGenParMother2             , MAXGENPAR, &b_GenParMother2);
+  SetBufferAddress("GenParDoughterOf"                      ,mGenParDoughterOf          , MAXGENPAR, &b_GenParDoughterOf);
 
   //GenJet
-  mDataTree->SetBranchAddress(  "GenAK4JetE"                          ,mGenAK4JetE                );
-  mDataTree->SetBranchAddress(  "GenAK4JetPt"                         ,mGenAK4JetPt               );
-  mDataTree->SetBranchAddress(  "GenAK4JetPx"                         ,mGenAK4JetPx               );
-  mDataTree->SetBranchAddress(  "GenAK4JetPy"                         ,mGenAK4JetPy               );
-  mDataTree->SetBranchAddress(  "GenAK4JetPz"                         ,mGenAK4JetPz               );
-  mDataTree->SetBranchAddress(  "GenAK4JetEta"                        ,mGenAK4JetEta              );
-  mDataTree->SetBranchAddress(  "GenAK4JetPhi"                        ,mGenAK4JetPhi              );
-  mDataTree->SetBranchAddress(  "GenAK4JetEmEnergy"                   ,mGenAK4JetEmEnergy         );
-  mDataTree->SetBranchAddress(  "GenAK4JetHadEnergy"                  ,mGenAK4JetHadEnergy        );
+  SetBufferAddress("GenAK4JetE"                          ,mGenAK4JetE                , MAXJET, &b_GenAK4JetE);
+  SetBufferAddress("GenAK4JetPt"                         ,mGenAK4JetPt               , MAXJET, &b_GenAK4JetPt);
+  SetBufferAddress("GenAK4JetPx"                         ,mGenAK4JetPx               , MAXJET, &b_GenAK4JetPx);
+  SetBufferAddress("GenAK4JetPy"                         ,mGenAK4JetPy               , MAXJET, &b_GenAK4JetPy);
+  SetBufferAddress("GenAK4JetPz"                         ,mGenAK4JetPz               , MAXJET, &b_GenAK4JetPz);
+  SetBufferAddress("GenAK4JetEta"                        ,mGenAK4JetEta              , MAXJET, &b_GenAK4JetEta);
+  SetBufferAddress("GenAK4JetPhi"                        ,mGenAK4JetPhi              , MAXJET, &b_GenAK4JetPhi);
+  SetBufferAddress("GenAK4JetEmEnergy"                   ,mGenAK4JetEmEnergy         , MAXJET, &b_GenAK4JetEmEnergy);
+  SetBufferAddress("GenAK4JetHadEnergy"                  ,mGenAK4JetHadEnergy        , MAXJET, &b_GenAK4JetHadEnergy);
   
   //PDF
-  mDataTree->SetBranchAddress( "GenScale"                             ,&mPDFGenScale              );
-  mDataTree->SetBranchAddress( "PDFx1"                                ,&mPDFx1                    );
-  mDataTree->SetBranchAddress( "PDFx2"                                ,&mPDFx2                    );
-  mDataTree->SetBranchAddress( "PDFf1"                                ,&mPDFf1                    );
-  mDataTree->SetBranchAddress( "PDFf2"                                ,&mPDFf2                    );
-  mDataTree->SetBranchAddress( "PDFscale"                             ,&mPDFscale                 );
-  mDataTree->SetBranchAddress( "PDFpdf1"                              ,&mPDFpdf1                  );
-  mDataTree->SetBranchAddress( "PDFpdf2"                              ,&mPDFpdf2                  );
+  BranchAddress("GenScale"                             ,&mPDFGenScale              , &b_GenScale);
+  BranchAddress("PDFx1"                                ,&mPDFx1                    , &b_PDFx1);
+  BranchAddress("PDFx2"                                ,&mPDFx2                    , &b_PDFx2);
+  BranchAddress("PDFf1"                                ,&mPDFf1                    , &b_PDFf1);
+  BranchAddress("PDFf2"                                ,&mPDFf2                    , &b_PDFf2);
+  BranchAddress("PDFscale"                             ,&mPDFscale                 , &b_PDFscale);
+  BranchAddress("PDFpdf1"                              ,&mPDFpdf1                  , &b_PDFpdf1);
+  BranchAddress("PDFpdf2"                              ,&mPDFpdf2                  , &b_PDFpdf2);
+  
+  size_t bytes = 0, maxBytes = 0;
+  for(size_t i=0; i<mBuffers.size(); i++){
+    bytes    += mBuffers[i].size * mBuffers[i].elemSize;
+    maxBytes += mBuffers[i].maxSize * mBuffers[i].elemSize;
+  }
+  cout << "EventData: " << mBuffers.size() << " collection buffers, " << bytes/1024. << " kB ("
+       << maxBytes/1024. << " kB with the fixed maxima), reader " << sizeof(EventData)/1024. << " kB" << endl;
+  
+  // Ntuples written with compactOutput store the Double_t leaves as Float_t
+  IndexFloatBranches();
+  if ( mFloatBranches.size() ) cout << "EventData: " << mFloatBranches.size() << " Float_t leaves read into Double_t members (compact ntuple)" << endl;
+  
+  // In lazy mode nothing is read by the tree itself, every accessor pulls its own branch
+  if ( mLazyLoad ) mDataTree->SetBranchStatus("*", 0);
+  
+  if ( mColumnar && !OpenColumns() ) cerr << "EventData: can not read the column cache in " << mColumnDir << endl;
+  if ( !mColumnar ) SetReadCache(0, 100);
+  
+  if ( rangeLast >= 0 ) SetEntryRange( rangeFirst, rangeLast < (Long64_t) mMaxEvents ? rangeLast : (Long64_t) mMaxEvents );
 }
 
 
 EventData::~EventData() 
 {
+  for(size_t i=0; i<mColumns.size(); i++){
+    if ( mColumns[i].data )    munmap(mColumns[i].data, mColumns[i].dataSize);
+    if ( mColumns[i].offsets ) munmap(mColumns[i].offsets, mColumns[i].offSize);
+  }
+  if ( !mColumnar && mEventsRead > 0 ) PrintReadStats();
+  for(size_t i=0; i<mPDFMembers.size(); i++) delete mPDFMembers[i];
+  for(size_t i=0; i<mPDFAlphaS.size(); i++)  delete mPDFAlphaS[i];
+  delete mPDFReference;
   delete mDataTree;
+  for(size_t i=0; i<mBuffers.size(); i++) mBuffers[i].release( *mBuffers[i].address );
 }
 
 
@@ -1252,18 +768,539 @@ bool EventData::GetNextEvent()
   time ( &rawtime );
   
   if ( mEvent % 1000000 == 0 ) cout << mEvent << "   time:"<< ctime (&rawtime)  << endl;
-  if ( mEvent == mMaxEvents ) return false;
-  if ( !mDataTree->GetEntry(mEvent) ) return false;
+  if ( mEvent >= mMaxEvents ) return false;
+  if ( mColumnar )
+    {
+      if ( mEvent >= mColumnEntries ) return false;
+      mEntry = mEvent;
+    }
+  else
+    {
+      // a new file is checked before anything is read into the buffers
+      mEntry = mDataTree->LoadTree(mEvent);
+      if ( mEntry < 0 ) return false;
+      CheckTree();
+      if ( !mLazyLoad ){
+	if ( !mDataTree->GetEntry(mEvent) ) return false;
+	for(map<TBranch*, size_t>::iterator i=mFloatIndex.begin(); i!=mFloatIndex.end(); ++i) ConvertFloats(i->first);
+      }
+    }
   mEvent++;
+  mEventsRead++;
+  ClearCache();
+  
+  // the learning phase is over, fit the cache to the branches actually used
+  if ( mCacheLearn > 0 && --mCacheLearn == 0 ){
+    TTreeCache * cache = (TTreeCache*) mDataTree->GetCurrentFile()->GetCacheRead(mDataTree);
+    if ( cache ) mDataTree->SetCacheSize( ReadCacheSize( cache->GetCachedBranches() ) );
+  }
   
   return true;
 }
 
 
+// First entry of a new file of the chain: its weight, and larger buffers if it holds
+// bigger collections than the files before
+void EventData::CheckTree()
+{
+  if ( !mChain || mChain->GetTreeNumber() == mTreeNumber ) return;
+  mTreeNumber = mChain->GetTreeNumber();
+  mFileWeight = size_t(mTreeNumber) < mFileWeights.size() ? mFileWeights[mTreeNumber] : 1.;
+  
+  for(size_t i=0; i<mBuffers.size(); i++){
+    Int_t size = BufferSize(mBuffers[i].name, mBuffers[i].maxSize);
+    if ( size > mBuffers[i].size ) ResizeBuffer(i, size);
+  }
+  for(size_t f=0; f<mFloatBranches.size(); f++)
+    if ( !mFloatBranches[f].buffer ) GrowFloatCopy(f, BufferSize(mFloatBranches[f].name, 1));
+  IndexFloatBranches();
+}
+
+
+///------------------------------------------------------------------------------------------------------------------------------------
+/// Collection buffers
+template<class T> void EventData::SetBufferAddress(const char * name, T *& buffer, Int_t maxSize, TBranch ** branch)
+{
+  Buffer b;
+  b.name     = name;
+  b.address  = (void**) &buffer;
+  b.branch   = branch;
+  b.size     = BufferSize(name, maxSize);
+  b.maxSize  = maxSize;
+  b.elemSize = sizeof(T);
+  b.allocate = NewBuffer<T>;
+  b.release  = DeleteBuffer<T>;
+  mBuffers.push_back(b);
+  
+  buffer = (T*) b.allocate(b.size);
+  BranchAddress(name, buffer, branch, b.address);
+}
+
+// Elements needed by a branch of the current tree: its length times the largest
+// value its count leaf took in the file
+Int_t EventData::BufferSize(const string & name, Int_t maxSize)
+{
+  TBranch * branch = mDataTree->GetBranch(name.c_str());
+  if ( !branch ) return maxSize;
+  
+  TLeaf * leaf  = (TLeaf*) branch->GetListOfLeaves()->UncheckedAt(0);
+  TLeaf * count = leaf->GetLeafCount();
+  Int_t size = leaf->GetLenStatic();
+  if ( count && count->GetMaximum() > 1 ) size *= count->GetMaximum();
+  return size > 0 ? size : 1;
+}
+
+void EventData::ResizeBuffer(size_t i, Int_t size)
+{
+  Buffer & b = mBuffers[i];
+  if ( size > b.maxSize )
+    cout << "EventData: " << b.name << " holds " << size << " entries, more than the old fixed maximum " << b.maxSize << endl;
+  
+  b.release( *b.address );
+  *b.address = b.allocate(size);
+  b.size = size;
+  
+  // a Float_t leaf stays bound to its float copy, grown with the buffer
+  for(size_t f=0; f<mFloatBranches.size(); f++){
+    if ( mFloatBranches[f].buffer != b.address ) continue;
+    if ( mFloatBranches[f].staging.size() < size_t(size) ) mFloatBranches[f].staging.resize(size);
+    mDataTree->SetBranchAddress(b.name.c_str(), &mFloatBranches[f].staging[0], b.branch);
+    IndexFloatBranches();
+    return;
+  }
+  mDataTree->SetBranchAddress(b.name.c_str(), *b.address, b.branch);
+}
+
+
+///------------------------------------------------------------------------------------------------------------------------------------
+/// Float_t leaves of a compactOutput ntuple. The Double_t members keep their type: ROOT reads
+/// the leaf into a float copy, which is converted after each read of the branch
+void EventData::BranchAddress(const char * name, Double_t * address, TBranch ** branch, void ** buffer)
+{
+  TBranch * b = mDataTree->GetBranch(name);
+  TLeaf * leaf = b ? (TLeaf*) b->GetListOfLeaves()->UncheckedAt(0) : 0;
+  if ( !leaf || strcmp(leaf->GetTypeName(), "Float_t") != 0 ){
+    mDataTree->SetBranchAddress(name, address, branch);
+    return;
+  }
+  
+  FloatBranch f;
+  f.name    = name;
+  f.branch  = branch;
+  f.target  = address;
+  f.buffer  = buffer;
+  f.staging.resize( BufferSize(name, 1) );
+  // moving the vector of copies keeps their arrays in place
+  mFloatBranches.push_back(f);
+  mDataTree->SetBranchAddress(name, &mFloatBranches.back().staging[0], branch);
+}
+
+// Branches of the current tree with a float copy, the chain moves the b_ pointers on each file
+void EventData::IndexFloatBranches()
+{
+  mFloatIndex.clear();
+  for(size_t f=0; f<mFloatBranches.size(); f++)
+    if ( *mFloatBranches[f].branch ) mFloatIndex[ *mFloatBranches[f].branch ] = f;
+}
+
+// The float copy of a fixed member holds at least size elements
+void EventData::GrowFloatCopy(size_t f, size_t size)
+{
+  FloatBranch & copy = mFloatBranches[f];
+  if ( size <= copy.staging.size() ) return;
+  copy.staging.resize(size);
+  mDataTree->SetBranchAddress(copy.name.c_str(), &copy.staging[0], copy.branch);
+}
+
+void EventData::ConvertFloats(TBranch * branch)
+{
+  map<TBranch*, size_t>::iterator i = mFloatIndex.find(branch);
+  if ( i == mFloatIndex.end() ) return;
+  FloatBranch & f = mFloatBranches[i->second];
+  
+  Int_t n = ((TLeaf*) branch->GetListOfLeaves()->UncheckedAt(0))->GetLen();
+  if ( n > (Int_t) f.staging.size() ) n = f.staging.size();
+  Double_t * target = f.buffer ? (Double_t*) *f.buffer : f.target;
+  for(Int_t k=0; k<n; k++) target[k] = f.staging[k];
+}
+
+
+///------------------------------------------------------------------------------------------------------------------------------------
+Long64_t EventData::Entries()
+{
+  Long64_t n = mColumnar ? mColumnEntries : mDataTree->GetEntries();
+  if ( (Long64_t) mMaxEvents < n ) n = mMaxEvents;
+  return n;
+}
+
+Long64_t EventData::FirstEntry()
+{
+  return mEvent;
+}
+
+vector<Long64_t> EventData::SplitEntries(int nParts)
+{
+  Long64_t first = FirstEntry(), last = Entries();
+  if ( nParts < 1 ) nParts = 1;
+  
+  // start of each file of the chain
+  vector<Long64_t> files;
+  if ( mChain )
+    for(int i=1; i<mChain->GetNtrees(); i++) files.push_back( mChain->GetTreeOffset()[i] );
+  
+  vector<Long64_t> bounds(1, first);
+  double step = double(last-first) / nParts;
+  for(int k=1; k<nParts; k++){
+    Long64_t target = first + Long64_t(k*step);
+    Long64_t bound  = target;
+    double   dist   = 0.5*step;
+    for(size_t i=0; i<files.size(); i++){
+      if ( files[i] <= bounds.back() || files[i] >= last || fabs( double(files[i]-target) ) >= dist ) continue;
+      bound = files[i];
+      dist  = fabs( double(files[i]-target) );
+    }
+    if ( bound > bounds.back() && bound < last ) bounds.push_back(bound);
+  }
+  bounds.push_back(last);
+  return bounds;
+}
+
+void EventData::SetEntryRange(Long64_t first, Long64_t last)
+{
+  mEvent     = first;
+  mMaxEvents = last;
+  if ( !mColumnar ) mDataTree->SetCacheEntryRange(first, last);
+}
+
+
+///------------------------------------------------------------------------------------------------------------------------------------
+/// Read cache. Without it every basket of the ntuple is a separate read, which is a network
+/// round-trip for the root:// files
+void EventData::SetReadCache(Long64_t size, Long64_t learnEntries)
+{
+  if ( mColumnar ) return;
+  
+  mDataTree->SetCacheSize( size > 0 ? size : ReadCacheSize( mDataTree->GetListOfBranches() ) );
+  mDataTree->SetCacheEntryRange(mEvent, mMaxEvents);
+  
+  if ( mLazyLoad && learnEntries > 0 ){
+    TTreeCache::SetLearnEntries(learnEntries);
+    mCacheLearn = size > 0 ? 0 : learnEntries;
+  }
+  else {
+    // every active branch is read by GetEntry
+    mDataTree->AddBranchToCache("*", kTRUE);
+    mDataTree->StopCacheLearningPhase();
+    mCacheLearn = 0;
+  }
+}
+
+// Compressed size of one cluster of the given (bound) branches, with some margin
+Long64_t EventData::ReadCacheSize(TObjArray * branches)
+{
+  // the file being read, for a chain
+  TTree * tree = mDataTree->GetTree();
+  Long64_t entries = tree ? tree->GetEntries() : 0;
+  if ( entries <= 0 || branches == 0 ) return 0;
+  
+  TTree::TClusterIterator cluster = tree->GetClusterIterator(0);
+  cluster.Next();
+  Long64_t clusterEntries = cluster.GetNextEntry();
+  if ( clusterEntries <= 0 || clusterEntries > entries ) clusterEntries = entries;
+  
+  Long64_t zipBytes = 0;
+  for(int i=0; i<branches->GetEntriesFast(); i++){
+    TBranch * branch = (TBranch*) branches->UncheckedAt(i);
+    if ( branch && branch->GetAddress() ) zipBytes += branch->GetZipBytes("*");
+  }
+  
+  Long64_t size = Long64_t( 1.2 * zipBytes * ( double(clusterEntries) / entries ) );
+  if ( size < 1000000 )   size = 1000000;
+  if ( size > 200000000 ) size = 200000000;
+  return size;
+}
+
+void EventData::PrintReadStats()
+{
+  TFile * file = mDataTree->GetCurrentFile();
+  if ( !file ) return;
+  
+  cout << "EventData " << mFileName << ": " << mEventsRead << " events, " << file->GetBytesRead()/1.e6 << " MB in " << file->GetReadCalls() << " reads";
+  TTreeCache * cache = (TTreeCache*) file->GetCacheRead(mDataTree);
+  if ( cache ) cout << ", read cache " << cache->GetBufferSize()/1.e6 << " MB for " << cache->GetCachedBranches()->GetEntriesFast()
+		    << " branches, hit rate " << 100.*cache->GetEfficiency() << "%";
+  cout << endl;
+}
+
+
+///------------------------------------------------------------------------------------------------------------------------------------
+/// Read a single branch for the current entry, once per event. Arrays need
+/// their counter branch first, otherwise ROOT does not know how much to read.
+void EventData::LoadBranch(TBranch * branch)
+{
+  if ( !mLazyLoad || branch == 0 || branch->GetReadEntry() == mEntry ) return;
+  
+  TLeaf* count = ((TLeaf*) branch->GetListOfLeaves()->UncheckedAt(0))->GetLeafCount();
+  if ( count ) LoadBranch( count->GetBranch() );
+  
+  if ( mColumnar ) LoadColumn(branch);
+  else {
+    branch->GetEntry(mEntry, 1);
+    ConvertFloats(branch);
+  }
+}
+
+
+///------------------------------------------------------------------------------------------------------------------------------------
+/// Column cache. Branches get the index of their column in the TObject unique id
+void EventData::LoadColumn(TBranch * branch)
+{
+  UInt_t id = branch->GetUniqueID();
+  if ( id == 0 || id > mColumns.size() ) return;
+  Column & col = mColumns[id-1];
+  if ( col.readEntry == mEntry ) return;
+  col.readEntry = mEntry;
+  
+  if ( col.offsets ){
+    Long64_t first = col.offsets[mEntry];
+    Long64_t n     = col.offsets[mEntry+1] - first;
+    // the schema only knows the maxima of the first file
+    if ( col.buffer >= 0 && n > mBuffers[col.buffer].size ) ResizeBuffer(col.buffer, n);
+    if ( col.buffer < 0 && mFloatIndex.count(branch) ) GrowFloatCopy(mFloatIndex[branch], n);
+    memcpy( branch->GetAddress(), col.data + first*col.elemSize, n*col.elemSize );
+  }
+  else {
+    size_t size = size_t(col.fixedLen)*col.elemSize;
+    memcpy( branch->GetAddress(), col.data + mEntry*size, size );
+  }
+  ConvertFloats(branch);
+}
+
+static void * MapColumnFile(const string & fileName, size_t & size)
+{
+  size = 0;
+  int fd = open(fileName.c_str(), O_RDONLY);
+  if ( fd < 0 ) return 0;
+  struct stat st;
+  void * data = 0;
+  if ( fstat(fd, &st) == 0 && st.st_size > 0 ){
+    size = st.st_size;
+    data = mmap(0, size, PROT_READ, MAP_PRIVATE, fd, 0);
+    if ( data == MAP_FAILED ){ data = 0; size = 0; }
+  }
+  close(fd);
+  return data;
+}
+
+bool EventData::OpenColumns()
+{
+  ifstream index( (mColumnDir+"/columns.txt").c_str() );
+  if ( !(index >> mColumnEntries) ) return false;
+  
+  TObjArray * branches = mDataTree->GetListOfBranches();
+  for(int i=0; i<branches->GetEntriesFast(); i++){
+    TBranch * branch = (TBranch*) branches->UncheckedAt(i);
+    if ( !branch->GetAddress() ) continue;
+    TLeaf * leaf = (TLeaf*) branch->GetListOfLeaves()->UncheckedAt(0);
+    
+    string colName = mColumnDir+"/"+branch->GetName();
+    if ( access( (colName+".col").c_str(), R_OK ) != 0 ){
+      cerr << "EventData: no column for branch " << branch->GetName() << endl;
+      continue;
+    }
+    
+    Column col;
+    col.branch    = branch;
+    col.elemSize  = leaf->GetLenType();
+    col.fixedLen  = leaf->GetLenStatic();
+    col.readEntry = -1;
+    col.buffer    = -1;
+    for(size_t k=0; k<mBuffers.size(); k++) if ( mBuffers[k].name == branch->GetName() ) col.buffer = k;
+    col.data      = (char*) MapColumnFile(colName+".col", col.dataSize);
+    col.offsets   = (Long64_t*) MapColumnFile(colName+".off", col.offSize);
+    mColumns.push_back(col);
+    branch->SetUniqueID( mColumns.size() );
+  }
+  return true;
+}
+
+bool EventData::WriteColumns(const string & dir)
+{
+  if ( mColumnar ){
+    cerr << "EventData: " << mColumnDir << " is already a column cache" << endl;
+    return false;
+  }
+  gSystem->mkdir(dir.c_str(), kTRUE);
+  
+  // Branch layout without entries, bound again by the reader. For a chain this is
+  // the layout of the file currently loaded, not of the chain itself
+  mDataTree->LoadTree(0);
+  CheckTree();
+  mDataTree->SetBranchStatus("*", 1);
+  TFile schema( (dir+"/schema.root").c_str(), "RECREATE" );
+  TTree * layout = mDataTree->GetTree()->CloneTree(0);
+  layout->Write();
+  schema.Close();
+  if ( mLazyLoad ) mDataTree->SetBranchStatus("*", 0);
+  
+  vector<string>   names;
+  vector<TBranch*> branches;
+  vector<FILE*>    data;
+  vector<FILE*>    offsets;
+  vector<Long64_t> filled;
+  TObjArray * list = mDataTree->GetListOfBranches();
+  for(int i=0; i<list->GetEntriesFast(); i++){
+    TBranch * branch = (TBranch*) list->UncheckedAt(i);
+    if ( !branch->GetAddress() ) continue;
+    TLeaf * leaf = (TLeaf*) branch->GetListOfLeaves()->UncheckedAt(0);
+    bool jagged = leaf->GetLeafCount() || dynamic_cast<TLeafC*>(leaf);
+    names.push_back( branch->GetName() );
+    branches.push_back(branch);
+    data.push_back( fopen( (dir+"/"+branch->GetName()+".col").c_str(), "wb" ) );
+    offsets.push_back( jagged ? fopen( (dir+"/"+branch->GetName()+".off").c_str(), "wb" ) : 0 );
+    filled.push_back(0);
+    if ( offsets.back() ) fwrite(&filled.back(), sizeof(Long64_t), 1, offsets.back());
+  }
+  
+  // The branches of a chain belong to the file loaded, and are deleted with it: on each
+  // new file they are looked up again, after CheckTree has grown the buffers
+  Long64_t nentries = Entries();
+  int treeNumber = mDataTree->GetTreeNumber();
+  bool ok = true;
+  for(Long64_t entry=0; entry<nentries; entry++){
+    if ( entry % 100000 == 0 ) cout << "Writing columns, entry " << entry << endl;
+    Long64_t local = mDataTree->LoadTree(entry);
+    if ( local < 0 ) break;
+    if ( mDataTree->GetTreeNumber() != treeNumber ){
+      treeNumber = mDataTree->GetTreeNumber();
+      CheckTree();
+      for(size_t i=0; i<branches.size(); i++){
+	branches[i] = mDataTree->GetTree()->GetBranch( names[i].c_str() );
+	if ( !branches[i] || !branches[i]->GetAddress() ){
+	  cerr << "EventData: branch " << names[i] << " is missing in " << mDataTree->GetCurrentFile()->GetName() << endl;
+	  ok = false;
+	}
+      }
+      if ( !ok ) break;
+    }
+    for(size_t i=0; i<branches.size(); i++){
+      TBranch * branch = branches[i];
+      TLeaf * leaf = (TLeaf*) branch->GetListOfLeaves()->UncheckedAt(0);
+      branch->GetEntry(local, 1);
+      
+      Long64_t n = leaf->GetLenStatic();
+      if ( dynamic_cast<TLeafC*>(leaf) ) n = strlen( (char*) branch->GetAddress() ) + 1;
+      else if ( leaf->GetLeafCount() )   n = leaf->GetLen();
+      
+      fwrite(branch->GetAddress(), leaf->GetLenType(), n, data[i]);
+      if ( offsets[i] ){
+	filled[i] += n;
+	fwrite(&filled[i], sizeof(Long64_t), 1, offsets[i]);
+      }
+    }
+  }
+  
+  for(size_t i=0; i<branches.size(); i++){
+    fclose(data[i]);
+    if ( offsets[i] ) fclose(offsets[i]);
+  }
+  
+  if ( !ok ) return false;
+  
+  ofstream index( (dir+"/columns.txt").c_str() );
+  index << nentries << endl;
+  for(size_t i=0; i<branches.size(); i++) index << branches[i]->GetName() << (offsets[i] ? " jagged" : " fixed") << endl;
+  return true;
+}
+
+
+///------------------------------------------------------------------------------------------------------------------------------------
+EventData::JetCache & EventData::Cache() { return mJetCache; }
+
+// Everything derived from the current entry
+void EventData::ClearCache()
+{
+  ClearJetCache();
+  
+  mMetCache.hasLepSum        = false;
+  mMetCache.hasTightLepSum   = false;
+  
+  mPDFCache.hasWeights       = false;
+}
+
+// What depends on the jet energy scale and resolution variation
+void EventData::ClearJetCache()
+{
+  mJetCache.hasJetIndex      = false;
+  mJetCache.hasWideJetIndex  = false;
+  mJetCache.hasJetNumber     = false;
+  mJetCache.hasWideJetNumber = false;
+  mJetCache.hasWideJet1      = false;
+  for(int k=0; k<5; k++) mJetCache.hasCor[k] = false;
+  
+  mMetCache.hasJetShift      = false;
+}
+
+
+///------------------------------------------------------------------------------------------------------------------------------------
+void EventData::SetVariation(float energyScale, int jerMode)
+{
+  if( energyScale==mEnergyScale && jerMode==mJERMode ) return;
+  mEnergyScale = energyScale;
+  mJERMode     = jerMode;
+  // jet selection depends on the corrected jet momenta, the lepton sums and PDF weights do not
+  ClearJetCache();
+}
+
+// Factor applied to the corrected PF AK4 jet momentum by the current variation. The JER
+// smearing scales the reco-gen difference, jets without a gen match are left unchanged
+Double_t EventData::PFAK4JetScale(UInt_t id)
+{
+  if( mEnergyScale==0. && mJERMode==JERNone ) return 1.;
+  
+  LoadBranch(b_PFAK4uncer);
+  Double_t scale = 1.+ mEnergyScale*mPFAK4uncer[id];
+  
+  if( mJERMode!=JERNone ){
+    LoadBranch(b_PFAK4JetPtCor); LoadBranch(b_GenPFAK4JetPt);
+    Double_t c = 1.;
+    if( mJERMode==JERCentral ) { LoadBranch(b_PFAK4JERCentral); c = mPFAK4JERCentral[id]; }
+    if( mJERMode==JERUp )      { LoadBranch(b_PFAK4JERUp);      c = mPFAK4JERUp[id];      }
+    if( mJERMode==JERDown )    { LoadBranch(b_PFAK4JERDown);    c = mPFAK4JERDown[id];    }
+    
+    Double_t pt    = mPFAK4JetPtCor[id];
+    Double_t genpt = mGenPFAK4JetPt[id];
+    if( c>0. && genpt>0. && pt>0. ){
+      Double_t smeared = genpt + c*(pt-genpt);
+      scale *= ( smeared>0. ? smeared : 0. ) / pt;
+    }
+  }
+  return scale;
+}
+
+
+// Corrected PF AK4 momentum column of the views: the branch itself for the nominal jets,
+// scaled once per event into the jet cache under a variation
+EventData::Span<Double_t> EventData::PFAK4JetCorSpan(int k, TBranch * branch, Double_t * raw)
+{
+  LoadBranch(branch);
+  Int_t n = NPFAK4Jets();
+  if( mEnergyScale==0. && mJERMode==JERNone ) return Span<Double_t>(raw, n);
+  
+  vector<Double_t> & cor = mJetCache.cor[k];
+  if( !mJetCache.hasCor[k] ){
+    if( cor.size() < size_t(n) ) cor.resize(n);
+    for(Int_t i=0; i<n; i++) cor[i] = raw[i] * PFAK4JetScale(i);
+    mJetCache.hasCor[k] = true;
+  }
+  return Span<Double_t>(n > 0 ? &cor[0] : raw, n);
+}
+
+
 ///------------------------------------------------------------------------------------------------------------------------------------
 double EventData::Weight()
 {   
-  double ww = mylumi["met1"] / mylumi[ mFileName.c_str() ] ; 
+  double ww = mNormalization * mFileWeight; 
   double pileup_weight=0.;
   if(misMC==1){
     int mnpv=0;
@@ -1271,6 +1308,7 @@ double EventData::Weight()
     //else if(mbx ==0) mnpv= mnpv0;
     //else if(mbx ==1) mnpv= mnpvp1;
     
+    LoadBranch(b_npv0);
     mnpv = mnpv0;
     
     size_t dd = mnpv;
@@ -1294,128 +1332,146 @@ double EventData::Weight()
   return www;
 }
 
-/*
-Double_t  EventData::PDFWeight( UInt_t id ){	
-double  w1,w2;
-
-LHAPDF::usePDFMember(1, id ); 
-
-double basepdf1 = LHAPDF::xfx(1, mPDFx1, mPDFscale, mPDFf1)/mPDFx1;
-double basepdf2 = LHAPDF::xfx(1, mPDFx2, mPDFscale, mPDFf2)/mPDFx2;
-w1 = basepdf1*basepdf2;
-
-LHAPDF::usePDFMember(3,0 );
-
-double basepdf1_ = LHAPDF::xfx(3, mPDFx1, mPDFscale, mPDFf1)/mPDFx1;
-double basepdf2_ = LHAPDF::xfx(3, mPDFx2, mPDFscale, mPDFf2)/mPDFx2;
-w2 = basepdf1_*basepdf2_;
-
-return w1/w2 ;
-} 
-
-Double_t  EventData::PDFWeightAlphaS( UInt_t id ){
-double  w1;
-
-LHAPDF::usePDFMember(2,id );
-
-double basepdf1 = LHAPDF::xfx(2, mPDFx1, mPDFscale, mPDFf1)/mPDFx1;
-double basepdf2 = LHAPDF::xfx(2, mPDFx2, mPDFscale, mPDFf2)/mPDFx2;
-w1 = basepdf1*basepdf2;
+///------------------------------------------------------------------------------------------------------------------------------------
+/// PDF weights
+string EventData::mPDFSetNames[3];
 
-return w1;
+void EventData::SetPDFSets(const string & members, const string & reference, const string & alphaS)
+{
+  mPDFSetNames[0] = members;
+  mPDFSetNames[1] = reference;
+  mPDFSetNames[2] = alphaS;
 }
 
+bool EventData::HasPDFSets()
+{
+  return !mPDFMembers.empty() || !mPDFAlphaS.empty() || mPDFReference;
+}
 
-Double_t  EventData::PDFWeightAlphaSmstw( UInt_t id ){
+// x1*f1(x1)*x2*f2(x2)/(x1*x2) of one member for the partons of the event
+static double PDFProduct(const LHAPDF::PDF * pdf, double x1, double x2, double q, int f1, int f2)
+{
+  return pdf->xfxQ(f1, x1, q) * pdf->xfxQ(f2, x2, q) / (x1*x2);
+}
 
-double  w1;
-int usemem =0;
+void EventData::FillPDFCache()
+{
+  mPDFCache.hasWeights = true;
+  
+  double x1 = PDFx1(), x2 = PDFx2(), q = PDFscale();
+  int    f1 = PDFf1(), f2 = PDFf2();
+  
+  mPDFCache.reference = mPDFReference ? PDFProduct(mPDFReference, x1, x2, q, f1, f2) : 1.;
+  
+  mPDFCache.weights.resize( mPDFMembers.size() );
+  for(size_t i=0; i<mPDFMembers.size(); i++)
+    mPDFCache.weights[i] = PDFProduct(mPDFMembers[i], x1, x2, q, f1, f2) / mPDFCache.reference;
+  
+  mPDFCache.alphaS.resize( mPDFAlphaS.size() );
+  for(size_t i=0; i<mPDFAlphaS.size(); i++)
+    mPDFCache.alphaS[i] = PDFProduct(mPDFAlphaS[i], x1, x2, q, f1, f2);
+}
 
-if(id==0) usemem=2;
-else if(id==1) usemem=3;
+const vector<double> & EventData::PDFWeightVector()
+{
+  if ( !mPDFCache.hasWeights ) FillPDFCache();
+  return mPDFCache.weights;
+}
 
-LHAPDF::usePDFMember(usemem,0 );
-double basepdf1 = LHAPDF::xfx(usemem, mPDFx1, mPDFscale, mPDFf1)/mPDFx1;
-double basepdf2 = LHAPDF::xfx(usemem, mPDFx2, mPDFscale, mPDFf2)/mPDFx2;
+Double_t  EventData::PDFWeight( UInt_t id )
+{
+  const vector<double> & weights = PDFWeightVector();
+  return id < weights.size() ? weights[id] : 0.;
+}
 
-w1 = basepdf1*basepdf2;
+Double_t  EventData::PDFWeightAlphaS( UInt_t id )
+{
+  if ( !mPDFCache.hasWeights ) FillPDFCache();
+  return id < mPDFCache.alphaS.size() ? mPDFCache.alphaS[id] : 0.;
+}
 
-return w1;
+// alphaS down from member 0 of the alphaS set, alphaS up from the reference set
+Double_t  EventData::PDFWeightAlphaSmstw( UInt_t id )
+{
+  if ( !mPDFCache.hasWeights ) FillPDFCache();
+  if ( id == 0 ) return mPDFCache.alphaS.empty() ? 0. : mPDFCache.alphaS[0];
+  if ( id == 1 ) return mPDFReference ? mPDFCache.reference : 0.;
+  return 0.;
 } 
-*/
 
 
 Int_t           EventData::IsMC()                                            {   return misMC;                                    }
-string          EventData::JetType()                                         {   return mJetType;                                 }
-string          EventData::LepType()                                         {   return mLepType;                                 }
+int             EventData::JetType()                                         {   return mJetType;                                 }
+int             EventData::LepType()                                         {   return mLepType;                                 }
 
 int             EventData::MetType()                                         {   return mMetType;                                 }
 float           EventData::SecJetCut()                                       {   return mSecJetCut;                               }
-Double_t        EventData::PDFWeights(UInt_t id)                             {   return mPDFWeights[id];                          } 
+Double_t        EventData::PDFWeights(UInt_t id)                             {   LoadBranch(b_PDFWeights1); return mPDFWeights[id]; } 
 float           EventData::EnergyScale()                                     {   return mEnergyScale;                             }
+int             EventData::JERMode()                                         {   return mJERMode;                                 }
 
-Int_t           EventData::run()                                             {   return  mrun;                                     }
-Long64_t        EventData::event()                                           {   return  mevent;                                   }
-Int_t           EventData::lumi()                                            {   return  mlumi;                                    }
-Int_t           EventData::bx()                                              {   return  mbx;                                      }
-Int_t           EventData::npvm1()                                           {   return  mnpvm1;                                   }
-Int_t           EventData::npv0()                                            {   return  mnpv0;                                    }
-Int_t           EventData::npvp1()                                           {   return  mnpvp1;                                   }
+Int_t           EventData::run()                                             {   LoadBranch(b_run); return  mrun;                  }
+Long64_t        EventData::event()                                           {   LoadBranch(b_event); return  mevent;              }
+Int_t           EventData::lumi()                                            {   LoadBranch(b_lumi); return  mlumi;                }
+Int_t           EventData::bx()                                              {   LoadBranch(b_bx); return  mbx;                    }
+Int_t           EventData::npvm1()                                           {   LoadBranch(b_npvm1); return  mnpvm1;              }
+Int_t           EventData::npv0()                                            {   LoadBranch(b_npv0); return  mnpv0;                }
+Int_t           EventData::npvp1()                                           {   LoadBranch(b_npvp1); return  mnpvp1;              }
 
-Double_t        EventData::ptHat()                                           {   return  mptHat;                                   }
-Int_t           EventData::NoiseFlag(UInt_t id)                              {   return  mNoiseFlag[id];                           }
+Double_t        EventData::ptHat()                                           {   LoadBranch(b_ptHat); return  mptHat;              }
+Int_t           EventData::NoiseFlag(UInt_t id)                              {   LoadBranch(b_NoiseFlag); return  mNoiseFlag[id];  }
 
-Double_t        EventData::fastJetRho()                                      {   return  mfastJetRho;                              }
+Double_t        EventData::fastJetRho()                                      {   LoadBranch(b_fastJetRho); return  mfastJetRho;    }
 										
-Int_t           EventData::NCaloAK4Jets()                                    {   return  mNCaloAK4Jets;                            }
-Double_t        EventData::CaloAK4JetE(UInt_t id)                            {   return  mCaloAK4JetE[id];                         }
-Double_t        EventData::CaloAK4JetPt(UInt_t id)                           {   return  mCaloAK4JetPt[id];                        }
-Double_t        EventData::CaloAK4JetPx(UInt_t id)                           {   return  mCaloAK4JetPx[id];                        }
-Double_t        EventData::CaloAK4JetPy(UInt_t id)                           {   return  mCaloAK4JetPy[id];                        }
-Double_t        EventData::CaloAK4JetPz(UInt_t id)                           {   return  mCaloAK4JetPz[id];                        }
-Double_t        EventData::CaloAK4JetEta(UInt_t id)                          {   return  mCaloAK4JetEta[id];                       }
-Double_t        EventData::CaloAK4JetPhi(UInt_t id)                          {   return  mCaloAK4JetPhi[id];                       }
-Double_t        EventData::CaloAK4JetEmf(UInt_t id)                          {   return  mCaloAK4JetEmf[id];                       }
-Double_t        EventData::CaloAK4JetfHPD(UInt_t id)                         {   return  mCaloAK4JetfHPD[id];                      }
-Double_t        EventData::CaloAK4JetfRBX(UInt_t id)                         {   return  mCaloAK4JetfRBX[id];                      }
-Double_t        EventData::CaloAK4JetN90Hits(UInt_t id)                      {   return  mCaloAK4JetN90Hits[id];                   }
-Int_t           EventData::CaloAK4JetN90(UInt_t id)                          {   return  mCaloAK4JetN90[id];                       }
-Double_t        EventData::CaloAK4JetSigEta(UInt_t id)                       {   return  mCaloAK4JetSigEta[id];                    }
-Double_t        EventData::CaloAK4JetSigPhi(UInt_t id)                       {   return  mCaloAK4JetSigPhi[id];                    }
-Double_t        EventData::CaloAK4JetIDEmf(UInt_t id)                        {   return  mCaloAK4JetIDEmf[id];                     }
-Double_t        EventData::CaloAK4JetECor(UInt_t id)                         {   return  mCaloAK4JetECor[id];                      }
-Double_t        EventData::CaloAK4JetPtCor(UInt_t id)                        {   return  mCaloAK4JetPtCor[id];                     }
-Double_t        EventData::CaloAK4JetPxCor(UInt_t id)                        {   return  mCaloAK4JetPxCor[id];                     }
-Double_t        EventData::CaloAK4JetPyCor(UInt_t id)                        {   return  mCaloAK4JetPyCor[id];                     }
-Double_t        EventData::CaloAK4JetPzCor(UInt_t id)                        {   return  mCaloAK4JetPzCor[id];                     }
-Double_t        EventData::CaloAK4JetBtagTkCountHighEff(UInt_t id)           {   return  mCaloAK4JetBtagTkCountHighEff[id];        }
-Double_t        EventData::CaloAK4JetBTagSimpleSecVtx(UInt_t id)             {   return  mCaloAK4JetBTagSimpleSecVtx[id];          }
-Double_t        EventData::CaloAK4JetBTagCombSecVtx(UInt_t id)               {   return  mCaloAK4JetBTagCombSecVtx[id];            }
-Double_t        EventData::CaloAK4TrackPt(UInt_t id)                         {   return  mCaloAK4TrackPt[id];                      }
-Int_t           EventData::CaloAK4JetIDLOOSE(UInt_t id)                      {   return  mCaloAK4JetIDLOOSE[id];                   }
-Int_t           EventData::CaloAK4JetIDTIGHT(UInt_t id)                      {   return  mCaloAK4JetIDTIGHT[id];                   }							
+Int_t           EventData::NCaloAK4Jets()                                    {   LoadBranch(b_NCaloAK4Jets); return  mNCaloAK4Jets; }
+Double_t        EventData::CaloAK4JetE(UInt_t id)                            {   LoadBranch(b_CaloAK4JetE); return  mCaloAK4JetE[id]; }
+Double_t        EventData::CaloAK4JetPt(UInt_t id)                           {   LoadBranch(b_CaloAK4JetPt); return  mCaloAK4JetPt[id]; }
+Double_t        EventData::CaloAK4JetPx(UInt_t id)                           {   LoadBranch(b_CaloAK4JetPx); return  mCaloAK4JetPx[id]; }
+Double_t        EventData::CaloAK4JetPy(UInt_t id)                           {   LoadBranch(b_CaloAK4JetPy); return  mCaloAK4JetPy[id]; }
+Double_t        EventData::CaloAK4JetPz(UInt_t id)                           {   LoadBranch(b_CaloAK4JetPz); return  mCaloAK4JetPz[id]; }
+Double_t        EventData::CaloAK4JetEta(UInt_t id)                          {   LoadBranch(b_CaloAK4JetEta); return  mCaloAK4JetEta[id]; }
+Double_t        EventData::CaloAK4JetPhi(UInt_t id)                          {   LoadBranch(b_CaloAK4JetPhi); return  mCaloAK4JetPhi[id]; }
+Double_t        EventData::CaloAK4JetEmf(UInt_t id)                          {   LoadBranch(b_CaloAK4JetEmf); return  mCaloAK4JetEmf[id]; }
+Double_t        EventData::CaloAK4JetfHPD(UInt_t id)                         {   LoadBranch(b_CaloAK4JetfHPD); return  mCaloAK4JetfHPD[id]; }
+Double_t        EventData::CaloAK4JetfRBX(UInt_t id)                         {   LoadBranch(b_CaloAK4JetfRBX); return  mCaloAK4JetfRBX[id]; }
+Double_t        EventData::CaloAK4JetN90Hits(UInt_t id)                      {   LoadBranch(b_CaloAK4JetN90Hits); return  mCaloAK4JetN90Hits[id]; }
+Int_t           EventData::CaloAK4JetN90(UInt_t id)                          {   LoadBranch(b_CaloAK4JetN90); return  mCaloAK4JetN90[id]; }
+Double_t        EventData::CaloAK4JetSigEta(UInt_t id)                       {   LoadBranch(b_CaloAK4JetSigEta); return  mCaloAK4JetSigEta[id]; }
+Double_t        EventData::CaloAK4JetSigPhi(UInt_t id)                       {   LoadBranch(b_CaloAK4JetSigPhi); return  mCaloAK4JetSigPhi[id]; }
+Double_t        EventData::CaloAK4JetIDEmf(UInt_t id)                        {   LoadBranch(b_CaloAK4JetIDEmf); return  mCaloAK4JetIDEmf[id]; }
+Double_t        EventData::CaloAK4JetECor(UInt_t id)                         {   LoadBranch(b_CaloAK4JetECor); return  mCaloAK4JetECor[id]; }
+Double_t        EventData::CaloAK4JetPtCor(UInt_t id)                        {   LoadBranch(b_CaloAK4JetPtCor); return  mCaloAK4JetPtCor[id]; }
+Double_t        EventData::CaloAK4JetPxCor(UInt_t id)                        {   LoadBranch(b_CaloAK4JetPxCor); return  mCaloAK4JetPxCor[id]; }
+Double_t        EventData::CaloAK4JetPyCor(UInt_t id)                        {   LoadBranch(b_CaloAK4JetPyCor); return  mCaloAK4JetPyCor[id]; }
+Double_t        EventData::CaloAK4JetPzCor(UInt_t id)                        {   LoadBranch(b_CaloAK4JetPzCor); return  mCaloAK4JetPzCor[id]; }
+Double_t        EventData::CaloAK4JetBtagTkCountHighEff(UInt_t id)           {   LoadBranch(b_CaloAK4JetBtagTkCountHighEff); return  mCaloAK4JetBtagTkCountHighEff[id]; }
+Double_t        EventData::CaloAK4JetBTagSimpleSecVtx(UInt_t id)             {   LoadBranch(b_CaloAK4JetBTagSimpleSecVtx); return  mCaloAK4JetBTagSimpleSecVtx[id]; }
+Double_t        EventData::CaloAK4JetBTagCombSecVtx(UInt_t id)               {   LoadBranch(b_CaloAK4JetBTagCombSecVtx); return  mCaloAK4JetBTagCombSecVtx[id]; }
+Double_t        EventData::CaloAK4TrackPt(UInt_t id)                         {   LoadBranch(b_CaloAK4TrackPt); return  mCaloAK4TrackPt[id]; }
+Int_t           EventData::CaloAK4JetIDLOOSE(UInt_t id)                      {   LoadBranch(b_CaloAK4JetIDLOOSE); return  mCaloAK4JetIDLOOSE[id]; }
+Int_t           EventData::CaloAK4JetIDTIGHT(UInt_t id)                      {   LoadBranch(b_CaloAK4JetIDTIGHT); return  mCaloAK4JetIDTIGHT[id]; }							
 		
-Int_t           EventData::NPFAK4Jets()                                      {   return  mNPFAK4Jets;                              }
-Double_t        EventData::PFAK4JetE(UInt_t id)                              {   return  mPFAK4JetE[id];                           }
-Double_t        EventData::PFAK4JetPt(UInt_t id)                             {   return  mPFAK4JetPt[id];                          }
-Double_t        EventData::PFAK4JetPx(UInt_t id)                             {   return  mPFAK4JetPx[id];                          }
-Double_t        EventData::PFAK4JetPy(UInt_t id)                             {   return  mPFAK4JetPy[id];                          }
-Double_t        EventData::PFAK4JetPz(UInt_t id)                             {   return  mPFAK4JetPz[id];                          }
-Double_t        EventData::PFAK4JetEta(UInt_t id)                            {   return  mPFAK4JetEta[id];                         }
-Double_t        EventData::PFAK4JetPhi(UInt_t id)                            {   return  mPFAK4JetPhi[id];                         }
-Double_t        EventData::PFAK4JetfHPD(UInt_t id)                           {   return  mPFAK4JetfHPD[id];                        }
-Double_t        EventData::PFAK4JetfRBX(UInt_t id)                           {   return  mPFAK4JetfRBX[id];                        }
-Double_t        EventData::PFAK4JetN90Hits(UInt_t id)                        {   return  mPFAK4JetN90Hits[id];                     }
-Int_t           EventData::PFAK4JetN90(UInt_t id)                            {   return  mPFAK4JetN90[id];                         }
-Double_t        EventData::PFAK4JetSigEta(UInt_t id)                         {   return  mPFAK4JetSigEta[id];                      }
-Double_t        EventData::PFAK4JetSigPhi(UInt_t id)                         {   return  mPFAK4JetSigPhi[id];                      }
-Double_t        EventData::PFAK4JetIDEmf(UInt_t id)                          {   return  mPFAK4JetIDEmf[id];                       }
-Double_t        EventData::PFAK4JetECor(UInt_t id)                           {   return  mPFAK4JetECor[id];                        }
-
- Double_t        EventData::PFAK4JetPtCor(UInt_t id)                          {   return  mPFAK4JetPtCor[id];                       }
- Double_t        EventData::PFAK4JetPxCor(UInt_t id)                          {   return  mPFAK4JetPxCor[id];                       }
- Double_t        EventData::PFAK4JetPyCor(UInt_t id)                          {   return  mPFAK4JetPyCor[id];                       }
- Double_t        EventData::PFAK4JetPzCor(UInt_t id)                          {   return  mPFAK4JetPzCor[id];                       }
+Int_t           EventData::NPFAK4Jets()                                      {   LoadBranch(b_NPFAK4Jets); return  mNPFAK4Jets;    }
+Double_t        EventData::PFAK4JetE(UInt_t id)                              {   LoadBranch(b_PFAK4JetE); return  mPFAK4JetE[id];  }
+Double_t        EventData::PFAK4JetPt(UInt_t id)                             {   LoadBranch(b_PFAK4JetPt); return  mPFAK4JetPt[id]; }
+Double_t        EventData::PFAK4JetPx(UInt_t id)                             {   LoadBranch(b_PFAK4JetPx); return  mPFAK4JetPx[id]; }
+Double_t        EventData::PFAK4JetPy(UInt_t id)                             {   LoadBranch(b_PFAK4JetPy); return  mPFAK4JetPy[id]; }
+Double_t        EventData::PFAK4JetPz(UInt_t id)                             {   LoadBranch(b_PFAK4JetPz); return  mPFAK4JetPz[id]; }
+Double_t        EventData::PFAK4JetEta(UInt_t id)                            {   LoadBranch(b_PFAK4JetEta); return  mPFAK4JetEta[id]; }
+Double_t        EventData::PFAK4JetPhi(UInt_t id)                            {   LoadBranch(b_PFAK4JetPhi); return  mPFAK4JetPhi[id]; }
+Double_t        EventData::PFAK4JetfHPD(UInt_t id)                           {   LoadBranch(b_PFAK4JetfHPD); return  mPFAK4JetfHPD[id]; }
+Double_t        EventData::PFAK4JetfRBX(UInt_t id)                           {   LoadBranch(b_PFAK4JetfRBX); return  mPFAK4JetfRBX[id]; }
+Double_t        EventData::PFAK4JetN90Hits(UInt_t id)                        {   LoadBranch(b_PFAK4JetN90Hits); return  mPFAK4JetN90Hits[id]; }
+Int_t           EventData::PFAK4JetN90(UInt_t id)                            {   LoadBranch(b_PFAK4JetN90); return  mPFAK4JetN90[id]; }
+Double_t        EventData::PFAK4JetSigEta(UInt_t id)                         {   LoadBranch(b_PFAK4JetSigEta); return  mPFAK4JetSigEta[id]; }
+Double_t        EventData::PFAK4JetSigPhi(UInt_t id)                         {   LoadBranch(b_PFAK4JetSigPhi); return  mPFAK4JetSigPhi[id]; }
+Double_t        EventData::PFAK4JetIDEmf(UInt_t id)                          {   LoadBranch(b_PFAK4JetIDEmf); return  mPFAK4JetIDEmf[id]; }
+Double_t        EventData::PFAK4JetECor(UInt_t id)                           {   LoadBranch(b_PFAK4JetECor); return  mPFAK4JetECor[id] * PFAK4JetScale(id); }
+
+ Double_t        EventData::PFAK4JetPtCor(UInt_t id)                          {   LoadBranch(b_PFAK4JetPtCor); return  mPFAK4JetPtCor[id] * PFAK4JetScale(id); }
+ Double_t        EventData::PFAK4JetPxCor(UInt_t id)                          {   LoadBranch(b_PFAK4JetPxCor); return  mPFAK4JetPxCor[id] * PFAK4JetScale(id); }
+ Double_t        EventData::PFAK4JetPyCor(UInt_t id)                          {   LoadBranch(b_PFAK4JetPyCor); return  mPFAK4JetPyCor[id] * PFAK4JetScale(id); }
+ Double_t        EventData::PFAK4JetPzCor(UInt_t id)                          {   LoadBranch(b_PFAK4JetPzCor); return  mPFAK4JetPzCor[id] * PFAK4JetScale(id); }
 
 //Double_t        EventData::PFAK4JetPtCor(UInt_t id)                     {    return  mPFAK4JetPtCor[id] * (1+ mEnergyScale*mPFAK4uncer[id] );      } 
 //Double_t        EventData::PFAK4JetPxCor(UInt_t id)                     {    return  mPFAK4JetPxCor[id] * (1+ mEnergyScale*mPFAK4uncer[id] );      } 
@@ -1424,87 +1480,165 @@ Double_t        EventData::PFAK4JetECor(UInt_t id)                           {
 
 
 
-Double_t        EventData::PFAK4JetBtagTkCountHighEff(UInt_t id)             {   return  mPFAK4JetBtagTkCountHighEff[id];          }
-Double_t        EventData::PFAK4JetBTagSimpleSecVtx(UInt_t id)               {   return  mPFAK4JetBTagSimpleSecVtx[id];            }
-Double_t        EventData::PFAK4JetBTagCombSecVtx(UInt_t id)                 {   return  mPFAK4JetBTagCombSecVtx[id];              }
-Double_t        EventData::PFAK4JetNeuEmEngFrac(UInt_t id)                   {   return  mPFAK4JetNeuEmEngFrac[id];                }
-Double_t        EventData::PFAK4JetChaEmEngFrac(UInt_t id)                   {   return  mPFAK4JetChaEmEngFrac[id];                }
-Double_t        EventData::PFAK4JetChaHadEngFrac(UInt_t id)                  {   return  mPFAK4JetChaHadEngFrac[id];               }
-Double_t        EventData::PFAK4JetNeuHadEngFrac(UInt_t id)                  {   return  mPFAK4JetNeuHadEngFrac[id];               }
-Double_t        EventData::PFAK4JetChaMuEng(UInt_t id)                       {   return  mPFAK4JetChaMuEng[id];                    }
-Double_t        EventData::PFAK4JetMuonEng(UInt_t id)                        {   return  mPFAK4JetMuonEng[id];                     }
-Double_t        EventData::PFAK4JetPhotEng(UInt_t id)                        {   return  mPFAK4JetPhotEng[id];                     }
-Double_t        EventData::PFAK4JetElecEng(UInt_t id)                        {   return  mPFAK4JetElecEng[id];                     }
-Int_t           EventData::PFAK4JetNumOfChaMu(UInt_t id)                     {   return  mPFAK4JetNumOfChaMu[id];                  }
-Int_t           EventData::PFAK4JetNumOfMuon(UInt_t id)                      {   return  mPFAK4JetNumOfMuon[id];                   }
-Int_t           EventData::PFAK4JetNumOfPhot(UInt_t id)                      {   return  mPFAK4JetNumOfPhot[id];                   }
-Int_t           EventData::PFAK4JetNumOfElec(UInt_t id)                      {   return  mPFAK4JetNumOfElec[id];                   }
-Int_t           EventData::PFAK4JetNumOfNeu(UInt_t id)                       {   return  mPFAK4JetNumOfNeu[id];                    }
-Int_t           EventData::PFAK4JetNumOfCha(UInt_t id)                       {   return  mPFAK4JetNumOfCha[id];                    }
-Int_t           EventData::PFAK4JetNumOfNeuHad(UInt_t id)                    {   return  mPFAK4JetNumOfNeuHad[id];                 }
-Int_t           EventData::PFAK4JetNumOfChaHad(UInt_t id)                    {   return  mPFAK4JetNumOfChaHad[id];                 }
-Int_t           EventData::PFAK4JetNumOfDaughters(UInt_t id)                 {   return  mPFAK4JetNumOfDaughters[id];              }
-Int_t           EventData::PFAK4JetIDLOOSE(UInt_t id)                        {   return  mPFAK4JetIDLOOSE[id];                     }
-Int_t           EventData::PFAK4JetIDTIGHT(UInt_t id)                        {   return  mPFAK4JetIDTIGHT[id];                     }
-Double_t           EventData::PFAK4JetPUFullJetId(UInt_t id)                    {   return  mPFAK4JetPUFullJetId[id];                 }
-Double_t        EventData::PFAK4uncer(UInt_t id)                             {   return  mPFAK4uncer[id];                          }						
+Double_t        EventData::PFAK4JetBtagTkCountHighEff(UInt_t id)             {   LoadBranch(b_PFAK4JetBtagTkCountHighEff); return  mPFAK4JetBtagTkCountHighEff[id]; }
+Double_t        EventData::PFAK4JetBTagSimpleSecVtx(UInt_t id)               {   LoadBranch(b_PFAK4JetBTagSimpleSecVtx); return  mPFAK4JetBTagSimpleSecVtx[id]; }
+Double_t        EventData::PFAK4JetBTagCombSecVtx(UInt_t id)                 {   LoadBranch(b_PFAK4JetBTagCombSecVtx); return  mPFAK4JetBTagCombSecVtx[id]; }
+Double_t        EventData::PFAK4JetNeuEmEngFrac(UInt_t id)                   {   LoadBranch(b_PFAK4JetNeuEmEngFrac); return  mPFAK4JetNeuEmEngFrac[id]; }
+Double_t        EventData::PFAK4JetChaEmEngFrac(UInt_t id)                   {   LoadBranch(b_PFAK4JetChaEmEngFrac); return  mPFAK4JetChaEmEngFrac[id]; }
+Double_t        EventData::PFAK4JetChaHadEngFrac(UInt_t id)                  {   LoadBranch(b_PFAK4JetChaHadEngFrac); return  mPFAK4JetChaHadEngFrac[id]; }
+Double_t        EventData::PFAK4JetNeuHadEngFrac(UInt_t id)                  {   LoadBranch(b_PFAK4JetNeuHadEngFrac); return  mPFAK4JetNeuHadEngFrac[id]; }
+Double_t        EventData::PFAK4JetChaMuEng(UInt_t id)                       {   LoadBranch(b_PFAK4JetChaMuEng); return  mPFAK4JetChaMuEng[id]; }
+Double_t        EventData::PFAK4JetMuonEng(UInt_t id)                        {   LoadBranch(b_PFAK4JetMuonEng); return  mPFAK4JetMuonEng[id]; }
+Double_t        EventData::PFAK4JetPhotEng(UInt_t id)                        {   LoadBranch(b_PFAK4JetPhotEng); return  mPFAK4JetPhotEng[id]; }
+Double_t        EventData::PFAK4JetElecEng(UInt_t id)                        {   LoadBranch(b_PFAK4JetElecEng); return  mPFAK4JetElecEng[id]; }
+Int_t           EventData::PFAK4JetNumOfChaMu(UInt_t id)                     {   LoadBranch(b_PFAK4JetNumOfChaMu); return  mPFAK4JetNumOfChaMu[id]; }
+Int_t           EventData::PFAK4JetNumOfMuon(UInt_t id)                      {   LoadBranch(b_PFAK4JetNumOfMuon); return  mPFAK4JetNumOfMuon[id]; }
+Int_t           EventData::PFAK4JetNumOfPhot(UInt_t id)                      {   LoadBranch(b_PFAK4JetNumOfPhot); return  mPFAK4JetNumOfPhot[id]; }
+Int_t           EventData::PFAK4JetNumOfElec(UInt_t id)                      {   LoadBranch(b_PFAK4JetNumOfElec); return  mPFAK4JetNumOfElec[id]; }
+Int_t           EventData::PFAK4JetNumOfNeu(UInt_t id)                       {   LoadBranch(b_PFAK4JetNumOfNeu); return  mPFAK4JetNumOfNeu[id]; }
+Int_t           EventData::PFAK4JetNumOfCha(UInt_t id)                       {   LoadBranch(b_PFAK4JetNumOfCha); return  mPFAK4JetNumOfCha[id]; }
+Int_t           EventData::PFAK4JetNumOfNeuHad(UInt_t id)                    {   LoadBranch(b_PFAK4JetNumOfNeuHad); return  mPFAK4JetNumOfNeuHad[id]; }
+Int_t           EventData::PFAK4JetNumOfChaHad(UInt_t id)                    {   LoadBranch(b_PFAK4JetNumOfChaHad); return  mPFAK4JetNumOfChaHad[id]; }
+Int_t           EventData::PFAK4JetNumOfDaughters(UInt_t id)                 {   LoadBranch(b_PFAK4JetNumOfDaughters); return  mPFAK4JetNumOfDaughters[id]; }
+Int_t           EventData::PFAK4JetIDLOOSE(UInt_t id)                        {   LoadBranch(b_PFAK4JetIDLOOSE); return  mPFAK4JetIDLOOSE[id]; }
+Int_t           EventData::PFAK4JetIDTIGHT(UInt_t id)                        {   LoadBranch(b_PFAK4JetIDTIGHT); return  mPFAK4JetIDTIGHT[id]; }
+Double_t           EventData::PFAK4JetPUFullJetId(UInt_t id)                    {   LoadBranch(b_PFAK4JetPUFullJetId); return  mPFAK4JetPUFullJetId[id]; }
+Double_t        EventData::PFAK4uncer(UInt_t id)                             {   LoadBranch(b_PFAK4uncer); return  mPFAK4uncer[id]; }
+Double_t        EventData::GenPFAK4JetPt(UInt_t id)                          {   LoadBranch(b_GenPFAK4JetPt); return  mGenPFAK4JetPt[id]; }
+Double_t        EventData::PFAK4JERCentral(UInt_t id)                        {   LoadBranch(b_PFAK4JERCentral); return  mPFAK4JERCentral[id]; }
+Double_t        EventData::PFAK4JERUp(UInt_t id)                             {   LoadBranch(b_PFAK4JERUp); return  mPFAK4JERUp[id]; }
+Double_t        EventData::PFAK4JERDown(UInt_t id)                           {   LoadBranch(b_PFAK4JERDown); return  mPFAK4JERDown[id]; }						
 						
-Int_t           EventData::NMet()                                            {   return  mNMet;                                    }
+Int_t           EventData::NMet()                                            {   LoadBranch(b_NMet); return  mNMet;                }
 Double_t        EventData::MetPt(UInt_t id) 
 {   
+    LoadBranch(b_MetPx); LoadBranch(b_MetPy);
+    double metx =  mMetPx[id] + MetJetShiftPx();
+    double mety =  mMetPy[id] + MetJetShiftPy();
+    return  sqrt( metx*metx + mety*mety);
+}
 
-    Double_t jetx=0.;
 
-    for(int i=0; i<mNPFAK4Jets;  i++)
-    {
-          jetx = jetx+  ( mEnergyScale*mPFAK4uncer[i]* mPFAK4JetPxCor[i] ) ;
-    }
-    double metx =  mMetPx[id]+jetx ;                               
 
-    Double_t jety=0.;
 
-      for(int i=0; i<mNPFAK4Jets;  i++)
-      {
-	   jety = jety+  ( mEnergyScale*mPFAK4uncer[i]* mPFAK4JetPyCor[i] ) ;
-      }
+//Double_t        EventData::MetPx(UInt_t id)                                  {   return  mMetPx[id];                               }
+//Double_t        EventData::MetPy(UInt_t id)                                  {   return  mMetPy[id];                               }
+Double_t        EventData::MetPhi(UInt_t id)                                 {   LoadBranch(b_MetPhi); return  mMetPhi[id];        }
+Double_t        EventData::MetSumEt(UInt_t id)                               {   LoadBranch(b_MetSumEt); return  mMetSumEt[id];    }
+Double_t        EventData::MetSign(UInt_t id)                                {   LoadBranch(b_MetSign); return  mMetSign[id];      }
 
-      double mety =   mMetPy[id]+jety ;
-    
 
-      return  sqrt( metx*metx + mety*mety);
+Double_t  EventData::MetPx(UInt_t id)
+{
+	LoadBranch(b_MetPx);
+	return  mMetPx[id] + MetJetShiftPx();
 }
 
+Double_t  EventData::MetPy(UInt_t id)
+{
+	LoadBranch(b_MetPy);
+	return  mMetPy[id] + MetJetShiftPy();
+}
 
+Double_t  EventData::MetLepPt(UInt_t id)
+{
+	double metx = MetPx(id);
+	double mety = MetPy(id);
+	if( mMetType>9 ){  // pf or tc Met
+		metx = metx + PFLepSumPx();
+		mety = mety + PFLepSumPy();
+	}
+	return  sqrt( metx*metx + mety*mety );
+}
 
+Double_t  EventData::MetLepPhi(UInt_t id)
+{
+	double metx = MetPx(id);
+	double mety = MetPy(id);
+	if( mMetType>9 ){  // pf or tc Met
+		metx = metx + PFLepSumPx();
+		mety = mety + PFLepSumPy();
+	}
+	return  atan2( mety, metx );
+}
 
-//Double_t        EventData::MetPx(UInt_t id)                                  {   return  mMetPx[id];                               }
-//Double_t        EventData::MetPy(UInt_t id)                                  {   return  mMetPy[id];                               }
-Double_t        EventData::MetPhi(UInt_t id)                                 {   return  mMetPhi[id];                              }
-Double_t        EventData::MetSumEt(UInt_t id)                               {   return  mMetSumEt[id];                            }
-Double_t        EventData::MetSign(UInt_t id)                                {   return  mMetSign[id];                             }
+Double_t  EventData::MetTightLepPt(UInt_t id)
+{
+	double metx = MetPx(id);
+	double mety = MetPy(id);
+	if( mMetType>9 ){  // pf or tc Met
+		metx = metx + PFTightLepSumPx();
+		mety = mety + PFTightLepSumPy();
+	}
+	return  sqrt( metx*metx + mety*mety );
+}
 
+// Shift of the MET from the variation applied to the PF AK4 jets, the same for every MET type
+Double_t  EventData::MetJetShiftPx()
+{
+	if( !mMetCache.hasJetShift ){
+		mMetCache.jetShiftPx = 0.;
+		mMetCache.jetShiftPy = 0.;
+		if( mEnergyScale!=0. || mJERMode!=JERNone ){
+			LoadBranch(b_NPFAK4Jets); LoadBranch(b_PFAK4JetPxCor); LoadBranch(b_PFAK4JetPyCor);
+			for(int i=0; i<mNPFAK4Jets;  i++)
+			{
+				Double_t scale = PFAK4JetScale(i)-1.;
+				mMetCache.jetShiftPx = mMetCache.jetShiftPx + ( scale* mPFAK4JetPxCor[i] ) ;
+				mMetCache.jetShiftPy = mMetCache.jetShiftPy + ( scale* mPFAK4JetPyCor[i] ) ;
+			}
+		}
+		mMetCache.hasJetShift = true;
+	}
+	return  mMetCache.jetShiftPx;
+}
 
-Double_t  EventData::MetPx(UInt_t id)
+Double_t  EventData::MetJetShiftPy()
 {
-	Double_t jetx=0.;
+	MetJetShiftPx();
+	return  mMetCache.jetShiftPy;
+}
 
-	for(int i=0; i<mNPFAK4Jets;  i++)
-	{
-		jetx = jetx+  ( mEnergyScale*mPFAK4uncer[i]* mPFAK4JetPxCor[i] ) ; 	
+Double_t  EventData::PFLepSumPx()
+{
+	if( !mMetCache.hasLepSum ){
+		mMetCache.lepSumPx = 0.;
+		mMetCache.lepSumPy = 0.;
+		for(int i=0; i<NPFLep(); i++ ){
+			mMetCache.lepSumPx = mMetCache.lepSumPx + PFLepPx(i);
+			mMetCache.lepSumPy = mMetCache.lepSumPy + PFLepPy(i);
+		}
+		mMetCache.hasLepSum = true;
 	}
-	return  mMetPx[id]+jetx  ;
+	return  mMetCache.lepSumPx;
 }
 
-Double_t  EventData::MetPy(UInt_t id)
+Double_t  EventData::PFLepSumPy()
 {
-	Double_t jety=0.;
+	PFLepSumPx();
+	return  mMetCache.lepSumPy;
+}
 
-	for(int i=0; i<mNPFAK4Jets;  i++)
-	{
-		jety = jety+  ( mEnergyScale*mPFAK4uncer[i]* mPFAK4JetPyCor[i] ) ; 
+Double_t  EventData::PFTightLepSumPx()
+{
+	if( !mMetCache.hasTightLepSum ){
+		mMetCache.tightLepSumPx = 0.;
+		mMetCache.tightLepSumPy = 0.;
+		for(int i=0; i<NPFLep(); i++ ){
+			if( PFLepTightCuts(*this ,i, 20, 2.1) ){
+				mMetCache.tightLepSumPx = mMetCache.tightLepSumPx + PFLepPx(i);
+				mMetCache.tightLepSumPy = mMetCache.tightLepSumPy + PFLepPy(i);
+			}
+		}
+		mMetCache.hasTightLepSum = true;
 	}
-	
-	return  mMetPy[id]+jety ;
+	return  mMetCache.tightLepSumPx;
+}
+
+Double_t  EventData::PFTightLepSumPy()
+{
+	PFTightLepSumPx();
+	return  mMetCache.tightLepSumPy;
 }
 	
 
@@ -1513,534 +1647,534 @@ Double_t  EventData::MetPy(UInt_t id)
 Int_t  EventData::NPFLep()
 {
 	Int_t send=0; 
-	if(mLepType=="m") send=  mNPFMuon;
-	if(mLepType=="e") send=  mNPFElec;
-	if(mLepType=="t") send=  mNPFTau;
+	if(mLepType==LepMuon) { LoadBranch(b_NPFMuon); send=  mNPFMuon; }
+	if(mLepType==LepElec) { LoadBranch(b_NPFElec); send=  mNPFElec; }
+	if(mLepType==LepTau) { LoadBranch(b_NPFTau); send=  mNPFTau; }
 	return send; 
 }
 
 Double_t  EventData::PFLepPt(UInt_t id)
 {
 	Double_t send=0.; 
-	if(mLepType=="m") send=  mPFMuonPt[id];
-	if(mLepType=="e") send=  mPFElecPt[id];
-	if(mLepType=="t") send=  mPFTauPt[id];
+	if(mLepType==LepMuon) { LoadBranch(b_PFMuonPt); send=  mPFMuonPt[id]; }
+	if(mLepType==LepElec) { LoadBranch(b_PFElecPt); send=  mPFElecPt[id]; }
+	if(mLepType==LepTau) { LoadBranch(b_PFTauPt); send=  mPFTauPt[id]; }
 	return send; 
 }
 Double_t  EventData::PFLepE(UInt_t id)
 { 
 	Double_t send=0.; 
-	if(mLepType=="m") send=  mPFMuonE[id];
-	if(mLepType=="e") send=  mPFElecE[id];
-	if(mLepType=="t") send=  mPFTauE[id];
+	if(mLepType==LepMuon) { LoadBranch(b_PFMuonE); send=  mPFMuonE[id]; }
+	if(mLepType==LepElec) { LoadBranch(b_PFElecE); send=  mPFElecE[id]; }
+	if(mLepType==LepTau) { LoadBranch(b_PFTauE); send=  mPFTauE[id]; }
 	return send; 
 }
 Double_t  EventData::PFLepPx(UInt_t id)
 {
 	Double_t send=0.; 
-	if(mLepType=="m") send=  mPFMuonPx[id];
-	if(mLepType=="e") send=  mPFElecPx[id];
-	if(mLepType=="t") send=  mPFTauPx[id];
+	if(mLepType==LepMuon) { LoadBranch(b_PFMuonPx); send=  mPFMuonPx[id]; }
+	if(mLepType==LepElec) { LoadBranch(b_PFElecPx); send=  mPFElecPx[id]; }
+	if(mLepType==LepTau) { LoadBranch(b_PFTauPx); send=  mPFTauPx[id]; }
 	return send; 
 }
 Double_t  EventData::PFLepPy(UInt_t id)
 {
 	Double_t send=0.; 
-	if(mLepType=="m") send=  mPFMuonPy[id];
-	if(mLepType=="e") send=  mPFElecPy[id];
-	if(mLepType=="t") send=  mPFTauPy[id];
+	if(mLepType==LepMuon) { LoadBranch(b_PFMuonPy); send=  mPFMuonPy[id]; }
+	if(mLepType==LepElec) { LoadBranch(b_PFElecPy); send=  mPFElecPy[id]; }
+	if(mLepType==LepTau) { LoadBranch(b_PFTauPy); send=  mPFTauPy[id]; }
 	return send; 
 }
 Double_t  EventData::PFLepPz(UInt_t id)
 {
 	Double_t send=0.; 
-	if(mLepType=="m") send=  mPFMuonPz[id];
-	if(mLepType=="e") send=  mPFElecPz[id];
-	if(mLepType=="t") send=  mPFTauPz[id];
+	if(mLepType==LepMuon) { LoadBranch(b_PFMuonPz); send=  mPFMuonPz[id]; }
+	if(mLepType==LepElec) { LoadBranch(b_PFElecPz); send=  mPFElecPz[id]; }
+	if(mLepType==LepTau) { LoadBranch(b_PFTauPz); send=  mPFTauPz[id]; }
 	return send; 
 }
 Double_t  EventData::PFLepEta(UInt_t id)
 {
 	Double_t send=0.; 
-	if(mLepType=="m") send=  mPFMuonEta[id];
-	if(mLepType=="e") send=  mPFElecEta[id];
-	if(mLepType=="t") send=  mPFTauEta[id];
+	if(mLepType==LepMuon) { LoadBranch(b_PFMuonEta); send=  mPFMuonEta[id]; }
+	if(mLepType==LepElec) { LoadBranch(b_PFElecEta); send=  mPFElecEta[id]; }
+	if(mLepType==LepTau) { LoadBranch(b_PFTauEta); send=  mPFTauEta[id]; }
 	return send; 
 }
 Double_t  EventData::PFLepPhi(UInt_t id)
 {
 	Double_t send=0.; 
-	if(mLepType=="m") send=  mPFMuonPhi[id];
-	if(mLepType=="e") send=  mPFElecPhi[id];
-	if(mLepType=="t") send=  mPFTauPhi[id];
+	if(mLepType==LepMuon) { LoadBranch(b_PFMuonPhi); send=  mPFMuonPhi[id]; }
+	if(mLepType==LepElec) { LoadBranch(b_PFElecPhi); send=  mPFElecPhi[id]; }
+	if(mLepType==LepTau) { LoadBranch(b_PFTauPhi); send=  mPFTauPhi[id]; }
 	return send; 
 }
 Int_t  EventData::PFLepCharge(UInt_t id)
 {
 	Int_t send=0; 
-	if(mLepType=="m") send=  mPFMuonCharge[id];
-	if(mLepType=="e") send=  mPFElecCharge[id];
-	if(mLepType=="t") send=  mPFTauCharge[id]; 
+	if(mLepType==LepMuon) { LoadBranch(b_PFMuonCharge); send=  mPFMuonCharge[id]; }
+	if(mLepType==LepElec) { LoadBranch(b_PFElecCharge); send=  mPFElecCharge[id]; }
+	if(mLepType==LepTau) { LoadBranch(b_PFTauCharge); send=  mPFTauCharge[id]; } 
 	return send; 
 }
 
-Int_t           EventData::NMuon()                                           {   return  mNMuon;                                   }
-Double_t        EventData::MuonPt(UInt_t id)                                 {   return  mMuonPt[id];                              }
-Double_t        EventData::MuonEt(UInt_t id)                                 {   return  mMuonEt[id];                              }
-Double_t        EventData::MuonE(UInt_t id)                                  {   return  mMuonE[id];                               }
-Double_t        EventData::MuonPx(UInt_t id)                                 {   return  mMuonPx[id];                              }
-Double_t        EventData::MuonPy(UInt_t id)                                 {   return  mMuonPy[id];                              }
-Double_t        EventData::MuonPz(UInt_t id)                                 {   return  mMuonPz[id];                              }
-Double_t        EventData::MuonEta(UInt_t id)                                {   return  mMuonEta[id];                             }
-Double_t        EventData::MuonPhi(UInt_t id)                                {   return  mMuonPhi[id];                             }
-Double_t        EventData::MuonCharge(UInt_t id)                             {   return  mMuonCharge[id];                          }
-Int_t           EventData::MuonIsGlobal(UInt_t id)                           {   return  mMuonIsGlobal[id];                        }
-Int_t           EventData::MuonIsStandAlone(UInt_t id)                       {   return  mMuonIsStandAlone[id];                    }
-Int_t           EventData::MuonIsTracker(UInt_t id)                          {   return  mMuonIsTracker[id];                       }
-Double_t        EventData::MuonSumPtDR03(UInt_t id)                          {   return  mMuonSumPtDR03[id];                       }
-Double_t        EventData::MuonSumPtDR05(UInt_t id)                          {   return  mMuonSumPtDR05[id];                       }
-Double_t        EventData::MuonEmEtDR03(UInt_t id)                           {   return  mMuonEmEtDR03[id];                        }
-Double_t        EventData::MuonHadEtDR03(UInt_t id)                          {   return  mMuonHadEtDR03[id];                       }
-Int_t           EventData::MuonNumOfMatches(UInt_t id)                       {   return  mMuonNumOfMatches[id];                    }
-Double_t        EventData::MuonCombChi2Norm(UInt_t id)                       {   return  mMuonCombChi2Norm[id];                    }
-Int_t           EventData::MuonCombValidHits(UInt_t id)                      {   return  mMuonCombValidHits[id];                   }
-Int_t           EventData::MuonCombLostHits(UInt_t id)                       {   return  mMuonCombLostHits[id];                    }
-Double_t        EventData::MuonCombPt(UInt_t id)                             {   return  mMuonCombPt[id];                          }
-Double_t        EventData::MuonCombPz(UInt_t id)                             {   return  mMuonCombPz[id];                          }
-Double_t        EventData::MuonCombP(UInt_t id)                              {   return  mMuonCombP[id];                           }
-Double_t        EventData::MuonCombEta(UInt_t id)                            {   return  mMuonCombEta[id];                         }
-Double_t        EventData::MuonCombPhi(UInt_t id)                            {   return  mMuonCombPhi[id];                         }
-Double_t        EventData::MuonCombChi2(UInt_t id)                           {   return  mMuonCombChi2[id];                        }
-Double_t        EventData::MuonCombCharge(UInt_t id)                         {   return  mMuonCombCharge[id];                      }
-Double_t        EventData::MuonCombQOverPError(UInt_t id)                    {   return  mMuonCombQOverPError[id];                 }
-Double_t        EventData::MuonCombNdof(UInt_t id)                           {   return  mMuonCombNdof[id];                        }
-Double_t        EventData::MuonCombVx(UInt_t id)                             {   return  mMuonCombVx[id];                          }
-Double_t        EventData::MuonCombVy(UInt_t id)                             {   return  mMuonCombVy[id];                          }
-Double_t        EventData::MuonCombVz(UInt_t id)                             {   return  mMuonCombVz[id];                          }
-Double_t        EventData::MuonCombD0(UInt_t id)                             {   return  mMuonCombD0[id];                          }
-Double_t        EventData::MuonCombDz(UInt_t id)                             {   return  mMuonCombDz[id];                          }
-Double_t        EventData::MuonStandChi2Norm(UInt_t id)                      {   return  mMuonStandChi2Norm[id];                   }
-Int_t           EventData::MuonStandValidHits(UInt_t id)                     {   return  mMuonStandValidHits[id];                  }
-Int_t           EventData::MuonStandLostHits(UInt_t id)                      {   return  mMuonStandLostHits[id];                   }
-Double_t        EventData::MuonStandPt(UInt_t id)                            {   return  mMuonStandPt[id];                         }
-Double_t        EventData::MuonStandPz(UInt_t id)                            {   return  mMuonStandPz[id];                         }
-Double_t        EventData::MuonStandP(UInt_t id)                             {   return  mMuonStandP[id];                          }
-Double_t        EventData::MuonStandEta(UInt_t id)                           {   return  mMuonStandEta[id];                        }
-Double_t        EventData::MuonStandPhi(UInt_t id)                           {   return  mMuonStandPhi[id];                        }
-Double_t        EventData::MuonStandChi2(UInt_t id)                          {   return  mMuonStandChi2[id];                       }
-Double_t        EventData::MuonStandCharge(UInt_t id)                        {   return  mMuonStandCharge[id];                     }
-Double_t        EventData::MuonStandQOverPError(UInt_t id)                   {   return  mMuonStandQOverPError[id];                }
-Double_t        EventData::MuonTrkChi2Norm(UInt_t id)                        {   return  mMuonTrkChi2Norm[id];                     }
-Int_t           EventData::MuonTrkValidHits(UInt_t id)                       {   return  mMuonTrkValidHits[id];                    }
-Int_t           EventData::MuonTrkLostHits(UInt_t id)                        {   return  mMuonTrkLostHits[id];                     }
-Double_t        EventData::MuonTrkPt(UInt_t id)                              {   return  mMuonTrkPt[id];                           }
-Double_t        EventData::MuonTrkPz(UInt_t id)                              {   return  mMuonTrkPz[id];                           }
-Double_t        EventData::MuonTrkP(UInt_t id)                               {   return  mMuonTrkP[id];                            }
-Double_t        EventData::MuonTrkEta(UInt_t id)                             {   return  mMuonTrkEta[id];                          }
-Double_t        EventData::MuonTrkPhi(UInt_t id)                             {   return  mMuonTrkPhi[id];                          }
-Double_t        EventData::MuonTrkChi2(UInt_t id)                            {   return  mMuonTrkChi2[id];                         }
-Double_t        EventData::MuonTrkCharge(UInt_t id)                          {   return  mMuonTrkCharge[id];                       }
-Double_t        EventData::MuonTrkQOverPError(UInt_t id)                     {   return  mMuonTrkQOverPError[id];                  }
-Double_t        EventData::MuonTrkDxy(UInt_t id)                             {   return  mMuonTrkDxy[id];                          }
-Int_t           EventData::MuonTrkNumOfValidPixHits(UInt_t id)               {   return  mMuonTrkNumOfValidPixHits[id];            }
+Int_t           EventData::NMuon()                                           {   LoadBranch(b_NMuon); return  mNMuon;              }
+Double_t        EventData::MuonPt(UInt_t id)                                 {   LoadBranch(b_MuonPt); return  mMuonPt[id];        }
+Double_t        EventData::MuonEt(UInt_t id)                                 {   LoadBranch(b_MuonEt); return  mMuonEt[id];        }
+Double_t        EventData::MuonE(UInt_t id)                                  {   LoadBranch(b_MuonE); return  mMuonE[id];          }
+Double_t        EventData::MuonPx(UInt_t id)                                 {   LoadBranch(b_MuonPx); return  mMuonPx[id];        }
+Double_t        EventData::MuonPy(UInt_t id)                                 {   LoadBranch(b_MuonPy); return  mMuonPy[id];        }
+Double_t        EventData::MuonPz(UInt_t id)                                 {   LoadBranch(b_MuonPz); return  mMuonPz[id];        }
+Double_t        EventData::MuonEta(UInt_t id)                                {   LoadBranch(b_MuonEta); return  mMuonEta[id];      }
+Double_t        EventData::MuonPhi(UInt_t id)                                {   LoadBranch(b_MuonPhi); return  mMuonPhi[id];      }
+Double_t        EventData::MuonCharge(UInt_t id)                             {   LoadBranch(b_MuonCharge); return  mMuonCharge[id]; }
+Int_t           EventData::MuonIsGlobal(UInt_t id)                           {   LoadBranch(b_MuonIsGlobal); return  mMuonIsGlobal[id]; }
+Int_t           EventData::MuonIsStandAlone(UInt_t id)                       {   LoadBranch(b_MuonIsStandAlone); return  mMuonIsStandAlone[id]; }
+Int_t           EventData::MuonIsTracker(UInt_t id)                          {   LoadBranch(b_MuonIsTracker); return  mMuonIsTracker[id]; }
+Double_t        EventData::MuonSumPtDR03(UInt_t id)                          {   LoadBranch(b_MuonSumPtDR03); return  mMuonSumPtDR03[id]; }
+Double_t        EventData::MuonSumPtDR05(UInt_t id)                          {   LoadBranch(b_MuonSumPtDR05); return  mMuonSumPtDR05[id]; }
+Double_t        EventData::MuonEmEtDR03(UInt_t id)                           {   LoadBranch(b_MuonEmEtDR03); return  mMuonEmEtDR03[id]; }
+Double_t        EventData::MuonHadEtDR03(UInt_t id)                          {   LoadBranch(b_MuonHadEtDR03); return  mMuonHadEtDR03[id]; }
+Int_t           EventData::MuonNumOfMatches(UInt_t id)                       {   LoadBranch(b_MuonNumOfMatches); return  mMuonNumOfMatches[id]; }
+Double_t        EventData::MuonCombChi2Norm(UInt_t id)                       {   LoadBranch(b_MuonCombChi2Norm); return  mMuonCombChi2Norm[id]; }
+Int_t           EventData::MuonCombValidHits(UInt_t id)                      {   LoadBranch(b_MuonCombValidHits); return  mMuonCombValidHits[id]; }
+Int_t           EventData::MuonCombLostHits(UInt_t id)                       {   LoadBranch(b_MuonCombLostHits); return  mMuonCombLostHits[id]; }
+Double_t        EventData::MuonCombPt(UInt_t id)                             {   LoadBranch(b_MuonCombPt); return  mMuonCombPt[id]; }
+Double_t        EventData::MuonCombPz(UInt_t id)                             {   LoadBranch(b_MuonCombPz); return  mMuonCombPz[id]; }
+Double_t        EventData::MuonCombP(UInt_t id)                              {   LoadBranch(b_MuonCombP); return  mMuonCombP[id];  }
+Double_t        EventData::MuonCombEta(UInt_t id)                            {   LoadBranch(b_MuonCombEta); return  mMuonCombEta[id]; }
+Double_t        EventData::MuonCombPhi(UInt_t id)                            {   LoadBranch(b_MuonCombPhi); return  mMuonCombPhi[id]; }
+Double_t        EventData::MuonCombChi2(UInt_t id)                           {   LoadBranch(b_MuonCombChi2); return  mMuonCombChi2[id]; }
+Double_t        EventData::MuonCombCharge(UInt_t id)                         {   LoadBranch(b_MuonCombCharge); return  mMuonCombCharge[id]; }
+Double_t        EventData::MuonCombQOverPError(UInt_t id)                    {   LoadBranch(b_MuonCombQOverPError); return  mMuonCombQOverPError[id]; }
+Double_t        EventData::MuonCombNdof(UInt_t id)                           {   LoadBranch(b_MuonCombNdof); return  mMuonCombNdof[id]; }
+Double_t        EventData::MuonCombVx(UInt_t id)                             {   LoadBranch(b_MuonCombVx); return  mMuonCombVx[id]; }
+Double_t        EventData::MuonCombVy(UInt_t id)                             {   LoadBranch(b_MuonCombVy); return  mMuonCombVy[id]; }
+Double_t        EventData::MuonCombVz(UInt_t id)                             {   LoadBranch(b_MuonCombVz); return  mMuonCombVz[id]; }
+Double_t        EventData::MuonCombD0(UInt_t id)                             {   LoadBranch(b_MuonCombD0); return  mMuonCombD0[id]; }
+Double_t        EventData::MuonCombDz(UInt_t id)                             {   LoadBranch(b_MuonCombDz); return  mMuonCombDz[id]; }
+Double_t        EventData::MuonStandChi2Norm(UInt_t id)                      {   LoadBranch(b_MuonStandChi2Norm); return  mMuonStandChi2Norm[id]; }
+Int_t           EventData::MuonStandValidHits(UInt_t id)                     {   LoadBranch(b_MuonStandValidHits); return  mMuonStandValidHits[id]; }
+Int_t           EventData::MuonStandLostHits(UInt_t id)                      {   LoadBranch(b_MuonStandLostHits); return  mMuonStandLostHits[id]; }
+Double_t        EventData::MuonStandPt(UInt_t id)                            {   LoadBranch(b_MuonStandPt); return  mMuonStandPt[id]; }
+Double_t        EventData::MuonStandPz(UInt_t id)                            {   LoadBranch(b_MuonStandPz); return  mMuonStandPz[id]; }
+Double_t        EventData::MuonStandP(UInt_t id)                             {   LoadBranch(b_MuonStandP); return  mMuonStandP[id]; }
+Double_t        EventData::MuonStandEta(UInt_t id)                           {   LoadBranch(b_MuonStandEta); return  mMuonStandEta[id]; }
+Double_t        EventData::MuonStandPhi(UInt_t id)                           {   LoadBranch(b_MuonStandPhi); return  mMuonStandPhi[id]; }
+Double_t        EventData::MuonStandChi2(UInt_t id)                          {   LoadBranch(b_MuonStandChi2); return  mMuonStandChi2[id]; }
+Double_t        EventData::MuonStandCharge(UInt_t id)                        {   LoadBranch(b_MuonStandCharge); return  mMuonStandCharge[id]; }
+Double_t        EventData::MuonStandQOverPError(UInt_t id)                   {   LoadBranch(b_MuonStandQOverPError); return  mMuonStandQOverPError[id]; }
+Double_t        EventData::MuonTrkChi2Norm(UInt_t id)                        {   LoadBranch(b_MuonTrkChi2Norm); return  mMuonTrkChi2Norm[id]; }
+Int_t           EventData::MuonTrkValidHits(UInt_t id)                       {   LoadBranch(b_MuonTrkValidHits); return  mMuonTrkValidHits[id]; }
+Int_t           EventData::MuonTrkLostHits(UInt_t id)                        {   LoadBranch(b_MuonTrkLostHits); return  mMuonTrkLostHits[id]; }
+Double_t        EventData::MuonTrkPt(UInt_t id)                              {   LoadBranch(b_MuonTrkPt); return  mMuonTrkPt[id];  }
+Double_t        EventData::MuonTrkPz(UInt_t id)                              {   LoadBranch(b_MuonTrkPz); return  mMuonTrkPz[id];  }
+Double_t        EventData::MuonTrkP(UInt_t id)                               {   LoadBranch(b_MuonTrkP); return  mMuonTrkP[id];    }
+Double_t        EventData::MuonTrkEta(UInt_t id)                             {   LoadBranch(b_MuonTrkEta); return  mMuonTrkEta[id]; }
+Double_t        EventData::MuonTrkPhi(UInt_t id)                             {   LoadBranch(b_MuonTrkPhi); return  mMuonTrkPhi[id]; }
+Double_t        EventData::MuonTrkChi2(UInt_t id)                            {   LoadBranch(b_MuonTrkChi2); return  mMuonTrkChi2[id]; }
+Double_t        EventData::MuonTrkCharge(UInt_t id)                          {   LoadBranch(b_MuonTrkCharge); return  mMuonTrkCharge[id]; }
+Double_t        EventData::MuonTrkQOverPError(UInt_t id)                     {   LoadBranch(b_MuonTrkQOverPError); return  mMuonTrkQOverPError[id]; }
+Double_t        EventData::MuonTrkDxy(UInt_t id)                             {   LoadBranch(b_MuonTrkDxy); return  mMuonTrkDxy[id]; }
+Int_t           EventData::MuonTrkNumOfValidPixHits(UInt_t id)               {   LoadBranch(b_MuonTrkNumOfValidPixHits); return  mMuonTrkNumOfValidPixHits[id]; }
 					
-Int_t           EventData::NPFMuon()                                         {   return  mNPFMuon;                                 }
-Double_t        EventData::PFMuonPt(UInt_t id)                               {   return  mPFMuonPt[id];                            }
-Double_t        EventData::PFMuonEt(UInt_t id)                               {   return  mPFMuonEt[id];                            }
-Double_t        EventData::PFMuonE(UInt_t id)                                {   return  mPFMuonE[id];                             }
-Double_t        EventData::PFMuonPx(UInt_t id)                               {   return  mPFMuonPx[id];                            }
-Double_t        EventData::PFMuonPy(UInt_t id)                               {   return  mPFMuonPy[id];                            }
-Double_t        EventData::PFMuonPz(UInt_t id)                               {   return  mPFMuonPz[id];                            }
-Double_t        EventData::PFMuonEta(UInt_t id)                              {   return  mPFMuonEta[id];                           }
-Double_t        EventData::PFMuonPhi(UInt_t id)                              {   return  mPFMuonPhi[id];                           }
-Int_t           EventData::PFMuonCharge(UInt_t id)                           {   return  mPFMuonCharge[id];                        }
-Int_t           EventData::PFMuonIsGlobal(UInt_t id)                         {   return  mPFMuonIsGlobal[id];                      }
-Int_t           EventData::PFMuonIsStandAlone(UInt_t id)                     {   return  mPFMuonIsStandAlone[id];                  }
-Int_t           EventData::PFMuonIsTracker(UInt_t id)                        {   return  mPFMuonIsTracker[id];                     }
-Int_t           EventData::PFMuonIsTight(UInt_t id)                          {   return  mPFMuonIsTight[id];                       }
-Int_t           EventData::PFMuonIsLoose(UInt_t id)                          {   return  mPFMuonIsLoose[id];                       }
-Double_t        EventData::PFMuonChargedHadronIso(UInt_t id)                 {   return  mPFMuonChargedHadronIso[id];              }
-Double_t        EventData::PFMuonPhotonIso(UInt_t id)                        {   return  mPFMuonPhotonIso[id];                     }
-Double_t        EventData::PFMuonNeutralHadronIso(UInt_t id)                 {   return  mPFMuonNeutralHadronIso[id];              }
-Int_t           EventData::PFMuonisGMPT(UInt_t id)                           {   return  mPFMuonisGMPT[id];                        }
-Int_t           EventData::PFMuonNumOfMatches(UInt_t id)                     {   return  mPFMuonNumOfMatches[id];                  }
-Double_t        EventData::PFMuoninnertrackPt(UInt_t id)                     {   return  mPFMuoninnertrackPt[id];                  }
-Int_t           EventData::PFMuonnValidHits(UInt_t id)                       {   return  mPFMuonnValidHits[id];                    }
-Int_t           EventData::PFMuonnValidPixelHits(UInt_t id)                  {   return  mPFMuonnValidPixelHits[id];               }
-Double_t        EventData::PFMuondxy(UInt_t id)                              {   return  mPFMuondxy[id];                           }
-Double_t        EventData::PFMuondz(UInt_t id)                               {   return  mPFMuondz[id];                            }
-Double_t        EventData::PFMuonCombChi2Norm(UInt_t id)                     {   return  mPFMuonCombChi2Norm[id];                  }
-Int_t           EventData::PFMuonCombValidHits(UInt_t id)                    {   return  mPFMuonCombValidHits[id];                 }
-Int_t           EventData::PFMuonCombLostHits(UInt_t id)                     {   return  mPFMuonCombLostHits[id];                  }
-Double_t        EventData::PFMuonCombPt(UInt_t id)                           {   return  mPFMuonCombPt[id];                        }
-Double_t        EventData::PFMuonCombPz(UInt_t id)                           {   return  mPFMuonCombPz[id];                        }
-Double_t        EventData::PFMuonCombP(UInt_t id)                            {   return  mPFMuonCombP[id];                         }
-Double_t        EventData::PFMuonCombEta(UInt_t id)                          {   return  mPFMuonCombEta[id];                       }
-Double_t        EventData::PFMuonCombPhi(UInt_t id)                          {   return  mPFMuonCombPhi[id];                       }
-Double_t        EventData::PFMuonCombChi2(UInt_t id)                         {   return  mPFMuonCombChi2[id];                      }
-Double_t        EventData::PFMuonCombCharge(UInt_t id)                       {   return  mPFMuonCombCharge[id];                    }
-Double_t        EventData::PFMuonCombQOverPError(UInt_t id)                  {   return  mPFMuonCombQOverPError[id];               }
-Double_t        EventData::PFMuonCombNdof(UInt_t id)                         {   return  mPFMuonCombNdof[id];                      }
-Double_t        EventData::PFMuonCombVx(UInt_t id)                           {   return  mPFMuonCombVx[id];                        }
-Double_t        EventData::PFMuonCombVy(UInt_t id)                           {   return  mPFMuonCombVy[id];                        }
-Double_t        EventData::PFMuonCombVz(UInt_t id)                           {   return  mPFMuonCombVz[id];                        }
-Double_t        EventData::PFMuonCombD0(UInt_t id)                           {   return  mPFMuonCombD0[id];                        }
-Double_t        EventData::PFMuonCombDz(UInt_t id)                           {   return  mPFMuonCombDz[id];                        }
-Double_t        EventData::PFMuonStandChi2Norm(UInt_t id)                    {   return  mPFMuonStandChi2Norm[id];                 }
-Int_t           EventData::PFMuonStandValidHits(UInt_t id)                   {   return  mPFMuonStandValidHits[id];                }
-Int_t           EventData::PFMuonStandLostHits(UInt_t id)                    {   return  mPFMuonStandLostHits[id];                 }
-Double_t        EventData::PFMuonStandPt(UInt_t id)                          {   return  mPFMuonStandPt[id];                       }
-Double_t        EventData::PFMuonStandPz(UInt_t id)                          {   return  mPFMuonStandPz[id];                       }
-Double_t        EventData::PFMuonStandP(UInt_t id)                           {   return  mPFMuonStandP[id];                        }
-Double_t        EventData::PFMuonStandEta(UInt_t id)                         {   return  mPFMuonStandEta[id];                      }
-Double_t        EventData::PFMuonStandPhi(UInt_t id)                         {   return  mPFMuonStandPhi[id];                      }
-Double_t        EventData::PFMuonStandChi2(UInt_t id)                        {   return  mPFMuonStandChi2[id];                     }
-Double_t        EventData::PFMuonStandCharge(UInt_t id)                      {   return  mPFMuonStandCharge[id];                   }
-Double_t        EventData::PFMuonStandQOverPError(UInt_t id)                 {   return  mPFMuonStandQOverPError[id];              }
-Double_t        EventData::PFMuonTrkChi2Norm(UInt_t id)                      {   return  mPFMuonTrkChi2Norm[id];                   }
-Int_t           EventData::PFMuonTrkValidHits(UInt_t id)                     {   return  mPFMuonTrkValidHits[id];                  }
-Int_t           EventData::PFMuonTrkLostHits(UInt_t id)                      {   return  mPFMuonTrkLostHits[id];                   }
-Double_t        EventData::PFMuonTrkPt(UInt_t id)                            {   return  mPFMuonTrkPt[id];                         }
-Double_t        EventData::PFMuonTrkPz(UInt_t id)                            {   return  mPFMuonTrkPz[id];                         }
-Double_t        EventData::PFMuonTrkP(UInt_t id)                             {   return  mPFMuonTrkP[id];                          }
-Double_t        EventData::PFMuonTrkEta(UInt_t id)                           {   return  mPFMuonTrkEta[id];                        }
-Double_t        EventData::PFMuonTrkPhi(UInt_t id)                           {   return  mPFMuonTrkPhi[id];                        }
-Double_t        EventData::PFMuonTrkChi2(UInt_t id)                          {   return  mPFMuonTrkChi2[id];                       }
-Double_t        EventData::PFMuonTrkCharge(UInt_t id)                        {   return  mPFMuonTrkCharge[id];                     }
-Double_t        EventData::PFMuonTrkQOverPError(UInt_t id)                   {   return  mPFMuonTrkQOverPError[id];                }
-Double_t        EventData::PFMuonTrkDxy(UInt_t id)                           {   return  mPFMuonTrkDxy[id];                        }
-Double_t        EventData::PFMuonTrkNumOfValidPixHits(UInt_t id)             {   return  mPFMuonTrkNumOfValidPixHits[id];          }
-Double_t        EventData::PFMuonR04ChargedHadronPt(UInt_t id)               {   return  mPFMuonR04ChargedHadronPt[id];            }
-Double_t        EventData::PFMuonR04NeutralHadronEt(UInt_t id)               {   return  mPFMuonR04NeutralHadronEt[id];            }
-Double_t        EventData::PFMuonR04PhotonEt(UInt_t id)                      {   return  mPFMuonR04PhotonEt[id];                   }
-Double_t        EventData::PFMuonR04PUPt(UInt_t id)                          {   return  mPFMuonR04PUPt[id];                       }
+Int_t           EventData::NPFMuon()                                         {   LoadBranch(b_NPFMuon); return  mNPFMuon;          }
+Double_t        EventData::PFMuonPt(UInt_t id)                               {   LoadBranch(b_PFMuonPt); return  mPFMuonPt[id];    }
+Double_t        EventData::PFMuonEt(UInt_t id)                               {   LoadBranch(b_PFMuonEt); return  mPFMuonEt[id];    }
+Double_t        EventData::PFMuonE(UInt_t id)                                {   LoadBranch(b_PFMuonE); return  mPFMuonE[id];      }
+Double_t        EventData::PFMuonPx(UInt_t id)                               {   LoadBranch(b_PFMuonPx); return  mPFMuonPx[id];    }
+Double_t        EventData::PFMuonPy(UInt_t id)                               {   LoadBranch(b_PFMuonPy); return  mPFMuonPy[id];    }
+Double_t        EventData::PFMuonPz(UInt_t id)                               {   LoadBranch(b_PFMuonPz); return  mPFMuonPz[id];    }
+Double_t        EventData::PFMuonEta(UInt_t id)                              {   LoadBranch(b_PFMuonEta); return  mPFMuonEta[id];  }
+Double_t        EventData::PFMuonPhi(UInt_t id)                              {   LoadBranch(b_PFMuonPhi); return  mPFMuonPhi[id];  }
+Int_t           EventData::PFMuonCharge(UInt_t id)                           {   LoadBranch(b_PFMuonCharge); return  mPFMuonCharge[id]; }
+Int_t           EventData::PFMuonIsGlobal(UInt_t id)                         {   LoadBranch(b_PFMuonIsGlobal); return  mPFMuonIsGlobal[id]; }
+Int_t           EventData::PFMuonIsStandAlone(UInt_t id)                     {   LoadBranch(b_PFMuonIsStandAlone); return  mPFMuonIsStandAlone[id]; }
+Int_t           EventData::PFMuonIsTracker(UInt_t id)                        {   LoadBranch(b_PFMuonIsTracker); return  mPFMuonIsTracker[id]; }
+Int_t           EventData::PFMuonIsTight(UInt_t id)                          {   LoadBranch(b_PFMuonIsTight); return  mPFMuonIsTight[id]; }
+Int_t           EventData::PFMuonIsLoose(UInt_t id)                          {   LoadBranch(b_PFMuonIsLoose); return  mPFMuonIsLoose[id]; }
+Double_t        EventData::PFMuonChargedHadronIso(UInt_t id)                 {   LoadBranch(b_PFMuonChargedHadronIso); return  mPFMuonChargedHadronIso[id]; }
+Double_t        EventData::PFMuonPhotonIso(UInt_t id)                        {   LoadBranch(b_PFMuonPhotonIso); return  mPFMuonPhotonIso[id]; }
+Double_t        EventData::PFMuonNeutralHadronIso(UInt_t id)                 {   LoadBranch(b_PFMuonNeutralHadronIso); return  mPFMuonNeutralHadronIso[id]; }
+Int_t           EventData::PFMuonisGMPT(UInt_t id)                           {   LoadBranch(b_PFMuonisGMPT); return  mPFMuonisGMPT[id]; }
+Int_t           EventData::PFMuonNumOfMatches(UInt_t id)                     {   LoadBranch(b_PFMuonNumOfMatches); return  mPFMuonNumOfMatches[id]; }
+Double_t        EventData::PFMuoninnertrackPt(UInt_t id)                     {   LoadBranch(b_PFMuoninnertrackPt); return  mPFMuoninnertrackPt[id]; }
+Int_t           EventData::PFMuonnValidHits(UInt_t id)                       {   LoadBranch(b_PFMuonnValidHits); return  mPFMuonnValidHits[id]; }
+Int_t           EventData::PFMuonnValidPixelHits(UInt_t id)                  {   LoadBranch(b_PFMuonnValidPixelHits); return  mPFMuonnValidPixelHits[id]; }
+Double_t        EventData::PFMuondxy(UInt_t id)                              {   LoadBranch(b_PFMuondxy); return  mPFMuondxy[id];  }
+Double_t        EventData::PFMuondz(UInt_t id)                               {   LoadBranch(b_PFMuondz); return  mPFMuondz[id];    }
+Double_t        EventData::PFMuonCombChi2Norm(UInt_t id)                     {   LoadBranch(b_PFMuonCombChi2Norm); return  mPFMuonCombChi2Norm[id]; }
+Int_t           EventData::PFMuonCombValidHits(UInt_t id)                    {   LoadBranch(b_PFMuonCombValidHits); return  mPFMuonCombValidHits[id]; }
+Int_t           EventData::PFMuonCombLostHits(UInt_t id)                     {   LoadBranch(b_PFMuonCombLostHits); return  mPFMuonCombLostHits[id]; }
+Double_t        EventData::PFMuonCombPt(UInt_t id)                           {   LoadBranch(b_PFMuonCombPt); return  mPFMuonCombPt[id]; }
+Double_t        EventData::PFMuonCombPz(UInt_t id)                           {   LoadBranch(b_PFMuonCombPz); return  mPFMuonCombPz[id]; }
+Double_t        EventData::PFMuonCombP(UInt_t id)                            {   LoadBranch(b_PFMuonCombP); return  mPFMuonCombP[id]; }
+Double_t        EventData::PFMuonCombEta(UInt_t id)                          {   LoadBranch(b_PFMuonCombEta); return  mPFMuonCombEta[id]; }
+Double_t        EventData::PFMuonCombPhi(UInt_t id)                          {   LoadBranch(b_PFMuonCombPhi); return  mPFMuonCombPhi[id]; }
+Double_t        EventData::PFMuonCombChi2(UInt_t id)                         {   LoadBranch(b_PFMuonCombChi2); return  mPFMuonCombChi2[id]; }
+Double_t        EventData::PFMuonCombCharge(UInt_t id)                       {   LoadBranch(b_PFMuonCombCharge); return  mPFMuonCombCharge[id]; }
+Double_t        EventData::PFMuonCombQOverPError(UInt_t id)                  {   LoadBranch(b_PFMuonCombQOverPError); return  mPFMuonCombQOverPError[id]; }
+Double_t        EventData::PFMuonCombNdof(UInt_t id)                         {   LoadBranch(b_PFMuonCombNdof); return  mPFMuonCombNdof[id]; }
+Double_t        EventData::PFMuonCombVx(UInt_t id)                           {   LoadBranch(b_PFMuonCombVx); return  mPFMuonCombVx[id]; }
+Double_t        EventData::PFMuonCombVy(UInt_t id)                           {   LoadBranch(b_PFMuonCombVy); return  mPFMuonCombVy[id]; }
+Double_t        EventData::PFMuonCombVz(UInt_t id)                           {   LoadBranch(b_PFMuonCombVz); return  mPFMuonCombVz[id]; }
+Double_t        EventData::PFMuonCombD0(UInt_t id)                           {   LoadBranch(b_PFMuonCombD0); return  mPFMuonCombD0[id]; }
+Double_t        EventData::PFMuonCombDz(UInt_t id)                           {   LoadBranch(b_PFMuonCombDz); return  mPFMuonCombDz[id]; }
+Double_t        EventData::PFMuonStandChi2Norm(UInt_t id)                    {   LoadBranch(b_PFMuonStandChi2Norm); return  mPFMuonStandChi2Norm[id]; }
+Int_t           EventData::PFMuonStandValidHits(UInt_t id)                   {   LoadBranch(b_PFMuonStandValidHits); return  mPFMuonStandValidHits[id]; }
+Int_t           EventData::PFMuonStandLostHits(UInt_t id)                    {   LoadBranch(b_PFMuonStandLostHits); return  mPFMuonStandLostHits[id]; }
+Double_t        EventData::PFMuonStandPt(UInt_t id)                          {   LoadBranch(b_PFMuonStandPt); return  mPFMuonStandPt[id]; }
+Double_t        EventData::PFMuonStandPz(UInt_t id)                          {   LoadBranch(b_PFMuonStandPz); return  mPFMuonStandPz[id]; }
+Double_t        EventData::PFMuonStandP(UInt_t id)                           {   LoadBranch(b_PFMuonStandP); return  mPFMuonStandP[id]; }
+Double_t        EventData::PFMuonStandEta(UInt_t id)                         {   LoadBranch(b_PFMuonStandEta); return  mPFMuonStandEta[id]; }
+Double_t        EventData::PFMuonStandPhi(UInt_t id)                         {   LoadBranch(b_PFMuonStandPhi); return  mPFMuonStandPhi[id]; }
+Double_t        EventData::PFMuonStandChi2(UInt_t id)                        {   LoadBranch(b_PFMuonStandChi2); return  mPFMuonStandChi2[id]; }
+Double_t        EventData::PFMuonStandCharge(UInt_t id)                      {   LoadBranch(b_PFMuonStandCharge); return  mPFMuonStandCharge[id]; }
+Double_t        EventData::PFMuonStandQOverPError(UInt_t id)                 {   LoadBranch(b_PFMuonStandQOverPError); return  mPFMuonStandQOverPError[id]; }
+Double_t        EventData::PFMuonTrkChi2Norm(UInt_t id)                      {   LoadBranch(b_PFMuonTrkChi2Norm); return  mPFMuonTrkChi2Norm[id]; }
+Int_t           EventData::PFMuonTrkValidHits(UInt_t id)                     {   LoadBranch(b_PFMuonTrkValidHits); return  mPFMuonTrkValidHits[id]; }
+Int_t           EventData::PFMuonTrkLostHits(UInt_t id)                      {   LoadBranch(b_PFMuonTrkLostHits); return  mPFMuonTrkLostHits[id]; }
+Double_t        EventData::PFMuonTrkPt(UInt_t id)                            {   LoadBranch(b_PFMuonTrkPt); return  mPFMuonTrkPt[id]; }
+Double_t        EventData::PFMuonTrkPz(UInt_t id)                            {   LoadBranch(b_PFMuonTrkPz); return  mPFMuonTrkPz[id]; }
+Double_t        EventData::PFMuonTrkP(UInt_t id)                             {   LoadBranch(b_PFMuonTrkP); return  mPFMuonTrkP[id]; }
+Double_t        EventData::PFMuonTrkEta(UInt_t id)                           {   LoadBranch(b_PFMuonTrkEta); return  mPFMuonTrkEta[id]; }
+Double_t        EventData::PFMuonTrkPhi(UInt_t id)                           {   LoadBranch(b_PFMuonTrkPhi); return  mPFMuonTrkPhi[id]; }
+Double_t        EventData::PFMuonTrkChi2(UInt_t id)                          {   LoadBranch(b_PFMuonTrkChi2); return  mPFMuonTrkChi2[id]; }
+Double_t        EventData::PFMuonTrkCharge(UInt_t id)                        {   LoadBranch(b_PFMuonTrkCharge); return  mPFMuonTrkCharge[id]; }
+Double_t        EventData::PFMuonTrkQOverPError(UInt_t id)                   {   LoadBranch(b_PFMuonTrkQOverPError); return  mPFMuonTrkQOverPError[id]; }
+Double_t        EventData::PFMuonTrkDxy(UInt_t id)                           {   LoadBranch(b_PFMuonTrkDxy); return  mPFMuonTrkDxy[id]; }
+Double_t        EventData::PFMuonTrkNumOfValidPixHits(UInt_t id)             {   LoadBranch(b_PFMuonTrkNumOfValidPixHits); return  mPFMuonTrkNumOfValidPixHits[id]; }
+Double_t        EventData::PFMuonR04ChargedHadronPt(UInt_t id)               {   LoadBranch(b_PFMuonR04ChargedHadronPt); return  mPFMuonR04ChargedHadronPt[id]; }
+Double_t        EventData::PFMuonR04NeutralHadronEt(UInt_t id)               {   LoadBranch(b_PFMuonR04NeutralHadronEt); return  mPFMuonR04NeutralHadronEt[id]; }
+Double_t        EventData::PFMuonR04PhotonEt(UInt_t id)                      {   LoadBranch(b_PFMuonR04PhotonEt); return  mPFMuonR04PhotonEt[id]; }
+Double_t        EventData::PFMuonR04PUPt(UInt_t id)                          {   LoadBranch(b_PFMuonR04PUPt); return  mPFMuonR04PUPt[id]; }
 						
-Int_t           EventData::NElec()                                           {   return  mNElec;                                   }
-Double_t        EventData::ElecE(UInt_t id)                                  {   return  mElecE[id];                               }
-Double_t        EventData::ElecPt(UInt_t id)                                 {   return  mElecPt[id];                              }
-Double_t        EventData::ElecPx(UInt_t id)                                 {   return  mElecPx[id];                              }
-Double_t        EventData::ElecPy(UInt_t id)                                 {   return  mElecPy[id];                              }
-Double_t        EventData::ElecPz(UInt_t id)                                 {   return  mElecPz[id];                              }
-Int_t           EventData::ElecEcalseed(UInt_t id)                           {   return  mElecEcalseed[id];                        }
-Int_t           EventData::ElecID80(UInt_t id)                               {   return  mElecID80[id];                            }
-Int_t           EventData::ElecID95(UInt_t id)                               {   return  mElecID95[id];                            }
-Double_t        EventData::ElecEta(UInt_t id)                                {   return  mElecEta[id];                             }
-Double_t        EventData::ElecPhi(UInt_t id)                                {   return  mElecPhi[id];                             }
-Int_t           EventData::ElecCharge(UInt_t id)                             {   return  mElecCharge[id];                          }
-Double_t        EventData::Elecdr03HcalTowerSumEt(UInt_t id)                 {   return  mElecdr03HcalTowerSumEt[id];              }
-Double_t        EventData::Elecdr03EcalRecHitSumEt(UInt_t id)                {   return  mElecdr03EcalRecHitSumEt[id];             }
-Double_t        EventData::Elecdr03TkSumPt(UInt_t id)                        {   return  mElecdr03TkSumPt[id];                     }
-Int_t           EventData::ElecNumOfValidHits(UInt_t id)                     {   return  mElecNumOfValidHits[id];                  }
-Int_t           EventData::ElecInnerNumOfHits(UInt_t id)                     {   return  mElecInnerNumOfHits[id];                  }
-Double_t        EventData::Elecdist(UInt_t id)                               {   return  mElecdist[id];                            }
-Double_t        EventData::Elecdcot(UInt_t id)                               {   return  mElecdcot[id];                            }
-Double_t        EventData::ElecNormChi2(UInt_t id)                           {   return  mElecNormChi2[id];                        }
-Double_t        EventData::Elecdxy(UInt_t id)                                {   return  mElecdxy[id];                             }
-Double_t        EventData::Elecdz(UInt_t id)                                 {   return  mElecdz[id];                              }
-Int_t           EventData::ElecdB(UInt_t id)                                 {   return  mElecdB[id];                              }
-Int_t           EventData::ElecIsEB(UInt_t id)                               {   return  mElecIsEB[id];                            }
-Double_t        EventData::Elecfbrem(UInt_t id)                              {   return  mElecfbrem[id];                           }
-Double_t        EventData::ElecDEtaSuTrAtVtx(UInt_t id)                      {   return  mElecDEtaSuTrAtVtx[id];                   }
-Double_t        EventData::ElecDPhiSuTrAtVtx(UInt_t id)                      {   return  mElecDPhiSuTrAtVtx[id];                   }
-Double_t        EventData::ElecHadronicOverEm(UInt_t id)                     {   return  mElecHadronicOverEm[id];                  }
-Double_t        EventData::ElecHcalOverEcal(UInt_t id)                       {   return  mElecHcalOverEcal[id];                    }
-Double_t        EventData::ElecSuperClusOverP(UInt_t id)                     {   return  mElecSuperClusOverP[id];                  }
-Double_t        EventData::Elecetaeta(UInt_t id)                             {   return  mElecetaeta[id];                          }
-Double_t        EventData::Elecietaieta(UInt_t id)                           {   return  mElecietaieta[id];                        }
+Int_t           EventData::NElec()                                           {   LoadBranch(b_NElec); return  mNElec;              }
+Double_t        EventData::ElecE(UInt_t id)                                  {   LoadBranch(b_ElecE); return  mElecE[id];          }
+Double_t        EventData::ElecPt(UInt_t id)                                 {   LoadBranch(b_ElecPt); return  mElecPt[id];        }
+Double_t        EventData::ElecPx(UInt_t id)                                 {   LoadBranch(b_ElecPx); return  mElecPx[id];        }
+Double_t        EventData::ElecPy(UInt_t id)                                 {   LoadBranch(b_ElecPy); return  mElecPy[id];        }
+Double_t        EventData::ElecPz(UInt_t id)                                 {   LoadBranch(b_ElecPz); return  mElecPz[id];        }
+Int_t           EventData::ElecEcalseed(UInt_t id)                           {   LoadBranch(b_ElecEcalseed); return  mElecEcalseed[id]; }
+Int_t           EventData::ElecID80(UInt_t id)                               {   LoadBranch(b_ElecID80); return  mElecID80[id];    }
+Int_t           EventData::ElecID95(UInt_t id)                               {   LoadBranch(b_ElecID95); return  mElecID95[id];    }
+Double_t        EventData::ElecEta(UInt_t id)                                {   LoadBranch(b_ElecEta); return  mElecEta[id];      }
+Double_t        EventData::ElecPhi(UInt_t id)                                {   LoadBranch(b_ElecPhi); return  mElecPhi[id];      }
+Int_t           EventData::ElecCharge(UInt_t id)                             {   LoadBranch(b_ElecCharge); return  mElecCharge[id]; }
+Double_t        EventData::Elecdr03HcalTowerSumEt(UInt_t id)                 {   LoadBranch(b_Elecdr03HcalTowerSumEt); return  mElecdr03HcalTowerSumEt[id]; }
+Double_t        EventData::Elecdr03EcalRecHitSumEt(UInt_t id)                {   LoadBranch(b_Elecdr03EcalRecHitSumEt); return  mElecdr03EcalRecHitSumEt[id]; }
+Double_t        EventData::Elecdr03TkSumPt(UInt_t id)                        {   LoadBranch(b_Elecdr03TkSumPt); return  mElecdr03TkSumPt[id]; }
+Int_t           EventData::ElecNumOfValidHits(UInt_t id)                     {   LoadBranch(b_ElecNumOfValidHits); return  mElecNumOfValidHits[id]; }
+Int_t           EventData::ElecInnerNumOfHits(UInt_t id)                     {   LoadBranch(b_ElecInnerNumOfHits); return  mElecInnerNumOfHits[id]; }
+Double_t        EventData::Elecdist(UInt_t id)                               {   LoadBranch(b_Elecdist); return  mElecdist[id];    }
+Double_t        EventData::Elecdcot(UInt_t id)                               {   LoadBranch(b_Elecdcot); return  mElecdcot[id];    }
+Double_t        EventData::ElecNormChi2(UInt_t id)                           {   LoadBranch(b_ElecNormChi2); return  mElecNormChi2[id]; }
+Double_t        EventData::Elecdxy(UInt_t id)                                {   LoadBranch(b_Elecdxy); return  mElecdxy[id];      }
+Double_t        EventData::Elecdz(UInt_t id)                                 {   LoadBranch(b_Elecdz); return  mElecdz[id];        }
+Int_t           EventData::ElecdB(UInt_t id)                                 {   LoadBranch(b_ElecdB); return  mElecdB[id];        }
+Int_t           EventData::ElecIsEB(UInt_t id)                               {   LoadBranch(b_ElecIsEB); return  mElecIsEB[id];    }
+Double_t        EventData::Elecfbrem(UInt_t id)                              {   LoadBranch(b_Elecfbrem); return  mElecfbrem[id];  }
+Double_t        EventData::ElecDEtaSuTrAtVtx(UInt_t id)                      {   LoadBranch(b_ElecDEtaSuTrAtVtx); return  mElecDEtaSuTrAtVtx[id]; }
+Double_t        EventData::ElecDPhiSuTrAtVtx(UInt_t id)                      {   LoadBranch(b_ElecDPhiSuTrAtVtx); return  mElecDPhiSuTrAtVtx[id]; }
+Double_t        EventData::ElecHadronicOverEm(UInt_t id)                     {   LoadBranch(b_ElecHadronicOverEm); return  mElecHadronicOverEm[id]; }
+Double_t        EventData::ElecHcalOverEcal(UInt_t id)                       {   LoadBranch(b_ElecHcalOverEcal); return  mElecHcalOverEcal[id]; }
+Double_t        EventData::ElecSuperClusOverP(UInt_t id)                     {   LoadBranch(b_ElecSuperClusOverP); return  mElecSuperClusOverP[id]; }
+Double_t        EventData::Elecetaeta(UInt_t id)                             {   LoadBranch(b_Elecetaeta); return  mElecetaeta[id]; }
+Double_t        EventData::Elecietaieta(UInt_t id)                           {   LoadBranch(b_Elecietaieta); return  mElecietaieta[id]; }
 					
-Int_t           EventData::NPFElec()                                         {   return  mNPFElec;                                 }
-Int_t           EventData::PFElecCharge(UInt_t id)                           {   return  mPFElecCharge[id];                        }
-Int_t           EventData::PFElecIsEB(UInt_t id)                             {   return  mPFElecIsEB[id];                          }
-Double_t        EventData::PFElecPassTight(UInt_t id)                        {   return  mPFElecPassTight[id];                     }
-Double_t        EventData::PFElecE(UInt_t id)                                {   return  mPFElecE[id];                             }
-Double_t        EventData::PFElecPt(UInt_t id)                               {   return  mPFElecPt[id];                            }
-Double_t        EventData::PFElecPx(UInt_t id)                               {   return  mPFElecPx[id];                            }
-Double_t        EventData::PFElecPy(UInt_t id)                               {   return  mPFElecPy[id];                            }
-Double_t        EventData::PFElecPz(UInt_t id)                               {   return  mPFElecPz[id];                            }
-Double_t        EventData::PFElecEta(UInt_t id)                              {   return  mPFElecEta[id];                           }
-Double_t        EventData::PFElecPhi(UInt_t id)                              {   return  mPFElecPhi[id];                           }
-Double_t        EventData::PFElecCharHadIso(UInt_t id)                       {   return  mPFElecCharHadIso[id];                    }
-Double_t        EventData::PFElecPhoIso(UInt_t id)                           {   return  mPFElecPhoIso[id];                        }
-Double_t        EventData::PFElecNeuHadIso(UInt_t id)                        {   return  mPFElecNeuHadIso[id];                     }
-Double_t        EventData::PFElecMva(UInt_t id)                              {   return  mPFElecMva[id];                           }
-Double_t        EventData::PFElecdxy(UInt_t id)                              {   return  mPFElecdxy[id];                           }
-Double_t        EventData::PFElecdz(UInt_t id)                               {   return  mPFElecdz[id];                            }
-Double_t        EventData::PFElecHadOverEm(UInt_t id)                        {   return  mPFElecHadOverEm[id];                     }
-Double_t        EventData::PFElecHcalOverEm(UInt_t id)                       {   return  mPFElecHcalOverEm[id];                    }
-Double_t        EventData::PFElecSupClusOverP(UInt_t id)                     {   return  mPFElecSupClusOverP[id];                  }
-Double_t        EventData::PFElecInnerHits(UInt_t id)                        {   return  mPFElecInnerHits[id];                     }
-Double_t        EventData::PFElecConvDist(UInt_t id)                         {   return  mPFElecConvDist[id];                      }
-Double_t        EventData::PFElecConvDcot(UInt_t id)                         {   return  mPFElecConvDcot[id];                      }
-Double_t        EventData::PFElecDEtaSuTrAtVtx(UInt_t id)                    {   return  mPFElecDEtaSuTrAtVtx[id];                 }
-Double_t        EventData::PFElecDPhiSuTrAtVtx(UInt_t id)                    {   return  mPFElecDPhiSuTrAtVtx[id];                 }
-Double_t        EventData::PFElecHadronicOverEm(UInt_t id)                   {   return  mPFElecHadronicOverEm[id];                }
-Double_t        EventData::PFElecHcalOverEcal(UInt_t id)                     {   return  mPFElecHcalOverEcal[id];                  }
-Double_t        EventData::PFElecetaeta(UInt_t id)                           {   return  mPFElecetaeta[id];                        }
-Double_t        EventData::PFElecietaieta(UInt_t id)                         {   return  mPFElecietaieta[id];                      }
-Int_t           EventData::PFElecIsTight(UInt_t id)                          {   return  mPFElecIsTight[id];                       }
-Int_t           EventData::PFElecIsMedium(UInt_t id)                         {   return  mPFElecIsMedium[id];                      }
-Int_t           EventData::PFElecIsLoose(UInt_t id)                          {   return  mPFElecIsLoose[id];                       }
-Int_t           EventData::PFElecIsVeto(UInt_t id)                           {   return  mPFElecIsVeto[id];                        }
-Double_t        EventData::PFElecEffArea(UInt_t id)                          {   return  mPFElecEffArea[id];                       }
-
-Int_t           EventData::NTau()                                                       {   return  mNTau;                                                 }            
-Double_t        EventData::TauE(UInt_t id)                                              {   return  mTauE[id];                                             }            
-Double_t        EventData::TauPt(UInt_t id)                                             {   return  mTauPt[id];                                            }            
-Double_t        EventData::TauPx(UInt_t id)                                             {   return  mTauPx[id];                                            }
-Double_t        EventData::TauPy(UInt_t id)                                             {   return  mTauPy[id];                                            }
-Double_t        EventData::TauPz(UInt_t id)                                             {   return  mTauPz[id];                                            }
-Double_t        EventData::TauEta(UInt_t id)                                            {   return  mTauEta[id];                                           }
-Double_t        EventData::TauPhi(UInt_t id)                                            {   return  mTauPhi[id];                                           }
-Int_t           EventData::TauCharge(UInt_t id)                                         {   return  mTauCharge[id];                                        }
-Double_t        EventData::TauEtaEtaMoment(UInt_t id)                                   {   return  mTauEtaEtaMoment[id];                                  }
-Double_t        EventData::TauPhiPhiMoment(UInt_t id)                                   {   return  mTauPhiPhiMoment[id];                                  }
-Double_t        EventData::TauEtaPhiMoment(UInt_t id)                                   {   return  mTauEtaPhiMoment[id];                                  }
-Double_t        EventData::TauLeadPFChargedHadrCandsignedSipt(UInt_t id)                {   return  mTauLeadPFChargedHadrCandsignedSipt[id];               }
-Double_t        EventData::TauIsoPFChargedHadrCandsPtSum(UInt_t id)                     {   return  mTauIsoPFChargedHadrCandsPtSum[id];                    }
-Double_t        EventData::TauIsoPFGammaCandsEtSum(UInt_t id)                           {   return  mTauIsoPFGammaCandsEtSum[id];                          }
-Double_t        EventData::TauMaximumHCALPFClusterEt(UInt_t id)                         {   return  mTauMaximumHCALPFClusterEt[id];                        }
-Double_t        EventData::TauEmFraction(UInt_t id)                                     {   return  mTauEmFraction[id];                                    }
-Double_t        EventData::TauHcalTotOverPLead(UInt_t id)                               {   return  mTauHcalTotOverPLead[id];                              }
-Double_t        EventData::TauHcalMaxOverPLead(UInt_t id)                               {   return  mTauHcalMaxOverPLead[id];                              }
-Double_t        EventData::TauHcal3x3OverPLead(UInt_t id)                               {   return  mTauHcal3x3OverPLead[id];                              }
-Double_t        EventData::TauEcalStripSumEOverPLead(UInt_t id)                         {   return  mTauEcalStripSumEOverPLead[id];                        }
-Double_t        EventData::TauBremsRecoveryEOverPLead(UInt_t id)                        {   return  mTauBremsRecoveryEOverPLead[id];                       }
-Double_t        EventData::TauElectronPreIDOutput(UInt_t id)                            {   return  mTauElectronPreIDOutput[id];                           }
-Double_t        EventData::TauElectronPreIDDecision(UInt_t id)                          {   return  mTauElectronPreIDDecision[id];                         }
-Double_t        EventData::TauCaloComp(UInt_t id)                                       {   return  mTauCaloComp[id];                                      }
-Double_t        EventData::TauSegComp(UInt_t id)                                        {   return  mTauSegComp[id];                                       }
-Double_t        EventData::TauMuonDecision(UInt_t id)                                   {   return  mTauMuonDecision[id];                                  }
-Double_t        EventData::TausignalPFChargedHadrCands(UInt_t id)                       {   return  mTausignalPFChargedHadrCands[id];                      }
-Double_t        EventData::TausignalPFGammaCands(UInt_t id)                             {   return  mTausignalPFGammaCands[id];                            }
-Double_t        EventData::TauDisAgainstElectronDeadECAL(UInt_t id)                     {   return  mTauDisAgainstElectronDeadECAL[id];                    }
-Double_t        EventData::TauDisAgainstElectronLoose(UInt_t id)                        {   return  mTauDisAgainstElectronLoose[id];                       }
-Double_t        EventData::TauDisAgainstElectronLooseMVA2(UInt_t id)                    {   return  mTauDisAgainstElectronLooseMVA2[id];                   }
-Double_t        EventData::TauDisAgainstElectronLooseMVA3(UInt_t id)                    {   return  mTauDisAgainstElectronLooseMVA3[id];                   }
-Double_t        EventData::TauDisAgainstElectronMVA2category(UInt_t id)                 {   return  mTauDisAgainstElectronMVA2category[id];                }
-Double_t        EventData::TauDisAgainstElectronMVA2raw(UInt_t id)                      {   return  mTauDisAgainstElectronMVA2raw[id];                     }
-Double_t        EventData::TauDisAgainstElectronMVA3category(UInt_t id)                 {   return  mTauDisAgainstElectronMVA3category[id];                }
-Double_t        EventData::TauDisAgainstElectronMVA3raw(UInt_t id)                      {   return  mTauDisAgainstElectronMVA3raw[id];                     }
-Double_t        EventData::TauDisAgainstElectronMVA(UInt_t id)                          {   return  mTauDisAgainstElectronMVA[id];                         }
-Double_t        EventData::TauDisAgainstElectronMedium(UInt_t id)                       {   return  mTauDisAgainstElectronMedium[id];                      }
-Double_t        EventData::TauDisAgainstElectronMediumMVA2(UInt_t id)                   {   return  mTauDisAgainstElectronMediumMVA2[id];                  }
-Double_t        EventData::TauDisAgainstElectronMediumMVA3(UInt_t id)                   {   return  mTauDisAgainstElectronMediumMVA3[id];                  }
-Double_t        EventData::TauDisAgainstElectronTight(UInt_t id)                        {   return  mTauDisAgainstElectronTight[id];                       }
-Double_t        EventData::TauDisAgainstElectronTightMVA2(UInt_t id)                    {   return  mTauDisAgainstElectronTightMVA2[id];                   }
-Double_t        EventData::TauDisAgainstElectronTightMVA3(UInt_t id)                    {   return  mTauDisAgainstElectronTightMVA3[id];                   }
-Double_t        EventData::TauDisAgainstElectronVLooseMVA2(UInt_t id)                   {   return  mTauDisAgainstElectronVLooseMVA2[id];                  }
-Double_t        EventData::TauDisAgainstElectronVTightMVA3(UInt_t id)                   {   return  mTauDisAgainstElectronVTightMVA3[id];                  }
-Double_t        EventData::TauDisAgainstMuonLoose2(UInt_t id)                           {   return  mTauDisAgainstMuonLoose2[id];                          }
-Double_t        EventData::TauDisAgainstMuonLoose(UInt_t id)                            {   return  mTauDisAgainstMuonLoose[id];                           }
-Double_t        EventData::TauDisAgainstMuonMedium2(UInt_t id)                          {   return  mTauDisAgainstMuonMedium2[id];                         }
-Double_t        EventData::TauDisAgainstMuonMedium(UInt_t id)                           {   return  mTauDisAgainstMuonMedium[id];                          }
-Double_t        EventData::TauDisAgainstMuonTight2(UInt_t id)                           {   return  mTauDisAgainstMuonTight2[id];                          }
-Double_t        EventData::TauDisAgainstMuonTight(UInt_t id)                            {   return  mTauDisAgainstMuonTight[id];                           }            
-Double_t        EventData::TauDisByCombinedIsolationDeltaBetaCorrRaw3Hits(UInt_t id)    {   return  mTauDisByCombinedIsolationDeltaBetaCorrRaw3Hits[id];   }
-Double_t        EventData::TauDisByCombinedIsolationDeltaBetaCorrRaw(UInt_t id)         {   return  mTauDisByCombinedIsolationDeltaBetaCorrRaw[id];        }
-Double_t        EventData::TauDisByIsolationMVA2raw(UInt_t id)                          {   return  mTauDisByIsolationMVA2raw[id];                         }
-Double_t        EventData::TauDisByIsolationMVAraw(UInt_t id)                           {   return  mTauDisByIsolationMVAraw[id];                          }
-Double_t        EventData::TauDisByLooseCombinedIsolationDeltaBetaCorr3Hits(UInt_t id)  {   return  mTauDisByLooseCombinedIsolationDeltaBetaCorr3Hits[id]; }
-Double_t        EventData::TauDisByLooseCombinedIsolationDeltaBetaCorr(UInt_t id)       {   return  mTauDisByLooseCombinedIsolationDeltaBetaCorr[id];      }
-Double_t        EventData::TauDisByLooseIsolationMVA2(UInt_t id)                        {   return  mTauDisByLooseIsolationMVA2[id];                       }
-Double_t        EventData::TauDisByLooseIsolationMVA(UInt_t id)                         {   return  mTauDisByLooseIsolationMVA[id];                        }
-Double_t        EventData::TauDisByMediumCombinedIsolationDeltaBetaCorr3Hits(UInt_t id) {   return  mTauDisByMediumCombinedIsolationDeltaBetaCorr3Hits[id];}
-Double_t        EventData::TauDisByMediumCombinedIsolationDeltaBetaCorr(UInt_t id)      {   return  mTauDisByMediumCombinedIsolationDeltaBetaCorr[id];     }
-Double_t        EventData::TauDisByMediumIsolationMVA2(UInt_t id)                       {   return  mTauDisByMediumIsolationMVA2[id];                      }
-Double_t        EventData::TauDisByMediumIsolationMVA(UInt_t id)                        {   return  mTauDisByMediumIsolationMVA[id];                       }
-Double_t        EventData::TauDisByTightCombinedIsolationDeltaBetaCorr3Hits(UInt_t id)  {   return  mTauDisByTightCombinedIsolationDeltaBetaCorr3Hits[id]; }
-Double_t        EventData::TauDisByTightCombinedIsolationDeltaBetaCorr(UInt_t id)       {   return  mTauDisByTightCombinedIsolationDeltaBetaCorr[id];      }
-Double_t        EventData::TauDisByTightIsolationMVA2(UInt_t id)                        {   return  mTauDisByTightIsolationMVA2[id];                       }
-Double_t        EventData::TauDisByTightIsolationMVA(UInt_t id)                         {   return  mTauDisByTightIsolationMVA[id];                        }
-Double_t        EventData::TauDisByVLooseCombinedIsolationDeltaBetaCorr(UInt_t id)      {   return  mTauDisByVLooseCombinedIsolationDeltaBetaCorr[id];     }
-Double_t        EventData::TauDisDecayModeFinding(UInt_t id)                            {   return  mTauDisDecayModeFinding[id];                           }
-Double_t        EventData::TauJetPt(UInt_t id)                                          {   return  mTauJetPt[id];                                         }
-Double_t        EventData::TauJetEta(UInt_t id)                                         {   return  mTauJetEta[id];                                        }
-Double_t        EventData::TauJetPhi(UInt_t id)                                         {   return  mTauJetPhi[id];                                        }
-
-Int_t           EventData::NPFTau()                                                     {   return  mNPFTau;                                               }
-Double_t        EventData::PFTauE(UInt_t id)                                            {   return  mPFTauE[id];                                           }
-Double_t        EventData::PFTauPt(UInt_t id)                                           {   return  mPFTauPt[id];                                          }
-Double_t        EventData::PFTauPx(UInt_t id)                                           {   return  mPFTauPx[id];                                          }
-Double_t        EventData::PFTauPy(UInt_t id)                                           {   return  mPFTauPy[id];                                          }
-Double_t        EventData::PFTauPz(UInt_t id)                                           {   return  mPFTauPz[id];                                          }
-Double_t        EventData::PFTauEta(UInt_t id)                                          {   return  mPFTauEta[id];                                         }
-Double_t        EventData::PFTauPhi(UInt_t id)                                          {   return  mPFTauPhi[id];                                         }
-Int_t           EventData::PFTauCharge(UInt_t id)                                       {   return  mPFTauCharge[id];                                      }
-Double_t        EventData::PFTauEtaEtaMoment(UInt_t id)                                 {   return  mPFTauEtaEtaMoment[id];                                }
-Double_t        EventData::PFTauPhiPhiMoment(UInt_t id)                                 {   return  mPFTauPhiPhiMoment[id];                                }
-Double_t        EventData::PFTauEtaPhiMoment(UInt_t id)                                 {   return  mPFTauEtaPhiMoment[id];                                }
-Double_t        EventData::PFTauLeadPFChargedHadrCandsignedSipt(UInt_t id)              {   return  mPFTauLeadPFChargedHadrCandsignedSipt[id];             }
-Double_t        EventData::PFTauIsoPFChargedHadrCandsPtSum(UInt_t id)                   {   return  mPFTauIsoPFChargedHadrCandsPtSum[id];                  }
-Double_t        EventData::PFTauIsoPFGammaCandsEtSum(UInt_t id)                         {   return  mPFTauIsoPFGammaCandsEtSum[id];                        }
-Double_t        EventData::PFTauMaximumHCALPFClusterEt(UInt_t id)                       {   return  mPFTauMaximumHCALPFClusterEt[id];                      }
-Double_t        EventData::PFTauEmFraction(UInt_t id)                                   {   return  mPFTauEmFraction[id];                                  }
-Double_t        EventData::PFTauHcalTotOverPLead(UInt_t id)                             {   return  mPFTauHcalTotOverPLead[id];                            }
-Double_t        EventData::PFTauHcalMaxOverPLead(UInt_t id)                             {   return  mPFTauHcalMaxOverPLead[id];                            }
-Double_t        EventData::PFTauHcal3x3OverPLead(UInt_t id)                             {   return  mPFTauHcal3x3OverPLead[id];                            }
-Double_t        EventData::PFTauEcalStripSumEOverPLead(UInt_t id)                       {   return  mPFTauEcalStripSumEOverPLead[id];                      }
-Double_t        EventData::PFTauBremsRecoveryEOverPLead(UInt_t id)                      {   return  mPFTauBremsRecoveryEOverPLead[id];                     }
-Double_t        EventData::PFTauElectronPreIDOutput(UInt_t id)                          {   return  mPFTauElectronPreIDOutput[id];                         }
-Double_t        EventData::PFTauElectronPreIDDecision(UInt_t id)                        {   return  mPFTauElectronPreIDDecision[id];                       }
-Double_t        EventData::PFTauCaloComp(UInt_t id)                                     {   return  mPFTauCaloComp[id];                                    }
-Double_t        EventData::PFTauSegComp(UInt_t id)                                      {   return  mPFTauSegComp[id];                                     }
-Double_t        EventData::PFTauMuonDecision(UInt_t id)                                 {   return  mPFTauMuonDecision[id];                                }
-Double_t        EventData::PFTausignalPFChargedHadrCands(UInt_t id)                     {   return  mPFTausignalPFChargedHadrCands[id];                    }
-Double_t        EventData::PFTausignalPFGammaCands(UInt_t id)                           {   return  mPFTausignalPFGammaCands[id];                          }
-Double_t        EventData::PFTauDisAgainstElectronDeadECAL(UInt_t id)                   {   return  mPFTauDisAgainstElectronDeadECAL[id];                  }
-Double_t        EventData::PFTauDisAgainstElectronLoose(UInt_t id)                      {   return  mPFTauDisAgainstElectronLoose[id];                     }
-Double_t        EventData::PFTauDisAgainstElectronLooseMVA2(UInt_t id)                  {   return  mPFTauDisAgainstElectronLooseMVA2[id];                 }
-Double_t        EventData::PFTauDisAgainstElectronLooseMVA3(UInt_t id)                  {   return  mPFTauDisAgainstElectronLooseMVA3[id];                 }
-Double_t        EventData::PFTauDisAgainstElectronMVA2category(UInt_t id)               {   return  mPFTauDisAgainstElectronMVA2category[id];              }
-Double_t        EventData::PFTauDisAgainstElectronMVA2raw(UInt_t id)                    {   return  mPFTauDisAgainstElectronMVA2raw[id];                   }
-Double_t        EventData::PFTauDisAgainstElectronMVA3category(UInt_t id)               {   return  mPFTauDisAgainstElectronMVA3category[id];              }
-Double_t        EventData::PFTauDisAgainstElectronMVA3raw(UInt_t id)                    {   return  mPFTauDisAgainstElectronMVA3raw[id];                   }
-Double_t        EventData::PFTauDisAgainstElectronMVA(UInt_t id)                        {   return  mPFTauDisAgainstElectronMVA[id];                       }
-Double_t        EventData::PFTauDisAgainstElectronMedium(UInt_t id)                     {   return  mPFTauDisAgainstElectronMedium[id];                    }
-Double_t        EventData::PFTauDisAgainstElectronMediumMVA2(UInt_t id)                 {   return  mPFTauDisAgainstElectronMediumMVA2[id];                }
-Double_t        EventData::PFTauDisAgainstElectronMediumMVA3(UInt_t id)                 {   return  mPFTauDisAgainstElectronMediumMVA3[id];                }
-Double_t        EventData::PFTauDisAgainstElectronTight(UInt_t id)                      {   return  mPFTauDisAgainstElectronTight[id];                     }
-Double_t        EventData::PFTauDisAgainstElectronTightMVA2(UInt_t id)                  {   return  mPFTauDisAgainstElectronTightMVA2[id];                 }
-Double_t        EventData::PFTauDisAgainstElectronTightMVA3(UInt_t id)                  {   return  mPFTauDisAgainstElectronTightMVA3[id];                 }
-Double_t        EventData::PFTauDisAgainstElectronVLooseMVA2(UInt_t id)                 {   return  mPFTauDisAgainstElectronVLooseMVA2[id];                }
-Double_t        EventData::PFTauDisAgainstElectronVTightMVA3(UInt_t id)                 {   return  mPFTauDisAgainstElectronVTightMVA3[id];                }
-Double_t        EventData::PFTauDisAgainstMuonLoose2(UInt_t id)                         {   return  mPFTauDisAgainstMuonLoose2[id];                        }
-Double_t        EventData::PFTauDisAgainstMuonLoose(UInt_t id)                          {   return  mPFTauDisAgainstMuonLoose[id];                         }
-Double_t        EventData::PFTauDisAgainstMuonMedium2(UInt_t id)                        {   return  mPFTauDisAgainstMuonMedium2[id];                       }
-Double_t        EventData::PFTauDisAgainstMuonMedium(UInt_t id)                         {   return  mPFTauDisAgainstMuonMedium[id];                        }
-Double_t        EventData::PFTauDisAgainstMuonTight2(UInt_t id)                         {   return  mPFTauDisAgainstMuonTight2[id];                        }
-Double_t        EventData::PFTauDisAgainstMuonTight(UInt_t id)                          {   return  mPFTauDisAgainstMuonTight[id];                         }
-Double_t        EventData::PFTauDisByCombinedIsolationDeltaBetaCorrRaw3Hits(UInt_t id)  {   return  mPFTauDisByCombinedIsolationDeltaBetaCorrRaw3Hits[id]; }
-Double_t        EventData::PFTauDisByCombinedIsolationDeltaBetaCorrRaw(UInt_t id)       {   return  mPFTauDisByCombinedIsolationDeltaBetaCorrRaw[id];      }
-Double_t        EventData::PFTauDisByIsolationMVA2raw(UInt_t id)                        {   return  mPFTauDisByIsolationMVA2raw[id];                       }
-Double_t        EventData::PFTauDisByIsolationMVAraw(UInt_t id)                         {   return  mPFTauDisByIsolationMVAraw[id];                        }
-Double_t        EventData::PFTauDisByLooseCombinedIsolationDeltaBetaCorr3Hits(UInt_t id){   return  mPFTauDisByLooseCombinedIsolationDeltaBetaCorr3Hits[id];}
-Double_t        EventData::PFTauDisByLooseCombinedIsolationDeltaBetaCorr(UInt_t id)     {   return  mPFTauDisByLooseCombinedIsolationDeltaBetaCorr[id];    }
-Double_t        EventData::PFTauDisByLooseIsolationDeltaBetaCorr(UInt_t id)             {   return  mPFTauDisByLooseIsolationDeltaBetaCorr[id];            }
-Double_t        EventData::PFTauDisByLooseIsolation(UInt_t id)                          {   return  mPFTauDisByLooseIsolation[id];                         }
-Double_t        EventData::PFTauDisByLooseIsolationMVA2(UInt_t id)                      {   return  mPFTauDisByLooseIsolationMVA2[id];                     }
-Double_t        EventData::PFTauDisByLooseIsolationMVA(UInt_t id)                       {   return  mPFTauDisByLooseIsolationMVA[id];                      }
-Double_t        EventData::PFTauDisByMediumCombinedIsolationDeltaBetaCorr3Hits(UInt_t id){  return  mPFTauDisByMediumCombinedIsolationDeltaBetaCorr3Hits[id];}
-Double_t        EventData::PFTauDisByMediumCombinedIsolationDeltaBetaCorr(UInt_t id)    {   return  mPFTauDisByMediumCombinedIsolationDeltaBetaCorr[id];   }
-Double_t        EventData::PFTauDisByMediumIsolationDeltaBetaCorr(UInt_t id)            {   return  mPFTauDisByMediumIsolationDeltaBetaCorr[id];           }
-Double_t        EventData::PFTauDisByMediumIsolation(UInt_t id)                         {   return  mPFTauDisByMediumIsolation[id];                        }
-Double_t        EventData::PFTauDisByMediumIsolationMVA2(UInt_t id)                     {   return  mPFTauDisByMediumIsolationMVA2[id];                    }
-Double_t        EventData::PFTauDisByMediumIsolationMVA(UInt_t id)                      {   return  mPFTauDisByMediumIsolationMVA[id];                     }
-Double_t        EventData::PFTauDisByTightCombinedIsolationDeltaBetaCorr3Hits(UInt_t id){   return  mPFTauDisByTightCombinedIsolationDeltaBetaCorr3Hits[id]; }
-Double_t        EventData::PFTauDisByTightCombinedIsolationDeltaBetaCorr(UInt_t id)     {   return  mPFTauDisByTightCombinedIsolationDeltaBetaCorr[id];      }
-Double_t        EventData::PFTauDisByTightIsolationDeltaBetaCorr(UInt_t id)             {   return  mPFTauDisByTightIsolationDeltaBetaCorr[id];              }
-Double_t        EventData::PFTauDisByTightIsolation(UInt_t id)                          {   return  mPFTauDisByTightIsolation[id];                           }
-Double_t        EventData::PFTauDisByTightIsolationMVA2(UInt_t id)                      {   return  mPFTauDisByTightIsolationMVA2[id];                       }
-Double_t        EventData::PFTauDisByTightIsolationMVA(UInt_t id)                       {   return  mPFTauDisByTightIsolationMVA[id];                        }
-Double_t        EventData::PFTauDisByVLooseCombinedIsolationDeltaBetaCorr(UInt_t id)    {   return  mPFTauDisByVLooseCombinedIsolationDeltaBetaCorr[id];     }
-Double_t        EventData::PFTauDisByVLooseIsolationDeltaBetaCorr(UInt_t id)            {   return  mPFTauDisByVLooseIsolationDeltaBetaCorr[id];             }
-Double_t        EventData::PFTauDisByVLooseIsolation(UInt_t id)                         {   return  mPFTauDisByVLooseIsolation[id];                          }
-Double_t        EventData::PFTauDisDecayModeFinding(UInt_t id)                          {   return  mPFTauDisDecayModeFinding[id];                           }
-Double_t        EventData::PFTauJetPt(UInt_t id)                                        {   return  mPFTauJetPt[id];                                         }
-Double_t        EventData::PFTauJetEta(UInt_t id)                                       {   return  mPFTauJetEta[id];                                        }
-Double_t        EventData::PFTauJetPhi(UInt_t id)                                       {   return  mPFTauJetPhi[id];                                        }
-
-Int_t           EventData::WTauDecayMode()                                   {   return mWTauDecayMode;         }
-Int_t           EventData::WTauN()                                           {   return mWTauN;                 }
-Int_t           EventData::WTauDecayId(UInt_t id)                            {   return mWTauDecayId[id];       }
-Double_t        EventData::WTauDecayPt(UInt_t id)                            {   return mWTauDecayPt[id];       }
-Double_t        EventData::WTauDecayEta(UInt_t id)                           {   return mWTauDecayEta[id];      }
-Double_t        EventData::WTauDecayPhi(UInt_t id)                           {   return mWTauDecayPhi[id];      }
-Double_t        EventData::WTauDecayMass(UInt_t id)                          {   return mWTauDecayMass[id];     }
+Int_t           EventData::NPFElec()                                         {   LoadBranch(b_NPFElec); return  mNPFElec;          }
+Int_t           EventData::PFElecCharge(UInt_t id)                           {   LoadBranch(b_PFElecCharge); return  mPFElecCharge[id]; }
+Int_t           EventData::PFElecIsEB(UInt_t id)                             {   LoadBranch(b_PFElecIsEB); return  mPFElecIsEB[id]; }
+Double_t        EventData::PFElecPassTight(UInt_t id)                        {   LoadBranch(b_PFElecPassTight); return  mPFElecPassTight[id]; }
+Double_t        EventData::PFElecE(UInt_t id)                                {   LoadBranch(b_PFElecE); return  mPFElecE[id];      }
+Double_t        EventData::PFElecPt(UInt_t id)                               {   LoadBranch(b_PFElecPt); return  mPFElecPt[id];    }
+Double_t        EventData::PFElecPx(UInt_t id)                               {   LoadBranch(b_PFElecPx); return  mPFElecPx[id];    }
+Double_t        EventData::PFElecPy(UInt_t id)                               {   LoadBranch(b_PFElecPy); return  mPFElecPy[id];    }
+Double_t        EventData::PFElecPz(UInt_t id)                               {   LoadBranch(b_PFElecPz); return  mPFElecPz[id];    }
+Double_t        EventData::PFElecEta(UInt_t id)                              {   LoadBranch(b_PFElecEta); return  mPFElecEta[id];  }
+Double_t        EventData::PFElecPhi(UInt_t id)                              {   LoadBranch(b_PFElecPhi); return  mPFElecPhi[id];  }
+Double_t        EventData::PFElecCharHadIso(UInt_t id)                       {   LoadBranch(b_PFElecCharHadIso); return  mPFElecCharHadIso[id]; }
+Double_t        EventData::PFElecPhoIso(UInt_t id)                           {   LoadBranch(b_PFElecPhoIso); return  mPFElecPhoIso[id]; }
+Double_t        EventData::PFElecNeuHadIso(UInt_t id)                        {   LoadBranch(b_PFElecNeuHadIso); return  mPFElecNeuHadIso[id]; }
+Double_t        EventData::PFElecMva(UInt_t id)                              {   LoadBranch(b_PFElecMva); return  mPFElecMva[id];  }
+Double_t        EventData::PFElecdxy(UInt_t id)                              {   LoadBranch(b_PFElecdxy); return  mPFElecdxy[id];  }
+Double_t        EventData::PFElecdz(UInt_t id)                               {   LoadBranch(b_PFElecdz); return  mPFElecdz[id];    }
+Double_t        EventData::PFElecHadOverEm(UInt_t id)                        {   LoadBranch(b_PFElecHadOverEm); return  mPFElecHadOverEm[id]; }
+Double_t        EventData::PFElecHcalOverEm(UInt_t id)                       {   LoadBranch(b_PFElecHcalOverEm); return  mPFElecHcalOverEm[id]; }
+Double_t        EventData::PFElecSupClusOverP(UInt_t id)                     {   LoadBranch(b_PFElecSupClusOverP); return  mPFElecSupClusOverP[id]; }
+Double_t        EventData::PFElecInnerHits(UInt_t id)                        {   LoadBranch(b_PFElecInnerHits); return  mPFElecInnerHits[id]; }
+Double_t        EventData::PFElecConvDist(UInt_t id)                         {   LoadBranch(b_PFElecConvDist); return  mPFElecConvDist[id]; }
+Double_t        EventData::PFElecConvDcot(UInt_t id)                         {   LoadBranch(b_PFElecConvDcot); return  mPFElecConvDcot[id]; }
+Double_t        EventData::PFElecDEtaSuTrAtVtx(UInt_t id)                    {   LoadBranch(b_PFElecDEtaSuTrAtVtx); return  mPFElecDEtaSuTrAtVtx[id]; }
+Double_t        EventData::PFElecDPhiSuTrAtVtx(UInt_t id)                    {   LoadBranch(b_PFElecDPhiSuTrAtVtx); return  mPFElecDPhiSuTrAtVtx[id]; }
+Double_t        EventData::PFElecHadronicOverEm(UInt_t id)                   {   LoadBranch(b_PFElecHadronicOverEm); return  mPFElecHadronicOverEm[id]; }
+Double_t        EventData::PFElecHcalOverEcal(UInt_t id)                     {   LoadBranch(b_PFElecHcalOverEcal); return  mPFElecHcalOverEcal[id]; }
+Double_t        EventData::PFElecetaeta(UInt_t id)                           {   LoadBranch(b_PFElecetaeta); return  mPFElecetaeta[id]; }
+Double_t        EventData::PFElecietaieta(UInt_t id)                         {   LoadBranch(b_PFElecietaieta); return  mPFElecietaieta[id]; }
+Int_t           EventData::PFElecIsTight(UInt_t id)                          {   LoadBranch(b_PFElecIsTight); return  mPFElecIsTight[id]; }
+Int_t           EventData::PFElecIsMedium(UInt_t id)                         {   LoadBranch(b_PFElecIsMedium); return  mPFElecIsMedium[id]; }
+Int_t           EventData::PFElecIsLoose(UInt_t id)                          {   LoadBranch(b_PFElecIsLoose); return  mPFElecIsLoose[id]; }
+Int_t           EventData::PFElecIsVeto(UInt_t id)                           {   LoadBranch(b_PFElecIsVeto); return  mPFElecIsVeto[id]; }
+Double_t        EventData::PFElecEffArea(UInt_t id)                          {   LoadBranch(b_PFElecEffArea); return  mPFElecEffArea[id]; }
+
+Int_t           EventData::NTau()                                                       {   LoadBranch(b_NTau); return  mNTau;                             }            
+Double_t        EventData::TauE(UInt_t id)                                              {   LoadBranch(b_TauE); return  mTauE[id];                         }            
+Double_t        EventData::TauPt(UInt_t id)                                             {   LoadBranch(b_TauPt); return  mTauPt[id];                       }            
+Double_t        EventData::TauPx(UInt_t id)                                             {   LoadBranch(b_TauPx); return  mTauPx[id];                       }
+Double_t        EventData::TauPy(UInt_t id)                                             {   LoadBranch(b_TauPy); return  mTauPy[id];                       }
+Double_t        EventData::TauPz(UInt_t id)                                             {   LoadBranch(b_TauPz); return  mTauPz[id];                       }
+Double_t        EventData::TauEta(UInt_t id)                                            {   LoadBranch(b_TauEta); return  mTauEta[id];                     }
+Double_t        EventData::TauPhi(UInt_t id)                                            {   LoadBranch(b_TauPhi); return  mTauPhi[id];                     }
+Int_t           EventData::TauCharge(UInt_t id)                                         {   LoadBranch(b_TauCharge); return  mTauCharge[id];               }
+Double_t        EventData::TauEtaEtaMoment(UInt_t id)                                   {   LoadBranch(b_TauEtaEtaMoment); return  mTauEtaEtaMoment[id];   }
+Double_t        EventData::TauPhiPhiMoment(UInt_t id)                                   {   LoadBranch(b_TauPhiPhiMoment); return  mTauPhiPhiMoment[id];   }
+Double_t        EventData::TauEtaPhiMoment(UInt_t id)                                   {   LoadBranch(b_TauEtaPhiMoment); return  mTauEtaPhiMoment[id];   }
+Double_t        EventData::TauLeadPFChargedHadrCandsignedSipt(UInt_t id)                {   LoadBranch(b_TauLeadPFChargedHadrCandsignedSipt); return  mTauLeadPFChargedHadrCandsignedSipt[id]; }
+Double_t        EventData::TauIsoPFChargedHadrCandsPtSum(UInt_t id)                     {   LoadBranch(b_TauIsoPFChargedHadrCandsPtSum); return  mTauIsoPFChargedHadrCandsPtSum[id]; }
+Double_t        EventData::TauIsoPFGammaCandsEtSum(UInt_t id)                           {   LoadBranch(b_TauIsoPFGammaCandsEtSum); return  mTauIsoPFGammaCandsEtSum[id]; }
+Double_t        EventData::TauMaximumHCALPFClusterEt(UInt_t id)                         {   LoadBranch(b_TauMaximumHCALPFClusterEt); return  mTauMaximumHCALPFClusterEt[id]; }
+Double_t        EventData::TauEmFraction(UInt_t id)                                     {   LoadBranch(b_TauEmFraction); return  mTauEmFraction[id];       }
+Double_t        EventData::TauHcalTotOverPLead(UInt_t id)                               {   LoadBranch(b_TauHcalTotOverPLead); return  mTauHcalTotOverPLead[id]; }
+Double_t        EventData::TauHcalMaxOverPLead(UInt_t id)                               {   LoadBranch(b_TauHcalMaxOverPLead); return  mTauHcalMaxOverPLead[id]; }
+Double_t        EventData::TauHcal3x3OverPLead(UInt_t id)                               {   LoadBranch(b_TauHcal3x3OverPLead); return  mTauHcal3x3OverPLead[id]; }
+Double_t        EventData::TauEcalStripSumEOverPLead(UInt_t id)                         {   LoadBranch(b_TauEcalStripSumEOverPLead); return  mTauEcalStripSumEOverPLead[id]; }
+Double_t        EventData::TauBremsRecoveryEOverPLead(UInt_t id)                        {   LoadBranch(b_TauBremsRecoveryEOverPLead); return  mTauBremsRecoveryEOverPLead[id]; }
+Double_t        EventData::TauElectronPreIDOutput(UInt_t id)                            {   LoadBranch(b_TauElectronPreIDOutput); return  mTauElectronPreIDOutput[id]; }
+Double_t        EventData::TauElectronPreIDDecision(UInt_t id)                          {   LoadBranch(b_TauElectronPreIDDecision); return  mTauElectronPreIDDecision[id]; }
+Double_t        EventData::TauCaloComp(UInt_t id)                                       {   LoadBranch(b_TauCaloComp); return  mTauCaloComp[id];           }
+Double_t        EventData::TauSegComp(UInt_t id)                                        {   LoadBranch(b_TauSegComp); return  mTauSegComp[id];             }
+Double_t        EventData::TauMuonDecision(UInt_t id)                                   {   LoadBranch(b_TauMuonDecision); return  mTauMuonDecision[id];   }
+Double_t        EventData::TausignalPFChargedHadrCands(UInt_t id)                       {   LoadBranch(b_TausignalPFChargedHadrCands); return  mTausignalPFChargedHadrCands[id]; }
+Double_t        EventData::TausignalPFGammaCands(UInt_t id)                             {   LoadBranch(b_TausignalPFGammaCands); return  mTausignalPFGammaCands[id]; }
+Double_t        EventData::TauDisAgainstElectronDeadECAL(UInt_t id)                     {   LoadBranch(b_TauDisAgainstElectronDeadECAL); return  mTauDisAgainstElectronDeadECAL[id]; }
+Double_t        EventData::TauDisAgainstElectronLoose(UInt_t id)                        {   LoadBranch(b_TauDisAgainstElectronLoose); return  mTauDisAgainstElectronLoose[id]; }
+Double_t        EventData::TauDisAgainstElectronLooseMVA2(UInt_t id)                    {   LoadBranch(b_TauDisAgainstElectronLooseMVA2); return  mTauDisAgainstElectronLooseMVA2[id]; }
+Double_t        EventData::TauDisAgainstElectronLooseMVA3(UInt_t id)                    {   LoadBranch(b_TauDisAgainstElectronLooseMVA3); return  mTauDisAgainstElectronLooseMVA3[id]; }
+Double_t        EventData::TauDisAgainstElectronMVA2category(UInt_t id)                 {   LoadBranch(b_TauDisAgainstElectronMVA2category); return  mTauDisAgainstElectronMVA2category[id]; }
+Double_t        EventData::TauDisAgainstElectronMVA2raw(UInt_t id)                      {   LoadBranch(b_TauDisAgainstElectronMVA2raw); return  mTauDisAgainstElectronMVA2raw[id]; }
+Double_t        EventData::TauDisAgainstElectronMVA3category(UInt_t id)                 {   LoadBranch(b_TauDisAgainstElectronMVA3category); return  mTauDisAgainstElectronMVA3category[id]; }
+Double_t        EventData::TauDisAgainstElectronMVA3raw(UInt_t id)                      {   LoadBranch(b_TauDisAgainstElectronMVA3raw); return  mTauDisAgainstElectronMVA3raw[id]; }
+Double_t        EventData::TauDisAgainstElectronMVA(UInt_t id)                          {   LoadBranch(b_TauDisAgainstElectronMVA); return  mTauDisAgainstElectronMVA[id]; }
+Double_t        EventData::TauDisAgainstElectronMedium(UInt_t id)                       {   LoadBranch(b_TauDisAgainstElectronMedium); return  mTauDisAgainstElectronMedium[id]; }
+Double_t        EventData::TauDisAgainstElectronMediumMVA2(UInt_t id)                   {   LoadBranch(b_TauDisAgainstElectronMediumMVA2); return  mTauDisAgainstElectronMediumMVA2[id]; }
+Double_t        EventData::TauDisAgainstElectronMediumMVA3(UInt_t id)                   {   LoadBranch(b_TauDisAgainstElectronMediumMVA3); return  mTauDisAgainstElectronMediumMVA3[id]; }
+Double_t        EventData::TauDisAgainstElectronTight(UInt_t id)                        {   LoadBranch(b_TauDisAgainstElectronTight); return  mTauDisAgainstElectronTight[id]; }
+Double_t        EventData::TauDisAgainstElectronTightMVA2(UInt_t id)                    {   LoadBranch(b_TauDisAgainstElectronTightMVA2); return  mTauDisAgainstElectronTightMVA2[id]; }
+Double_t        EventData::TauDisAgainstElectronTightMVA3(UInt_t id)                    {   LoadBranch(b_TauDisAgainstElectronTightMVA3); return  mTauDisAgainstElectronTightMVA3[id]; }
+Double_t        EventData::TauDisAgainstElectronVLooseMVA2(UInt_t id)                   {   LoadBranch(b_TauDisAgainstElectronVLooseMVA2); return  mTauDisAgainstElectronVLooseMVA2[id]; }
+Double_t        EventData::TauDisAgainstElectronVTightMVA3(UInt_t id)                   {   LoadBranch(b_TauDisAgainstElectronVTightMVA3); return  mTauDisAgainstElectronVTightMVA3[id]; }
+Double_t        EventData::TauDisAgainstMuonLoose2(UInt_t id)                           {   LoadBranch(b_TauDisAgainstMuonLoose2); return  mTauDisAgainstMuonLoose2[id]; }
+Double_t        EventData::TauDisAgainstMuonLoose(UInt_t id)                            {   LoadBranch(b_TauDisAgainstMuonLoose); return  mTauDisAgainstMuonLoose[id]; }
+Double_t        EventData::TauDisAgainstMuonMedium2(UInt_t id)                          {   LoadBranch(b_TauDisAgainstMuonMedium2); return  mTauDisAgainstMuonMedium2[id]; }
+Double_t        EventData::TauDisAgainstMuonMedium(UInt_t id)                           {   LoadBranch(b_TauDisAgainstMuonMedium); return  mTauDisAgainstMuonMedium[id]; }
+Double_t        EventData::TauDisAgainstMuonTight2(UInt_t id)                           {   LoadBranch(b_TauDisAgainstMuonTight2); return  mTauDisAgainstMuonTight2[id]; }
+Double_t        EventData::TauDisAgainstMuonTight(UInt_t id)                            {   LoadBranch(b_TauDisAgainstMuonTight); return  mTauDisAgainstMuonTight[id]; }            
+Double_t        EventData::TauDisByCombinedIsolationDeltaBetaCorrRaw3Hits(UInt_t id)    {   LoadBranch(b_TauDisByCombinedIsolationDeltaBetaCorrRaw3Hits); return  mTauDisByCombinedIsolationDeltaBetaCorrRaw3Hits[id]; }
+Double_t        EventData::TauDisByCombinedIsolationDeltaBetaCorrRaw(UInt_t id)         {   LoadBranch(b_TauDisByCombinedIsolationDeltaBetaCorrRaw); return  mTauDisByCombinedIsolationDeltaBetaCorrRaw[id]; }
+Double_t        EventData::TauDisByIsolationMVA2raw(UInt_t id)                          {   LoadBranch(b_TauDisByIsolationMVA2raw); return  mTauDisByIsolationMVA2raw[id]; }
+Double_t        EventData::TauDisByIsolationMVAraw(UInt_t id)                           {   LoadBranch(b_TauDisByIsolationMVAraw); return  mTauDisByIsolationMVAraw[id]; }
+Double_t        EventData::TauDisByLooseCombinedIsolationDeltaBetaCorr3Hits(UInt_t id)  {   LoadBranch(b_TauDisByLooseCombinedIsolationDeltaBetaCorr3Hits); return  mTauDisByLooseCombinedIsolationDeltaBetaCorr3Hits[id]; }
+Double_t        EventData::TauDisByLooseCombinedIsolationDeltaBetaCorr(UInt_t id)       {   LoadBranch(b_TauDisByLooseCombinedIsolationDeltaBetaCorr); return  mTauDisByLooseCombinedIsolationDeltaBetaCorr[id]; }
+Double_t        EventData::TauDisByLooseIsolationMVA2(UInt_t id)                        {   LoadBranch(b_TauDisByLooseIsolationMVA2); return  mTauDisByLooseIsolationMVA2[id]; }
+Double_t        EventData::TauDisByLooseIsolationMVA(UInt_t id)                         {   LoadBranch(b_TauDisByLooseIsolationMVA); return  mTauDisByLooseIsolationMVA[id]; }
+Double_t        EventData::TauDisByMediumCombinedIsolationDeltaBetaCorr3Hits(UInt_t id) {   LoadBranch(b_TauDisByMediumCombinedIsolationDeltaBetaCorr3Hits); return  mTauDisByMediumCombinedIsolationDeltaBetaCorr3Hits[id]; }
+Double_t        EventData::TauDisByMediumCombinedIsolationDeltaBetaCorr(UInt_t id)      {   LoadBranch(b_TauDisByMediumCombinedIsolationDeltaBetaCorr); return  mTauDisByMediumCombinedIsolationDeltaBetaCorr[id]; }
+Double_t        EventData::TauDisByMediumIsolationMVA2(UInt_t id)                       {   LoadBranch(b_TauDisByMediumIsolationMVA2); return  mTauDisByMediumIsolationMVA2[id]; }
+Double_t        EventData::TauDisByMediumIsolationMVA(UInt_t id)                        {   LoadBranch(b_TauDisByMediumIsolationMVA); return  mTauDisByMediumIsolationMVA[id]; }
+Double_t        EventData::TauDisByTightCombinedIsolationDeltaBetaCorr3Hits(UInt_t id)  {   LoadBranch(b_TauDisByTightCombinedIsolationDeltaBetaCorr3Hits); return  mTauDisByTightCombinedIsolationDeltaBetaCorr3Hits[id]; }
+Double_t        EventData::TauDisByTightCombinedIsolationDeltaBetaCorr(UInt_t id)       {   LoadBranch(b_TauDisByTightCombinedIsolationDeltaBetaCorr); return  mTauDisByTightCombinedIsolationDeltaBetaCorr[id]; }
+Double_t        EventData::TauDisByTightIsolationMVA2(UInt_t id)                        {   LoadBranch(b_TauDisByTightIsolationMVA2); return  mTauDisByTightIsolationMVA2[id]; }
+Double_t        EventData::TauDisByTightIsolationMVA(UInt_t id)                         {   LoadBranch(b_TauDisByTightIsolationMVA); return  mTauDisByTightIsolationMVA[id]; }
+Double_t        EventData::TauDisByVLooseCombinedIsolationDeltaBetaCorr(UInt_t id)      {   LoadBranch(b_TauDisByVLooseCombinedIsolationDeltaBetaCorr); return  mTauDisByVLooseCombinedIsolationDeltaBetaCorr[id]; }
+Double_t        EventData::TauDisDecayModeFinding(UInt_t id)                            {   LoadBranch(b_TauDisDecayModeFinding); return  mTauDisDecayModeFinding[id]; }
+Double_t        EventData::TauJetPt(UInt_t id)                                          {   LoadBranch(b_TauJetPt); return  mTauJetPt[id];                 }
+Double_t        EventData::TauJetEta(UInt_t id)                                         {   LoadBranch(b_TauJetEta); return  mTauJetEta[id];               }
+Double_t        EventData::TauJetPhi(UInt_t id)                                         {   LoadBranch(b_TauJetPhi); return  mTauJetPhi[id];               }
+
+Int_t           EventData::NPFTau()                                                     {   LoadBranch(b_NPFTau); return  mNPFTau;                         }
+Double_t        EventData::PFTauE(UInt_t id)                                            {   LoadBranch(b_PFTauE); return  mPFTauE[id];                     }
+Double_t        EventData::PFTauPt(UInt_t id)                                           {   LoadBranch(b_PFTauPt); return  mPFTauPt[id];                   }
+Double_t        EventData::PFTauPx(UInt_t id)                                           {   LoadBranch(b_PFTauPx); return  mPFTauPx[id];                   }
+Double_t        EventData::PFTauPy(UInt_t id)                                           {   LoadBranch(b_PFTauPy); return  mPFTauPy[id];                   }
+Double_t        EventData::PFTauPz(UInt_t id)                                           {   LoadBranch(b_PFTauPz); return  mPFTauPz[id];                   }
+Double_t        EventData::PFTauEta(UInt_t id)                                          {   LoadBranch(b_PFTauEta); return  mPFTauEta[id];                 }
+Double_t        EventData::PFTauPhi(UInt_t id)                                          {   LoadBranch(b_PFTauPhi); return  mPFTauPhi[id];                 }
+Int_t           EventData::PFTauCharge(UInt_t id)                                       {   LoadBranch(b_PFTauCharge); return  mPFTauCharge[id];           }
+Double_t        EventData::PFTauEtaEtaMoment(UInt_t id)                                 {   LoadBranch(b_PFTauEtaEtaMoment); return  mPFTauEtaEtaMoment[id]; }
+Double_t        EventData::PFTauPhiPhiMoment(UInt_t id)                                 {   LoadBranch(b_PFTauPhiPhiMoment); return  mPFTauPhiPhiMoment[id]; }
+Double_t        EventData::PFTauEtaPhiMoment(UInt_t id)                                 {   LoadBranch(b_PFTauEtaPhiMoment); return  mPFTauEtaPhiMoment[id]; }
+Double_t        EventData::PFTauLeadPFChargedHadrCandsignedSipt(UInt_t id)              {   LoadBranch(b_PFTauLeadPFChargedHadrCandsignedSipt); return  mPFTauLeadPFChargedHadrCandsignedSipt[id]; }
+Double_t        EventData::PFTauIsoPFChargedHadrCandsPtSum(UInt_t id)                   {   LoadBranch(b_PFTauIsoPFChargedHadrCandsPtSum); return  mPFTauIsoPFChargedHadrCandsPtSum[id]; }
+Double_t        EventData::PFTauIsoPFGammaCandsEtSum(UInt_t id)                         {   LoadBranch(b_PFTauIsoPFGammaCandsEtSum); return  mPFTauIsoPFGammaCandsEtSum[id]; }
+Double_t        EventData::PFTauMaximumHCALPFClusterEt(UInt_t id)                       {   LoadBranch(b_PFTauMaximumHCALPFClusterEt); return  mPFTauMaximumHCALPFClusterEt[id]; }
+Double_t        EventData::PFTauEmFraction(UInt_t id)                                   {   LoadBranch(b_PFTauEmFraction); return  mPFTauEmFraction[id];   }
+Double_t        EventData::PFTauHcalTotOverPLead(UInt_t id)                             {   LoadBranch(b_PFTauHcalTotOverPLead); return  mPFTauHcalTotOverPLead[id]; }
+Double_t        EventData::PFTauHcalMaxOverPLead(UInt_t id)                             {   LoadBranch(b_PFTauHcalMaxOverPLead); return  mPFTauHcalMaxOverPLead[id]; }
+Double_t        EventData::PFTauHcal3x3OverPLead(UInt_t id)                             {   LoadBranch(b_PFTauHcal3x3OverPLead); return  mPFTauHcal3x3OverPLead[id]; }
+Double_t        EventData::PFTauEcalStripSumEOverPLead(UInt_t id)                       {   LoadBranch(b_PFTauEcalStripSumEOverPLead); return  mPFTauEcalStripSumEOverPLead[id]; }
+Double_t        EventData::PFTauBremsRecoveryEOverPLead(UInt_t id)                      {   LoadBranch(b_PFTauBremsRecoveryEOverPLead); return  mPFTauBremsRecoveryEOverPLead[id]; }
+Double_t        EventData::PFTauElectronPreIDOutput(UInt_t id)                          {   LoadBranch(b_PFTauElectronPreIDOutput); return  mPFTauElectronPreIDOutput[id]; }
+Double_t        EventData::PFTauElectronPreIDDecision(UInt_t id)                        {   LoadBranch(b_PFTauElectronPreIDDecision); return  mPFTauElectronPreIDDecision[id]; }
+Double_t        EventData::PFTauCaloComp(UInt_t id)                                     {   LoadBranch(b_PFTauCaloComp); return  mPFTauCaloComp[id];       }
+Double_t        EventData::PFTauSegComp(UInt_t id)                                      {   LoadBranch(b_PFTauSegComp); return  mPFTauSegComp[id];         }
+Double_t        EventData::PFTauMuonDecision(UInt_t id)                                 {   LoadBranch(b_PFTauMuonDecision); return  mPFTauMuonDecision[id]; }
+Double_t        EventData::PFTausignalPFChargedHadrCands(UInt_t id)                     {   LoadBranch(b_PFTausignalPFChargedHadrCands); return  mPFTausignalPFChargedHadrCands[id]; }
+Double_t        EventData::PFTausignalPFGammaCands(UInt_t id)                           {   LoadBranch(b_PFTausignalPFGammaCands); return  mPFTausignalPFGammaCands[id]; }
+Double_t        EventData::PFTauDisAgainstElectronDeadECAL(UInt_t id)                   {   LoadBranch(b_PFTauDisAgainstElectronDeadECAL); return  mPFTauDisAgainstElectronDeadECAL[id]; }
+Double_t        EventData::PFTauDisAgainstElectronLoose(UInt_t id)                      {   LoadBranch(b_PFTauDisAgainstElectronLoose); return  mPFTauDisAgainstElectronLoose[id]; }
+Double_t        EventData::PFTauDisAgainstElectronLooseMVA2(UInt_t id)                  {   LoadBranch(b_PFTauDisAgainstElectronLooseMVA2); return  mPFTauDisAgainstElectronLooseMVA2[id]; }
+Double_t        EventData::PFTauDisAgainstElectronLooseMVA3(UInt_t id)                  {   LoadBranch(b_PFTauDisAgainstElectronLooseMVA3); return  mPFTauDisAgainstElectronLooseMVA3[id]; }
+Double_t        EventData::PFTauDisAgainstElectronMVA2category(UInt_t id)               {   LoadBranch(b_PFTauDisAgainstElectronMVA2category); return  mPFTauDisAgainstElectronMVA2category[id]; }
+Double_t        EventData::PFTauDisAgainstElectronMVA2raw(UInt_t id)                    {   LoadBranch(b_PFTauDisAgainstElectronMVA2raw); return  mPFTauDisAgainstElectronMVA2raw[id]; }
+Double_t        EventData::PFTauDisAgainstElectronMVA3category(UInt_t id)               {   LoadBranch(b_PFTauDisAgainstElectronMVA3category); return  mPFTauDisAgainstElectronMVA3category[id]; }
+Double_t        EventData::PFTauDisAgainstElectronMVA3raw(UInt_t id)                    {   LoadBranch(b_PFTauDisAgainstElectronMVA3raw); return  mPFTauDisAgainstElectronMVA3raw[id]; }
+Double_t        EventData::PFTauDisAgainstElectronMVA(UInt_t id)                        {   LoadBranch(b_PFTauDisAgainstElectronMVA); return  mPFTauDisAgainstElectronMVA[id]; }
+Double_t        EventData::PFTauDisAgainstElectronMedium(UInt_t id)                     {   LoadBranch(b_PFTauDisAgainstElectronMedium); return  mPFTauDisAgainstElectronMedium[id]; }
+Double_t        EventData::PFTauDisAgainstElectronMediumMVA2(UInt_t id)                 {   LoadBranch(b_PFTauDisAgainstElectronMediumMVA2); return  mPFTauDisAgainstElectronMediumMVA2[id]; }
+Double_t        EventData::PFTauDisAgainstElectronMediumMVA3(UInt_t id)                 {   LoadBranch(b_PFTauDisAgainstElectronMediumMVA3); return  mPFTauDisAgainstElectronMediumMVA3[id]; }
+Double_t        EventData::PFTauDisAgainstElectronTight(UInt_t id)                      {   LoadBranch(b_PFTauDisAgainstElectronTight); return  mPFTauDisAgainstElectronTight[id]; }
+Double_t        EventData::PFTauDisAgainstElectronTightMVA2(UInt_t id)                  {   LoadBranch(b_PFTauDisAgainstElectronTightMVA2); return  mPFTauDisAgainstElectronTightMVA2[id]; }
+Double_t        EventData::PFTauDisAgainstElectronTightMVA3(UInt_t id)                  {   LoadBranch(b_PFTauDisAgainstElectronTightMVA3); return  mPFTauDisAgainstElectronTightMVA3[id]; }
+Double_t        EventData::PFTauDisAgainstElectronVLooseMVA2(UInt_t id)                 {   LoadBranch(b_PFTauDisAgainstElectronVLooseMVA2); return  mPFTauDisAgainstElectronVLooseMVA2[id]; }
+Double_t        EventData::PFTauDisAgainstElectronVTightMVA3(UInt_t id)                 {   LoadBranch(b_PFTauDisAgainstElectronVTightMVA3); return  mPFTauDisAgainstElectronVTightMVA3[id]; }
+Double_t        EventData::PFTauDisAgainstMuonLoose2(UInt_t id)                         {   LoadBranch(b_PFTauDisAgainstMuonLoose2); return  mPFTauDisAgainstMuonLoose2[id]; }
+Double_t        EventData::PFTauDisAgainstMuonLoose(UInt_t id)                          {   LoadBranch(b_PFTauDisAgainstMuonLoose); return  mPFTauDisAgainstMuonLoose[id]; }
+Double_t        EventData::PFTauDisAgainstMuonMedium2(UInt_t id)                        {   LoadBranch(b_PFTauDisAgainstMuonMedium2); return  mPFTauDisAgainstMuonMedium2[id]; }
+Double_t        EventData::PFTauDisAgainstMuonMedium(UInt_t id)                         {   LoadBranch(b_PFTauDisAgainstMuonMedium); return  mPFTauDisAgainstMuonMedium[id]; }
+Double_t        EventData::PFTauDisAgainstMuonTight2(UInt_t id)                         {   LoadBranch(b_PFTauDisAgainstMuonTight2); return  mPFTauDisAgainstMuonTight2[id]; }
+Double_t        EventData::PFTauDisAgainstMuonTight(UInt_t id)                          {   LoadBranch(b_PFTauDisAgainstMuonTight); return  mPFTauDisAgainstMuonTight[id]; }
+Double_t        EventData::PFTauDisByCombinedIsolationDeltaBetaCorrRaw3Hits(UInt_t id)  {   LoadBranch(b_PFTauDisByCombinedIsolationDeltaBetaCorrRaw3Hits); return  mPFTauDisByCombinedIsolationDeltaBetaCorrRaw3Hits[id]; }
+Double_t        EventData::PFTauDisByCombinedIsolationDeltaBetaCorrRaw(UInt_t id)       {   LoadBranch(b_PFTauDisByCombinedIsolationDeltaBetaCorrRaw); return  mPFTauDisByCombinedIsolationDeltaBetaCorrRaw[id]; }
+Double_t        EventData::PFTauDisByIsolationMVA2raw(UInt_t id)                        {   LoadBranch(b_PFTauDisByIsolationMVA2raw); return  mPFTauDisByIsolationMVA2raw[id]; }
+Double_t        EventData::PFTauDisByIsolationMVAraw(UInt_t id)                         {   LoadBranch(b_PFTauDisByIsolationMVAraw); return  mPFTauDisByIsolationMVAraw[id]; }
+Double_t        EventData::PFTauDisByLooseCombinedIsolationDeltaBetaCorr3Hits(UInt_t id){   LoadBranch(b_PFTauDisByLooseCombinedIsolationDeltaBetaCorr3Hits); return  mPFTauDisByLooseCombinedIsolationDeltaBetaCorr3Hits[id]; }
+Double_t        EventData::PFTauDisByLooseCombinedIsolationDeltaBetaCorr(UInt_t id)     {   LoadBranch(b_PFTauDisByLooseCombinedIsolationDeltaBetaCorr); return  mPFTauDisByLooseCombinedIsolationDeltaBetaCorr[id]; }
+Double_t        EventData::PFTauDisByLooseIsolationDeltaBetaCorr(UInt_t id)             {   LoadBranch(b_PFTauDisByLooseIsolationDeltaBetaCorr); return  mPFTauDisByLooseIsolationDeltaBetaCorr[id]; }
+Double_t        EventData::PFTauDisByLooseIsolation(UInt_t id)                          {   LoadBranch(b_PFTauDisByLooseIsolation); return  mPFTauDisByLooseIsolation[id]; }
+Double_t        EventData::PFTauDisByLooseIsolationMVA2(UInt_t id)                      {   LoadBranch(b_PFTauDisByLooseIsolationMVA2); return  mPFTauDisByLooseIsolationMVA2[id]; }
+Double_t        EventData::PFTauDisByLooseIsolationMVA(UInt_t id)                       {   LoadBranch(b_PFTauDisByLooseIsolationMVA); return  mPFTauDisByLooseIsolationMVA[id]; }
+Double_t        EventData::PFTauDisByMediumCombinedIsolationDeltaBetaCorr3Hits(UInt_t id){  LoadBranch(b_PFTauDisByMediumCombinedIsolationDeltaBetaCorr3Hits); return  mPFTauDisByMediumCombinedIsolationDeltaBetaCorr3Hits[id]; }
+Double_t        EventData::PFTauDisByMediumCombinedIsolationDeltaBetaCorr(UInt_t id)    {   LoadBranch(b_PFTauDisByMediumCombinedIsolationDeltaBetaCorr); return  mPFTauDisByMediumCombinedIsolationDeltaBetaCorr[id]; }
+Double_t        EventData::PFTauDisByMediumIsolationDeltaBetaCorr(UInt_t id)            {   LoadBranch(b_PFTauDisByMediumIsolationDeltaBetaCorr); return  mPFTauDisByMediumIsolationDeltaBetaCorr[id]; }
+Double_t        EventData::PFTauDisByMediumIsolation(UInt_t id)                         {   LoadBranch(b_PFTauDisByMediumIsolation); return  mPFTauDisByMediumIsolation[id]; }
+Double_t        EventData::PFTauDisByMediumIsolationMVA2(UInt_t id)                     {   LoadBranch(b_PFTauDisByMediumIsolationMVA2); return  mPFTauDisByMediumIsolationMVA2[id]; }
+Double_t        EventData::PFTauDisByMediumIsolationMVA(UInt_t id)                      {   LoadBranch(b_PFTauDisByMediumIsolationMVA); return  mPFTauDisByMediumIsolationMVA[id]; }
+Double_t        EventData::PFTauDisByTightCombinedIsolationDeltaBetaCorr3Hits(UInt_t id){   LoadBranch(b_PFTauDisByTightCombinedIsolationDeltaBetaCorr3Hits); return  mPFTauDisByTightCombinedIsolationDeltaBetaCorr3Hits[id]; }
+Double_t        EventData::PFTauDisByTightCombinedIsolationDeltaBetaCorr(UInt_t id)     {   LoadBranch(b_PFTauDisByTightCombinedIsolationDeltaBetaCorr); return  mPFTauDisByTightCombinedIsolationDeltaBetaCorr[id]; }
+Double_t        EventData::PFTauDisByTightIsolationDeltaBetaCorr(UInt_t id)             {   LoadBranch(b_PFTauDisByTightIsolationDeltaBetaCorr); return  mPFTauDisByTightIsolationDeltaBetaCorr[id]; }
+Double_t        EventData::PFTauDisByTightIsolation(UInt_t id)                          {   LoadBranch(b_PFTauDisByTightIsolation); return  mPFTauDisByTightIsolation[id]; }
+Double_t        EventData::PFTauDisByTightIsolationMVA2(UInt_t id)                      {   LoadBranch(b_PFTauDisByTightIsolationMVA2); return  mPFTauDisByTightIsolationMVA2[id]; }
+Double_t        EventData::PFTauDisByTightIsolationMVA(UInt_t id)                       {   LoadBranch(b_PFTauDisByTightIsolationMVA); return  mPFTauDisByTightIsolationMVA[id]; }
+Double_t        EventData::PFTauDisByVLooseCombinedIsolationDeltaBetaCorr(UInt_t id)    {   LoadBranch(b_PFTauDisByVLooseCombinedIsolationDeltaBetaCorr); return  mPFTauDisByVLooseCombinedIsolationDeltaBetaCorr[id]; }
+Double_t        EventData::PFTauDisByVLooseIsolationDeltaBetaCorr(UInt_t id)            {   LoadBranch(b_PFTauDisByVLooseIsolationDeltaBetaCorr); return  mPFTauDisByVLooseIsolationDeltaBetaCorr[id]; }
+Double_t        EventData::PFTauDisByVLooseIsolation(UInt_t id)                         {   LoadBranch(b_PFTauDisByVLooseIsolation); return  mPFTauDisByVLooseIsolation[id]; }
+Double_t        EventData::PFTauDisDecayModeFinding(UInt_t id)                          {   LoadBranch(b_PFTauDisDecayModeFinding); return  mPFTauDisDecayModeFinding[id]; }
+Double_t        EventData::PFTauJetPt(UInt_t id)                                        {   LoadBranch(b_PFTauJetPt); return  mPFTauJetPt[id];               }
+Double_t        EventData::PFTauJetEta(UInt_t id)                                       {   LoadBranch(b_PFTauJetEta); return  mPFTauJetEta[id];             }
+Double_t        EventData::PFTauJetPhi(UInt_t id)                                       {   LoadBranch(b_PFTauJetPhi); return  mPFTauJetPhi[id];             }
+
+Int_t           EventData::WTauDecayMode()                                   {   LoadBranch(b_WTauDecayMode); return mWTauDecayMode; }
+Int_t           EventData::WTauN()                                           {   LoadBranch(b_WTauN); return mWTauN; }
+Int_t           EventData::WTauDecayId(UInt_t id)                            {   LoadBranch(b_WTauDecayId); return mWTauDecayId[id]; }
+Double_t        EventData::WTauDecayPt(UInt_t id)                            {   LoadBranch(b_WTauDecayPt); return mWTauDecayPt[id]; }
+Double_t        EventData::WTauDecayEta(UInt_t id)                           {   LoadBranch(b_WTauDecayEta); return mWTauDecayEta[id]; }
+Double_t        EventData::WTauDecayPhi(UInt_t id)                           {   LoadBranch(b_WTauDecayPhi); return mWTauDecayPhi[id]; }
+Double_t        EventData::WTauDecayMass(UInt_t id)                          {   LoadBranch(b_WTauDecayMass); return mWTauDecayMass[id]; }
 						
-Int_t           EventData::NPhot()                                           {   return  mNPhot;                                   }
-Double_t        EventData::PhotE(UInt_t id)                                  {   return  mPhotE[id];                               }
-Double_t        EventData::PhotPt(UInt_t id)                                 {   return  mPhotPt[id];                              }
-Double_t        EventData::PhotPx(UInt_t id)                                 {   return  mPhotPx[id];                              }
-Double_t        EventData::PhotPy(UInt_t id)                                 {   return  mPhotPy[id];                              }
-Double_t        EventData::PhotPz(UInt_t id)                                 {   return  mPhotPz[id];                              }
-Double_t        EventData::PhotEta(UInt_t id)                                {   return  mPhotEta[id];                             }
-Double_t        EventData::PhotPhi(UInt_t id)                                {   return  mPhotPhi[id];                             }
-Double_t        EventData::PhotE1x5(UInt_t id)                               {   return  mPhotE1x5[id];                            }
-Double_t        EventData::PhotE2x5(UInt_t id)                               {   return  mPhotE2x5[id];                            }
-Double_t        EventData::PhotE5x5(UInt_t id)                               {   return  mPhotE5x5[id];                            }
-Double_t        EventData::PhotSigEta(UInt_t id)                             {   return  mPhotSigEta[id];                          }
-Double_t        EventData::PhotSigPhi(UInt_t id)                             {   return  mPhotSigPhi[id];                          }
-Double_t        EventData::PhotEcalIso04(UInt_t id)                          {   return  mPhotEcalIso04[id];                       }
-Double_t        EventData::PhotHcalIso04(UInt_t id)                          {   return  mPhotHcalIso04[id];                       }
-Double_t        EventData::PhotTrackIso04(UInt_t id)                         {   return  mPhotTrackIso04[id];                      }
-Double_t        EventData::PhotHasPixSeed(UInt_t id)                         {   return  mPhotHasPixSeed[id];                      }
-Double_t        EventData::PhotIsPhot(UInt_t id)                             {   return  mPhotIsPhot[id];                          }
+Int_t           EventData::NPhot()                                           {   LoadBranch(b_NPhot); return  mNPhot;              }
+Double_t        EventData::PhotE(UInt_t id)                                  {   LoadBranch(b_PhotE); return  mPhotE[id];          }
+Double_t        EventData::PhotPt(UInt_t id)                                 {   LoadBranch(b_PhotPt); return  mPhotPt[id];        }
+Double_t        EventData::PhotPx(UInt_t id)                                 {   LoadBranch(b_PhotPx); return  mPhotPx[id];        }
+Double_t        EventData::PhotPy(UInt_t id)                                 {   LoadBranch(b_PhotPy); return  mPhotPy[id];        }
+Double_t        EventData::PhotPz(UInt_t id)                                 {   LoadBranch(b_PhotPz); return  mPhotPz[id];        }
+Double_t        EventData::PhotEta(UInt_t id)                                {   LoadBranch(b_PhotEta); return  mPhotEta[id];      }
+Double_t        EventData::PhotPhi(UInt_t id)                                {   LoadBranch(b_PhotPhi); return  mPhotPhi[id];      }
+Double_t        EventData::PhotE1x5(UInt_t id)                               {   LoadBranch(b_PhotE1x5); return  mPhotE1x5[id];    }
+Double_t        EventData::PhotE2x5(UInt_t id)                               {   LoadBranch(b_PhotE2x5); return  mPhotE2x5[id];    }
+Double_t        EventData::PhotE5x5(UInt_t id)                               {   LoadBranch(b_PhotE5x5); return  mPhotE5x5[id];    }
+Double_t        EventData::PhotSigEta(UInt_t id)                             {   LoadBranch(b_PhotSigEta); return  mPhotSigEta[id]; }
+Double_t        EventData::PhotSigPhi(UInt_t id)                             {   LoadBranch(b_PhotSigPhi); return  mPhotSigPhi[id]; }
+Double_t        EventData::PhotEcalIso04(UInt_t id)                          {   LoadBranch(b_PhotEcalIso04); return  mPhotEcalIso04[id]; }
+Double_t        EventData::PhotHcalIso04(UInt_t id)                          {   LoadBranch(b_PhotHcalIso04); return  mPhotHcalIso04[id]; }
+Double_t        EventData::PhotTrackIso04(UInt_t id)                         {   LoadBranch(b_PhotTrackIso04); return  mPhotTrackIso04[id]; }
+Double_t        EventData::PhotHasPixSeed(UInt_t id)                         {   LoadBranch(b_PhotHasPixSeed); return  mPhotHasPixSeed[id]; }
+Double_t        EventData::PhotIsPhot(UInt_t id)                             {   LoadBranch(b_PhotIsPhot); return  mPhotIsPhot[id]; }
 						
-Int_t           EventData::NPV()                                             {   return  mNPV;                                     }
-Double_t        EventData::PVx(UInt_t id)                                    {   return  mPVx[id];                                 }
-Double_t        EventData::PVy(UInt_t id)                                    {   return  mPVy[id];                                 }
-Double_t        EventData::PVz(UInt_t id)                                    {   return  mPVz[id];                                 }
-Double_t        EventData::PVchi2(UInt_t id)                                 {   return  mPVchi2[id];                              }
-Double_t        EventData::PVndof(UInt_t id)                                 {   return  mPVndof[id];                              }
-Int_t           EventData::PVntracks(UInt_t id)                              {   return  mPVntracks[id];                           }
+Int_t           EventData::NPV()                                             {   LoadBranch(b_NPV); return  mNPV;                  }
+Double_t        EventData::PVx(UInt_t id)                                    {   LoadBranch(b_PVx); return  mPVx[id];              }
+Double_t        EventData::PVy(UInt_t id)                                    {   LoadBranch(b_PVy); return  mPVy[id];              }
+Double_t        EventData::PVz(UInt_t id)                                    {   LoadBranch(b_PVz); return  mPVz[id];              }
+Double_t        EventData::PVchi2(UInt_t id)                                 {   LoadBranch(b_PVchi2); return  mPVchi2[id];        }
+Double_t        EventData::PVndof(UInt_t id)                                 {   LoadBranch(b_PVndof); return  mPVndof[id];        }
+Int_t           EventData::PVntracks(UInt_t id)                              {   LoadBranch(b_PVntracks); return  mPVntracks[id];  }
 						
-Int_t           EventData::nHLT()                                            {   return  mnHLT;                                    }
-Int_t           EventData::HLTArray(UInt_t id)                               {   return  mHLTArray[id];                            }
-Int_t           EventData::HLTArray2(UInt_t id)                              {   return  mHLTArray2[id];                           }
-string          EventData::HLTNames()                                        {   return  mHLTNames;                                }
-Int_t           EventData::HLTPreScale2(UInt_t id)                           {   return  mHLTPreScale2[id];                        }
-Int_t           EventData::nL1()                                             {   return  mnL1;                                     }
-Int_t           EventData::L1Array(UInt_t id)                                {   return  mL1Array[id];                             }
-Int_t           EventData::nL1T()                                            {   return  mnL1T;                                    }
-Int_t           EventData::L1TArray(UInt_t id)                               {   return  mL1TArray[id];                            }
+Int_t           EventData::nHLT()                                            {   LoadBranch(b_nHLT); return  mnHLT;                }
+Int_t           EventData::HLTArray(UInt_t id)                               {   LoadBranch(b_HLTArray); return  mHLTArray[id];    }
+Int_t           EventData::HLTArray2(UInt_t id)                              {   LoadBranch(b_HLTArray2); return  mHLTArray2[id];  }
+string          EventData::HLTNames()                                        {   LoadBranch(b_HLTNames); return  mHLTNames;        }
+Int_t           EventData::HLTPreScale2(UInt_t id)                           {   LoadBranch(b_HLTPreScale2); return  mHLTPreScale2[id]; }
+Int_t           EventData::nL1()                                             {   LoadBranch(b_nL1); return  mnL1;                  }
+Int_t           EventData::L1Array(UInt_t id)                                {   LoadBranch(b_L1Array); return  mL1Array[id];      }
+Int_t           EventData::nL1T()                                            {   LoadBranch(b_nL1T); return  mnL1T;                }
+Int_t           EventData::L1TArray(UInt_t id)                               {   LoadBranch(b_L1TArray); return  mL1TArray[id];    }
 							
-Int_t           EventData::BeamHaloTight()                                   {   return  mBeamHaloTight;                           }
-Int_t           EventData::BeamHaloLoose()                                   {   return  mBeamHaloLoose;                           }
-
-Int_t           EventData::TIV_N()                                           {   return  mTIV_N;                                   }
-Float_t         EventData::TIV(UInt_t id)                                    {   return  mTIV[id];                                 }
-Float_t         EventData::TIV_pt(UInt_t id)                                 {   return  mTIV_pt[id];                              }
-Float_t         EventData::TIV_px(UInt_t id)                                 {   return  mTIV_px[id];                              }
-Float_t         EventData::TIV_py(UInt_t id)                                 {   return  mTIV_py[id];                              }
-Float_t         EventData::TIV_pz(UInt_t id)                                 {   return  mTIV_pz[id];                              }
-Float_t         EventData::TIV_phi(UInt_t id)                                {   return  mTIV_phi[id];                             }
-Float_t         EventData::TIV_eta(UInt_t id)                                {   return  mTIV_eta[id];                             }
-Float_t         EventData::TIV_dsz(UInt_t id)                                {   return  mTIV_dsz[id];                             }
-Float_t         EventData::TIV_dxy(UInt_t id)                                {   return  mTIV_dxy[id];                             }
-Float_t         EventData::TIV_d0(UInt_t id)                                 {   return  mTIV_d0[id];                              }
-Float_t         EventData::TIV_dz(UInt_t id)                                 {   return  mTIV_dz[id];                              }
-Float_t         EventData::TIV_dsz_corr(UInt_t id)                           {   return  mTIV_dsz_corr[id];                        }
-Float_t         EventData::TIV_dxy_corr(UInt_t id)                           {   return  mTIV_dxy_corr[id];                        }
-Float_t         EventData::TIV_d0_corr(UInt_t id)                            {   return  mTIV_d0_corr[id];                         }
-Float_t         EventData::TIV_dz_corr(UInt_t id)                            {   return  mTIV_dz_corr[id];                         }
-Float_t         EventData::TIV_dR(UInt_t id)                                 {   return  mTIV_dR[id];                              }
-Int_t           EventData::TIV_lead(UInt_t id)                               {   return  mTIV_lead[id];                            }
-Float_t         EventData::LowTIV()                                          {   return  mLowTIV;                                  }
-
-Int_t           EventData::NGenPar()                                         {    return  mNGenPar;                                }
-Int_t           EventData::GenParId    (UInt_t id)                           {    return  mGenParId    [id];                       }
-Int_t           EventData::GenParStatus(UInt_t id)                           {    return  mGenParStatus[id];                       }
-Double_t        EventData::GenParE     (UInt_t id)                           {    return  mGenParE     [id];                       }
-Double_t        EventData::GenParPx    (UInt_t id)                           {    return  mGenParPx    [id];                       }
-Double_t        EventData::GenParPy    (UInt_t id)                           {    return  mGenParPy    [id];                       }
-Double_t        EventData::GenParPz    (UInt_t id)                           {    return  mGenParPz    [id];                       }
-Double_t        EventData::GenParEta   (UInt_t id)                           {    return  mGenParEta   [id];                       }
-Double_t        EventData::GenParPhi   (UInt_t id)                           {    return  mGenParPhi   [id];                       }
-Int_t           EventData::GenParCharge(UInt_t id)                           {    return  mGenParCharge[id];                       }
-Double_t        EventData::GenParPt    (UInt_t id)                           {    return  mGenParPt    [id];                       }
-Double_t        EventData::GenParMass  (UInt_t id)                           {    return  mGenParMass  [id];                       }
-Int_t           EventData::GenParMother1(UInt_t id)                          {    return  mGenParMother1[id];                      }
-Int_t           EventData::GenParMother2(UInt_t id)                          {    return  mGenParMother2[id];                      }
-Int_t           EventData::GenParDoughterOf(UInt_t id)                       {    return  mGenParDoughterOf[id];                   }
-
-Double_t        EventData::GenAK4JetE         (UInt_t id)                    {    return mGenAK4JetE          [id];                } 
-Double_t        EventData::GenAK4JetPt        (UInt_t id)                    {    return mGenAK4JetPt         [id];                } 
-Double_t        EventData::GenAK4JetPx        (UInt_t id)                    {    return mGenAK4JetPx         [id];                } 
-Double_t        EventData::GenAK4JetPy        (UInt_t id)                    {    return mGenAK4JetPy         [id];                } 
-Double_t        EventData::GenAK4JetPz        (UInt_t id)                    {    return mGenAK4JetPz         [id];                } 
-Double_t        EventData::GenAK4JetEta       (UInt_t id)                    {    return mGenAK4JetEta        [id];                } 
-Double_t        EventData::GenAK4JetPhi       (UInt_t id)                    {    return mGenAK4JetPhi        [id];                } 
-Double_t        EventData::GenAK4JetEmEnergy  (UInt_t id)                    {    return mGenAK4JetEmEnergy   [id];                } 
-Double_t        EventData::GenAK4JetHadEnergy (UInt_t id)                    {    return mGenAK4JetHadEnergy  [id];                } 
-
-Double_t         EventData::PDFGenScale()                                    {   return  mPDFGenScale;                            }
-Double_t         EventData::PDFx1()                                          {   return  mPDFx1;                                  }
-Double_t         EventData::PDFx2()                                          {   return  mPDFx2;                                  }
-Int_t            EventData::PDFf1()                                          {   return  mPDFf1;                                  }
-Int_t            EventData::PDFf2()                                          {   return  mPDFf2;                                  }
-Double_t         EventData::PDFscale()                                       {   return  mPDFscale;                               }
-Double_t         EventData::PDFpdf1()                                        {   return  mPDFpdf1;                                }
-Double_t         EventData::PDFpdf2()                                        {   return  mPDFpdf2;                                }
+Int_t           EventData::BeamHaloTight()                                   {   LoadBranch(b_BeamHaloTight); return  mBeamHaloTight; }
+Int_t           EventData::BeamHaloLoose()                                   {   LoadBranch(b_BeamHaloLoose); return  mBeamHaloLoose; }
+
+Int_t           EventData::TIV_N()                                           {   LoadBranch(b_TIV_N); return  mTIV_N;              }
+Float_t         EventData::TIV(UInt_t id)                                    {   LoadBranch(b_TIV); return  mTIV[id];              }
+Float_t         EventData::TIV_pt(UInt_t id)                                 {   LoadBranch(b_TIV_pt); return  mTIV_pt[id];        }
+Float_t         EventData::TIV_px(UInt_t id)                                 {   LoadBranch(b_TIV_px); return  mTIV_px[id];        }
+Float_t         EventData::TIV_py(UInt_t id)                                 {   LoadBranch(b_TIV_py); return  mTIV_py[id];        }
+Float_t         EventData::TIV_pz(UInt_t id)                                 {   LoadBranch(b_TIV_pz); return  mTIV_pz[id];        }
+Float_t         EventData::TIV_phi(UInt_t id)                                {   LoadBranch(b_TIV_phi); return  mTIV_phi[id];      }
+Float_t         EventData::TIV_eta(UInt_t id)                                {   LoadBranch(b_TIV_eta); return  mTIV_eta[id];      }
+Float_t         EventData::TIV_dsz(UInt_t id)                                {   LoadBranch(b_TIV_dsz); return  mTIV_dsz[id];      }
+Float_t         EventData::TIV_dxy(UInt_t id)                                {   LoadBranch(b_TIV_dxy); return  mTIV_dxy[id];      }
+Float_t         EventData::TIV_d0(UInt_t id)                                 {   LoadBranch(b_TIV_d0); return  mTIV_d0[id];        }
+Float_t         EventData::TIV_dz(UInt_t id)                                 {   LoadBranch(b_TIV_dz); return  mTIV_dz[id];        }
+Float_t         EventData::TIV_dsz_corr(UInt_t id)                           {   LoadBranch(b_TIV_dsz_corr); return  mTIV_dsz_corr[id]; }
+Float_t         EventData::TIV_dxy_corr(UInt_t id)                           {   LoadBranch(b_TIV_dxy_corr); return  mTIV_dxy_corr[id]; }
+Float_t         EventData::TIV_d0_corr(UInt_t id)                            {   LoadBranch(b_TIV_d0_corr); return  mTIV_d0_corr[id]; }
+Float_t         EventData::TIV_dz_corr(UInt_t id)                            {   LoadBranch(b_TIV_dz_corr); return  mTIV_dz_corr[id]; }
+Float_t         EventData::TIV_dR(UInt_t id)                                 {   LoadBranch(b_TIV_dR); return  mTIV_dR[id];        }
+Int_t           EventData::TIV_lead(UInt_t id)                               {   LoadBranch(b_TIV_lead); return  mTIV_lead[id];    }
+Float_t         EventData::LowTIV()                                          {   LoadBranch(b_LowTIV); return  mLowTIV;            }
+
+Int_t           EventData::NGenPar()                                         {    LoadBranch(b_NGenPar); return  mNGenPar;         }
+Int_t           EventData::GenParId    (UInt_t id)                           {    LoadBranch(b_GenParId); return  mGenParId    [id]; }
+Int_t           EventData::GenParStatus(UInt_t id)                           {    LoadBranch(b_GenParStatus); return  mGenParStatus[id]; }
+Double_t        EventData::GenParE     (UInt_t id)                           {    LoadBranch(b_GenParE); return  mGenParE     [id]; }
+Double_t        EventData::GenParPx    (UInt_t id)                           {    LoadBranch(b_GenParPx); return  mGenParPx    [id]; }
+Double_t        EventData::GenParPy    (UInt_t id)                           {    LoadBranch(b_GenParPy); return  mGenParPy    [id]; }
+Double_t        EventData::GenParPz    (UInt_t id)                           {    LoadBranch(b_GenParPz); return  mGenParPz    [id]; }
+Double_t        EventData::GenParEta   (UInt_t id)                           {    LoadBranch(b_GenParEta); return  mGenParEta   [id]; }
+Double_t        EventData::GenParPhi   (UInt_t id)                           {    LoadBranch(b_GenParPhi); return  mGenParPhi   [id]; }
+Int_t           EventData::GenParCharge(UInt_t id)                           {    LoadBranch(b_GenParCharge); return  mGenParCharge[id]; }
+Double_t        EventData::GenParPt    (UInt_t id)                           {    LoadBranch(b_GenParPt); return  mGenParPt    [id]; }
+Double_t        EventData::GenParMass  (UInt_t id)                           {    LoadBranch(b_GenParMass); return  mGenParMass  [id]; }
+Int_t           EventData::GenParMother1(UInt_t id)                          {    LoadBranch(b_GenParMother1); return  mGenParMother1[id]; }
+Int_t           EventData::GenParMother2(UInt_t id)                          {    LoadBranch(b_GenParMother2); return  mGenParMother2[id]; }
+Int_t           EventData::GenParDoughterOf(UInt_t id)                       {    LoadBranch(b_GenParDoughterOf); return  mGenParDoughterOf[id]; }
+
+Double_t        EventData::GenAK4JetE         (UInt_t id)                    {    LoadBranch(b_GenAK4JetE); return mGenAK4JetE          [id]; } 
+Double_t        EventData::GenAK4JetPt        (UInt_t id)                    {    LoadBranch(b_GenAK4JetPt); return mGenAK4JetPt         [id]; } 
+Double_t        EventData::GenAK4JetPx        (UInt_t id)                    {    LoadBranch(b_GenAK4JetPx); return mGenAK4JetPx         [id]; } 
+Double_t        EventData::GenAK4JetPy        (UInt_t id)                    {    LoadBranch(b_GenAK4JetPy); return mGenAK4JetPy         [id]; } 
+Double_t        EventData::GenAK4JetPz        (UInt_t id)                    {    LoadBranch(b_GenAK4JetPz); return mGenAK4JetPz         [id]; } 
+Double_t        EventData::GenAK4JetEta       (UInt_t id)                    {    LoadBranch(b_GenAK4JetEta); return mGenAK4JetEta        [id]; } 
+Double_t        EventData::GenAK4JetPhi       (UInt_t id)                    {    LoadBranch(b_GenAK4JetPhi); return mGenAK4JetPhi        [id]; } 
+Double_t        EventData::GenAK4JetEmEnergy  (UInt_t id)                    {    LoadBranch(b_GenAK4JetEmEnergy); return mGenAK4JetEmEnergy   [id]; } 
+Double_t        EventData::GenAK4JetHadEnergy (UInt_t id)                    {    LoadBranch(b_GenAK4JetHadEnergy); return mGenAK4JetHadEnergy  [id]; } 
+
+Double_t         EventData::PDFGenScale()                                    {   LoadBranch(b_GenScale); return  mPDFGenScale;    }
+Double_t         EventData::PDFx1()                                          {   LoadBranch(b_PDFx1); return  mPDFx1;             }
+Double_t         EventData::PDFx2()                                          {   LoadBranch(b_PDFx2); return  mPDFx2;             }
+Int_t            EventData::PDFf1()                                          {   LoadBranch(b_PDFf1); return  mPDFf1;             }
+Int_t            EventData::PDFf2()                                          {   LoadBranch(b_PDFf2); return  mPDFf2;             }
+Double_t         EventData::PDFscale()                                       {   LoadBranch(b_PDFscale); return  mPDFscale;       }
+Double_t         EventData::PDFpdf1()                                        {   LoadBranch(b_PDFpdf1); return  mPDFpdf1;         }
+Double_t         EventData::PDFpdf2()                                        {   LoadBranch(b_PDFpdf2); return  mPDFpdf2;         }
 
 
 
@@ -3,10 +3,17 @@
 
 #include <TROOT.h>
 #include <TTree.h>
+#include <TChain.h>
 #include <TFile.h>
+#include <TBranch.h>
+#include <TLeaf.h>
+#include <TLorentzVector.h>
 #include <map>
 #include <LHAPDF/LHAPDF.h>
 
+#include "DatasetCatalog.h"
+#include "EventDataViews.h"
+
 #define TIVMAX 10000
 #define MAXMUON 30
 #define MAXTAU 50
@@ -30,17 +37,113 @@ class EventData
   
   bool            GetNextEvent();
   
+  // Entries to process are [FirstEntry(), Entries()), SetEntryRange restricts them for a worker
+  Long64_t        FirstEntry();
+  Long64_t        Entries();
+  void            SetEntryRange(Long64_t first, Long64_t last);
+  
+  // Boundaries of nParts ranges covering [FirstEntry(), Entries()), on file boundaries where
+  // one is within half a range of the even split
+  vector<Long64_t> SplitEntries(int nParts);
+  
+  // TTreeCache of size bytes on the ntuple (0 sizes it for one cluster of the bound branches).
+  // The branches read in the first learnEntries events are cached, then the cache is resized
+  // for them. The constructor sets it up with SetReadCache(0, 100)
+  void            SetReadCache(Long64_t size, Long64_t learnEntries);
+  void            PrintReadStats();
+  
+  // Per-event results of the Operation jet helpers (JetIndex, WideJetIndex,
+  // JetNumber, WideJetNumber, WideJet1), invalidated by GetNextEvent()
+  struct JetCache
+  {
+    bool            hasJetIndex;
+    bool            hasWideJetIndex;
+    bool            hasJetNumber;
+    bool            hasWideJetNumber;
+    bool            hasWideJet1;
+    vector<int>     jetIndex;
+    vector<int>     wideJetIndex;
+    int             jetNumber;
+    int             wideJetNumber;
+    TLorentzVector  wideJet1;
+    bool            hasCor[5];        // PFAK4 ECor, PtCor, PxCor, PyCor, PzCor with the variation
+    vector<Double_t> cor[5];          // grown with the PFAK4 collection, not bound by MAXJET
+  };
+  JetCache &      Cache();
+  
+  // Array of one branch over the current event, valid until the next GetNextEvent()
+  template<class T> struct Span
+  {
+    Span(const T * d, Int_t n) : data(d), n(n) {}
+    const T & operator[](Int_t i) const { return data[i]; }
+    const T * begin() const { return data; }
+    const T * end() const { return data+n; }
+    Int_t size() const { return n; }
+    const T * data;
+    Int_t n;
+  };
+  
+  // Collections as arrays, ev.PFAK4Jets().Eta()[i] is ev.PFAK4JetEta(i) without a call per
+  // element. Columns listed in EventDataViews.h
+  EVENTDATA_VIEW_BEGIN(PFAK4JetView, NPFAK4Jets)
+    EVENTDATA_PFAK4JET_COLUMNS(EVENTDATA_VIEW_COLUMN)
+    // corrected momenta, with the JES/JER variation like PFAK4JetPtCor(i)
+    Span<Double_t> ECor()  const { return mEv->PFAK4JetCorSpan(0, mEv->b_PFAK4JetECor,  mEv->mPFAK4JetECor); }
+    Span<Double_t> PtCor() const { return mEv->PFAK4JetCorSpan(1, mEv->b_PFAK4JetPtCor, mEv->mPFAK4JetPtCor); }
+    Span<Double_t> PxCor() const { return mEv->PFAK4JetCorSpan(2, mEv->b_PFAK4JetPxCor, mEv->mPFAK4JetPxCor); }
+    Span<Double_t> PyCor() const { return mEv->PFAK4JetCorSpan(3, mEv->b_PFAK4JetPyCor, mEv->mPFAK4JetPyCor); }
+    Span<Double_t> PzCor() const { return mEv->PFAK4JetCorSpan(4, mEv->b_PFAK4JetPzCor, mEv->mPFAK4JetPzCor); }
+  EVENTDATA_VIEW_END
+  EVENTDATA_VIEW_BEGIN(CaloAK4JetView, NCaloAK4Jets) EVENTDATA_CALOAK4JET_COLUMNS(EVENTDATA_VIEW_COLUMN) EVENTDATA_VIEW_END
+  EVENTDATA_VIEW_BEGIN(PFMuonView,     NPFMuon)      EVENTDATA_PFMUON_COLUMNS(EVENTDATA_VIEW_COLUMN)     EVENTDATA_VIEW_END
+  EVENTDATA_VIEW_BEGIN(PFElecView,     NPFElec)      EVENTDATA_PFELEC_COLUMNS(EVENTDATA_VIEW_COLUMN)     EVENTDATA_VIEW_END
+  EVENTDATA_VIEW_BEGIN(PFTauView,      NPFTau)       EVENTDATA_PFTAU_COLUMNS(EVENTDATA_VIEW_COLUMN)      EVENTDATA_VIEW_END
+  EVENTDATA_VIEW_BEGIN(MuonView,       NMuon)        EVENTDATA_MUON_COLUMNS(EVENTDATA_VIEW_COLUMN)       EVENTDATA_VIEW_END
+  EVENTDATA_VIEW_BEGIN(ElecView,       NElec)        EVENTDATA_ELEC_COLUMNS(EVENTDATA_VIEW_COLUMN)       EVENTDATA_VIEW_END
+  EVENTDATA_VIEW_BEGIN(TauView,        NTau)         EVENTDATA_TAU_COLUMNS(EVENTDATA_VIEW_COLUMN)        EVENTDATA_VIEW_END
+  EVENTDATA_VIEW_BEGIN(PhotView,       NPhot)        EVENTDATA_PHOT_COLUMNS(EVENTDATA_VIEW_COLUMN)       EVENTDATA_VIEW_END
+  EVENTDATA_VIEW_BEGIN(GenParView,     NGenPar)      EVENTDATA_GENPAR_COLUMNS(EVENTDATA_VIEW_COLUMN)     EVENTDATA_VIEW_END
+  
+  PFAK4JetView    PFAK4Jets()   { return PFAK4JetView(this);   }
+  CaloAK4JetView  CaloAK4Jets() { return CaloAK4JetView(this); }
+  PFMuonView      PFMuons()     { return PFMuonView(this);     }
+  PFElecView      PFElecs()     { return PFElecView(this);     }
+  PFTauView       PFTaus()      { return PFTauView(this);      }
+  MuonView        Muons()       { return MuonView(this);       }
+  ElecView        Elecs()       { return ElecView(this);       }
+  TauView         Taus()        { return TauView(this);        }
+  PhotView        Phots()       { return PhotView(this);       }
+  GenParView      GenPars()     { return GenParView(this);     }
+  
   vector<double>  PileUpWeights();
   
   double          Weight();
   int             IsMC();
   
-  string          JetType();
-  string          LepType();
+  // Jet and lepton collections used by the operations, fixed in the constructor
+  enum { JetCalo = 0, JetPF, JetWidePF };
+  enum { LepMuon = 0, LepElec, LepTau };
+  int             JetType();
+  int             LepType();
   int             MetType();
   float           EnergyScale();
+  
+  // Systematic variation of the PF AK4 jets and of the MET: energy scale shift in units
+  // of PFAK4uncer and JER smearing mode, Manager::Run switches it for each variation chain
+  enum { JERNone = 0, JERCentral, JERUp, JERDown };
+  void            SetVariation(float energyScale, int jerMode);
+  int             JERMode();
+  Double_t        PFAK4JetScale(UInt_t id);
   float           SecJetCut();
   
+  // PDF reweighting with LHAPDF6 sets, one PDF object per member so there is no switching of
+  // the global member. PDFWeight(i) is member i of the members set over member 0 of the
+  // reference set, PDFWeightAlphaS(i) member i of the alphaS set. All of them are evaluated
+  // once per event. SetPDFSets is called before the EventData are made, "" leaves a set out
+  static void     SetPDFSets(const string & members, const string & reference, const string & alphaS);
+  bool            HasPDFSets();
+  const vector<double> & PDFWeightVector();
+  
   Double_t        PDFWeights(UInt_t id);
   Double_t        PDFWeight(UInt_t id);
   Double_t        PDFWeightAlphaS( UInt_t id );
@@ -129,12 +232,28 @@ class EventData
   Int_t           PFAK4JetIDTIGHT(UInt_t id);
   Double_t           PFAK4JetPUFullJetId(UInt_t id); 
   Double_t        PFAK4uncer(UInt_t id);
+  Double_t        GenPFAK4JetPt(UInt_t id);
+  Double_t        PFAK4JERCentral(UInt_t id);
+  Double_t        PFAK4JERUp(UInt_t id);
+  Double_t        PFAK4JERDown(UInt_t id);
   
   Int_t           NMet();
   Double_t        MetPt(UInt_t id);
   Double_t        MetPx(UInt_t id);
   Double_t        MetPy(UInt_t id);
   Double_t        MetPhi(UInt_t id);
+  // MET with the PF leptons added back (all of them or the tight ones only), as
+  // Operation::MetLepPt( MetPx(id) , MetPy(id) , ev ) but from the per-event sums
+  Double_t        MetLepPt(UInt_t id);
+  Double_t        MetLepPhi(UInt_t id);
+  Double_t        MetTightLepPt(UInt_t id);
+  // Per-event sums behind the MET accessors, computed once per event and variation
+  Double_t        MetJetShiftPx();
+  Double_t        MetJetShiftPy();
+  Double_t        PFLepSumPx();
+  Double_t        PFLepSumPy();
+  Double_t        PFTightLepSumPx();
+  Double_t        PFTightLepSumPy();
   Double_t        MetSumEt(UInt_t id);
   Double_t        MetSign(UInt_t id);
 
@@ -606,15 +725,132 @@ class EventData
   Double_t	  PDFpdf1();
   Double_t	  PDFpdf2();
   
+  // Write the bound branches as a column cache in dir (one .col file per branch, plus
+  // a .off file of element offsets for variable length ones). The cache is read back
+  // with the dataset name "col:dir"
+  bool            WriteColumns(const string & dir);
+  
  private:
   
   unsigned int mEvent, mMaxEvents;
   
+  // Lazy branch loading: only branches touched through an accessor are read
+  bool     mLazyLoad;
+  Long64_t mEntry;
+  void     LoadBranch(TBranch * branch);
+  
+  // Read cache, mCacheLearn counts down the events of the learning phase
+  Long64_t mCacheLearn;
+  Long64_t mEventsRead;
+  Long64_t ReadCacheSize(TObjArray * branches);
+  
+  // Collection arrays, sized from the maximum of the leaf count of each file and grown
+  // when a later file (or a column) holds more entries. The MAX* defines are only used
+  // for branches missing from the ntuple
+  struct Buffer
+  {
+    string          name;
+    void          **address;   // the m member
+    TBranch       **branch;
+    Int_t           size;      // elements
+    Int_t           maxSize;
+    size_t          elemSize;
+    void         *(*allocate)(Int_t n);
+    void          (*release)(void * p);
+  };
+  vector<Buffer> mBuffers;
+  template<class T> static void* NewBuffer(Int_t n) { return new T[n](); }
+  template<class T> static void  DeleteBuffer(void * p) { delete [] (T*) p; }
+  template<class T> void SetBufferAddress(const char * name, T *& buffer, Int_t maxSize, TBranch ** branch);
+  
+  // Binding of the m members. A Float_t leaf (compactOutput ntuple) of a Double_t member is
+  // read into a float copy and converted by ConvertFloats after each read of the branch;
+  // buffer is the member pointer of a collection buffer, which ResizeBuffer may move
+  template<class T> void BranchAddress(const char * name, T * address, TBranch ** branch, void ** buffer = 0)
+  { mDataTree->SetBranchAddress(name, address, branch); }
+  void            BranchAddress(const char * name, Double_t * address, TBranch ** branch, void ** buffer = 0);
+  struct FloatBranch
+  {
+    string          name;
+    TBranch       **branch;
+    Double_t       *target;    // fixed members
+    void          **buffer;    // collection buffers, 0 for fixed members
+    vector<Float_t> staging;
+  };
+  vector<FloatBranch>   mFloatBranches;
+  map<TBranch*, size_t> mFloatIndex;   // by branch of the current tree
+  void            IndexFloatBranches();
+  void            GrowFloatCopy(size_t f, size_t size);
+  void            ConvertFloats(TBranch * branch);
+  Int_t    BufferSize(const string & name, Int_t maxSize);
+  void     ResizeBuffer(size_t i, Int_t size);
+  void     CheckTree();
+  
+  // Column cache backend, branches are copied from memory mapped files
+  struct Column
+  {
+    TBranch        *branch;
+    char           *data;
+    size_t          dataSize;
+    Long64_t       *offsets;   // 0 for fixed size branches
+    size_t          offSize;
+    Int_t           elemSize;
+    Int_t           fixedLen;
+    Long64_t        readEntry;
+    Int_t           buffer;    // index in mBuffers, -1 for the other branches
+  };
+  bool           mColumnar;
+  string         mColumnDir;
+  Long64_t       mColumnEntries;
+  vector<Column> mColumns;
+  bool     OpenColumns();
+  void     LoadColumn(TBranch * branch);
+  
+  JetCache mJetCache;
+  void     ClearCache();
+  void     ClearJetCache();
+  Span<Double_t> PFAK4JetCorSpan(int k, TBranch * branch, Double_t * raw);
+  
+  // Jet and lepton sums used by the MET accessors
+  struct MetCache
+  {
+    bool            hasJetShift;
+    bool            hasLepSum;
+    bool            hasTightLepSum;
+    Double_t        jetShiftPx;
+    Double_t        jetShiftPy;
+    Double_t        lepSumPx;
+    Double_t        lepSumPy;
+    Double_t        tightLepSumPx;
+    Double_t        tightLepSumPy;
+  };
+  MetCache mMetCache;
+  
+  // PDF members of the sets given to SetPDFSets and their values for the current event
+  static string        mPDFSetNames[3];
+  vector<LHAPDF::PDF*> mPDFMembers;
+  vector<LHAPDF::PDF*> mPDFAlphaS;
+  LHAPDF::PDF         *mPDFReference;
+  struct PDFCache
+  {
+    bool            hasWeights;
+    vector<double>  weights;
+    vector<double>  alphaS;
+    double          reference;
+  };
+  PDFCache mPDFCache;
+  void     FillPDFCache();
+  
   TFile *mFile;
   TTree *mDataTree;
   
-  map<string, string> mydataset;
-  map<string, double> mylumi;
+  double mNormalization;
+  
+  // Input chain, mFileWeight is the weight of the file being read
+  TChain         *mChain;
+  vector<double>  mFileWeights;
+  double          mFileWeight;
+  Int_t           mTreeNumber;
 
   // TTree variable
   vector<double>  mPileUpWeights;
@@ -622,11 +858,12 @@ class EventData
   double mWeight;
   int   misMC;
   
-  string mJetType;
-  string mLepType;
+  int mJetType;
+  int mLepType;
   int mMetType;
   
   float mEnergyScale;
+  int   mJERMode;
   float mSecJetCut;
   
   double mCaloTowerdEx;
@@ -647,77 +884,81 @@ class EventData
   Int_t           mNoiseFlag[10];
   
   Int_t           mNCaloAK4Jets;
-  Double_t        mCaloAK4JetE[MAXJET];    
-  Double_t        mCaloAK4JetPt[MAXJET];    
-  Double_t        mCaloAK4JetPx[MAXJET];    
-  Double_t        mCaloAK4JetPy[MAXJET];    
-  Double_t        mCaloAK4JetPz[MAXJET];    
-  Double_t        mCaloAK4JetEta[MAXJET];    
-  Double_t        mCaloAK4JetPhi[MAXJET];    
-  Double_t        mCaloAK4JetEmf[MAXJET];    
-  Double_t        mCaloAK4JetfHPD[MAXJET];    
-  Double_t        mCaloAK4JetfRBX[MAXJET];    
-  Double_t        mCaloAK4JetN90Hits[MAXJET];    
-  Int_t           mCaloAK4JetN90[MAXJET];    
-  Double_t        mCaloAK4JetSigEta[MAXJET];    
-  Double_t        mCaloAK4JetSigPhi[MAXJET];    
-  Double_t        mCaloAK4JetIDEmf[MAXJET];    
-  Double_t        mCaloAK4JetECor[MAXJET];    
-  Double_t        mCaloAK4JetPtCor[MAXJET];    
-  Double_t        mCaloAK4JetPxCor[MAXJET];    
-  Double_t        mCaloAK4JetPyCor[MAXJET];    
-  Double_t        mCaloAK4JetPzCor[MAXJET];    
-  Double_t        mCaloAK4JetBtagTkCountHighEff[MAXJET];    
-  Double_t        mCaloAK4JetBTagSimpleSecVtx[MAXJET];    
-  Double_t        mCaloAK4JetBTagCombSecVtx[MAXJET];    
-  Double_t        mCaloAK4TrackPt[MAXJET];    
-  Int_t           mCaloAK4JetIDLOOSE[MAXJET];    
-  Int_t           mCaloAK4JetIDTIGHT[MAXJET];    
+  Double_t       *mCaloAK4JetE;    
+  Double_t       *mCaloAK4JetPt;    
+  Double_t       *mCaloAK4JetPx;    
+  Double_t       *mCaloAK4JetPy;    
+  Double_t       *mCaloAK4JetPz;    
+  Double_t       *mCaloAK4JetEta;    
+  Double_t       *mCaloAK4JetPhi;    
+  Double_t       *mCaloAK4JetEmf;    
+  Double_t       *mCaloAK4JetfHPD;    
+  Double_t       *mCaloAK4JetfRBX;    
+  Double_t       *mCaloAK4JetN90Hits;    
+  Int_t          *mCaloAK4JetN90;    
+  Double_t       *mCaloAK4JetSigEta;    
+  Double_t       *mCaloAK4JetSigPhi;    
+  Double_t       *mCaloAK4JetIDEmf;    
+  Double_t       *mCaloAK4JetECor;    
+  Double_t       *mCaloAK4JetPtCor;    
+  Double_t       *mCaloAK4JetPxCor;    
+  Double_t       *mCaloAK4JetPyCor;    
+  Double_t       *mCaloAK4JetPzCor;    
+  Double_t       *mCaloAK4JetBtagTkCountHighEff;    
+  Double_t       *mCaloAK4JetBTagSimpleSecVtx;    
+  Double_t       *mCaloAK4JetBTagCombSecVtx;    
+  Double_t       *mCaloAK4TrackPt;    
+  Int_t          *mCaloAK4JetIDLOOSE;    
+  Int_t          *mCaloAK4JetIDTIGHT;    
   
   Int_t           mNPFAK4Jets;
-  Double_t        mPFAK4JetE[MAXJET];    
-  Double_t        mPFAK4JetPt[MAXJET];    
-  Double_t        mPFAK4JetPx[MAXJET];    
-  Double_t        mPFAK4JetPy[MAXJET];    
-  Double_t        mPFAK4JetPz[MAXJET];    
-  Double_t        mPFAK4JetEta[MAXJET];    
-  Double_t        mPFAK4JetPhi[MAXJET];    
-  Double_t        mPFAK4JetfHPD[MAXJET];    
-  Double_t        mPFAK4JetfRBX[MAXJET];    
-  Double_t        mPFAK4JetN90Hits[MAXJET];    
-  Int_t           mPFAK4JetN90[MAXJET];    
-  Double_t        mPFAK4JetSigEta[MAXJET];    
-  Double_t        mPFAK4JetSigPhi[MAXJET];    
-  Double_t        mPFAK4JetIDEmf[MAXJET];    
-  Double_t        mPFAK4JetECor[MAXJET];    
-  Double_t        mPFAK4JetPtCor[MAXJET];    
-  Double_t        mPFAK4JetPxCor[MAXJET];    
-  Double_t        mPFAK4JetPyCor[MAXJET];    
-  Double_t        mPFAK4JetPzCor[MAXJET];    
-  Double_t        mPFAK4JetBtagTkCountHighEff[MAXJET];    
-  Double_t        mPFAK4JetBTagSimpleSecVtx[MAXJET];    
-  Double_t        mPFAK4JetBTagCombSecVtx[MAXJET];    
-  Double_t        mPFAK4JetNeuEmEngFrac[MAXJET];    
-  Double_t        mPFAK4JetChaEmEngFrac[MAXJET];    
-  Double_t        mPFAK4JetChaHadEngFrac[MAXJET];    
-  Double_t        mPFAK4JetNeuHadEngFrac[MAXJET];    
-  Double_t        mPFAK4JetChaMuEng[MAXJET];    
-  Double_t        mPFAK4JetMuonEng[MAXJET];    
-  Double_t        mPFAK4JetPhotEng[MAXJET];    
-  Double_t        mPFAK4JetElecEng[MAXJET];    
-  Int_t           mPFAK4JetNumOfChaMu[MAXJET];    
-  Int_t           mPFAK4JetNumOfMuon[MAXJET];    
-  Int_t           mPFAK4JetNumOfPhot[MAXJET];    
-  Int_t           mPFAK4JetNumOfElec[MAXJET];    
-  Int_t           mPFAK4JetNumOfNeu[MAXJET];    
-  Int_t           mPFAK4JetNumOfCha[MAXJET];    
-  Int_t           mPFAK4JetNumOfNeuHad[MAXJET];    
-  Int_t           mPFAK4JetNumOfChaHad[MAXJET];    
-  Int_t           mPFAK4JetNumOfDaughters[MAXJET];    
-  Int_t           mPFAK4JetIDLOOSE[MAXJET];    
-  Int_t           mPFAK4JetIDTIGHT[MAXJET];
-  Double_t           mPFAK4JetPUFullJetId[MAXJET];
-  Double_t        mPFAK4uncer[MAXJET];
+  Double_t       *mPFAK4JetE;    
+  Double_t       *mPFAK4JetPt;    
+  Double_t       *mPFAK4JetPx;    
+  Double_t       *mPFAK4JetPy;    
+  Double_t       *mPFAK4JetPz;    
+  Double_t       *mPFAK4JetEta;    
+  Double_t       *mPFAK4JetPhi;    
+  Double_t       *mPFAK4JetfHPD;    
+  Double_t       *mPFAK4JetfRBX;    
+  Double_t       *mPFAK4JetN90Hits;    
+  Int_t          *mPFAK4JetN90;    
+  Double_t       *mPFAK4JetSigEta;    
+  Double_t       *mPFAK4JetSigPhi;    
+  Double_t       *mPFAK4JetIDEmf;    
+  Double_t       *mPFAK4JetECor;    
+  Double_t       *mPFAK4JetPtCor;    
+  Double_t       *mPFAK4JetPxCor;    
+  Double_t       *mPFAK4JetPyCor;    
+  Double_t       *mPFAK4JetPzCor;    
+  Double_t       *mPFAK4JetBtagTkCountHighEff;    
+  Double_t       *mPFAK4JetBTagSimpleSecVtx;    
+  Double_t       *mPFAK4JetBTagCombSecVtx;    
+  Double_t       *mPFAK4JetNeuEmEngFrac;    
+  Double_t       *mPFAK4JetChaEmEngFrac;    
+  Double_t       *mPFAK4JetChaHadEngFrac;    
+  Double_t       *mPFAK4JetNeuHadEngFrac;    
+  Double_t       *mPFAK4JetChaMuEng;    
+  Double_t       *mPFAK4JetMuonEng;    
+  Double_t       *mPFAK4JetPhotEng;    
+  Double_t       *mPFAK4JetElecEng;    
+  Int_t          *mPFAK4JetNumOfChaMu;    
+  Int_t          *mPFAK4JetNumOfMuon;    
+  Int_t          *mPFAK4JetNumOfPhot;    
+  Int_t          *mPFAK4JetNumOfElec;    
+  Int_t          *mPFAK4JetNumOfNeu;    
+  Int_t          *mPFAK4JetNumOfCha;    
+  Int_t          *mPFAK4JetNumOfNeuHad;    
+  Int_t          *mPFAK4JetNumOfChaHad;    
+  Int_t          *mPFAK4JetNumOfDaughters;    
+  Int_t          *mPFAK4JetIDLOOSE;    
+  Int_t          *mPFAK4JetIDTIGHT;
+  Double_t          *mPFAK4JetPUFullJetId;
+  Double_t       *mPFAK4uncer;
+  Double_t       *mGenPFAK4JetPt;
+  Double_t       *mPFAK4JERCentral;
+  Double_t       *mPFAK4JERUp;
+  Double_t       *mPFAK4JERDown;
   
   Int_t           mNMet;
   Double_t        mMetPt[30];    
@@ -738,386 +979,386 @@ class EventData
   Int_t           mPFLepCharge[MAXMUON];  
   
   Int_t           mNMuon;
-  Double_t        mMuonPt[MAXMUON];    
-  Double_t        mMuonEt[MAXMUON];    
-  Double_t        mMuonE[MAXMUON];    
-  Double_t        mMuonPx[MAXMUON];    
-  Double_t        mMuonPy[MAXMUON];    
-  Double_t        mMuonPz[MAXMUON];    
-  Double_t        mMuonEta[MAXMUON];    
-  Double_t        mMuonPhi[MAXMUON];    
-  Double_t        mMuonCharge[MAXMUON];    
-  Int_t           mMuonIsGlobal[MAXMUON];    
-  Int_t           mMuonIsStandAlone[MAXMUON];    
-  Int_t           mMuonIsTracker[MAXMUON];    
-  Double_t        mMuonSumPtDR03[MAXMUON];    
-  Double_t        mMuonSumPtDR05[MAXMUON];    
-  Double_t        mMuonEmEtDR03[MAXMUON];    
-  Double_t        mMuonHadEtDR03[MAXMUON];    
-  Int_t           mMuonNumOfMatches[MAXMUON];    
-  Double_t        mMuonCombChi2Norm[MAXMUON];    
-  Int_t           mMuonCombValidHits[MAXMUON];    
-  Int_t           mMuonCombLostHits[MAXMUON];    
-  Double_t        mMuonCombPt[MAXMUON];    
-  Double_t        mMuonCombPz[MAXMUON];    
-  Double_t        mMuonCombP[MAXMUON];    
-  Double_t        mMuonCombEta[MAXMUON];    
-  Double_t        mMuonCombPhi[MAXMUON];    
-  Double_t        mMuonCombChi2[MAXMUON];    
-  Double_t        mMuonCombCharge[MAXMUON];    
-  Double_t        mMuonCombQOverPError[MAXMUON];    
-  Double_t        mMuonCombNdof[MAXMUON];    
-  Double_t        mMuonCombVx[MAXMUON];    
-  Double_t        mMuonCombVy[MAXMUON];    
-  Double_t        mMuonCombVz[MAXMUON];    
-  Double_t        mMuonCombD0[MAXMUON];    
-  Double_t        mMuonCombDz[MAXMUON];    
-  Double_t        mMuonStandChi2Norm[MAXMUON];    
-  Int_t           mMuonStandValidHits[MAXMUON];    
-  Int_t           mMuonStandLostHits[MAXMUON];    
-  Double_t        mMuonStandPt[MAXMUON];    
-  Double_t        mMuonStandPz[MAXMUON];    
-  Double_t        mMuonStandP[MAXMUON];    
-  Double_t        mMuonStandEta[MAXMUON];    
-  Double_t        mMuonStandPhi[MAXMUON];    
-  Double_t        mMuonStandChi2[MAXMUON];    
-  Double_t        mMuonStandCharge[MAXMUON];    
-  Double_t        mMuonStandQOverPError[MAXMUON];    
-  Double_t        mMuonTrkChi2Norm[MAXMUON];    
-  Int_t           mMuonTrkValidHits[MAXMUON];    
-  Int_t           mMuonTrkLostHits[MAXMUON];    
-  Double_t        mMuonTrkPt[MAXMUON];    
-  Double_t        mMuonTrkPz[MAXMUON];    
-  Double_t        mMuonTrkP[MAXMUON];    
-  Double_t        mMuonTrkEta[MAXMUON];    
-  Double_t        mMuonTrkPhi[MAXMUON];    
-  Double_t        mMuonTrkChi2[MAXMUON];    
-  Double_t        mMuonTrkCharge[MAXMUON];    
-  Double_t        mMuonTrkQOverPError[MAXMUON];    
-  Double_t        mMuonTrkDxy[MAXMUON];    
-  Int_t           mMuonTrkNumOfValidPixHits[MAXMUON];    
+  Double_t       *mMuonPt;    
+  Double_t       *mMuonEt;    
+  Double_t       *mMuonE;    
+  Double_t       *mMuonPx;    
+  Double_t       *mMuonPy;    
+  Double_t       *mMuonPz;    
+  Double_t       *mMuonEta;    
+  Double_t       *mMuonPhi;    
+  Double_t       *mMuonCharge;    
+  Int_t          *mMuonIsGlobal;    
+  Int_t          *mMuonIsStandAlone;    
+  Int_t          *mMuonIsTracker;    
+  Double_t       *mMuonSumPtDR03;    
+  Double_t       *mMuonSumPtDR05;    
+  Double_t       *mMuonEmEtDR03;    
+  Double_t       *mMuonHadEtDR03;    
+  Int_t          *mMuonNumOfMatches;    
+  Double_t       *mMuonCombChi2Norm;    
+  Int_t          *mMuonCombValidHits;    
+  Int_t          *mMuonCombLostHits;    
+  Double_t       *mMuonCombPt;    
+  Double_t       *mMuonCombPz;    
+  Double_t       *mMuonCombP;    
+  Double_t       *mMuonCombEta;    
+  Double_t       *mMuonCombPhi;    
+  Double_t       *mMuonCombChi2;    
+  Double_t       *mMuonCombCharge;    
+  Double_t       *mMuonCombQOverPError;    
+  Double_t       *mMuonCombNdof;    
+  Double_t       *mMuonCombVx;    
+  Double_t       *mMuonCombVy;    
+  Double_t       *mMuonCombVz;    
+  Double_t       *mMuonCombD0;    
+  Double_t       *mMuonCombDz;    
+  Double_t       *mMuonStandChi2Norm;    
+  Int_t          *mMuonStandValidHits;    
+  Int_t          *mMuonStandLostHits;    
+  Double_t       *mMuonStandPt;    
+  Double_t       *mMuonStandPz;    
+  Double_t       *mMuonStandP;    
+  Double_t       *mMuonStandEta;    
+  Double_t       *mMuonStandPhi;    
+  Double_t       *mMuonStandChi2;    
+  Double_t       *mMuonStandCharge;    
+  Double_t       *mMuonStandQOverPError;    
+  Double_t       *mMuonTrkChi2Norm;    
+  Int_t          *mMuonTrkValidHits;    
+  Int_t          *mMuonTrkLostHits;    
+  Double_t       *mMuonTrkPt;    
+  Double_t       *mMuonTrkPz;    
+  Double_t       *mMuonTrkP;    
+  Double_t       *mMuonTrkEta;    
+  Double_t       *mMuonTrkPhi;    
+  Double_t       *mMuonTrkChi2;    
+  Double_t       *mMuonTrkCharge;    
+  Double_t       *mMuonTrkQOverPError;    
+  Double_t       *mMuonTrkDxy;    
+  Int_t          *mMuonTrkNumOfValidPixHits;    
   
   Int_t           mNPFMuon;
-  Double_t        mPFMuonPt[MAXMUON];    
-  Double_t        mPFMuonEt[MAXMUON];    
-  Double_t        mPFMuonE[MAXMUON];    
-  Double_t        mPFMuonPx[MAXMUON];    
-  Double_t        mPFMuonPy[MAXMUON];    
-  Double_t        mPFMuonPz[MAXMUON];    
-  Double_t        mPFMuonEta[MAXMUON];    
-  Double_t        mPFMuonPhi[MAXMUON];    
-  Int_t           mPFMuonCharge[MAXMUON];    
-  Int_t           mPFMuonIsGlobal[MAXMUON];    
-  Int_t           mPFMuonIsStandAlone[MAXMUON];    
-  Int_t           mPFMuonIsTracker[MAXMUON];
-  Int_t           mPFMuonIsTight[MAXMUON];    
-  Int_t           mPFMuonIsLoose[MAXMUON];
-  Double_t        mPFMuonChargedHadronIso[MAXMUON];    
-  Double_t        mPFMuonPhotonIso[MAXMUON];    
-  Double_t        mPFMuonNeutralHadronIso[MAXMUON];    
-  Int_t           mPFMuonisGMPT[MAXMUON];    
-  Int_t           mPFMuonNumOfMatches[MAXMUON];    
-  Double_t        mPFMuoninnertrackPt[MAXMUON];    
-  Int_t           mPFMuonnValidHits[MAXMUON];    
-  Int_t           mPFMuonnValidPixelHits[MAXMUON];    
-  Double_t        mPFMuondxy[MAXMUON];    
-  Double_t        mPFMuondz[MAXMUON];    
-  Double_t        mPFMuonCombChi2Norm[MAXMUON];    
-  Int_t           mPFMuonCombValidHits[MAXMUON];    
-  Int_t           mPFMuonCombLostHits[MAXMUON];    
-  Double_t        mPFMuonCombPt[MAXMUON];    
-  Double_t        mPFMuonCombPz[MAXMUON];    
-  Double_t        mPFMuonCombP[MAXMUON];    
-  Double_t        mPFMuonCombEta[MAXMUON];    
-  Double_t        mPFMuonCombPhi[MAXMUON];    
-  Double_t        mPFMuonCombChi2[MAXMUON];    
-  Double_t        mPFMuonCombCharge[MAXMUON];    
-  Double_t        mPFMuonCombQOverPError[MAXMUON];    
-  Double_t        mPFMuonCombNdof[MAXMUON];    
-  Double_t        mPFMuonCombVx[MAXMUON];    
-  Double_t        mPFMuonCombVy[MAXMUON];    
-  Double_t        mPFMuonCombVz[MAXMUON];    
-  Double_t        mPFMuonCombD0[MAXMUON];    
-  Double_t        mPFMuonCombDz[MAXMUON];    
-  Double_t        mPFMuonStandChi2Norm[MAXMUON];    
-  Int_t           mPFMuonStandValidHits[MAXMUON];    
-  Int_t           mPFMuonStandLostHits[MAXMUON];    
-  Double_t        mPFMuonStandPt[MAXMUON];    
-  Double_t        mPFMuonStandPz[MAXMUON];    
-  Double_t        mPFMuonStandP[MAXMUON];    
-  Double_t        mPFMuonStandEta[MAXMUON];    
-  Double_t        mPFMuonStandPhi[MAXMUON];    
-  Double_t        mPFMuonStandChi2[MAXMUON];    
-  Double_t        mPFMuonStandCharge[MAXMUON];    
-  Double_t        mPFMuonStandQOverPError[MAXMUON];    
-  Double_t        mPFMuonTrkChi2Norm[MAXMUON];    
-  Int_t           mPFMuonTrkValidHits[MAXMUON];    
-  Int_t           mPFMuonTrkLostHits[MAXMUON];    
-  Double_t        mPFMuonTrkPt[MAXMUON];    
-  Double_t        mPFMuonTrkPz[MAXMUON];    
-  Double_t        mPFMuonTrkP[MAXMUON];    
-  Double_t        mPFMuonTrkEta[MAXMUON];    
-  Double_t        mPFMuonTrkPhi[MAXMUON];    
-  Double_t        mPFMuonTrkChi2[MAXMUON];    
-  Double_t        mPFMuonTrkCharge[MAXMUON];    
-  Double_t        mPFMuonTrkQOverPError[MAXMUON];    
-  Double_t        mPFMuonTrkDxy[MAXMUON];    
-  Double_t        mPFMuonTrkNumOfValidPixHits[MAXMUON];
-  Double_t        mPFMuonR04ChargedHadronPt[MAXMUON];
-  Double_t        mPFMuonR04NeutralHadronEt[MAXMUON];
-  Double_t        mPFMuonR04PhotonEt[MAXMUON];
-  Double_t        mPFMuonR04PUPt[MAXMUON];
+  Double_t       *mPFMuonPt;    
+  Double_t       *mPFMuonEt;    
+  Double_t       *mPFMuonE;    
+  Double_t       *mPFMuonPx;    
+  Double_t       *mPFMuonPy;    
+  Double_t       *mPFMuonPz;    
+  Double_t       *mPFMuonEta;    
+  Double_t       *mPFMuonPhi;    
+  Int_t          *mPFMuonCharge;    
+  Int_t          *mPFMuonIsGlobal;    
+  Int_t          *mPFMuonIsStandAlone;    
+  Int_t          *mPFMuonIsTracker;
+  Int_t          *mPFMuonIsTight;    
+  Int_t          *mPFMuonIsLoose;
+  Double_t       *mPFMuonChargedHadronIso;    
+  Double_t       *mPFMuonPhotonIso;    
+  Double_t       *mPFMuonNeutralHadronIso;    
+  Int_t          *mPFMuonisGMPT;    
+  Int_t          *mPFMuonNumOfMatches;    
+  Double_t       *mPFMuoninnertrackPt;    
+  Int_t          *mPFMuonnValidHits;    
+  Int_t          *mPFMuonnValidPixelHits;    
+  Double_t       *mPFMuondxy;    
+  Double_t       *mPFMuondz;    
+  Double_t       *mPFMuonCombChi2Norm;    
+  Int_t          *mPFMuonCombValidHits;    
+  Int_t          *mPFMuonCombLostHits;    
+  Double_t       *mPFMuonCombPt;    
+  Double_t       *mPFMuonCombPz;    
+  Double_t       *mPFMuonCombP;    
+  Double_t       *mPFMuonCombEta;    
+  Double_t       *mPFMuonCombPhi;    
+  Double_t       *mPFMuonCombChi2;    
+  Double_t       *mPFMuonCombCharge;    
+  Double_t       *mPFMuonCombQOverPError;    
+  Double_t       *mPFMuonCombNdof;    
+  Double_t       *mPFMuonCombVx;    
+  Double_t       *mPFMuonCombVy;    
+  Double_t       *mPFMuonCombVz;    
+  Double_t       *mPFMuonCombD0;    
+  Double_t       *mPFMuonCombDz;    
+  Double_t       *mPFMuonStandChi2Norm;    
+  Int_t          *mPFMuonStandValidHits;    
+  Int_t          *mPFMuonStandLostHits;    
+  Double_t       *mPFMuonStandPt;    
+  Double_t       *mPFMuonStandPz;    
+  Double_t       *mPFMuonStandP;    
+  Double_t       *mPFMuonStandEta;    
+  Double_t       *mPFMuonStandPhi;    
+  Double_t       *mPFMuonStandChi2;    
+  Double_t       *mPFMuonStandCharge;    
+  Double_t       *mPFMuonStandQOverPError;    
+  Double_t       *mPFMuonTrkChi2Norm;    
+  Int_t          *mPFMuonTrkValidHits;    
+  Int_t          *mPFMuonTrkLostHits;    
+  Double_t       *mPFMuonTrkPt;    
+  Double_t       *mPFMuonTrkPz;    
+  Double_t       *mPFMuonTrkP;    
+  Double_t       *mPFMuonTrkEta;    
+  Double_t       *mPFMuonTrkPhi;    
+  Double_t       *mPFMuonTrkChi2;    
+  Double_t       *mPFMuonTrkCharge;    
+  Double_t       *mPFMuonTrkQOverPError;    
+  Double_t       *mPFMuonTrkDxy;    
+  Double_t       *mPFMuonTrkNumOfValidPixHits;
+  Double_t       *mPFMuonR04ChargedHadronPt;
+  Double_t       *mPFMuonR04NeutralHadronEt;
+  Double_t       *mPFMuonR04PhotonEt;
+  Double_t       *mPFMuonR04PUPt;
   
   Int_t           mNElec;
-  Double_t        mElecE[MAXELEC];    
-  Double_t        mElecPt[MAXELEC];    
-  Double_t        mElecPx[MAXELEC];    
-  Double_t        mElecPy[MAXELEC];    
-  Double_t        mElecPz[MAXELEC];    
-  Int_t           mElecEcalseed[MAXELEC];    
-  Int_t           mElecID80[MAXELEC];    
-  Int_t           mElecID95[MAXELEC];    
-  Double_t        mElecEta[MAXELEC];    
-  Double_t        mElecPhi[MAXELEC];    
-  Int_t           mElecCharge[MAXELEC];    
-  Double_t        mElecdr03HcalTowerSumEt[MAXELEC];    
-  Double_t        mElecdr03EcalRecHitSumEt[MAXELEC];    
-  Double_t        mElecdr03TkSumPt[MAXELEC];    
-  Int_t           mElecNumOfValidHits[MAXELEC];    
-  Int_t           mElecInnerNumOfHits[MAXELEC];    
-  Double_t        mElecdist[MAXELEC];    
-  Double_t        mElecdcot[MAXELEC];    
-  Double_t        mElecNormChi2[MAXELEC];    
-  Double_t        mElecdxy[MAXELEC];    
-  Double_t        mElecdz[MAXELEC];    
-  Int_t           mElecdB[MAXELEC];    
-  Int_t           mElecIsEB[MAXELEC];    
-  Double_t        mElecfbrem[MAXELEC];    
-  Double_t        mElecDEtaSuTrAtVtx[MAXELEC];    
-  Double_t        mElecDPhiSuTrAtVtx[MAXELEC];    
-  Double_t        mElecHadronicOverEm[MAXELEC];    
-  Double_t        mElecHcalOverEcal[MAXELEC];    
-  Double_t        mElecSuperClusOverP[MAXELEC];    
-  Double_t        mElecetaeta[MAXELEC];    
-  Double_t        mElecietaieta[MAXELEC];    
+  Double_t       *mElecE;    
+  Double_t       *mElecPt;    
+  Double_t       *mElecPx;    
+  Double_t       *mElecPy;    
+  Double_t       *mElecPz;    
+  Int_t          *mElecEcalseed;    
+  Int_t          *mElecID80;    
+  Int_t          *mElecID95;    
+  Double_t       *mElecEta;    
+  Double_t       *mElecPhi;    
+  Int_t          *mElecCharge;    
+  Double_t       *mElecdr03HcalTowerSumEt;    
+  Double_t       *mElecdr03EcalRecHitSumEt;    
+  Double_t       *mElecdr03TkSumPt;    
+  Int_t          *mElecNumOfValidHits;    
+  Int_t          *mElecInnerNumOfHits;    
+  Double_t       *mElecdist;    
+  Double_t       *mElecdcot;    
+  Double_t       *mElecNormChi2;    
+  Double_t       *mElecdxy;    
+  Double_t       *mElecdz;    
+  Int_t          *mElecdB;    
+  Int_t          *mElecIsEB;    
+  Double_t       *mElecfbrem;    
+  Double_t       *mElecDEtaSuTrAtVtx;    
+  Double_t       *mElecDPhiSuTrAtVtx;    
+  Double_t       *mElecHadronicOverEm;    
+  Double_t       *mElecHcalOverEcal;    
+  Double_t       *mElecSuperClusOverP;    
+  Double_t       *mElecetaeta;    
+  Double_t       *mElecietaieta;    
   
   Int_t           mNPFElec;
-  Int_t           mPFElecCharge[MAXELEC];    
-  Int_t           mPFElecIsEB[MAXELEC];    
-  Double_t        mPFElecPassTight[MAXELEC];    
-  Double_t        mPFElecE[MAXELEC];    
-  Double_t        mPFElecPt[MAXELEC];    
-  Double_t        mPFElecPx[MAXELEC];    
-  Double_t        mPFElecPy[MAXELEC];    
-  Double_t        mPFElecPz[MAXELEC];    
-  Double_t        mPFElecEta[MAXELEC];    
-  Double_t        mPFElecPhi[MAXELEC];    
-  Double_t        mPFElecCharHadIso[MAXELEC];    
-  Double_t        mPFElecPhoIso[MAXELEC];    
-  Double_t        mPFElecNeuHadIso[MAXELEC];    
-  Double_t        mPFElecMva[MAXELEC];    
-  Double_t        mPFElecdxy[MAXELEC];    
-  Double_t        mPFElecdz[MAXELEC];    
-  Double_t        mPFElecHadOverEm[MAXELEC];    
-  Double_t        mPFElecHcalOverEm[MAXELEC];    
-  Double_t        mPFElecSupClusOverP[MAXELEC];    
-  Double_t        mPFElecInnerHits[MAXELEC];    
-  Double_t        mPFElecConvDist[MAXELEC];    
-  Double_t        mPFElecConvDcot[MAXELEC];    
-  Double_t        mPFElecDEtaSuTrAtVtx[MAXELEC];    
-  Double_t        mPFElecDPhiSuTrAtVtx[MAXELEC];    
-  Double_t        mPFElecHadronicOverEm[MAXELEC];    
-  Double_t        mPFElecHcalOverEcal[MAXELEC];    
-  Double_t        mPFElecetaeta[MAXELEC];    
-  Double_t        mPFElecietaieta[MAXELEC];
-  Int_t           mPFElecIsTight[MAXELEC];
-  Int_t           mPFElecIsMedium[MAXELEC];
-  Int_t           mPFElecIsLoose[MAXELEC];
-  Int_t           mPFElecIsVeto[MAXELEC];
-  Double_t        mPFElecEffArea[MAXELEC];
+  Int_t          *mPFElecCharge;    
+  Int_t          *mPFElecIsEB;    
+  Double_t       *mPFElecPassTight;    
+  Double_t       *mPFElecE;    
+  Double_t       *mPFElecPt;    
+  Double_t       *mPFElecPx;    
+  Double_t       *mPFElecPy;    
+  Double_t       *mPFElecPz;    
+  Double_t       *mPFElecEta;    
+  Double_t       *mPFElecPhi;    
+  Double_t       *mPFElecCharHadIso;    
+  Double_t       *mPFElecPhoIso;    
+  Double_t       *mPFElecNeuHadIso;    
+  Double_t       *mPFElecMva;    
+  Double_t       *mPFElecdxy;    
+  Double_t       *mPFElecdz;    
+  Double_t       *mPFElecHadOverEm;    
+  Double_t       *mPFElecHcalOverEm;    
+  Double_t       *mPFElecSupClusOverP;    
+  Double_t       *mPFElecInnerHits;    
+  Double_t       *mPFElecConvDist;    
+  Double_t       *mPFElecConvDcot;    
+  Double_t       *mPFElecDEtaSuTrAtVtx;    
+  Double_t       *mPFElecDPhiSuTrAtVtx;    
+  Double_t       *mPFElecHadronicOverEm;    
+  Double_t       *mPFElecHcalOverEcal;    
+  Double_t       *mPFElecetaeta;    
+  Double_t       *mPFElecietaieta;
+  Int_t          *mPFElecIsTight;
+  Int_t          *mPFElecIsMedium;
+  Int_t          *mPFElecIsLoose;
+  Int_t          *mPFElecIsVeto;
+  Double_t       *mPFElecEffArea;
   
   Int_t           mNTau;	
-  Double_t        mTauE[MAXTAU];
-  Double_t        mTauPt[MAXTAU];
-  Double_t        mTauPx[MAXTAU];
-  Double_t        mTauPy[MAXTAU];
-  Double_t        mTauPz[MAXTAU];
-  Double_t        mTauEta[MAXTAU];
-  Double_t        mTauPhi[MAXTAU];
-  Int_t           mTauCharge[MAXTAU];
-  Double_t        mTauEtaEtaMoment[MAXTAU];
-  Double_t        mTauPhiPhiMoment[MAXTAU];
-  Double_t        mTauEtaPhiMoment[MAXTAU];
-  Double_t        mTauLeadPFChargedHadrCandsignedSipt[MAXTAU];
-  Double_t        mTauIsoPFChargedHadrCandsPtSum[MAXTAU];
-  Double_t        mTauIsoPFGammaCandsEtSum[MAXTAU];
-  Double_t        mTauMaximumHCALPFClusterEt[MAXTAU];
-  Double_t        mTauEmFraction[MAXTAU];
-  Double_t        mTauHcalTotOverPLead[MAXTAU];
-  Double_t        mTauHcalMaxOverPLead[MAXTAU];
-  Double_t        mTauHcal3x3OverPLead[MAXTAU];
-  Double_t        mTauEcalStripSumEOverPLead[MAXTAU];
-  Double_t        mTauBremsRecoveryEOverPLead[MAXTAU];
-  Double_t        mTauElectronPreIDOutput[MAXTAU];
-  Double_t        mTauElectronPreIDDecision[MAXTAU];
-  Double_t        mTauCaloComp[MAXTAU];
-  Double_t        mTauSegComp[MAXTAU];
-  Double_t        mTauMuonDecision[MAXTAU];
-  Double_t        mTausignalPFChargedHadrCands[MAXTAU];
-  Double_t        mTausignalPFGammaCands[MAXTAU];
-  Double_t        mTauDisAgainstElectronDeadECAL[MAXTAU];
-  Double_t        mTauDisAgainstElectronLoose[MAXTAU];
-  Double_t        mTauDisAgainstElectronLooseMVA2[MAXTAU];
-  Double_t        mTauDisAgainstElectronLooseMVA3[MAXTAU];
-  Double_t        mTauDisAgainstElectronMVA2category[MAXTAU];
-  Double_t        mTauDisAgainstElectronMVA2raw[MAXTAU];
-  Double_t        mTauDisAgainstElectronMVA3category[MAXTAU];
-  Double_t        mTauDisAgainstElectronMVA3raw[MAXTAU];
-  Double_t        mTauDisAgainstElectronMVA[MAXTAU];
-  Double_t        mTauDisAgainstElectronMedium[MAXTAU];
-  Double_t        mTauDisAgainstElectronMediumMVA2[MAXTAU];
-  Double_t        mTauDisAgainstElectronMediumMVA3[MAXTAU];
-  Double_t        mTauDisAgainstElectronTight[MAXTAU];
-  Double_t        mTauDisAgainstElectronTightMVA2[MAXTAU];
-  Double_t        mTauDisAgainstElectronTightMVA3[MAXTAU];
-  Double_t        mTauDisAgainstElectronVLooseMVA2[MAXTAU];
-  Double_t        mTauDisAgainstElectronVTightMVA3[MAXTAU];
-  Double_t        mTauDisAgainstMuonLoose2[MAXTAU];
-  Double_t        mTauDisAgainstMuonLoose[MAXTAU];
-  Double_t        mTauDisAgainstMuonMedium2[MAXTAU];
-  Double_t        mTauDisAgainstMuonMedium[MAXTAU];
-  Double_t        mTauDisAgainstMuonTight2[MAXTAU];
-  Double_t        mTauDisAgainstMuonTight[MAXTAU];
-  Double_t        mTauDisByCombinedIsolationDeltaBetaCorrRaw3Hits[MAXTAU];
-  Double_t        mTauDisByCombinedIsolationDeltaBetaCorrRaw[MAXTAU];
-  Double_t        mTauDisByIsolationMVA2raw[MAXTAU];
-  Double_t        mTauDisByIsolationMVAraw[MAXTAU];
-  Double_t        mTauDisByLooseCombinedIsolationDeltaBetaCorr3Hits[MAXTAU];
-  Double_t        mTauDisByLooseCombinedIsolationDeltaBetaCorr[MAXTAU];
-  Double_t        mTauDisByLooseIsolationMVA2[MAXTAU];
-  Double_t        mTauDisByLooseIsolationMVA[MAXTAU];
-  Double_t        mTauDisByMediumCombinedIsolationDeltaBetaCorr3Hits[MAXTAU];
-  Double_t        mTauDisByMediumCombinedIsolationDeltaBetaCorr[MAXTAU];
-  Double_t        mTauDisByMediumIsolationMVA2[MAXTAU];
-  Double_t        mTauDisByMediumIsolationMVA[MAXTAU];
-  Double_t        mTauDisByTightCombinedIsolationDeltaBetaCorr3Hits[MAXTAU];
-  Double_t        mTauDisByTightCombinedIsolationDeltaBetaCorr[MAXTAU];
-  Double_t        mTauDisByTightIsolationMVA2[MAXTAU];
-  Double_t        mTauDisByTightIsolationMVA[MAXTAU];
-  Double_t        mTauDisByVLooseCombinedIsolationDeltaBetaCorr[MAXTAU];
-  Double_t        mTauDisDecayModeFinding[MAXTAU];
-  Double_t        mTauJetPt[MAXTAU];
-  Double_t        mTauJetEta[MAXTAU];
-  Double_t        mTauJetPhi[MAXTAU];
+  Double_t       *mTauE;
+  Double_t       *mTauPt;
+  Double_t       *mTauPx;
+  Double_t       *mTauPy;
+  Double_t       *mTauPz;
+  Double_t       *mTauEta;
+  Double_t       *mTauPhi;
+  Int_t          *mTauCharge;
+  Double_t       *mTauEtaEtaMoment;
+  Double_t       *mTauPhiPhiMoment;
+  Double_t       *mTauEtaPhiMoment;
+  Double_t       *mTauLeadPFChargedHadrCandsignedSipt;
+  Double_t       *mTauIsoPFChargedHadrCandsPtSum;
+  Double_t       *mTauIsoPFGammaCandsEtSum;
+  Double_t       *mTauMaximumHCALPFClusterEt;
+  Double_t       *mTauEmFraction;
+  Double_t       *mTauHcalTotOverPLead;
+  Double_t       *mTauHcalMaxOverPLead;
+  Double_t       *mTauHcal3x3OverPLead;
+  Double_t       *mTauEcalStripSumEOverPLead;
+  Double_t       *mTauBremsRecoveryEOverPLead;
+  Double_t       *mTauElectronPreIDOutput;
+  Double_t       *mTauElectronPreIDDecision;
+  Double_t       *mTauCaloComp;
+  Double_t       *mTauSegComp;
+  Double_t       *mTauMuonDecision;
+  Double_t       *mTausignalPFChargedHadrCands;
+  Double_t       *mTausignalPFGammaCands;
+  Double_t       *mTauDisAgainstElectronDeadECAL;
+  Double_t       *mTauDisAgainstElectronLoose;
+  Double_t       *mTauDisAgainstElectronLooseMVA2;
+  Double_t       *mTauDisAgainstElectronLooseMVA3;
+  Double_t       *mTauDisAgainstElectronMVA2category;
+  Double_t       *mTauDisAgainstElectronMVA2raw;
+  Double_t       *mTauDisAgainstElectronMVA3category;
+  Double_t       *mTauDisAgainstElectronMVA3raw;
+  Double_t       *mTauDisAgainstElectronMVA;
+  Double_t       *mTauDisAgainstElectronMedium;
+  Double_t       *mTauDisAgainstElectronMediumMVA2;
+  Double_t       *mTauDisAgainstElectronMediumMVA3;
+  Double_t       *mTauDisAgainstElectronTight;
+  Double_t       *mTauDisAgainstElectronTightMVA2;
+  Double_t       *mTauDisAgainstElectronTightMVA3;
+  Double_t       *mTauDisAgainstElectronVLooseMVA2;
+  Double_t       *mTauDisAgainstElectronVTightMVA3;
+  Double_t       *mTauDisAgainstMuonLoose2;
+  Double_t       *mTauDisAgainstMuonLoose;
+  Double_t       *mTauDisAgainstMuonMedium2;
+  Double_t       *mTauDisAgainstMuonMedium;
+  Double_t       *mTauDisAgainstMuonTight2;
+  Double_t       *mTauDisAgainstMuonTight;
+  Double_t       *mTauDisByCombinedIsolationDeltaBetaCorrRaw3Hits;
+  Double_t       *mTauDisByCombinedIsolationDeltaBetaCorrRaw;
+  Double_t       *mTauDisByIsolationMVA2raw;
+  Double_t       *mTauDisByIsolationMVAraw;
+  Double_t       *mTauDisByLooseCombinedIsolationDeltaBetaCorr3Hits;
+  Double_t       *mTauDisByLooseCombinedIsolationDeltaBetaCorr;
+  Double_t       *mTauDisByLooseIsolationMVA2;
+  Double_t       *mTauDisByLooseIsolationMVA;
+  Double_t       *mTauDisByMediumCombinedIsolationDeltaBetaCorr3Hits;
+  Double_t       *mTauDisByMediumCombinedIsolationDeltaBetaCorr;
+  Double_t       *mTauDisByMediumIsolationMVA2;
+  Double_t       *mTauDisByMediumIsolationMVA;
+  Double_t       *mTauDisByTightCombinedIsolationDeltaBetaCorr3Hits;
+  Double_t       *mTauDisByTightCombinedIsolationDeltaBetaCorr;
+  Double_t       *mTauDisByTightIsolationMVA2;
+  Double_t       *mTauDisByTightIsolationMVA;
+  Double_t       *mTauDisByVLooseCombinedIsolationDeltaBetaCorr;
+  Double_t       *mTauDisDecayModeFinding;
+  Double_t       *mTauJetPt;
+  Double_t       *mTauJetEta;
+  Double_t       *mTauJetPhi;
   
   Int_t           mNPFTau;
-  Double_t        mPFTauE[MAXTAU];
-  Double_t        mPFTauPt[MAXTAU];
-  Double_t        mPFTauPx[MAXTAU];
-  Double_t        mPFTauPy[MAXTAU];
-  Double_t        mPFTauPz[MAXTAU];
-  Double_t        mPFTauEta[MAXTAU];
-  Double_t        mPFTauPhi[MAXTAU];
-  Int_t           mPFTauCharge[MAXTAU];
-  Double_t        mPFTauEtaEtaMoment[MAXTAU];
-  Double_t        mPFTauPhiPhiMoment[MAXTAU];
-  Double_t        mPFTauEtaPhiMoment[MAXTAU];
-  Double_t        mPFTauLeadPFChargedHadrCandsignedSipt[MAXTAU];
-  Double_t        mPFTauIsoPFChargedHadrCandsPtSum[MAXTAU];
-  Double_t        mPFTauIsoPFGammaCandsEtSum[MAXTAU];
-  Double_t        mPFTauMaximumHCALPFClusterEt[MAXTAU];
-  Double_t        mPFTauEmFraction[MAXTAU];
-  Double_t        mPFTauHcalTotOverPLead[MAXTAU];
-  Double_t        mPFTauHcalMaxOverPLead[MAXTAU];
-  Double_t        mPFTauHcal3x3OverPLead[MAXTAU];
-  Double_t        mPFTauEcalStripSumEOverPLead[MAXTAU];
-  Double_t        mPFTauBremsRecoveryEOverPLead[MAXTAU];
-  Double_t        mPFTauElectronPreIDOutput[MAXTAU];
-  Double_t        mPFTauElectronPreIDDecision[MAXTAU];
-  Double_t        mPFTauCaloComp[MAXTAU];
-  Double_t        mPFTauSegComp[MAXTAU];
-  Double_t        mPFTauMuonDecision[MAXTAU];
-  Double_t        mPFTausignalPFChargedHadrCands[MAXTAU];
-  Double_t        mPFTausignalPFGammaCands[MAXTAU];
-  Double_t        mPFTauDisAgainstElectronDeadECAL[MAXTAU];
-  Double_t        mPFTauDisAgainstElectronLoose[MAXTAU];
-  Double_t        mPFTauDisAgainstElectronLooseMVA2[MAXTAU];
-  Double_t        mPFTauDisAgainstElectronLooseMVA3[MAXTAU];
-  Double_t        mPFTauDisAgainstElectronMVA2category[MAXTAU];
-  Double_t        mPFTauDisAgainstElectronMVA2raw[MAXTAU];
-  Double_t        mPFTauDisAgainstElectronMVA3category[MAXTAU];
-  Double_t        mPFTauDisAgainstElectronMVA3raw[MAXTAU];
-  Double_t        mPFTauDisAgainstElectronMVA[MAXTAU];
-  Double_t        mPFTauDisAgainstElectronMedium[MAXTAU];
-  Double_t        mPFTauDisAgainstElectronMediumMVA2[MAXTAU];
-  Double_t        mPFTauDisAgainstElectronMediumMVA3[MAXTAU];
-  Double_t        mPFTauDisAgainstElectronTight[MAXTAU];
-  Double_t        mPFTauDisAgainstElectronTightMVA2[MAXTAU];
-  Double_t        mPFTauDisAgainstElectronTightMVA3[MAXTAU];
-  Double_t        mPFTauDisAgainstElectronVLooseMVA2[MAXTAU];
-  Double_t        mPFTauDisAgainstElectronVTightMVA3[MAXTAU];
-  Double_t        mPFTauDisAgainstMuonLoose2[MAXTAU];
-  Double_t        mPFTauDisAgainstMuonLoose[MAXTAU];
-  Double_t        mPFTauDisAgainstMuonMedium2[MAXTAU];
-  Double_t        mPFTauDisAgainstMuonMedium[MAXTAU];
-  Double_t        mPFTauDisAgainstMuonTight2[MAXTAU];
-  Double_t        mPFTauDisAgainstMuonTight[MAXTAU];
-  Double_t        mPFTauDisByCombinedIsolationDeltaBetaCorrRaw3Hits[MAXTAU];
-  Double_t        mPFTauDisByCombinedIsolationDeltaBetaCorrRaw[MAXTAU];
-  Double_t        mPFTauDisByIsolationMVA2raw[MAXTAU];
-  Double_t        mPFTauDisByIsolationMVAraw[MAXTAU];
-  Double_t        mPFTauDisByLooseCombinedIsolationDeltaBetaCorr3Hits[MAXTAU];
-  Double_t        mPFTauDisByLooseCombinedIsolationDeltaBetaCorr[MAXTAU];
-  Double_t        mPFTauDisByLooseIsolationDeltaBetaCorr[MAXTAU];
-  Double_t        mPFTauDisByLooseIsolation[MAXTAU];
-  Double_t        mPFTauDisByLooseIsolationMVA2[MAXTAU];
-  Double_t        mPFTauDisByLooseIsolationMVA[MAXTAU];
-  Double_t        mPFTauDisByMediumCombinedIsolationDeltaBetaCorr3Hits[MAXTAU];
-  Double_t        mPFTauDisByMediumCombinedIsolationDeltaBetaCorr[MAXTAU];
-  Double_t        mPFTauDisByMediumIsolationDeltaBetaCorr[MAXTAU];
-  Double_t        mPFTauDisByMediumIsolation[MAXTAU];
-  Double_t        mPFTauDisByMediumIsolationMVA2[MAXTAU];
-  Double_t        mPFTauDisByMediumIsolationMVA[MAXTAU];
-  Double_t        mPFTauDisByTightCombinedIsolationDeltaBetaCorr3Hits[MAXTAU];
-  Double_t        mPFTauDisByTightCombinedIsolationDeltaBetaCorr[MAXTAU];
-  Double_t        mPFTauDisByTightIsolationDeltaBetaCorr[MAXTAU];
-  Double_t        mPFTauDisByTightIsolation[MAXTAU];
-  Double_t        mPFTauDisByTightIsolationMVA2[MAXTAU];
-  Double_t        mPFTauDisByTightIsolationMVA[MAXTAU];
-  Double_t        mPFTauDisByVLooseCombinedIsolationDeltaBetaCorr[MAXTAU];
-  Double_t        mPFTauDisByVLooseIsolationDeltaBetaCorr[MAXTAU];
-  Double_t        mPFTauDisByVLooseIsolation[MAXTAU];
-  Double_t        mPFTauDisDecayModeFinding[MAXTAU];
-  Double_t        mPFTauJetPt[MAXTAU];
-  Double_t        mPFTauJetEta[MAXTAU];
-  Double_t        mPFTauJetPhi[MAXTAU];
+  Double_t       *mPFTauE;
+  Double_t       *mPFTauPt;
+  Double_t       *mPFTauPx;
+  Double_t       *mPFTauPy;
+  Double_t       *mPFTauPz;
+  Double_t       *mPFTauEta;
+  Double_t       *mPFTauPhi;
+  Int_t          *mPFTauCharge;
+  Double_t       *mPFTauEtaEtaMoment;
+  Double_t       *mPFTauPhiPhiMoment;
+  Double_t       *mPFTauEtaPhiMoment;
+  Double_t       *mPFTauLeadPFChargedHadrCandsignedSipt;
+  Double_t       *mPFTauIsoPFChargedHadrCandsPtSum;
+  Double_t       *mPFTauIsoPFGammaCandsEtSum;
+  Double_t       *mPFTauMaximumHCALPFClusterEt;
+  Double_t       *mPFTauEmFraction;
+  Double_t       *mPFTauHcalTotOverPLead;
+  Double_t       *mPFTauHcalMaxOverPLead;
+  Double_t       *mPFTauHcal3x3OverPLead;
+  Double_t       *mPFTauEcalStripSumEOverPLead;
+  Double_t       *mPFTauBremsRecoveryEOverPLead;
+  Double_t       *mPFTauElectronPreIDOutput;
+  Double_t       *mPFTauElectronPreIDDecision;
+  Double_t       *mPFTauCaloComp;
+  Double_t       *mPFTauSegComp;
+  Double_t       *mPFTauMuonDecision;
+  Double_t       *mPFTausignalPFChargedHadrCands;
+  Double_t       *mPFTausignalPFGammaCands;
+  Double_t       *mPFTauDisAgainstElectronDeadECAL;
+  Double_t       *mPFTauDisAgainstElectronLoose;
+  Double_t       *mPFTauDisAgainstElectronLooseMVA2;
+  Double_t       *mPFTauDisAgainstElectronLooseMVA3;
+  Double_t       *mPFTauDisAgainstElectronMVA2category;
+  Double_t       *mPFTauDisAgainstElectronMVA2raw;
+  Double_t       *mPFTauDisAgainstElectronMVA3category;
+  Double_t       *mPFTauDisAgainstElectronMVA3raw;
+  Double_t       *mPFTauDisAgainstElectronMVA;
+  Double_t       *mPFTauDisAgainstElectronMedium;
+  Double_t       *mPFTauDisAgainstElectronMediumMVA2;
+  Double_t       *mPFTauDisAgainstElectronMediumMVA3;
+  Double_t       *mPFTauDisAgainstElectronTight;
+  Double_t       *mPFTauDisAgainstElectronTightMVA2;
+  Double_t       *mPFTauDisAgainstElectronTightMVA3;
+  Double_t       *mPFTauDisAgainstElectronVLooseMVA2;
+  Double_t       *mPFTauDisAgainstElectronVTightMVA3;
+  Double_t       *mPFTauDisAgainstMuonLoose2;
+  Double_t       *mPFTauDisAgainstMuonLoose;
+  Double_t       *mPFTauDisAgainstMuonMedium2;
+  Double_t       *mPFTauDisAgainstMuonMedium;
+  Double_t       *mPFTauDisAgainstMuonTight2;
+  Double_t       *mPFTauDisAgainstMuonTight;
+  Double_t       *mPFTauDisByCombinedIsolationDeltaBetaCorrRaw3Hits;
+  Double_t       *mPFTauDisByCombinedIsolationDeltaBetaCorrRaw;
+  Double_t       *mPFTauDisByIsolationMVA2raw;
+  Double_t       *mPFTauDisByIsolationMVAraw;
+  Double_t       *mPFTauDisByLooseCombinedIsolationDeltaBetaCorr3Hits;
+  Double_t       *mPFTauDisByLooseCombinedIsolationDeltaBetaCorr;
+  Double_t       *mPFTauDisByLooseIsolationDeltaBetaCorr;
+  Double_t       *mPFTauDisByLooseIsolation;
+  Double_t       *mPFTauDisByLooseIsolationMVA2;
+  Double_t       *mPFTauDisByLooseIsolationMVA;
+  Double_t       *mPFTauDisByMediumCombinedIsolationDeltaBetaCorr3Hits;
+  Double_t       *mPFTauDisByMediumCombinedIsolationDeltaBetaCorr;
+  Double_t       *mPFTauDisByMediumIsolationDeltaBetaCorr;
+  Double_t       *mPFTauDisByMediumIsolation;
+  Double_t       *mPFTauDisByMediumIsolationMVA2;
+  Double_t       *mPFTauDisByMediumIsolationMVA;
+  Double_t       *mPFTauDisByTightCombinedIsolationDeltaBetaCorr3Hits;
+  Double_t       *mPFTauDisByTightCombinedIsolationDeltaBetaCorr;
+  Double_t       *mPFTauDisByTightIsolationDeltaBetaCorr;
+  Double_t       *mPFTauDisByTightIsolation;
+  Double_t       *mPFTauDisByTightIsolationMVA2;
+  Double_t       *mPFTauDisByTightIsolationMVA;
+  Double_t       *mPFTauDisByVLooseCombinedIsolationDeltaBetaCorr;
+  Double_t       *mPFTauDisByVLooseIsolationDeltaBetaCorr;
+  Double_t       *mPFTauDisByVLooseIsolation;
+  Double_t       *mPFTauDisDecayModeFinding;
+  Double_t       *mPFTauJetPt;
+  Double_t       *mPFTauJetEta;
+  Double_t       *mPFTauJetPhi;
   
   Int_t           mWTauDecayMode;
   Int_t           mWTauN;
-  Int_t           mWTauDecayId[MAXGENTAU];
-  Double_t        mWTauDecayPt[MAXGENTAU];
-  Double_t        mWTauDecayEta[MAXGENTAU];
-  Double_t        mWTauDecayPhi[MAXGENTAU];
-  Double_t        mWTauDecayMass[MAXGENTAU];
+  Int_t          *mWTauDecayId;
+  Double_t       *mWTauDecayPt;
+  Double_t       *mWTauDecayEta;
+  Double_t       *mWTauDecayPhi;
+  Double_t       *mWTauDecayMass;
   
   Int_t           mNPhot;
-  Double_t        mPhotE[MAXPHOT];    
-  Double_t        mPhotPt[MAXPHOT];    
-  Double_t        mPhotPx[MAXPHOT];    
-  Double_t        mPhotPy[MAXPHOT];    
-  Double_t        mPhotPz[MAXPHOT];    
-  Double_t        mPhotEta[MAXPHOT];    
-  Double_t        mPhotPhi[MAXPHOT];    
-  Double_t        mPhotE1x5[MAXPHOT];    
-  Double_t        mPhotE2x5[MAXPHOT];    
-  Double_t        mPhotE5x5[MAXPHOT];    
-  Double_t        mPhotSigEta[MAXPHOT];    
-  Double_t        mPhotSigPhi[MAXPHOT];    
-  Double_t        mPhotEcalIso04[MAXPHOT];    
-  Double_t        mPhotHcalIso04[MAXPHOT];    
-  Double_t        mPhotTrackIso04[MAXPHOT];    
-  Double_t        mPhotHasPixSeed[MAXPHOT];    
-  Double_t        mPhotIsPhot[MAXPHOT];    
+  Double_t       *mPhotE;    
+  Double_t       *mPhotPt;    
+  Double_t       *mPhotPx;    
+  Double_t       *mPhotPy;    
+  Double_t       *mPhotPz;    
+  Double_t       *mPhotEta;    
+  Double_t       *mPhotPhi;    
+  Double_t       *mPhotE1x5;    
+  Double_t       *mPhotE2x5;    
+  Double_t       *mPhotE5x5;    
+  Double_t       *mPhotSigEta;    
+  Double_t       *mPhotSigPhi;    
+  Double_t       *mPhotEcalIso04;    
+  Double_t       *mPhotHcalIso04;    
+  Double_t       *mPhotTrackIso04;    
+  Double_t       *mPhotHasPixSeed;    
+  Double_t       *mPhotIsPhot;    
   
   Int_t           mNPV;
   Double_t        mPVx[40];    
@@ -1141,50 +1382,50 @@ class EventData
   Int_t           mBeamHaloLoose;
   
   Int_t           mTIV_N;
-  Float_t         mTIV[TIVMAX];    
-  Float_t         mTIV_pt[TIVMAX];    
-  Float_t         mTIV_px[TIVMAX];    
-  Float_t         mTIV_py[TIVMAX];    
-  Float_t         mTIV_pz[TIVMAX];    
-  Float_t         mTIV_phi[TIVMAX];    
-  Float_t         mTIV_eta[TIVMAX];    
-  Float_t         mTIV_dsz[TIVMAX];    
-  Float_t         mTIV_dxy[TIVMAX];    
-  Float_t         mTIV_d0[TIVMAX];    
-  Float_t         mTIV_dz[TIVMAX];    
-  Float_t         mTIV_dsz_corr[TIVMAX];    
-  Float_t         mTIV_dxy_corr[TIVMAX];    
-  Float_t         mTIV_d0_corr[TIVMAX];    
-  Float_t         mTIV_dz_corr[TIVMAX];    
-  Float_t         mTIV_dR[TIVMAX];    
-  Int_t           mTIV_lead[TIVMAX];    
+  Float_t        *mTIV;    
+  Float_t        *mTIV_pt;    
+  Float_t        *mTIV_px;    
+  Float_t        *mTIV_py;    
+  Float_t        *mTIV_pz;    
+  Float_t        *mTIV_phi;    
+  Float_t        *mTIV_eta;    
+  Float_t        *mTIV_dsz;    
+  Float_t        *mTIV_dxy;    
+  Float_t        *mTIV_d0;    
+  Float_t        *mTIV_dz;    
+  Float_t        *mTIV_dsz_corr;    
+  Float_t        *mTIV_dxy_corr;    
+  Float_t        *mTIV_d0_corr;    
+  Float_t        *mTIV_dz_corr;    
+  Float_t        *mTIV_dR;    
+  Int_t          *mTIV_lead;    
   Float_t         mLowTIV;
   
   Int_t           mNGenPar;    
-  Int_t           mGenParId[MAXGENPAR];    
-  Int_t           mGenParStatus[MAXGENPAR];
-  Double_t        mGenParE[MAXGENPAR];     
-  Double_t        mGenParPx[MAXGENPAR];    
-  Double_t        mGenParPy[MAXGENPAR];    
-  Double_t        mGenParPz[MAXGENPAR];    
-  Double_t        mGenParEta[MAXGENPAR];   
-  Double_t        mGenParPhi[MAXGENPAR];   
-  Int_t           mGenParCharge[MAXGENPAR];
-  Double_t        mGenParPt[MAXGENPAR];    
-  Double_t        mGenParMass[MAXGENPAR];  
-  Int_t           mGenParMother1[MAXGENPAR];  
-  Int_t           mGenParMother2[MAXGENPAR];  
-  Int_t           mGenParDoughterOf[MAXGENPAR];
-  
-  Double_t        mGenAK4JetE[MAXJET]; 
-  Double_t        mGenAK4JetPt[MAXJET]; 
-  Double_t        mGenAK4JetPx[MAXJET]; 
-  Double_t        mGenAK4JetPy[MAXJET]; 
-  Double_t        mGenAK4JetPz[MAXJET]; 
-  Double_t        mGenAK4JetEta[MAXJET]; 
-  Double_t        mGenAK4JetPhi[MAXJET]; 
-  Double_t        mGenAK4JetEmEnergy[MAXJET]; 
-  Double_t        mGenAK4JetHadEnergy[MAXJET]; 
+  Int_t          *mGenParId;    
+  Int_t          *mGenParStatus;
+  Double_t       *mGenParE;     
+  Double_t       *mGenParPx;    
+  Double_t       *mGenParPy;    
+  Double_t       *mGenParPz;    
+  Double_t       *mGenParEta;   
+  Double_t       *mGenParPhi;   
+  Int_t          *mGenParCharge;
+  Double_t       *mGenParPt;    
+  Double_t       *mGenParMass;  
+  Int_t          *mGenParMother1;  
+  Int_t          *mGenParMother2;  
+  Int_t          *mGenParDoughterOf;
+  
+  Double_t       *mGenAK4JetE; 
+  Double_t       *mGenAK4JetPt; 
+  Double_t       *mGenAK4JetPx; 
+  Double_t       *mGenAK4JetPy; 
+  Double_t       *mGenAK4JetPz; 
+  Double_t       *mGenAK4JetEta; 
+  Double_t       *mGenAK4JetPhi; 
+  Double_t       *mGenAK4JetEmEnergy; 
+  Double_t       *mGenAK4JetHadEnergy; 
   
   Double_t	  mPDFGenScale;
   Double_t	  mPDFx1;
@@ -1194,6 +1435,546 @@ class EventData
   Double_t	  mPDFscale;
   Double_t	  mPDFpdf1;
   Double_t	  mPDFpdf2;
+
+  // Branch handles, filled by SetBranchAddress and read on demand in lazy mode
+  TBranch        *b_PDFWeights1 = 0;
+  TBranch        *b_run = 0;
+  TBranch        *b_event = 0;
+  TBranch        *b_lumi = 0;
+  TBranch        *b_bx = 0;
+  TBranch        *b_npvm1 = 0;
+  TBranch        *b_npv0 = 0;
+  TBranch        *b_npvp1 = 0;
+  TBranch        *b_ptHat = 0;
+  TBranch        *b_fastJetRho = 0;
+  TBranch        *b_NoiseFlag = 0;
+  TBranch        *b_CaloTowerdEx = 0;
+  TBranch        *b_CaloTowerdEy = 0;
+  TBranch        *b_NCaloAK4Jets = 0;
+  TBranch        *b_CaloAK4JetE = 0;
+  TBranch        *b_CaloAK4JetPt = 0;
+  TBranch        *b_CaloAK4JetPx = 0;
+  TBranch        *b_CaloAK4JetPy = 0;
+  TBranch        *b_CaloAK4JetPz = 0;
+  TBranch        *b_CaloAK4JetEta = 0;
+  TBranch        *b_CaloAK4JetPhi = 0;
+  TBranch        *b_CaloAK4JetEmf = 0;
+  TBranch        *b_CaloAK4JetfHPD = 0;
+  TBranch        *b_CaloAK4JetfRBX = 0;
+  TBranch        *b_CaloAK4JetN90Hits = 0;
+  TBranch        *b_CaloAK4JetN90 = 0;
+  TBranch        *b_CaloAK4JetSigEta = 0;
+  TBranch        *b_CaloAK4JetSigPhi = 0;
+  TBranch        *b_CaloAK4JetIDEmf = 0;
+  TBranch        *b_CaloAK4JetECor = 0;
+  TBranch        *b_CaloAK4JetPtCor = 0;
+  TBranch        *b_CaloAK4JetPxCor = 0;
+  TBranch        *b_CaloAK4JetPyCor = 0;
+  TBranch        *b_CaloAK4JetPzCor = 0;
+  TBranch        *b_CaloAK4JetBtagTkCountHighEff = 0;
+  TBranch        *b_CaloAK4JetBTagSimpleSecVtx = 0;
+  TBranch        *b_CaloAK4JetBTagCombSecVtx = 0;
+  TBranch        *b_CaloAK4TrackPt = 0;
+  TBranch        *b_CaloAK4JetIDLOOSE = 0;
+  TBranch        *b_CaloAK4JetIDTIGHT = 0;
+  TBranch        *b_NPFAK4Jets = 0;
+  TBranch        *b_PFAK4JetE = 0;
+  TBranch        *b_PFAK4JetPt = 0;
+  TBranch        *b_PFAK4JetPx = 0;
+  TBranch        *b_PFAK4JetPy = 0;
+  TBranch        *b_PFAK4JetPz = 0;
+  TBranch        *b_PFAK4JetEta = 0;
+  TBranch        *b_PFAK4JetPhi = 0;
+  TBranch        *b_PFAK4JetfHPD = 0;
+  TBranch        *b_PFAK4JetfRBX = 0;
+  TBranch        *b_PFAK4JetN90Hits = 0;
+  TBranch        *b_PFAK4JetN90 = 0;
+  TBranch        *b_PFAK4JetSigEta = 0;
+  TBranch        *b_PFAK4JetSigPhi = 0;
+  TBranch        *b_PFAK4JetIDEmf = 0;
+  TBranch        *b_PFAK4JetECor = 0;
+  TBranch        *b_PFAK4JetPtCor = 0;
+  TBranch        *b_PFAK4JetPxCor = 0;
+  TBranch        *b_PFAK4JetPyCor = 0;
+  TBranch        *b_PFAK4JetPzCor = 0;
+  TBranch        *b_PFAK4JetBtagTkCountHighEff = 0;
+  TBranch        *b_PFAK4JetBTagSimpleSecVtx = 0;
+  TBranch        *b_PFAK4JetBTagCombSecVtx = 0;
+  TBranch        *b_PFAK4JetNeuEmEngFrac = 0;
+  TBranch        *b_PFAK4JetChaEmEngFrac = 0;
+  TBranch        *b_PFAK4JetChaHadEngFrac = 0;
+  TBranch        *b_PFAK4JetNeuHadEngFrac = 0;
+  TBranch        *b_PFAK4JetChaMuEng = 0;
+  TBranch        *b_PFAK4JetMuonEng = 0;
+  TBranch        *b_PFAK4JetPhotEng = 0;
+  TBranch        *b_PFAK4JetElecEng = 0;
+  TBranch        *b_PFAK4JetNumOfChaMu = 0;
+  TBranch        *b_PFAK4JetNumOfMuon = 0;
+  TBranch        *b_PFAK4JetNumOfPhot = 0;
+  TBranch        *b_PFAK4JetNumOfElec = 0;
+  TBranch        *b_PFAK4JetNumOfNeu = 0;
+  TBranch        *b_PFAK4JetNumOfCha = 0;
+  TBranch        *b_PFAK4JetNumOfNeuHad = 0;
+  TBranch        *b_PFAK4JetNumOfChaHad = 0;
+  TBranch        *b_PFAK4JetNumOfDaughters = 0;
+  TBranch        *b_PFAK4JetIDLOOSE = 0;
+  TBranch        *b_PFAK4JetIDTIGHT = 0;
+  TBranch        *b_PFAK4JetPUFullJetId = 0;
+  TBranch        *b_PFAK4uncer = 0;
+  TBranch        *b_GenPFAK4JetPt = 0;
+  TBranch        *b_PFAK4JERCentral = 0;
+  TBranch        *b_PFAK4JERUp = 0;
+  TBranch        *b_PFAK4JERDown = 0;
+  TBranch        *b_NMet = 0;
+  TBranch        *b_MetPt = 0;
+  TBranch        *b_MetPx = 0;
+  TBranch        *b_MetPy = 0;
+  TBranch        *b_MetPhi = 0;
+  TBranch        *b_MetSumEt = 0;
+  TBranch        *b_MetSign = 0;
+  TBranch        *b_NMuon = 0;
+  TBranch        *b_MuonPt = 0;
+  TBranch        *b_MuonEt = 0;
+  TBranch        *b_MuonE = 0;
+  TBranch        *b_MuonPx = 0;
+  TBranch        *b_MuonPy = 0;
+  TBranch        *b_MuonPz = 0;
+  TBranch        *b_MuonEta = 0;
+  TBranch        *b_MuonPhi = 0;
+  TBranch        *b_MuonCharge = 0;
+  TBranch        *b_MuonIsGlobal = 0;
+  TBranch        *b_MuonIsStandAlone = 0;
+  TBranch        *b_MuonIsTracker = 0;
+  TBranch        *b_MuonSumPtDR03 = 0;
+  TBranch        *b_MuonSumPtDR05 = 0;
+  TBranch        *b_MuonEmEtDR03 = 0;
+  TBranch        *b_MuonHadEtDR03 = 0;
+  TBranch        *b_MuonNumOfMatches = 0;
+  TBranch        *b_MuonCombChi2Norm = 0;
+  TBranch        *b_MuonCombValidHits = 0;
+  TBranch        *b_MuonCombLostHits = 0;
+  TBranch        *b_MuonCombPt = 0;
+  TBranch        *b_MuonCombPz = 0;
+  TBranch        *b_MuonCombP = 0;
+  TBranch        *b_MuonCombEta = 0;
+  TBranch        *b_MuonCombPhi = 0;
+  TBranch        *b_MuonCombChi2 = 0;
+  TBranch        *b_MuonCombCharge = 0;
+  TBranch        *b_MuonCombQOverPError = 0;
+  TBranch        *b_MuonCombNdof = 0;
+  TBranch        *b_MuonCombVx = 0;
+  TBranch        *b_MuonCombVy = 0;
+  TBranch        *b_MuonCombVz = 0;
+  TBranch        *b_MuonCombD0 = 0;
+  TBranch        *b_MuonCombDz = 0;
+  TBranch        *b_MuonStandChi2Norm = 0;
+  TBranch        *b_MuonStandValidHits = 0;
+  TBranch        *b_MuonStandLostHits = 0;
+  TBranch        *b_MuonStandPt = 0;
+  TBranch        *b_MuonStandPz = 0;
+  TBranch        *b_MuonStandP = 0;
+  TBranch        *b_MuonStandEta = 0;
+  TBranch        *b_MuonStandPhi = 0;
+  TBranch        *b_MuonStandChi2 = 0;
+  TBranch        *b_MuonStandCharge = 0;
+  TBranch        *b_MuonStandQOverPError = 0;
+  TBranch        *b_MuonTrkChi2Norm = 0;
+  TBranch        *b_MuonTrkValidHits = 0;
+  TBranch        *b_MuonTrkLostHits = 0;
+  TBranch        *b_MuonTrkPt = 0;
+  TBranch        *b_MuonTrkPz = 0;
+  TBranch        *b_MuonTrkP = 0;
+  TBranch        *b_MuonTrkEta = 0;
+  TBranch        *b_MuonTrkPhi = 0;
+  TBranch        *b_MuonTrkChi2 = 0;
+  TBranch        *b_MuonTrkCharge = 0;
+  TBranch        *b_MuonTrkQOverPError = 0;
+  TBranch        *b_MuonTrkDxy = 0;
+  TBranch        *b_MuonTrkNumOfValidPixHits = 0;
+  TBranch        *b_NPFMuon = 0;
+  TBranch        *b_PFMuonPt = 0;
+  TBranch        *b_PFMuonEt = 0;
+  TBranch        *b_PFMuonE = 0;
+  TBranch        *b_PFMuonPx = 0;
+  TBranch        *b_PFMuonPy = 0;
+  TBranch        *b_PFMuonPz = 0;
+  TBranch        *b_PFMuonEta = 0;
+  TBranch        *b_PFMuonPhi = 0;
+  TBranch        *b_PFMuonCharge = 0;
+  TBranch        *b_PFMuonIsGlobal = 0;
+  TBranch        *b_PFMuonIsStandAlone = 0;
+  TBranch        *b_PFMuonIsTracker = 0;
+  TBranch        *b_PFMuonIsTight = 0;
+  TBranch        *b_PFMuonIsLoose = 0;
+  TBranch        *b_PFMuonChargedHadronIso = 0;
+  TBranch        *b_PFMuonPhotonIso = 0;
+  TBranch        *b_PFMuonNeutralHadronIso = 0;
+  TBranch        *b_PFMuonisGMPT = 0;
+  TBranch        *b_PFMuonNumOfMatches = 0;
+  TBranch        *b_PFMuoninnertrackPt = 0;
+  TBranch        *b_PFMuonnValidHits = 0;
+  TBranch        *b_PFMuonnValidPixelHits = 0;
+  TBranch        *b_PFMuondxy = 0;
+  TBranch        *b_PFMuondz = 0;
+  TBranch        *b_PFMuonCombChi2Norm = 0;
+  TBranch        *b_PFMuonCombValidHits = 0;
+  TBranch        *b_PFMuonCombLostHits = 0;
+  TBranch        *b_PFMuonCombPt = 0;
+  TBranch        *b_PFMuonCombPz = 0;
+  TBranch        *b_PFMuonCombP = 0;
+  TBranch        *b_PFMuonCombEta = 0;
+  TBranch        *b_PFMuonCombPhi = 0;
+  TBranch        *b_PFMuonCombChi2 = 0;
+  TBranch        *b_PFMuonCombCharge = 0;
+  TBranch        *b_PFMuonCombQOverPError = 0;
+  TBranch        *b_PFMuonCombNdof = 0;
+  TBranch        *b_PFMuonCombVx = 0;
+  TBranch        *b_PFMuonCombVy = 0;
+  TBranch        *b_PFMuonCombVz = 0;
+  TBranch        *b_PFMuonCombD0 = 0;
+  TBranch        *b_PFMuonCombDz = 0;
+  TBranch        *b_PFMuonStandChi2Norm = 0;
+  TBranch        *b_PFMuonStandValidHits = 0;
+  TBranch        *b_PFMuonStandLostHits = 0;
+  TBranch        *b_PFMuonStandPt = 0;
+  TBranch        *b_PFMuonStandPz = 0;
+  TBranch        *b_PFMuonStandP = 0;
+  TBranch        *b_PFMuonStandEta = 0;
+  TBranch        *b_PFMuonStandPhi = 0;
+  TBranch        *b_PFMuonStandChi2 = 0;
+  TBranch        *b_PFMuonStandCharge = 0;
+  TBranch        *b_PFMuonStandQOverPError = 0;
+  TBranch        *b_PFMuonTrkChi2Norm = 0;
+  TBranch        *b_PFMuonTrkValidHits = 0;
+  TBranch        *b_PFMuonTrkLostHits = 0;
+  TBranch        *b_PFMuonTrkPt = 0;
+  TBranch        *b_PFMuonTrkPz = 0;
+  TBranch        *b_PFMuonTrkP = 0;
+  TBranch        *b_PFMuonTrkEta = 0;
+  TBranch        *b_PFMuonTrkPhi = 0;
+  TBranch        *b_PFMuonTrkChi2 = 0;
+  TBranch        *b_PFMuonTrkCharge = 0;
+  TBranch        *b_PFMuonTrkQOverPError = 0;
+  TBranch        *b_PFMuonTrkDxy = 0;
+  TBranch        *b_PFMuonTrkNumOfValidPixHits = 0;
+  TBranch        *b_PFMuonR04ChargedHadronPt = 0;
+  TBranch        *b_PFMuonR04NeutralHadronEt = 0;
+  TBranch        *b_PFMuonR04PhotonEt = 0;
+  TBranch        *b_PFMuonR04PUPt = 0;
+  TBranch        *b_NElec = 0;
+  TBranch        *b_ElecE = 0;
+  TBranch        *b_ElecPt = 0;
+  TBranch        *b_ElecPx = 0;
+  TBranch        *b_ElecPy = 0;
+  TBranch        *b_ElecPz = 0;
+  TBranch        *b_ElecEcalseed = 0;
+  TBranch        *b_ElecID80 = 0;
+  TBranch        *b_ElecID95 = 0;
+  TBranch        *b_ElecEta = 0;
+  TBranch        *b_ElecPhi = 0;
+  TBranch        *b_ElecCharge = 0;
+  TBranch        *b_Elecdr03HcalTowerSumEt = 0;
+  TBranch        *b_Elecdr03EcalRecHitSumEt = 0;
+  TBranch        *b_Elecdr03TkSumPt = 0;
+  TBranch        *b_ElecNumOfValidHits = 0;
+  TBranch        *b_ElecInnerNumOfHits = 0;
+  TBranch        *b_Elecdist = 0;
+  TBranch        *b_Elecdcot = 0;
+  TBranch        *b_ElecNormChi2 = 0;
+  TBranch        *b_Elecdxy = 0;
+  TBranch        *b_Elecdz = 0;
+  TBranch        *b_ElecdB = 0;
+  TBranch        *b_ElecIsEB = 0;
+  TBranch        *b_Elecfbrem = 0;
+  TBranch        *b_ElecDEtaSuTrAtVtx = 0;
+  TBranch        *b_ElecDPhiSuTrAtVtx = 0;
+  TBranch        *b_ElecHadronicOverEm = 0;
+  TBranch        *b_ElecHcalOverEcal = 0;
+  TBranch        *b_ElecSuperClusOverP = 0;
+  TBranch        *b_Elecetaeta = 0;
+  TBranch        *b_Elecietaieta = 0;
+  TBranch        *b_NPFElec = 0;
+  TBranch        *b_PFElecCharge = 0;
+  TBranch        *b_PFElecIsEB = 0;
+  TBranch        *b_PFElecPassTight = 0;
+  TBranch        *b_PFElecE = 0;
+  TBranch        *b_PFElecPt = 0;
+  TBranch        *b_PFElecPx = 0;
+  TBranch        *b_PFElecPy = 0;
+  TBranch        *b_PFElecPz = 0;
+  TBranch        *b_PFElecEta = 0;
+  TBranch        *b_PFElecPhi = 0;
+  TBranch        *b_PFElecCharHadIso = 0;
+  TBranch        *b_PFElecPhoIso = 0;
+  TBranch        *b_PFElecNeuHadIso = 0;
+  TBranch        *b_PFElecMva = 0;
+  TBranch        *b_PFElecdxy = 0;
+  TBranch        *b_PFElecdz = 0;
+  TBranch        *b_PFElecHadOverEm = 0;
+  TBranch        *b_PFElecHcalOverEm = 0;
+  TBranch        *b_PFElecSupClusOverP = 0;
+  TBranch        *b_PFElecInnerHits = 0;
+  TBranch        *b_PFElecConvDist = 0;
+  TBranch        *b_PFElecConvDcot = 0;
+  TBranch        *b_PFElecDEtaSuTrAtVtx = 0;
+  TBranch        *b_PFElecDPhiSuTrAtVtx = 0;
+  TBranch        *b_PFElecHadronicOverEm = 0;
+  TBranch        *b_PFElecHcalOverEcal = 0;
+  TBranch        *b_PFElecetaeta = 0;
+  TBranch        *b_PFElecietaieta = 0;
+  TBranch        *b_PFElecIsTight = 0;
+  TBranch        *b_PFElecIsMedium = 0;
+  TBranch        *b_PFElecIsLoose = 0;
+  TBranch        *b_PFElecIsVeto = 0;
+  TBranch        *b_PFElecEffArea = 0;
+  TBranch        *b_NTau = 0;
+  TBranch        *b_TauE = 0;
+  TBranch        *b_TauPt = 0;
+  TBranch        *b_TauPx = 0;
+  TBranch        *b_TauPy = 0;
+  TBranch        *b_TauPz = 0;
+  TBranch        *b_TauEta = 0;
+  TBranch        *b_TauPhi = 0;
+  TBranch        *b_TauCharge = 0;
+  TBranch        *b_TauEtaEtaMoment = 0;
+  TBranch        *b_TauPhiPhiMoment = 0;
+  TBranch        *b_TauEtaPhiMoment = 0;
+  TBranch        *b_TauLeadPFChargedHadrCandsignedSipt = 0;
+  TBranch        *b_TauIsoPFChargedHadrCandsPtSum = 0;
+  TBranch        *b_TauIsoPFGammaCandsEtSum = 0;
+  TBranch        *b_TauMaximumHCALPFClusterEt = 0;
+  TBranch        *b_TauEmFraction = 0;
+  TBranch        *b_TauHcalTotOverPLead = 0;
+  TBranch        *b_TauHcalMaxOverPLead = 0;
+  TBranch        *b_TauHcal3x3OverPLead = 0;
+  TBranch        *b_TauEcalStripSumEOverPLead = 0;
+  TBranch        *b_TauBremsRecoveryEOverPLead = 0;
+  TBranch        *b_TauElectronPreIDOutput = 0;
+  TBranch        *b_TauElectronPreIDDecision = 0;
+  TBranch        *b_TauCaloComp = 0;
+  TBranch        *b_TauSegComp = 0;
+  TBranch        *b_TauMuonDecision = 0;
+  TBranch        *b_TausignalPFChargedHadrCands = 0;
+  TBranch        *b_TausignalPFGammaCands = 0;
+  TBranch        *b_TauDisAgainstElectronDeadECAL = 0;
+  TBranch        *b_TauDisAgainstElectronLoose = 0;
+  TBranch        *b_TauDisAgainstElectronLooseMVA2 = 0;
+  TBranch        *b_TauDisAgainstElectronLooseMVA3 = 0;
+  TBranch        *b_TauDisAgainstElectronMVA2category = 0;
+  TBranch        *b_TauDisAgainstElectronMVA2raw = 0;
+  TBranch        *b_TauDisAgainstElectronMVA3category = 0;
+  TBranch        *b_TauDisAgainstElectronMVA3raw = 0;
+  TBranch        *b_TauDisAgainstElectronMVA = 0;
+  TBranch        *b_TauDisAgainstElectronMedium = 0;
+  TBranch        *b_TauDisAgainstElectronMediumMVA2 = 0;
+  TBranch        *b_TauDisAgainstElectronMediumMVA3 = 0;
+  TBranch        *b_TauDisAgainstElectronTight = 0;
+  TBranch        *b_TauDisAgainstElectronTightMVA2 = 0;
+  TBranch        *b_TauDisAgainstElectronTightMVA3 = 0;
+  TBranch        *b_TauDisAgainstElectronVLooseMVA2 = 0;
+  TBranch        *b_TauDisAgainstElectronVTightMVA3 = 0;
+  TBranch        *b_TauDisAgainstMuonLoose2 = 0;
+  TBranch        *b_TauDisAgainstMuonLoose = 0;
+  TBranch        *b_TauDisAgainstMuonMedium2 = 0;
+  TBranch        *b_TauDisAgainstMuonMedium = 0;
+  TBranch        *b_TauDisAgainstMuonTight2 = 0;
+  TBranch        *b_TauDisAgainstMuonTight = 0;
+  TBranch        *b_TauDisByCombinedIsolationDeltaBetaCorrRaw3Hits = 0;
+  TBranch        *b_TauDisByCombinedIsolationDeltaBetaCorrRaw = 0;
+  TBranch        *b_TauDisByIsolationMVA2raw = 0;
+  TBranch        *b_TauDisByIsolationMVAraw = 0;
+  TBranch        *b_TauDisByLooseCombinedIsolationDeltaBetaCorr3Hits = 0;
+  TBranch        *b_TauDisByLooseCombinedIsolationDeltaBetaCorr = 0;
+  TBranch        *b_TauDisByLooseIsolationMVA2 = 0;
+  TBranch        *b_TauDisByLooseIsolationMVA = 0;
+  TBranch        *b_TauDisByMediumCombinedIsolationDeltaBetaCorr3Hits = 0;
+  TBranch        *b_TauDisByMediumCombinedIsolationDeltaBetaCorr = 0;
+  TBranch        *b_TauDisByMediumIsolationMVA2 = 0;
+  TBranch        *b_TauDisByMediumIsolationMVA = 0;
+  TBranch        *b_TauDisByTightCombinedIsolationDeltaBetaCorr3Hits = 0;
+  TBranch        *b_TauDisByTightCombinedIsolationDeltaBetaCorr = 0;
+  TBranch        *b_TauDisByTightIsolationMVA2 = 0;
+  TBranch        *b_TauDisByTightIsolationMVA = 0;
+  TBranch        *b_TauDisByVLooseCombinedIsolationDeltaBetaCorr = 0;
+  TBranch        *b_TauDisDecayModeFinding = 0;
+  TBranch        *b_TauJetPt = 0;
+  TBranch        *b_TauJetEta = 0;
+  TBranch        *b_TauJetPhi = 0;
+  TBranch        *b_NPFTau = 0;
+  TBranch        *b_PFTauE = 0;
+  TBranch        *b_PFTauPt = 0;
+  TBranch        *b_PFTauPx = 0;
+  TBranch        *b_PFTauPy = 0;
+  TBranch        *b_PFTauPz = 0;
+  TBranch        *b_PFTauEta = 0;
+  TBranch        *b_PFTauPhi = 0;
+  TBranch        *b_PFTauCharge = 0;
+  TBranch        *b_PFTauEtaEtaMoment = 0;
+  TBranch        *b_PFTauPhiPhiMoment = 0;
+  TBranch        *b_PFTauEtaPhiMoment = 0;
+  TBranch        *b_PFTauLeadPFChargedHadrCandsignedSipt = 0;
+  TBranch        *b_PFTauIsoPFChargedHadrCandsPtSum = 0;
+  TBranch        *b_PFTauIsoPFGammaCandsEtSum = 0;
+  TBranch        *b_PFTauMaximumHCALPFClusterEt = 0;
+  TBranch        *b_PFTauEmFraction = 0;
+  TBranch        *b_PFTauHcalTotOverPLead = 0;
+  TBranch        *b_PFTauHcalMaxOverPLead = 0;
+  TBranch        *b_PFTauHcal3x3OverPLead = 0;
+  TBranch        *b_PFTauEcalStripSumEOverPLead = 0;
+  TBranch        *b_PFTauBremsRecoveryEOverPLead = 0;
+  TBranch        *b_PFTauElectronPreIDOutput = 0;
+  TBranch        *b_PFTauElectronPreIDDecision = 0;
+  TBranch        *b_PFTauCaloComp = 0;
+  TBranch        *b_PFTauSegComp = 0;
+  TBranch        *b_PFTauMuonDecision = 0;
+  TBranch        *b_PFTausignalPFChargedHadrCands = 0;
+  TBranch        *b_PFTausignalPFGammaCands = 0;
+  TBranch        *b_PFTauDisAgainstElectronDeadECAL = 0;
+  TBranch        *b_PFTauDisAgainstElectronLoose = 0;
+  TBranch        *b_PFTauDisAgainstElectronLooseMVA2 = 0;
+  TBranch        *b_PFTauDisAgainstElectronLooseMVA3 = 0;
+  TBranch        *b_PFTauDisAgainstElectronMVA2category = 0;
+  TBranch        *b_PFTauDisAgainstElectronMVA2raw = 0;
+  TBranch        *b_PFTauDisAgainstElectronMVA3category = 0;
+  TBranch        *b_PFTauDisAgainstElectronMVA3raw = 0;
+  TBranch        *b_PFTauDisAgainstElectronMVA = 0;
+  TBranch        *b_PFTauDisAgainstElectronMedium = 0;
+  TBranch        *b_PFTauDisAgainstElectronMediumMVA2 = 0;
+  TBranch        *b_PFTauDisAgainstElectronMediumMVA3 = 0;
+  TBranch        *b_PFTauDisAgainstElectronTight = 0;
+  TBranch        *b_PFTauDisAgainstElectronTightMVA2 = 0;
+  TBranch        *b_PFTauDisAgainstElectronTightMVA3 = 0;
+  TBranch        *b_PFTauDisAgainstElectronVLooseMVA2 = 0;
+  TBranch        *b_PFTauDisAgainstElectronVTightMVA3 = 0;
+  TBranch        *b_PFTauDisAgainstMuonLoose2 = 0;
+  TBranch        *b_PFTauDisAgainstMuonLoose = 0;
+  TBranch        *b_PFTauDisAgainstMuonMedium2 = 0;
+  TBranch        *b_PFTauDisAgainstMuonMedium = 0;
+  TBranch        *b_PFTauDisAgainstMuonTight2 = 0;
+  TBranch        *b_PFTauDisAgainstMuonTight = 0;
+  TBranch        *b_PFTauDisByCombinedIsolationDeltaBetaCorrRaw3Hits = 0;
+  TBranch        *b_PFTauDisByCombinedIsolationDeltaBetaCorrRaw = 0;
+  TBranch        *b_PFTauDisByIsolationMVA2raw = 0;
+  TBranch        *b_PFTauDisByIsolationMVAraw = 0;
+  TBranch        *b_PFTauDisByLooseCombinedIsolationDeltaBetaCorr3Hits = 0;
+  TBranch        *b_PFTauDisByLooseCombinedIsolationDeltaBetaCorr = 0;
+  TBranch        *b_PFTauDisByLooseIsolationDeltaBetaCorr = 0;
+  TBranch        *b_PFTauDisByLooseIsolation = 0;
+  TBranch        *b_PFTauDisByLooseIsolationMVA2 = 0;
+  TBranch        *b_PFTauDisByLooseIsolationMVA = 0;
+  TBranch        *b_PFTauDisByMediumCombinedIsolationDeltaBetaCorr3Hits = 0;
+  TBranch        *b_PFTauDisByMediumCombinedIsolationDeltaBetaCorr = 0;
+  TBranch        *b_PFTauDisByMediumIsolationDeltaBetaCorr = 0;
+  TBranch        *b_PFTauDisByMediumIsolation = 0;
+  TBranch        *b_PFTauDisByMediumIsolationMVA2 = 0;
+  TBranch        *b_PFTauDisByMediumIsolationMVA = 0;
+  TBranch        *b_PFTauDisByTightCombinedIsolationDeltaBetaCorr3Hits = 0;
+  TBranch        *b_PFTauDisByTightCombinedIsolationDeltaBetaCorr = 0;
+  TBranch        *b_PFTauDisByTightIsolationDeltaBetaCorr = 0;
+  TBranch        *b_PFTauDisByTightIsolation = 0;
+  TBranch        *b_PFTauDisByTightIsolationMVA2 = 0;
+  TBranch        *b_PFTauDisByTightIsolationMVA = 0;
+  TBranch        *b_PFTauDisByVLooseCombinedIsolationDeltaBetaCorr = 0;
+  TBranch        *b_PFTauDisByVLooseIsolationDeltaBetaCorr = 0;
+  TBranch        *b_PFTauDisByVLooseIsolation = 0;
+  TBranch        *b_PFTauDisDecayModeFinding = 0;
+  TBranch        *b_PFTauJetPt = 0;
+  TBranch        *b_PFTauJetEta = 0;
+  TBranch        *b_PFTauJetPhi = 0;
+  TBranch        *b_WTauDecayMode = 0;
+  TBranch        *b_WTauN = 0;
+  TBranch        *b_WTauDecayId = 0;
+  TBranch        *b_WTauDecayPt = 0;
+  TBranch        *b_WTauDecayEta = 0;
+  TBranch        *b_WTauDecayPhi = 0;
+  TBranch        *b_WTauDecayMass = 0;
+  TBranch        *b_NPhot = 0;
+  TBranch        *b_PhotE = 0;
+  TBranch        *b_PhotPt = 0;
+  TBranch        *b_PhotPx = 0;
+  TBranch        *b_PhotPy = 0;
+  TBranch        *b_PhotPz = 0;
+  TBranch        *b_PhotEta = 0;
+  TBranch        *b_PhotPhi = 0;
+  TBranch        *b_PhotE1x5 = 0;
+  TBranch        *b_PhotE2x5 = 0;
+  TBranch        *b_PhotE5x5 = 0;
+  TBranch        *b_PhotSigEta = 0;
+  TBranch        *b_PhotSigPhi = 0;
+  TBranch        *b_PhotEcalIso04 = 0;
+  TBranch        *b_PhotHcalIso04 = 0;
+  TBranch        *b_PhotTrackIso04 = 0;
+  TBranch        *b_PhotHasPixSeed = 0;
+  TBranch        *b_PhotIsPhot = 0;
+  TBranch        *b_NPV = 0;
+  TBranch        *b_PVx = 0;
+  TBranch        *b_PVy = 0;
+  TBranch        *b_PVz = 0;
+  TBranch        *b_PVchi2 = 0;
+  TBranch        *b_PVndof = 0;
+  TBranch        *b_PVntracks = 0;
+  TBranch        *b_nHLT = 0;
+  TBranch        *b_HLTArray = 0;
+  TBranch        *b_HLTArray2 = 0;
+  TBranch        *b_HLTNames = 0;
+  TBranch        *b_HLTPreScale2 = 0;
+  TBranch        *b_nL1 = 0;
+  TBranch        *b_L1Array = 0;
+  TBranch        *b_nL1T = 0;
+  TBranch        *b_L1TArray = 0;
+  TBranch        *b_BeamHaloTight = 0;
+  TBranch        *b_BeamHaloLoose = 0;
+  TBranch        *b_TIV_N = 0;
+  TBranch        *b_TIV = 0;
+  TBranch        *b_TIV_pt = 0;
+  TBranch        *b_TIV_px = 0;
+  TBranch        *b_TIV_py = 0;
+  TBranch        *b_TIV_pz = 0;
+  TBranch        *b_TIV_phi = 0;
+  TBranch        *b_TIV_eta = 0;
+  TBranch        *b_TIV_dsz = 0;
+  TBranch        *b_TIV_dxy = 0;
+  TBranch        *b_TIV_d0 = 0;
+  TBranch        *b_TIV_dz = 0;
+  TBranch        *b_TIV_dsz_corr = 0;
+  TBranch        *b_TIV_dxy_corr = 0;
+  TBranch        *b_TIV_d0_corr = 0;
+  TBranch        *b_TIV_dz_corr = 0;
+  TBranch        *b_TIV_dR = 0;
+  TBranch        *b_TIV_lead = 0;
+  TBranch        *b_LowTIV = 0;
+  TBranch        *b_NGenPar = 0;
+  TBranch        *b_GenParId = 0;
+  TBranch        *b_GenParStatus = 0;
+  TBranch        *b_GenParE = 0;
+  TBranch        *b_GenParPx = 0;
+  TBranch        *b_GenParPy = 0;
+  TBranch        *b_GenParPz = 0;
+  TBranch        *b_GenParEta = 0;
+  TBranch        *b_GenParPhi = 0;
+  TBranch        *b_GenParCharge = 0;
+  TBranch        *b_GenParPt = 0;
+  TBranch        *b_GenParMass = 0;
+  TBranch        *b_GenParMother1 = 0;
+  TBranch        *b_GenParMother2 = 0;
+  TBranch        *b_GenParDoughterOf = 0;
+  TBranch        *b_GenAK4JetE = 0;
+  TBranch        *b_GenAK4JetPt = 0;
+  TBranch        *b_GenAK4JetPx = 0;
+  TBranch        *b_GenAK4JetPy = 0;
+  TBranch        *b_GenAK4JetPz = 0;
+  TBranch        *b_GenAK4JetEta = 0;
+  TBranch        *b_GenAK4JetPhi = 0;
+  TBranch        *b_GenAK4JetEmEnergy = 0;
+  TBranch        *b_GenAK4JetHadEnergy = 0;
+  TBranch        *b_GenScale = 0;
+  TBranch        *b_PDFx1 = 0;
+  TBranch        *b_PDFx2 = 0;
+  TBranch        *b_PDFf1 = 0;
+  TBranch        *b_PDFf2 = 0;
+  TBranch        *b_PDFscale = 0;
+  TBranch        *b_PDFpdf1 = 0;
+  TBranch        *b_PDFpdf2 = 0;
 };                
                   
 #include "EventData.cc"
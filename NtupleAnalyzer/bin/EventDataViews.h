@@ -0,0 +1,491 @@
+#ifndef EventDataViews_h
+#define EventDataViews_h
+
+// Columns of the EventData collection views, one line per array branch with a plain
+// accessor: X(type, column, branch). Made from the member and accessor lists of
+// EventData, add a line here when a branch is added there
+
+// PFAK4Jets, count NPFAK4Jets
+#define EVENTDATA_PFAK4JET_COLUMNS(X) \
+  X( Double_t, E,                  PFAK4JetE ) \
+  X( Double_t, Pt,                 PFAK4JetPt ) \
+  X( Double_t, Px,                 PFAK4JetPx ) \
+  X( Double_t, Py,                 PFAK4JetPy ) \
+  X( Double_t, Pz,                 PFAK4JetPz ) \
+  X( Double_t, Eta,                PFAK4JetEta ) \
+  X( Double_t, Phi,                PFAK4JetPhi ) \
+  X( Double_t, fHPD,               PFAK4JetfHPD ) \
+  X( Double_t, fRBX,               PFAK4JetfRBX ) \
+  X( Double_t, N90Hits,            PFAK4JetN90Hits ) \
+  X( Int_t,    N90,                PFAK4JetN90 ) \
+  X( Double_t, SigEta,             PFAK4JetSigEta ) \
+  X( Double_t, SigPhi,             PFAK4JetSigPhi ) \
+  X( Double_t, IDEmf,              PFAK4JetIDEmf ) \
+  X( Double_t, BtagTkCountHighEff, PFAK4JetBtagTkCountHighEff ) \
+  X( Double_t, BTagSimpleSecVtx,   PFAK4JetBTagSimpleSecVtx ) \
+  X( Double_t, BTagCombSecVtx,     PFAK4JetBTagCombSecVtx ) \
+  X( Double_t, NeuEmEngFrac,       PFAK4JetNeuEmEngFrac ) \
+  X( Double_t, ChaEmEngFrac,       PFAK4JetChaEmEngFrac ) \
+  X( Double_t, ChaHadEngFrac,      PFAK4JetChaHadEngFrac ) \
+  X( Double_t, NeuHadEngFrac,      PFAK4JetNeuHadEngFrac ) \
+  X( Double_t, ChaMuEng,           PFAK4JetChaMuEng ) \
+  X( Double_t, MuonEng,            PFAK4JetMuonEng ) \
+  X( Double_t, PhotEng,            PFAK4JetPhotEng ) \
+  X( Double_t, ElecEng,            PFAK4JetElecEng ) \
+  X( Int_t,    NumOfChaMu,         PFAK4JetNumOfChaMu ) \
+  X( Int_t,    NumOfMuon,          PFAK4JetNumOfMuon ) \
+  X( Int_t,    NumOfPhot,          PFAK4JetNumOfPhot ) \
+  X( Int_t,    NumOfElec,          PFAK4JetNumOfElec ) \
+  X( Int_t,    NumOfNeu,           PFAK4JetNumOfNeu ) \
+  X( Int_t,    NumOfCha,           PFAK4JetNumOfCha ) \
+  X( Int_t,    NumOfNeuHad,        PFAK4JetNumOfNeuHad ) \
+  X( Int_t,    NumOfChaHad,        PFAK4JetNumOfChaHad ) \
+  X( Int_t,    NumOfDaughters,     PFAK4JetNumOfDaughters ) \
+  X( Int_t,    IDLOOSE,            PFAK4JetIDLOOSE ) \
+  X( Int_t,    IDTIGHT,            PFAK4JetIDTIGHT ) \
+  X( Double_t, PUFullJetId,        PFAK4JetPUFullJetId )
+
+// CaloAK4Jets, count NCaloAK4Jets
+#define EVENTDATA_CALOAK4JET_COLUMNS(X) \
+  X( Double_t, E,                  CaloAK4JetE ) \
+  X( Double_t, Pt,                 CaloAK4JetPt ) \
+  X( Double_t, Px,                 CaloAK4JetPx ) \
+  X( Double_t, Py,                 CaloAK4JetPy ) \
+  X( Double_t, Pz,                 CaloAK4JetPz ) \
+  X( Double_t, Eta,                CaloAK4JetEta ) \
+  X( Double_t, Phi,                CaloAK4JetPhi ) \
+  X( Double_t, Emf,                CaloAK4JetEmf ) \
+  X( Double_t, fHPD,               CaloAK4JetfHPD ) \
+  X( Double_t, fRBX,               CaloAK4JetfRBX ) \
+  X( Double_t, N90Hits,            CaloAK4JetN90Hits ) \
+  X( Int_t,    N90,                CaloAK4JetN90 ) \
+  X( Double_t, SigEta,             CaloAK4JetSigEta ) \
+  X( Double_t, SigPhi,             CaloAK4JetSigPhi ) \
+  X( Double_t, IDEmf,              CaloAK4JetIDEmf ) \
+  X( Double_t, ECor,               CaloAK4JetECor ) \
+  X( Double_t, PtCor,              CaloAK4JetPtCor ) \
+  X( Double_t, PxCor,              CaloAK4JetPxCor ) \
+  X( Double_t, PyCor,              CaloAK4JetPyCor ) \
+  X( Double_t, PzCor,              CaloAK4JetPzCor ) \
+  X( Double_t, BtagTkCountHighEff, CaloAK4JetBtagTkCountHighEff ) \
+  X( Double_t, BTagSimpleSecVtx,   CaloAK4JetBTagSimpleSecVtx ) \
+  X( Double_t, BTagCombSecVtx,     CaloAK4JetBTagCombSecVtx ) \
+  X( Int_t,    IDLOOSE,            CaloAK4JetIDLOOSE ) \
+  X( Int_t,    IDTIGHT,            CaloAK4JetIDTIGHT )
+
+// PFMuons, count NPFMuon
+#define EVENTDATA_PFMUON_COLUMNS(X) \
+  X( Double_t, Pt,                   PFMuonPt ) \
+  X( Double_t, Et,                   PFMuonEt ) \
+  X( Double_t, E,                    PFMuonE ) \
+  X( Double_t, Px,                   PFMuonPx ) \
+  X( Double_t, Py,                   PFMuonPy ) \
+  X( Double_t, Pz,                   PFMuonPz ) \
+  X( Double_t, Eta,                  PFMuonEta ) \
+  X( Double_t, Phi,                  PFMuonPhi ) \
+  X( Int_t,    Charge,               PFMuonCharge ) \
+  X( Int_t,    IsGlobal,             PFMuonIsGlobal ) \
+  X( Int_t,    IsStandAlone,         PFMuonIsStandAlone ) \
+  X( Int_t,    IsTracker,            PFMuonIsTracker ) \
+  X( Int_t,    IsTight,              PFMuonIsTight ) \
+  X( Int_t,    IsLoose,              PFMuonIsLoose ) \
+  X( Double_t, ChargedHadronIso,     PFMuonChargedHadronIso ) \
+  X( Double_t, PhotonIso,            PFMuonPhotonIso ) \
+  X( Double_t, NeutralHadronIso,     PFMuonNeutralHadronIso ) \
+  X( Int_t,    isGMPT,               PFMuonisGMPT ) \
+  X( Int_t,    NumOfMatches,         PFMuonNumOfMatches ) \
+  X( Double_t, innertrackPt,         PFMuoninnertrackPt ) \
+  X( Int_t,    nValidHits,           PFMuonnValidHits ) \
+  X( Int_t,    nValidPixelHits,      PFMuonnValidPixelHits ) \
+  X( Double_t, dxy,                  PFMuondxy ) \
+  X( Double_t, dz,                   PFMuondz ) \
+  X( Double_t, CombChi2Norm,         PFMuonCombChi2Norm ) \
+  X( Int_t,    CombValidHits,        PFMuonCombValidHits ) \
+  X( Int_t,    CombLostHits,         PFMuonCombLostHits ) \
+  X( Double_t, CombPt,               PFMuonCombPt ) \
+  X( Double_t, CombPz,               PFMuonCombPz ) \
+  X( Double_t, CombP,                PFMuonCombP ) \
+  X( Double_t, CombEta,              PFMuonCombEta ) \
+  X( Double_t, CombPhi,              PFMuonCombPhi ) \
+  X( Double_t, CombChi2,             PFMuonCombChi2 ) \
+  X( Double_t, CombCharge,           PFMuonCombCharge ) \
+  X( Double_t, CombQOverPError,      PFMuonCombQOverPError ) \
+  X( Double_t, CombNdof,             PFMuonCombNdof ) \
+  X( Double_t, CombVx,               PFMuonCombVx ) \
+  X( Double_t, CombVy,               PFMuonCombVy ) \
+  X( Double_t, CombVz,               PFMuonCombVz ) \
+  X( Double_t, CombD0,               PFMuonCombD0 ) \
+  X( Double_t, CombDz,               PFMuonCombDz ) \
+  X( Double_t, StandChi2Norm,        PFMuonStandChi2Norm ) \
+  X( Int_t,    StandValidHits,       PFMuonStandValidHits ) \
+  X( Int_t,    StandLostHits,        PFMuonStandLostHits ) \
+  X( Double_t, StandPt,              PFMuonStandPt ) \
+  X( Double_t, StandPz,              PFMuonStandPz ) \
+  X( Double_t, StandP,               PFMuonStandP ) \
+  X( Double_t, StandEta,             PFMuonStandEta ) \
+  X( Double_t, StandPhi,             PFMuonStandPhi ) \
+  X( Double_t, StandChi2,            PFMuonStandChi2 ) \
+  X( Double_t, StandCharge,          PFMuonStandCharge ) \
+  X( Double_t, StandQOverPError,     PFMuonStandQOverPError ) \
+  X( Double_t, TrkChi2Norm,          PFMuonTrkChi2Norm ) \
+  X( Int_t,    TrkValidHits,         PFMuonTrkValidHits ) \
+  X( Int_t,    TrkLostHits,          PFMuonTrkLostHits ) \
+  X( Double_t, TrkPt,                PFMuonTrkPt ) \
+  X( Double_t, TrkPz,                PFMuonTrkPz ) \
+  X( Double_t, TrkP,                 PFMuonTrkP ) \
+  X( Double_t, TrkEta,               PFMuonTrkEta ) \
+  X( Double_t, TrkPhi,               PFMuonTrkPhi ) \
+  X( Double_t, TrkChi2,              PFMuonTrkChi2 ) \
+  X( Double_t, TrkCharge,            PFMuonTrkCharge ) \
+  X( Double_t, TrkQOverPError,       PFMuonTrkQOverPError ) \
+  X( Double_t, TrkDxy,               PFMuonTrkDxy ) \
+  X( Double_t, TrkNumOfValidPixHits, PFMuonTrkNumOfValidPixHits ) \
+  X( Double_t, R04ChargedHadronPt,   PFMuonR04ChargedHadronPt ) \
+  X( Double_t, R04NeutralHadronEt,   PFMuonR04NeutralHadronEt ) \
+  X( Double_t, R04PhotonEt,          PFMuonR04PhotonEt ) \
+  X( Double_t, R04PUPt,              PFMuonR04PUPt )
+
+// PFElecs, count NPFElec
+#define EVENTDATA_PFELEC_COLUMNS(X) \
+  X( Int_t,    Charge,         PFElecCharge ) \
+  X( Int_t,    IsEB,           PFElecIsEB ) \
+  X( Double_t, PassTight,      PFElecPassTight ) \
+  X( Double_t, E,              PFElecE ) \
+  X( Double_t, Pt,             PFElecPt ) \
+  X( Double_t, Px,             PFElecPx ) \
+  X( Double_t, Py,             PFElecPy ) \
+  X( Double_t, Pz,             PFElecPz ) \
+  X( Double_t, Eta,            PFElecEta ) \
+  X( Double_t, Phi,            PFElecPhi ) \
+  X( Double_t, CharHadIso,     PFElecCharHadIso ) \
+  X( Double_t, PhoIso,         PFElecPhoIso ) \
+  X( Double_t, NeuHadIso,      PFElecNeuHadIso ) \
+  X( Double_t, Mva,            PFElecMva ) \
+  X( Double_t, dxy,            PFElecdxy ) \
+  X( Double_t, dz,             PFElecdz ) \
+  X( Double_t, HadOverEm,      PFElecHadOverEm ) \
+  X( Double_t, HcalOverEm,     PFElecHcalOverEm ) \
+  X( Double_t, SupClusOverP,   PFElecSupClusOverP ) \
+  X( Double_t, InnerHits,      PFElecInnerHits ) \
+  X( Double_t, ConvDist,       PFElecConvDist ) \
+  X( Double_t, ConvDcot,       PFElecConvDcot ) \
+  X( Double_t, DEtaSuTrAtVtx,  PFElecDEtaSuTrAtVtx ) \
+  X( Double_t, DPhiSuTrAtVtx,  PFElecDPhiSuTrAtVtx ) \
+  X( Double_t, HadronicOverEm, PFElecHadronicOverEm ) \
+  X( Double_t, HcalOverEcal,   PFElecHcalOverEcal ) \
+  X( Double_t, etaeta,         PFElecetaeta ) \
+  X( Double_t, ietaieta,       PFElecietaieta ) \
+  X( Int_t,    IsTight,        PFElecIsTight ) \
+  X( Int_t,    IsMedium,       PFElecIsMedium ) \
+  X( Int_t,    IsLoose,        PFElecIsLoose ) \
+  X( Int_t,    IsVeto,         PFElecIsVeto ) \
+  X( Double_t, EffArea,        PFElecEffArea )
+
+// PFTaus, count NPFTau
+#define EVENTDATA_PFTAU_COLUMNS(X) \
+  X( Double_t, E,                                              PFTauE ) \
+  X( Double_t, Pt,                                             PFTauPt ) \
+  X( Double_t, Px,                                             PFTauPx ) \
+  X( Double_t, Py,                                             PFTauPy ) \
+  X( Double_t, Pz,                                             PFTauPz ) \
+  X( Double_t, Eta,                                            PFTauEta ) \
+  X( Double_t, Phi,                                            PFTauPhi ) \
+  X( Int_t,    Charge,                                         PFTauCharge ) \
+  X( Double_t, EtaEtaMoment,                                   PFTauEtaEtaMoment ) \
+  X( Double_t, PhiPhiMoment,                                   PFTauPhiPhiMoment ) \
+  X( Double_t, EtaPhiMoment,                                   PFTauEtaPhiMoment ) \
+  X( Double_t, LeadPFChargedHadrCandsignedSipt,                PFTauLeadPFChargedHadrCandsignedSipt ) \
+  X( Double_t, IsoPFChargedHadrCandsPtSum,                     PFTauIsoPFChargedHadrCandsPtSum ) \
+  X( Double_t, IsoPFGammaCandsEtSum,                           PFTauIsoPFGammaCandsEtSum ) \
+  X( Double_t, MaximumHCALPFClusterEt,                         PFTauMaximumHCALPFClusterEt ) \
+  X( Double_t, EmFraction,                                     PFTauEmFraction ) \
+  X( Double_t, HcalTotOverPLead,                               PFTauHcalTotOverPLead ) \
+  X( Double_t, HcalMaxOverPLead,                               PFTauHcalMaxOverPLead ) \
+  X( Double_t, Hcal3x3OverPLead,                               PFTauHcal3x3OverPLead ) \
+  X( Double_t, EcalStripSumEOverPLead,                         PFTauEcalStripSumEOverPLead ) \
+  X( Double_t, BremsRecoveryEOverPLead,                        PFTauBremsRecoveryEOverPLead ) \
+  X( Double_t, ElectronPreIDOutput,                            PFTauElectronPreIDOutput ) \
+  X( Double_t, ElectronPreIDDecision,                          PFTauElectronPreIDDecision ) \
+  X( Double_t, CaloComp,                                       PFTauCaloComp ) \
+  X( Double_t, SegComp,                                        PFTauSegComp ) \
+  X( Double_t, MuonDecision,                                   PFTauMuonDecision ) \
+  X( Double_t, signalPFChargedHadrCands,                       PFTausignalPFChargedHadrCands ) \
+  X( Double_t, signalPFGammaCands,                             PFTausignalPFGammaCands ) \
+  X( Double_t, DisAgainstElectronDeadECAL,                     PFTauDisAgainstElectronDeadECAL ) \
+  X( Double_t, DisAgainstElectronLoose,                        PFTauDisAgainstElectronLoose ) \
+  X( Double_t, DisAgainstElectronLooseMVA2,                    PFTauDisAgainstElectronLooseMVA2 ) \
+  X( Double_t, DisAgainstElectronLooseMVA3,                    PFTauDisAgainstElectronLooseMVA3 ) \
+  X( Double_t, DisAgainstElectronMVA2category,                 PFTauDisAgainstElectronMVA2category ) \
+  X( Double_t, DisAgainstElectronMVA2raw,                      PFTauDisAgainstElectronMVA2raw ) \
+  X( Double_t, DisAgainstElectronMVA3category,                 PFTauDisAgainstElectronMVA3category ) \
+  X( Double_t, DisAgainstElectronMVA3raw,                      PFTauDisAgainstElectronMVA3raw ) \
+  X( Double_t, DisAgainstElectronMVA,                          PFTauDisAgainstElectronMVA ) \
+  X( Double_t, DisAgainstElectronMedium,                       PFTauDisAgainstElectronMedium ) \
+  X( Double_t, DisAgainstElectronMediumMVA2,                   PFTauDisAgainstElectronMediumMVA2 ) \
+  X( Double_t, DisAgainstElectronMediumMVA3,                   PFTauDisAgainstElectronMediumMVA3 ) \
+  X( Double_t, DisAgainstElectronTight,                        PFTauDisAgainstElectronTight ) \
+  X( Double_t, DisAgainstElectronTightMVA2,                    PFTauDisAgainstElectronTightMVA2 ) \
+  X( Double_t, DisAgainstElectronTightMVA3,                    PFTauDisAgainstElectronTightMVA3 ) \
+  X( Double_t, DisAgainstElectronVLooseMVA2,                   PFTauDisAgainstElectronVLooseMVA2 ) \
+  X( Double_t, DisAgainstElectronVTightMVA3,                   PFTauDisAgainstElectronVTightMVA3 ) \
+  X( Double_t, DisAgainstMuonLoose2,                           PFTauDisAgainstMuonLoose2 ) \
+  X( Double_t, DisAgainstMuonLoose,                            PFTauDisAgainstMuonLoose ) \
+  X( Double_t, DisAgainstMuonMedium2,                          PFTauDisAgainstMuonMedium2 ) \
+  X( Double_t, DisAgainstMuonMedium,                           PFTauDisAgainstMuonMedium ) \
+  X( Double_t, DisAgainstMuonTight2,                           PFTauDisAgainstMuonTight2 ) \
+  X( Double_t, DisAgainstMuonTight,                            PFTauDisAgainstMuonTight ) \
+  X( Double_t, DisByCombinedIsolationDeltaBetaCorrRaw3Hits,    PFTauDisByCombinedIsolationDeltaBetaCorrRaw3Hits ) \
+  X( Double_t, DisByCombinedIsolationDeltaBetaCorrRaw,         PFTauDisByCombinedIsolationDeltaBetaCorrRaw ) \
+  X( Double_t, DisByIsolationMVA2raw,                          PFTauDisByIsolationMVA2raw ) \
+  X( Double_t, DisByIsolationMVAraw,                           PFTauDisByIsolationMVAraw ) \
+  X( Double_t, DisByLooseCombinedIsolationDeltaBetaCorr3Hits,  PFTauDisByLooseCombinedIsolationDeltaBetaCorr3Hits ) \
+  X( Double_t, DisByLooseCombinedIsolationDeltaBetaCorr,       PFTauDisByLooseCombinedIsolationDeltaBetaCorr ) \
+  X( Double_t, DisByLooseIsolationDeltaBetaCorr,               PFTauDisByLooseIsolationDeltaBetaCorr ) \
+  X( Double_t, DisByLooseIsolation,                            PFTauDisByLooseIsolation ) \
+  X( Double_t, DisByLooseIsolationMVA2,                        PFTauDisByLooseIsolationMVA2 ) \
+  X( Double_t, DisByLooseIsolationMVA,                         PFTauDisByLooseIsolationMVA ) \
+  X( Double_t, DisByMediumCombinedIsolationDeltaBetaCorr3Hits, PFTauDisByMediumCombinedIsolationDeltaBetaCorr3Hits ) \
+  X( Double_t, DisByMediumCombinedIsolationDeltaBetaCorr,      PFTauDisByMediumCombinedIsolationDeltaBetaCorr ) \
+  X( Double_t, DisByMediumIsolationDeltaBetaCorr,              PFTauDisByMediumIsolationDeltaBetaCorr ) \
+  X( Double_t, DisByMediumIsolation,                           PFTauDisByMediumIsolation ) \
+  X( Double_t, DisByMediumIsolationMVA2,                       PFTauDisByMediumIsolationMVA2 ) \
+  X( Double_t, DisByMediumIsolationMVA,                        PFTauDisByMediumIsolationMVA ) \
+  X( Double_t, DisByTightCombinedIsolationDeltaBetaCorr3Hits,  PFTauDisByTightCombinedIsolationDeltaBetaCorr3Hits ) \
+  X( Double_t, DisByTightCombinedIsolationDeltaBetaCorr,       PFTauDisByTightCombinedIsolationDeltaBetaCorr ) \
+  X( Double_t, DisByTightIsolationDeltaBetaCorr,               PFTauDisByTightIsolationDeltaBetaCorr ) \
+  X( Double_t, DisByTightIsolation,                            PFTauDisByTightIsolation ) \
+  X( Double_t, DisByTightIsolationMVA2,                        PFTauDisByTightIsolationMVA2 ) \
+  X( Double_t, DisByTightIsolationMVA,                         PFTauDisByTightIsolationMVA ) \
+  X( Double_t, DisByVLooseCombinedIsolationDeltaBetaCorr,      PFTauDisByVLooseCombinedIsolationDeltaBetaCorr ) \
+  X( Double_t, DisByVLooseIsolationDeltaBetaCorr,              PFTauDisByVLooseIsolationDeltaBetaCorr ) \
+  X( Double_t, DisByVLooseIsolation,                           PFTauDisByVLooseIsolation ) \
+  X( Double_t, DisDecayModeFinding,                            PFTauDisDecayModeFinding ) \
+  X( Double_t, JetPt,                                          PFTauJetPt ) \
+  X( Double_t, JetEta,                                         PFTauJetEta ) \
+  X( Double_t, JetPhi,                                         PFTauJetPhi )
+
+// Muons, count NMuon
+#define EVENTDATA_MUON_COLUMNS(X) \
+  X( Double_t, Pt,                   MuonPt ) \
+  X( Double_t, Et,                   MuonEt ) \
+  X( Double_t, E,                    MuonE ) \
+  X( Double_t, Px,                   MuonPx ) \
+  X( Double_t, Py,                   MuonPy ) \
+  X( Double_t, Pz,                   MuonPz ) \
+  X( Double_t, Eta,                  MuonEta ) \
+  X( Double_t, Phi,                  MuonPhi ) \
+  X( Double_t, Charge,               MuonCharge ) \
+  X( Int_t,    IsGlobal,             MuonIsGlobal ) \
+  X( Int_t,    IsStandAlone,         MuonIsStandAlone ) \
+  X( Int_t,    IsTracker,            MuonIsTracker ) \
+  X( Double_t, SumPtDR03,            MuonSumPtDR03 ) \
+  X( Double_t, SumPtDR05,            MuonSumPtDR05 ) \
+  X( Double_t, EmEtDR03,             MuonEmEtDR03 ) \
+  X( Double_t, HadEtDR03,            MuonHadEtDR03 ) \
+  X( Int_t,    NumOfMatches,         MuonNumOfMatches ) \
+  X( Double_t, CombChi2Norm,         MuonCombChi2Norm ) \
+  X( Int_t,    CombValidHits,        MuonCombValidHits ) \
+  X( Int_t,    CombLostHits,         MuonCombLostHits ) \
+  X( Double_t, CombPt,               MuonCombPt ) \
+  X( Double_t, CombPz,               MuonCombPz ) \
+  X( Double_t, CombP,                MuonCombP ) \
+  X( Double_t, CombEta,              MuonCombEta ) \
+  X( Double_t, CombPhi,              MuonCombPhi ) \
+  X( Double_t, CombChi2,             MuonCombChi2 ) \
+  X( Double_t, CombCharge,           MuonCombCharge ) \
+  X( Double_t, CombQOverPError,      MuonCombQOverPError ) \
+  X( Double_t, CombNdof,             MuonCombNdof ) \
+  X( Double_t, CombVx,               MuonCombVx ) \
+  X( Double_t, CombVy,               MuonCombVy ) \
+  X( Double_t, CombVz,               MuonCombVz ) \
+  X( Double_t, CombD0,               MuonCombD0 ) \
+  X( Double_t, CombDz,               MuonCombDz ) \
+  X( Double_t, StandChi2Norm,        MuonStandChi2Norm ) \
+  X( Int_t,    StandValidHits,       MuonStandValidHits ) \
+  X( Int_t,    StandLostHits,        MuonStandLostHits ) \
+  X( Double_t, StandPt,              MuonStandPt ) \
+  X( Double_t, StandPz,              MuonStandPz ) \
+  X( Double_t, StandP,               MuonStandP ) \
+  X( Double_t, StandEta,             MuonStandEta ) \
+  X( Double_t, StandPhi,             MuonStandPhi ) \
+  X( Double_t, StandChi2,            MuonStandChi2 ) \
+  X( Double_t, StandCharge,          MuonStandCharge ) \
+  X( Double_t, StandQOverPError,     MuonStandQOverPError ) \
+  X( Double_t, TrkChi2Norm,          MuonTrkChi2Norm ) \
+  X( Int_t,    TrkValidHits,         MuonTrkValidHits ) \
+  X( Int_t,    TrkLostHits,          MuonTrkLostHits ) \
+  X( Double_t, TrkPt,                MuonTrkPt ) \
+  X( Double_t, TrkPz,                MuonTrkPz ) \
+  X( Double_t, TrkP,                 MuonTrkP ) \
+  X( Double_t, TrkEta,               MuonTrkEta ) \
+  X( Double_t, TrkPhi,               MuonTrkPhi ) \
+  X( Double_t, TrkChi2,              MuonTrkChi2 ) \
+  X( Double_t, TrkCharge,            MuonTrkCharge ) \
+  X( Double_t, TrkQOverPError,       MuonTrkQOverPError ) \
+  X( Double_t, TrkDxy,               MuonTrkDxy ) \
+  X( Int_t,    TrkNumOfValidPixHits, MuonTrkNumOfValidPixHits )
+
+// Elecs, count NElec
+#define EVENTDATA_ELEC_COLUMNS(X) \
+  X( Double_t, E,                   ElecE ) \
+  X( Double_t, Pt,                  ElecPt ) \
+  X( Double_t, Px,                  ElecPx ) \
+  X( Double_t, Py,                  ElecPy ) \
+  X( Double_t, Pz,                  ElecPz ) \
+  X( Int_t,    Ecalseed,            ElecEcalseed ) \
+  X( Int_t,    ID80,                ElecID80 ) \
+  X( Int_t,    ID95,                ElecID95 ) \
+  X( Double_t, Eta,                 ElecEta ) \
+  X( Double_t, Phi,                 ElecPhi ) \
+  X( Int_t,    Charge,              ElecCharge ) \
+  X( Double_t, dr03HcalTowerSumEt,  Elecdr03HcalTowerSumEt ) \
+  X( Double_t, dr03EcalRecHitSumEt, Elecdr03EcalRecHitSumEt ) \
+  X( Double_t, dr03TkSumPt,         Elecdr03TkSumPt ) \
+  X( Int_t,    NumOfValidHits,      ElecNumOfValidHits ) \
+  X( Int_t,    InnerNumOfHits,      ElecInnerNumOfHits ) \
+  X( Double_t, dist,                Elecdist ) \
+  X( Double_t, dcot,                Elecdcot ) \
+  X( Double_t, NormChi2,            ElecNormChi2 ) \
+  X( Double_t, dxy,                 Elecdxy ) \
+  X( Double_t, dz,                  Elecdz ) \
+  X( Int_t,    dB,                  ElecdB ) \
+  X( Int_t,    IsEB,                ElecIsEB ) \
+  X( Double_t, fbrem,               Elecfbrem ) \
+  X( Double_t, DEtaSuTrAtVtx,       ElecDEtaSuTrAtVtx ) \
+  X( Double_t, DPhiSuTrAtVtx,       ElecDPhiSuTrAtVtx ) \
+  X( Double_t, HadronicOverEm,      ElecHadronicOverEm ) \
+  X( Double_t, HcalOverEcal,        ElecHcalOverEcal ) \
+  X( Double_t, SuperClusOverP,      ElecSuperClusOverP ) \
+  X( Double_t, etaeta,              Elecetaeta ) \
+  X( Double_t, ietaieta,            Elecietaieta )
+
+// Taus, count NTau
+#define EVENTDATA_TAU_COLUMNS(X) \
+  X( Double_t, E,                                              TauE ) \
+  X( Double_t, Pt,                                             TauPt ) \
+  X( Double_t, Px,                                             TauPx ) \
+  X( Double_t, Py,                                             TauPy ) \
+  X( Double_t, Pz,                                             TauPz ) \
+  X( Double_t, Eta,                                            TauEta ) \
+  X( Double_t, Phi,                                            TauPhi ) \
+  X( Int_t,    Charge,                                         TauCharge ) \
+  X( Double_t, EtaEtaMoment,                                   TauEtaEtaMoment ) \
+  X( Double_t, PhiPhiMoment,                                   TauPhiPhiMoment ) \
+  X( Double_t, EtaPhiMoment,                                   TauEtaPhiMoment ) \
+  X( Double_t, LeadPFChargedHadrCandsignedSipt,                TauLeadPFChargedHadrCandsignedSipt ) \
+  X( Double_t, IsoPFChargedHadrCandsPtSum,                     TauIsoPFChargedHadrCandsPtSum ) \
+  X( Double_t, IsoPFGammaCandsEtSum,                           TauIsoPFGammaCandsEtSum ) \
+  X( Double_t, MaximumHCALPFClusterEt,                         TauMaximumHCALPFClusterEt ) \
+  X( Double_t, EmFraction,                                     TauEmFraction ) \
+  X( Double_t, HcalTotOverPLead,                               TauHcalTotOverPLead ) \
+  X( Double_t, HcalMaxOverPLead,                               TauHcalMaxOverPLead ) \
+  X( Double_t, Hcal3x3OverPLead,                               TauHcal3x3OverPLead ) \
+  X( Double_t, EcalStripSumEOverPLead,                         TauEcalStripSumEOverPLead ) \
+  X( Double_t, BremsRecoveryEOverPLead,                        TauBremsRecoveryEOverPLead ) \
+  X( Double_t, ElectronPreIDOutput,                            TauElectronPreIDOutput ) \
+  X( Double_t, ElectronPreIDDecision,                          TauElectronPreIDDecision ) \
+  X( Double_t, CaloComp,                                       TauCaloComp ) \
+  X( Double_t, SegComp,                                        TauSegComp ) \
+  X( Double_t, MuonDecision,                                   TauMuonDecision ) \
+  X( Double_t, signalPFChargedHadrCands,                       TausignalPFChargedHadrCands ) \
+  X( Double_t, signalPFGammaCands,                             TausignalPFGammaCands ) \
+  X( Double_t, DisAgainstElectronDeadECAL,                     TauDisAgainstElectronDeadECAL ) \
+  X( Double_t, DisAgainstElectronLoose,                        TauDisAgainstElectronLoose ) \
+  X( Double_t, DisAgainstElectronLooseMVA2,                    TauDisAgainstElectronLooseMVA2 ) \
+  X( Double_t, DisAgainstElectronLooseMVA3,                    TauDisAgainstElectronLooseMVA3 ) \
+  X( Double_t, DisAgainstElectronMVA2category,                 TauDisAgainstElectronMVA2category ) \
+  X( Double_t, DisAgainstElectronMVA2raw,                      TauDisAgainstElectronMVA2raw ) \
+  X( Double_t, DisAgainstElectronMVA3category,                 TauDisAgainstElectronMVA3category ) \
+  X( Double_t, DisAgainstElectronMVA3raw,                      TauDisAgainstElectronMVA3raw ) \
+  X( Double_t, DisAgainstElectronMVA,                          TauDisAgainstElectronMVA ) \
+  X( Double_t, DisAgainstElectronMedium,                       TauDisAgainstElectronMedium ) \
+  X( Double_t, DisAgainstElectronMediumMVA2,                   TauDisAgainstElectronMediumMVA2 ) \
+  X( Double_t, DisAgainstElectronMediumMVA3,                   TauDisAgainstElectronMediumMVA3 ) \
+  X( Double_t, DisAgainstElectronTight,                        TauDisAgainstElectronTight ) \
+  X( Double_t, DisAgainstElectronTightMVA2,                    TauDisAgainstElectronTightMVA2 ) \
+  X( Double_t, DisAgainstElectronTightMVA3,                    TauDisAgainstElectronTightMVA3 ) \
+  X( Double_t, DisAgainstElectronVLooseMVA2,                   TauDisAgainstElectronVLooseMVA2 ) \
+  X( Double_t, DisAgainstElectronVTightMVA3,                   TauDisAgainstElectronVTightMVA3 ) \
+  X( Double_t, DisAgainstMuonLoose2,                           TauDisAgainstMuonLoose2 ) \
+  X( Double_t, DisAgainstMuonLoose,                            TauDisAgainstMuonLoose ) \
+  X( Double_t, DisAgainstMuonMedium2,                          TauDisAgainstMuonMedium2 ) \
+  X( Double_t, DisAgainstMuonMedium,                           TauDisAgainstMuonMedium ) \
+  X( Double_t, DisAgainstMuonTight2,                           TauDisAgainstMuonTight2 ) \
+  X( Double_t, DisAgainstMuonTight,                            TauDisAgainstMuonTight ) \
+  X( Double_t, DisByCombinedIsolationDeltaBetaCorrRaw3Hits,    TauDisByCombinedIsolationDeltaBetaCorrRaw3Hits ) \
+  X( Double_t, DisByCombinedIsolationDeltaBetaCorrRaw,         TauDisByCombinedIsolationDeltaBetaCorrRaw ) \
+  X( Double_t, DisByIsolationMVA2raw,                          TauDisByIsolationMVA2raw ) \
+  X( Double_t, DisByIsolationMVAraw,                           TauDisByIsolationMVAraw ) \
+  X( Double_t, DisByLooseCombinedIsolationDeltaBetaCorr3Hits,  TauDisByLooseCombinedIsolationDeltaBetaCorr3Hits ) \
+  X( Double_t, DisByLooseCombinedIsolationDeltaBetaCorr,       TauDisByLooseCombinedIsolationDeltaBetaCorr ) \
+  X( Double_t, DisByLooseIsolationMVA2,                        TauDisByLooseIsolationMVA2 ) \
+  X( Double_t, DisByLooseIsolationMVA,                         TauDisByLooseIsolationMVA ) \
+  X( Double_t, DisByMediumCombinedIsolationDeltaBetaCorr3Hits, TauDisByMediumCombinedIsolationDeltaBetaCorr3Hits ) \
+  X( Double_t, DisByMediumCombinedIsolationDeltaBetaCorr,      TauDisByMediumCombinedIsolationDeltaBetaCorr ) \
+  X( Double_t, DisByMediumIsolationMVA2,                       TauDisByMediumIsolationMVA2 ) \
+  X( Double_t, DisByMediumIsolationMVA,                        TauDisByMediumIsolationMVA ) \
+  X( Double_t, DisByTightCombinedIsolationDeltaBetaCorr3Hits,  TauDisByTightCombinedIsolationDeltaBetaCorr3Hits ) \
+  X( Double_t, DisByTightCombinedIsolationDeltaBetaCorr,       TauDisByTightCombinedIsolationDeltaBetaCorr ) \
+  X( Double_t, DisByTightIsolationMVA2,                        TauDisByTightIsolationMVA2 ) \
+  X( Double_t, DisByTightIsolationMVA,                         TauDisByTightIsolationMVA ) \
+  X( Double_t, DisByVLooseCombinedIsolationDeltaBetaCorr,      TauDisByVLooseCombinedIsolationDeltaBetaCorr ) \
+  X( Double_t, DisDecayModeFinding,                            TauDisDecayModeFinding ) \
+  X( Double_t, JetPt,                                          TauJetPt ) \
+  X( Double_t, JetEta,                                         TauJetEta ) \
+  X( Double_t, JetPhi,                                         TauJetPhi )
+
+// Phots, count NPhot
+#define EVENTDATA_PHOT_COLUMNS(X) \
+  X( Double_t, E,          PhotE ) \
+  X( Double_t, Pt,         PhotPt ) \
+  X( Double_t, Px,         PhotPx ) \
+  X( Double_t, Py,         PhotPy ) \
+  X( Double_t, Pz,         PhotPz ) \
+  X( Double_t, Eta,        PhotEta ) \
+  X( Double_t, Phi,        PhotPhi ) \
+  X( Double_t, E1x5,       PhotE1x5 ) \
+  X( Double_t, E2x5,       PhotE2x5 ) \
+  X( Double_t, E5x5,       PhotE5x5 ) \
+  X( Double_t, SigEta,     PhotSigEta ) \
+  X( Double_t, SigPhi,     PhotSigPhi ) \
+  X( Double_t, EcalIso04,  PhotEcalIso04 ) \
+  X( Double_t, HcalIso04,  PhotHcalIso04 ) \
+  X( Double_t, TrackIso04, PhotTrackIso04 ) \
+  X( Double_t, HasPixSeed, PhotHasPixSeed ) \
+  X( Double_t, IsPhot,     PhotIsPhot )
+
+// GenPars, count NGenPar
+#define EVENTDATA_GENPAR_COLUMNS(X) \
+  X( Int_t,    Id,         GenParId ) \
+  X( Int_t,    Status,     GenParStatus ) \
+  X( Double_t, E,          GenParE ) \
+  X( Double_t, Px,         GenParPx ) \
+  X( Double_t, Py,         GenParPy ) \
+  X( Double_t, Pz,         GenParPz ) \
+  X( Double_t, Eta,        GenParEta ) \
+  X( Double_t, Phi,        GenParPhi ) \
+  X( Int_t,    Charge,     GenParCharge ) \
+  X( Double_t, Pt,         GenParPt ) \
+  X( Double_t, Mass,       GenParMass ) \
+  X( Int_t,    Mother1,    GenParMother1 ) \
+  X( Int_t,    Mother2,    GenParMother2 ) \
+  X( Int_t,    DoughterOf, GenParDoughterOf )
+
+
+// View class of one collection, the columns are read with LoadBranch when asked for
+#define EVENTDATA_VIEW_BEGIN(View, count)					\
+  class View									\
+  {										\
+  public:									\
+    View(EventData * ev) : mEv(ev) {}						\
+    Int_t size() const { mEv->LoadBranch(mEv->b_##count); return mEv->m##count; }
+
+#define EVENTDATA_VIEW_COLUMN(type, column, branch)				\
+    Span<type> column() const { mEv->LoadBranch(mEv->b_##branch); return Span<type>(mEv->m##branch, size()); }
+
+#define EVENTDATA_VIEW_END							\
+  private:									\
+    EventData * mEv;								\
+  };
+
+#endif
@@ -0,0 +1,82 @@
+// std includes
+#include <string>
+#include <iostream>
+#include <vector>
+#include <stdio.h>
+#include <stdlib.h>
+
+#include "HistMerger.h"
+
+using namespace std;
+
+// One output of the merge: the cumulative stacks or the sum of a list of samples
+struct Output
+{
+	bool           stack;
+	string         name;
+	vector<string> samples;
+};
+
+
+int main(int argc, char ** argv) 
+{
+	if ( argc < 7 ) 
+	{
+		cerr << "Insufficient arguments: [analysis] [cuts] [nThreads] [stack|sum] [output] [sample1] [sample2...] [stack|sum] [output] ..." << endl;
+		cerr << "Example:  HistMerge  AnaMonoJetCutEff  0-8  8  stack AnaMonoJetCutEff  zjets \"qcd*\" ttbar wjets \"znunu*\" md2d2   sum data \"met*\"" << endl;
+		cerr << "   reads sample_AnaMonoJetCutEff_cut.root, writes AnaMonoJetCutEff_cut_level.root (sum of the first level+1 samples) and data_cut.root" << endl;
+		cerr << "   cuts \"-\" reads sample_analysis.root and writes output_level.root or output.root" << endl;
+		return 1;
+	}
+
+	string analysis = argv[1];
+	string cuts     = argv[2];
+	int nThreads    = atoi(argv[3]);
+
+	int firstCut = 0, lastCut = 0;
+	bool withCut = cuts != "-";
+	if ( withCut && sscanf(cuts.c_str(), "%d-%d", &firstCut, &lastCut) < 2 ) lastCut = firstCut;
+
+	vector<Output> outputs;
+	for (int i=4; i<argc; i++) 
+	{
+		string arg = argv[i];
+		if ( (arg == "stack" || arg == "sum") && i+1 < argc )
+		{
+			Output output;
+			output.stack = arg == "stack";
+			output.name  = argv[++i];
+			outputs.push_back(output);
+		}
+		else if ( !outputs.empty() ) outputs.back().samples.push_back(arg);
+		else
+		{
+			cerr << "Expected stack or sum before " << arg << endl;
+			return 1;
+		}
+	}
+
+	HistMerger merger(nThreads);
+	bool ok = true;
+
+	for (int cut=firstCut; cut<=lastCut; cut++) 
+	{
+		char suffix[64] = "";
+		if ( withCut ) sprintf(suffix, "_%d", cut);
+
+		for (size_t o=0; o<outputs.size(); o++) 
+		{
+			merger.clear();
+			for (size_t s=0; s<outputs[o].samples.size(); s++) 
+				ok = merger.addGroup(outputs[o].samples[s] + "_" + analysis + suffix + ".root") && ok;
+
+			string output = outputs[o].name + suffix;
+			cout << "Writing " << output << (outputs[o].stack ? "_*.root" : ".root") << endl;
+			if ( outputs[o].stack ) ok = merger.writeStacks(output) && ok;
+			else                    ok = merger.writeSum(output + ".root") && ok;
+		}
+	}
+
+	return ok ? 0 : 1;
+
+} // end of main function
@@ -0,0 +1,192 @@
+#include "HistMerger.h"
+
+#include <TROOT.h>
+#include <TKey.h>
+#include <TDirectory.h>
+#include <TThread.h>
+
+#include <glob.h>
+#include <thread>
+#include <atomic>
+#include <set>
+
+using namespace std;
+
+HistMerger::HistMerger(int nThreads) : mNThreads(nThreads < 1 ? 1 : nThreads) 
+{
+  TH1::AddDirectory(kFALSE);
+  if ( mNThreads > 1 ) TThread::Initialize();
+}
+
+HistMerger::~HistMerger() 
+{
+  clear();
+}
+
+void HistMerger::clear()
+{
+  for(size_t g=0; g<mGroups.size(); g++) remove(mGroups[g]);
+  mGroups.clear();
+}
+
+bool HistMerger::addGroup(const string & pattern)
+{
+  vector<string> files;
+  glob_t found;
+  if ( glob(pattern.c_str(), 0, 0, &found) == 0 )
+    for(size_t i=0; i<found.gl_pathc; i++) files.push_back(found.gl_pathv[i]);
+  globfree(&found);
+
+  if ( files.empty() ) {
+    // keep an empty group, so the stack levels still follow the order of the groups
+    cerr << "HistMerger: no file matches " << pattern << endl;
+    mGroups.push_back(Histos());
+    return false;
+  }
+
+  vector<Histos> parts(files.size());
+  vector<char> ok(files.size(), 1);
+  parallel(files.size(), [&](size_t i){ ok[i] = readFile(files[i], parts[i]); });
+
+  for(size_t i=0; i<files.size(); i++)
+    if ( !ok[i] ) cerr << "HistMerger: can not read " << files[i] << endl;
+
+  reduce(parts);
+  mGroups.push_back(parts[0]);
+  return true;
+}
+
+bool HistMerger::writeSum(const string & fileName)
+{
+  if ( mGroups.empty() ) return false;
+
+  vector<Histos> parts(mGroups.size());
+  for(size_t g=0; g<mGroups.size(); g++) add(parts[g], mGroups[g]);
+  reduce(parts);
+
+  bool ok = write(fileName, parts[0]);
+  remove(parts[0]);
+  return ok;
+}
+
+bool HistMerger::writeStacks(const string & prefix)
+{
+  bool ok = true;
+  Histos stack;
+  for(size_t g=0; g<mGroups.size(); g++) {
+    add(stack, mGroups[g]);
+    char fileName[1024];
+    sprintf(fileName, "%s_%d.root", prefix.c_str(), (int) g);
+    ok = write(fileName, stack) && ok;
+  }
+  remove(stack);
+  return ok;
+}
+
+void HistMerger::parallel(size_t n, const function<void(size_t)> & job)
+{
+  size_t nThreads = (size_t) mNThreads < n ? mNThreads : n;
+  if ( nThreads <= 1 ) {
+    for(size_t i=0; i<n; i++) job(i);
+    return;
+  }
+
+  atomic<size_t> next(0);
+  vector<thread> threads;
+  for(size_t t=0; t<nThreads; t++)
+    threads.push_back( thread( [&](){ for(size_t i=next++; i<n; i=next++) job(i); } ) );
+  for(size_t t=0; t<nThreads; t++) threads[t].join();
+}
+
+void HistMerger::reduce(vector<Histos> & parts)
+{
+  for(size_t step=1; step<parts.size(); step*=2) {
+    size_t nPairs = (parts.size() + 2*step - 1) / (2*step);
+    parallel(nPairs, [&](size_t k){
+	size_t i = 2*step*k;
+	if ( i+step >= parts.size() ) return;
+	add(parts[i], parts[i+step]);
+	remove(parts[i+step]);
+      });
+  }
+}
+
+bool HistMerger::readFile(const string & fileName, Histos & histos)
+{
+  TFile * file = TFile::Open(fileName.c_str());
+  if ( !file || file->IsZombie() ) {
+    delete file;
+    return false;
+  }
+  readDir(file, "", histos);
+  file->Close();
+  delete file;
+  return true;
+}
+
+void HistMerger::readDir(TDirectory * dir, const string & path, Histos & histos)
+{
+  TIter next(dir->GetListOfKeys());
+  TKey * key;
+  set<string> seen;
+  while ( (key = (TKey*) next()) ) {
+    // only the highest cycle of each name, it comes first
+    if ( !seen.insert(key->GetName()).second ) continue;
+
+    TObject * obj = key->ReadObj();
+    if ( obj->InheritsFrom(TDirectory::Class()) ) {
+      readDir((TDirectory*) obj, path + key->GetName() + "/", histos);
+    }
+    else if ( obj->InheritsFrom(TH1::Class()) ) {
+      ((TH1*) obj)->SetDirectory(0);
+      histos[path + key->GetName()] = (TH1*) obj;
+      continue;
+    }
+    delete obj;
+  }
+}
+
+void HistMerger::add(Histos & to, const Histos & from)
+{
+  for(Histos::const_iterator i=from.begin(); i!=from.end(); ++i) {
+    Histos::iterator j = to.find(i->first);
+    if ( j == to.end() ) {
+      TH1 * h = (TH1*) i->second->Clone();
+      h->SetDirectory(0);
+      to[i->first] = h;
+    }
+    else j->second->Add(i->second);
+  }
+}
+
+void HistMerger::remove(Histos & histos)
+{
+  for(Histos::iterator i=histos.begin(); i!=histos.end(); ++i) delete i->second;
+  histos.clear();
+}
+
+bool HistMerger::write(const string & fileName, const Histos & histos)
+{
+  TFile * file = new TFile(fileName.c_str(), "recreate");
+  if ( file->IsZombie() ) {
+    cerr << "HistMerger: can not write " << fileName << endl;
+    delete file;
+    return false;
+  }
+
+  for(Histos::const_iterator i=histos.begin(); i!=histos.end(); ++i) {
+    TDirectory * dir = file;
+    size_t begin = 0, slash;
+    while ( (slash = i->first.find('/', begin)) != string::npos ) {
+      string name = i->first.substr(begin, slash-begin);
+      TDirectory * sub = dir->GetDirectory(name.c_str());
+      dir = sub ? sub : dir->mkdir(name.c_str());
+      begin = slash+1;
+    }
+    dir->WriteTObject(i->second, i->first.substr(begin).c_str());
+  }
+
+  file->Close();
+  delete file;
+  return true;
+}
@@ -0,0 +1,66 @@
+#ifndef HistMerger_h
+#define HistMerger_h
+
+#include <iostream>
+#include <string>
+#include <vector>
+#include <map>
+#include <functional>
+#include <TFile.h>
+#include <TH1.h>
+
+// Adds up the histograms of groups of files in memory. Every input file is read once,
+// on several threads, and the sums and cumulative stacks of the groups are written from memory
+class HistMerger 
+{
+
+public:
+
+  HistMerger(int nThreads = 1);
+  ~HistMerger();
+
+  /**
+   * \brief Reads the histograms of the files matching pattern (shell wildcards) as one group, returns false if nothing was read
+   */
+  bool addGroup(const std::string & pattern);
+
+  /**
+   * \brief Writes the sum of all the groups in fileName
+   */
+  bool writeSum(const std::string & fileName);
+
+  /**
+   * \brief Writes prefix_k.root for each group k, holding the sum of the groups 0 to k
+   */
+  bool writeStacks(const std::string & prefix);
+
+  /**
+   * \brief Forgets the groups already added
+   */
+  void clear();
+
+private:
+
+  // histograms of a file or a sum of files, keyed by their path in the file
+  typedef std::map<std::string, TH1*> Histos;
+
+  static bool readFile(const std::string & fileName, Histos & histos);
+  static void readDir(TDirectory * dir, const std::string & path, Histos & histos);
+  static void add(Histos & to, const Histos & from);
+  static void remove(Histos & histos);
+  static bool write(const std::string & fileName, const Histos & histos);
+
+  // runs job(0) ... job(n-1) on the threads
+  void parallel(size_t n, const std::function<void(size_t)> & job);
+
+  // sums parts into parts[0], pairwise on the threads
+  void reduce(std::vector<Histos> & parts);
+
+  int mNThreads;
+  std::vector<Histos> mGroups;
+
+};
+
+#include "HistMerger.cc"
+
+#endif
@@ -41,6 +41,29 @@ using namespace Constants;
 
 namespace Histogram01 
 {
+  ///----------------Thread clones-------------------------------------------------------------------------------------------
+  template <class T> void CloneHistos(const map<string,T*> & from, map<string,T*> & to){
+    for(typename map<string,T*>::const_iterator it = from.begin(); it != from.end(); ++it){
+      T* h = (T*) it->second->Clone();
+      h->SetDirectory(0);
+      h->Reset();
+      to[it->first] = h;
+    }
+  }
+  
+  template <class T> void MergeHistos(map<string,T*> & to, map<string,T*> & from){
+    for(typename map<string,T*>::iterator it = to.begin(); it != to.end(); ++it){
+      it->second->Add( from[it->first] );
+    }
+  }
+  
+  template <class T> void DeleteHistos(map<string,T*> & histos){
+    for(typename map<string,T*>::iterator it = histos.begin(); it != histos.end(); ++it){
+      delete it->second;
+    }
+    histos.clear();
+  }
+  
   ///----------------HLT Histograms  Defination--------------------------------------------------------------------------------
   hHLTEff::hHLTEff(const std::string & fileName):
     mFileName(fileName)
@@ -70,10 +93,10 @@ namespace Histogram01
       if(strtrg.find("HLT_MonoCentralPFJet80*")!=string::npos) flg_trg80=1;
       if(flg_trg80==1){
 	histo1D["Jet1Pt_80"]->Fill( ev.PFAK4JetPtCor(ixjet1) ,w );
-	histo1D["MET_80"]->Fill( MetLepPt( ev.MetPx(t) , ev.MetPy(t) , ev ),w );
+	histo1D["MET_80"]->Fill( ev.MetLepPt(t),w );
       }
       histo1D["Jet1Pt_All"]->Fill( ev.PFAK4JetPtCor(ixjet1),w );
-      histo1D["MET_All"]->Fill( MetLepPt( ev.MetPx(t) , ev.MetPy(t) , ev ) ,w );
+      histo1D["MET_All"]->Fill( ev.MetLepPt(t) ,w );
     }
     return true;
   }
@@ -83,7 +106,34 @@ namespace Histogram01
     return ostrm;
   }
   
+  hHLTEff::hHLTEff(const hHLTEff & other):
+    Operation::_Base(), mFileName(other.mFileName), fileOut(0)
+  {
+    CloneHistos(other.histo1D, histo1D);
+    CloneHistos(other.histo2D, histo2D);
+  }
+  
+  Operation::_Base* hHLTEff::Clone(){
+    return new hHLTEff(*this);
+  }
+  
+  Operation::_Base* hHLTEff::CloneVariation(const std::string & variation){
+    return new hHLTEff(Operation::VariationFileName(mFileName, variation));
+  }
+  
+  void hHLTEff::Merge(Operation::_Base * aClone){
+    hHLTEff * clone = dynamic_cast<hHLTEff*>(aClone);
+    if(!clone) return;
+    MergeHistos(histo1D, clone->histo1D);
+    MergeHistos(histo2D, clone->histo2D);
+  }
+  
   hHLTEff::~hHLTEff(){  
+    if(!fileOut){
+      DeleteHistos(histo1D);
+      DeleteHistos(histo2D);
+      return;
+    }
     histo1D["MET_80_Eff"]->Divide( histo1D["MET_80"], histo1D["MET_All"] , 1.0, 1.0 );
     histo1D["Jet1Pt_80_Eff"]->Divide( histo1D["Jet1Pt_80"], histo1D["Jet1Pt_All"] , 1.0, 1.0 ); 
     fileOut->Write();
@@ -636,11 +686,11 @@ namespace Histogram01
     
     
     //deltaPhi
-    histo1D["dPhi_MetLep_Jet1"]->Fill( fabs( deltaPhi( ev.PFAK4JetPhi(ixjet1) , MetLepPhi( ev.MetPx(t) , ev.MetPy(t) ,ev) ) ), w );
+    histo1D["dPhi_MetLep_Jet1"]->Fill( fabs( deltaPhi( ev.PFAK4JetPhi(ixjet1) , ev.MetLepPhi(t) ) ), w );
     histo1D["dPhi_Met_Jet1"]->Fill( fabs( deltaPhi( ev.PFAK4JetPhi(ixjet1) , ev.MetPhi(t) ) ), w );
     
     if(njets>=2){  
-      histo1D["dPhi_MetLep_Jet2"]->Fill(  fabs( deltaPhi( ev.PFAK4JetPhi(ixjet2) , MetLepPhi( ev.MetPx(t) , ev.MetPy(t) ,ev) ) ), w );
+      histo1D["dPhi_MetLep_Jet2"]->Fill(  fabs( deltaPhi( ev.PFAK4JetPhi(ixjet2) , ev.MetLepPhi(t) ) ), w );
       histo1D["dPhi_Met_Jet2"]->Fill(  fabs( deltaPhi( ev.PFAK4JetPhi(ixjet2) , ev.MetPhi(t) ) ) , w );			
       histo1D["dPhi_Jet1_Jet2"]->Fill(  fabs( deltaPhi( ev.PFAK4JetPhi(ixjet1) ,  ev.PFAK4JetPhi(ixjet2) ) ), w );		
       histo1D["dPhi_Jet1_muon"]->Fill(  fabs( deltaPhi( ev.PFAK4JetPhi(ixjet1) ,  ev.PFMuonPhi(0) ) ), w );
@@ -684,15 +734,15 @@ namespace Histogram01
     
     //Met
     histo1D["Met"]->Fill( ev.MetPt( t) , w );
-    histo1D["MetLep1"]->Fill( MetLepPt( ev.MetPx(t) , ev.MetPy(t) , ev ) , w ); 
-    histo1D["MetLep2"]->Fill( MetLepPt( ev.MetPx(t) , ev.MetPy(t) , ev ) , w );
-    histo1D["MetLep5"]->Fill( MetLepPt( ev.MetPx(t) , ev.MetPy(t) , ev ) , w );
-    histo1D["MetLep4"]->Fill( MetLepPt( ev.MetPx(t) , ev.MetPy(t) , ev ) , w );
+    histo1D["MetLep1"]->Fill( ev.MetLepPt(t) , w ); 
+    histo1D["MetLep2"]->Fill( ev.MetLepPt(t) , w );
+    histo1D["MetLep5"]->Fill( ev.MetLepPt(t) , w );
+    histo1D["MetLep4"]->Fill( ev.MetLepPt(t) , w );
     
-    if(ev.MetPt(0) >95. ) histo1D["MetLep1_cm"]->Fill( MetLepPt( ev.MetPx(t) , ev.MetPy(t) , ev ) , w ); 
+    if(ev.MetPt(0) >95. ) histo1D["MetLep1_cm"]->Fill( ev.MetLepPt(t) , w ); 
     
     
-    histo1D["MetLepPhi"]->Fill( fabs( MetLepPhi( ev.MetPx(t) , ev.MetPy(t) , ev) ), w );
+    histo1D["MetLepPhi"]->Fill( fabs( ev.MetLepPhi(t) ), w );
     histo1D["MetPhi"]->Fill(   ev.MetPhi(t)  , w ); 
     
     histo1D["MetSumEt"]->Fill(   ev.MetSumEt(t)  , w ); 
@@ -739,19 +789,19 @@ namespace Histogram01
     //ELectron
     if(ev.NPFElec() >0 )histo1D["PFElecPt"]->Fill( ev.PFElecPt(0)  , w ); 
     
-    if( MetLepPt( ev.MetPx(t) , ev.MetPy(t) , ev ) > 100.  ) histo1D["NJet_met100"]->Fill( njets , w );  
-    if( MetLepPt( ev.MetPx(t) , ev.MetPy(t) , ev ) > 150.  ) histo1D["NJet_met150"]->Fill( njets , w );  
-    if( MetLepPt( ev.MetPx(t) , ev.MetPy(t) , ev ) > 200.  ) histo1D["NJet_met200"]->Fill( njets , w );  
-    if( MetLepPt( ev.MetPx(t) , ev.MetPy(t) , ev ) > 250.  ) histo1D["NJet_met250"]->Fill( njets , w );  
+    if( ev.MetLepPt(t) > 100.  ) histo1D["NJet_met100"]->Fill( njets , w );  
+    if( ev.MetLepPt(t) > 150.  ) histo1D["NJet_met150"]->Fill( njets , w );  
+    if( ev.MetLepPt(t) > 200.  ) histo1D["NJet_met200"]->Fill( njets , w );  
+    if( ev.MetLepPt(t) > 250.  ) histo1D["NJet_met250"]->Fill( njets , w );  
     
-    if(MetLepPt( ev.MetPx(t) , ev.MetPy(t) , ev ) > 150. && MetLepPt( ev.MetPx(t) , ev.MetPy(t) , ev ) < 200.){
+    if(ev.MetLepPt(t) > 150. && ev.MetLepPt(t) < 200.){
 	histo1D["PFAK4JetChaHadEngFrac150"]->Fill( ev.PFAK4JetChaHadEngFrac(ixjet1) , w );
 	histo1D["PFAK4JetNeuHadEngFrac150"]->Fill( ev.PFAK4JetNeuHadEngFrac(ixjet1) , w );
 	histo1D["PFAK4JetChaEmEngFrac150"]->Fill( ev.PFAK4JetChaEmEngFrac(ixjet1) , w );
 	histo1D["PFAK4JetNeuEmEngFrac150"]->Fill( ev.PFAK4JetNeuEmEngFrac(ixjet1) , w ); 
     }
     
-    if(MetLepPt( ev.MetPx(t) , ev.MetPy(t) , ev ) > 300.){
+    if(ev.MetLepPt(t) > 300.){
       histo1D["PFAK4JetChaHadEngFrac300"]->Fill( ev.PFAK4JetChaHadEngFrac(ixjet1) , w );
       histo1D["PFAK4JetNeuHadEngFrac300"]->Fill( ev.PFAK4JetNeuHadEngFrac(ixjet1) , w );
       histo1D["PFAK4JetChaEmEngFrac300"]->Fill( ev.PFAK4JetChaEmEngFrac(ixjet1) , w );
@@ -787,12 +837,12 @@ namespace Histogram01
 	histo1D["GenZPt"]->Fill( ev.GenParPt(i), w );
 	histo2D["GenJet1ptvsZpt"]->Fill( ev.GenAK4JetPt(0), ev.GenParPt(i), w );
 	histo2D["RecJet1ptvsZpt"]->Fill( ev.PFAK4JetPtCor(ixjet1), ev.GenParPt(i), w );
-	histo2D["METmuvsZpt"]->Fill( MetLepPt( ev.MetPx(t) , ev.MetPy(t) , ev ), ev.GenParPt(i), w );   
-	histo1D["METoverZpt"]->Fill( MetLepPt( ev.MetPx(t) , ev.MetPy(t) , ev )/ ev.GenParPt(i), w ); 
+	histo2D["METmuvsZpt"]->Fill( ev.MetLepPt(t), ev.GenParPt(i), w );   
+	histo1D["METoverZpt"]->Fill( ev.MetLepPt(t)/ ev.GenParPt(i), w ); 
       }
-      if( abs(ev.GenParId(i) )==11 && ev.GenParStatus(i)==3 )  histo1D["Met_Wenu"]->Fill( MetLepPt( ev.MetPx(t) , ev.MetPy(t) , ev ) ,w );
-      if( abs(ev.GenParId(i) )==13 && ev.GenParStatus(i)==3 )  histo1D["Met_Wmnu"]->Fill( MetLepPt( ev.MetPx(t) , ev.MetPy(t) , ev ) ,w );
-      if( abs(ev.GenParId(i) )==15 && ev.GenParStatus(i)==3 )  histo1D["Met_Wtnu"]->Fill( MetLepPt( ev.MetPx(t) , ev.MetPy(t) , ev ) ,w );
+      if( abs(ev.GenParId(i) )==11 && ev.GenParStatus(i)==3 )  histo1D["Met_Wenu"]->Fill( ev.MetLepPt(t) ,w );
+      if( abs(ev.GenParId(i) )==13 && ev.GenParStatus(i)==3 )  histo1D["Met_Wmnu"]->Fill( ev.MetLepPt(t) ,w );
+      if( abs(ev.GenParId(i) )==15 && ev.GenParStatus(i)==3 )  histo1D["Met_Wtnu"]->Fill( ev.MetLepPt(t) ,w );
     }
     
     /*for(int i=0; i<ev.NGenPar(); i++)
@@ -813,43 +863,33 @@ namespace Histogram01
       }*/
     
     
-    /*
-      
-    for(int i=0; i<45; i++ )
-    {
-    char his[100];
-    sprintf(his,"PDF%d", i);
-    
-    //double w = ev.PDFWeight(i) * ev.PDFWeights(0) / ev.PDFWeight(0);
-    //if(ev.PDFWeight(0) >0) histo1D[his]->Fill( 5 , w );
-    
-    histo1D[his]->Fill( 5 , ev.PDFWeight(i) );
-    
-    //histo1D["nnpdf20"]->Fill(w);
-    //double delta= ( ev.PDFWeight(i) * ev.PDFWeights(0) / ev.PDFWeight(0) ) - ev.PDFWeights(0); 
-    //if (delta>0)   histo1D["nnpdf20_p"]->Fill(delta);
-    //else           histo1D["nnpdf20_m"]->Fill(delta);
-    }
-    
-    
-    if(ev.PDFWeight(0)>0)
-    {
-    
-    //use these ones if  you used  CTEQ  for  alphaS  uncert..
-    histo1D["alphas_m"]->Fill( 5 , ev.PDFWeightAlphaS(1) * ev.PDFWeights(0) / ev.PDFWeight(0) );
-    histo1D["alphas"]->Fill( 5 , ev.PDFWeightAlphaS(2) * ev.PDFWeights(0) / ev.PDFWeight(0) );
-    histo1D["alphas_p"]->Fill( 5 , ev.PDFWeightAlphaS(3) * ev.PDFWeights(0) / ev.PDFWeight(0) );
-    
-    //use these ones if you used  MSTW  for  alphaS  uncert..
-    //histo1D["alphas_m"]->Fill( 5 , ev.PDFWeightAlphaSmstw(0) * ev.PDFWeights(0) / ev.PDFWeight(0) );
-    //histo1D["alphas"]->Fill( 5 , ev.PDFWeights(0) );
-    //histo1D["alphas_p"]->Fill( 5 , ev.PDFWeightAlphaSmstw(1) * ev.PDFWeights(0) / ev.PDFWeight(0) );
-    
-    //for now  there is no  nnpdf  alphas  uncert
-    
+    // PDF systematics, when EventData::SetPDFSets was called. All the members
+    // come from a single evaluation per event
+    if ( ev.HasPDFSets() )
+      {
+	const vector<double> & pdf = ev.PDFWeightVector();
+	for(size_t i=0; i<pdf.size() && i<100; i++ )
+	  {
+	    char his[100];
+	    sprintf(his,"PDF%d", (int) i);
+	    histo1D[his]->Fill( 5 , pdf[i] );
+	  }
+	
+	if( !pdf.empty() && pdf[0]>0 )
+	  {
+	    //use these ones if  you used  CTEQ  for  alphaS  uncert..
+	    histo1D["alphas_m"]->Fill( 5 , ev.PDFWeightAlphaS(1) * ev.PDFWeights(0) / pdf[0] );
+	    histo1D["alphas"]->Fill( 5 , ev.PDFWeightAlphaS(2) * ev.PDFWeights(0) / pdf[0] );
+	    histo1D["alphas_p"]->Fill( 5 , ev.PDFWeightAlphaS(3) * ev.PDFWeights(0) / pdf[0] );
+	    
+	    //use these ones if you used  MSTW  for  alphaS  uncert..
+	    //histo1D["alphas_m"]->Fill( 5 , ev.PDFWeightAlphaSmstw(0) * ev.PDFWeights(0) / pdf[0] );
+	    //histo1D["alphas"]->Fill( 5 , ev.PDFWeights(0) );
+	    //histo1D["alphas_p"]->Fill( 5 , ev.PDFWeightAlphaSmstw(1) * ev.PDFWeights(0) / pdf[0] );
+	  }
+      }
     
-    } 
-       
+    /*
     for(int i=0; i<ev.NGenPar(); i++)
     {
     histo1D["GravitonPt"]->Fill( ev.GenParPt(i), w );
@@ -922,7 +962,38 @@ namespace Histogram01
     return ostrm;
   }
   
+  hDataMcMatching::hDataMcMatching(const hDataMcMatching & other):
+    Operation::_Base(), mFileName(other.mFileName), fileOut(0)
+  {
+    CloneHistos(other.histo1D, histo1D);
+    CloneHistos(other.histo2D, histo2D);
+    CloneHistos(other.profile1D, profile1D);
+  }
+  
+  Operation::_Base* hDataMcMatching::Clone(){
+    return new hDataMcMatching(*this);
+  }
+  
+  Operation::_Base* hDataMcMatching::CloneVariation(const std::string & variation){
+    return new hDataMcMatching(Operation::VariationFileName(mFileName, variation));
+  }
+  
+  void hDataMcMatching::Merge(Operation::_Base * aClone){
+    hDataMcMatching * clone = dynamic_cast<hDataMcMatching*>(aClone);
+    if(!clone) return;
+    MergeHistos(histo1D, clone->histo1D);
+    MergeHistos(histo2D, clone->histo2D);
+    MergeHistos(profile1D, clone->profile1D);
+  }
+  
   hDataMcMatching::~hDataMcMatching(){  
+    if(!fileOut){
+      DeleteHistos(histo1D);
+      DeleteHistos(histo2D);
+      DeleteHistos(profile1D);
+      return;
+    }
+    
     double a1=0, a2=0;
     for(int i=41; i>0; i--){		
       
@@ -1136,7 +1207,7 @@ namespace Histogram01
       w *= leptonWeight;
     }
     
-    histo1D["MetLep1"]->Fill(MetLepPt(ev.MetPx(t), ev.MetPy(t), ev), w);  
+    histo1D["MetLep1"]->Fill(ev.MetLepPt(t), w);  
 
     histo1D["CountEventLHE"]->Fill(1);
     histo1D["CountEventLHEWeight"]->Fill(w); 
@@ -1174,24 +1245,24 @@ namespace Histogram01
     if( Zmumu && dimuon.M() > 60. && dimuon.M() < 120. ) mumu_60_120 = true;
     if( GenMass > 60. && GenMass < 120. ) mass_60_120 = true;
     
-    if(GenPt>0 && MetLepPt(ev.MetPx(ev.MetType()), ev.MetPy(ev.MetType()),ev)>0){
-      histo2D["MetGen2D"]->Fill(MetLepPt(ev.MetPx(ev.MetType()), ev.MetPy(ev.MetType()),ev), GenPt, w);
-      histo1D["MetGenRatio"]->Fill(MetLepPt(ev.MetPx(ev.MetType()), ev.MetPy(ev.MetType()),ev)/GenPt,w);
-      histo1D["GenMetRatio"]->Fill(GenPt/MetLepPt(ev.MetPx(ev.MetType()), ev.MetPy(ev.MetType()),ev),w);
+    if(GenPt>0 && ev.MetLepPt(ev.MetType())>0){
+      histo2D["MetGen2D"]->Fill(ev.MetLepPt(ev.MetType()), GenPt, w);
+      histo1D["MetGenRatio"]->Fill(ev.MetLepPt(ev.MetType())/GenPt,w);
+      histo1D["GenMetRatio"]->Fill(GenPt/ev.MetLepPt(ev.MetType()),w);
     }
     
     //For Z(mumu)
-    if( Zmumu && MetLepPt(ev.MetPx(ev.MetType()), ev.MetPy(ev.MetType()),ev)>0){
-      histo2D["MetGenZmumu2D"]->Fill(MetLepPt(ev.MetPx(ev.MetType()), ev.MetPy(ev.MetType()),ev), GenPt , w);
-      histo1D["MetGenZmumuRatio"]->Fill(MetLepPt(ev.MetPx(ev.MetType()), ev.MetPy(ev.MetType()),ev)/(GenPt),w);
-      histo1D["GenMetZmumuRatio"]->Fill(GenPt/MetLepPt(ev.MetPx(ev.MetType()), ev.MetPy(ev.MetType()),ev),w);
+    if( Zmumu && ev.MetLepPt(ev.MetType())>0){
+      histo2D["MetGenZmumu2D"]->Fill(ev.MetLepPt(ev.MetType()), GenPt , w);
+      histo1D["MetGenZmumuRatio"]->Fill(ev.MetLepPt(ev.MetType())/(GenPt),w);
+      histo1D["GenMetZmumuRatio"]->Fill(GenPt/ev.MetLepPt(ev.MetType()),w);
     }
     
     //For Z(mumu) where Z mass: 60-120
-    if( mumu_60_120 && MetLepPt(ev.MetPx(ev.MetType()), ev.MetPy(ev.MetType()),ev)>0){
-      histo2D["MetGenZmumu_60_120_2D"]->Fill(MetLepPt(ev.MetPx(ev.MetType()), ev.MetPy(ev.MetType()),ev), GenPt , w);
-      histo1D["MetGenZmumu_60_120_Ratio"]->Fill(MetLepPt(ev.MetPx(ev.MetType()), ev.MetPy(ev.MetType()),ev)/(GenPt),w);
-      histo1D["GenMetZmumu_60_120_Ratio"]->Fill(GenPt/MetLepPt(ev.MetPx(ev.MetType()), ev.MetPy(ev.MetType()),ev),w);
+    if( mumu_60_120 && ev.MetLepPt(ev.MetType())>0){
+      histo2D["MetGenZmumu_60_120_2D"]->Fill(ev.MetLepPt(ev.MetType()), GenPt , w);
+      histo1D["MetGenZmumu_60_120_Ratio"]->Fill(ev.MetLepPt(ev.MetType())/(GenPt),w);
+      histo1D["GenMetZmumu_60_120_Ratio"]->Fill(GenPt/ev.MetLepPt(ev.MetType()),w);
     }
     
     //For R ratio
@@ -1199,8 +1270,8 @@ namespace Histogram01
       histo1D["GenZMass_60_120"] -> Fill( GenMass );
     }
 
-    double dPhi1= fabs( deltaPhi( ev.PFAK4JetPhi(ixjet1), MetLepPhi( ev.MetPx(t) , ev.MetPy(t) , ev ) ) );
-    double dPhi2= fabs( deltaPhi( ev.PFAK4JetPhi(ixjet2), MetLepPhi( ev.MetPx(t) , ev.MetPy(t) , ev ) ) ); 
+    double dPhi1= fabs( deltaPhi( ev.PFAK4JetPhi(ixjet1), ev.MetLepPhi(t) ) );
+    double dPhi2= fabs( deltaPhi( ev.PFAK4JetPhi(ixjet2), ev.MetLepPhi(t) ) ); 
     
     if(njets==2){
       histo1D["dPhiJ1J2"]->Fill( deltaPhi( ev.PFAK4JetPhi(ixjet1) , ev.PFAK4JetPhi(ixjet2)  ) , w );
@@ -1208,17 +1279,13 @@ namespace Histogram01
     }
     
     Int_t IsoLepIndex=0;	
-    Int_t isoLepPseq[20];
-    Int_t isoLepMseq[20];
+    vector<Int_t> isoLepPseq(ev.NPFLep(), 0);
+    vector<Int_t> isoLepMseq(ev.NPFLep(), 0);
     Int_t isoLepPnum=0;
     Int_t isoLepMnum=0;
     bool  checkAdditional1stLooseLepton = false;
     bool  checkAdditional2ndLooseLepton = false;
     
-    for (int i=0; i<20; i++){
-      isoLepPseq[i]=0; isoLepMseq[i]=0;
-    }
-    
     //---------- IsoMuon index counting for Zmumu---------------------------- 
     bool check2=true;
     for(int i=0; i<ev.NPFLep(); i++ ){
@@ -1259,14 +1326,14 @@ namespace Histogram01
     histo1D["NofLep2"]->Fill(ev.NPFMuon() , w ); 
 
     //
-    if(GenPt>0 && MetLepPt(ev.MetPx(ev.MetType()), ev.MetPy(ev.MetType()),ev)>0){
+    if(GenPt>0 && ev.MetLepPt(ev.MetType())>0){
       if(isoLepPnum==1 && isoLepMnum==1){
-	histo1D["MetGenRatio2Muons"]->Fill(MetLepPt(ev.MetPx(ev.MetType()), ev.MetPy(ev.MetType()),ev)/GenPt,w);
-	histo1D["GenMetRatio2Muons"]->Fill(GenPt/MetLepPt(ev.MetPx(ev.MetType()), ev.MetPy(ev.MetType()),ev),w);
+	histo1D["MetGenRatio2Muons"]->Fill(ev.MetLepPt(ev.MetType())/GenPt,w);
+	histo1D["GenMetRatio2Muons"]->Fill(GenPt/ev.MetLepPt(ev.MetType()),w);
       }
       else{
-	histo1D["MetGenRatioNot2Muons"]->Fill(MetLepPt(ev.MetPx(ev.MetType()), ev.MetPy(ev.MetType()),ev)/GenPt,w);
-	histo1D["GenMetRatioNot2Muons"]->Fill(GenPt/MetLepPt(ev.MetPx(ev.MetType()), ev.MetPy(ev.MetType()),ev),w);
+	histo1D["MetGenRatioNot2Muons"]->Fill(ev.MetLepPt(ev.MetType())/GenPt,w);
+	histo1D["GenMetRatioNot2Muons"]->Fill(GenPt/ev.MetLepPt(ev.MetType()),w);
       }
     }
 
@@ -1463,9 +1530,9 @@ namespace Histogram01
 	histo1D["ZleplepPFMET"]->Fill( ev.MetPt(t), w );
       
 	//robyn added: for reco mu+ mu- with m_inv 60-120 TT or TL 
-	histo2D["MetGen_reco_2D"]->Fill(MetLepPt(ev.MetPx(ev.MetType()), ev.MetPy(ev.MetType()),ev), GenPt , w);
-	histo1D["MetGen_reco_Ratio"]->Fill(MetLepPt(ev.MetPx(ev.MetType()), ev.MetPy(ev.MetType()),ev)/(GenPt),w);
-	histo1D["GenMet_reco_Ratio"]->Fill(GenPt/MetLepPt(ev.MetPx(ev.MetType()), ev.MetPy(ev.MetType()),ev),w);
+	histo2D["MetGen_reco_2D"]->Fill(ev.MetLepPt(ev.MetType()), GenPt , w);
+	histo1D["MetGen_reco_Ratio"]->Fill(ev.MetLepPt(ev.MetType())/(GenPt),w);
+	histo1D["GenMet_reco_Ratio"]->Fill(GenPt/ev.MetLepPt(ev.MetType()),w);
 	
       }
     }  
@@ -22,6 +22,11 @@ namespace Histogram01
 {
   
 	void  OutputEPS( map<string,TH1D*> histos_ , string dirName);
+	
+	// Helpers for the thread clones of the histogrammers
+	template <class T> void CloneHistos(const map<string,T*> & from, map<string,T*> & to);
+	template <class T> void MergeHistos(map<string,T*> & to, map<string,T*> & from);
+	template <class T> void DeleteHistos(map<string,T*> & histos);
 
 	class hHLTEff : public Operation::_Base 
 	{
@@ -31,8 +36,15 @@ namespace Histogram01
 			bool Process(EventData & ev);
 
 			std::ostream& Description(std::ostream& ostrm);
+			
+			Operation::_Base* Clone();
+			Operation::_Base* CloneVariation(const std::string & variation);
+			void Merge(Operation::_Base * aClone);
 
 		private:
+			// In-memory copy for a worker thread, no output file
+			hHLTEff(const hHLTEff & other);
+			
 			const std::string mFileName;
 
 			// Output file
@@ -55,8 +67,15 @@ namespace Histogram01
 			bool Process(EventData & ev);
 
 			std::ostream& Description(std::ostream& ostrm);
+			
+			Operation::_Base* Clone();
+			Operation::_Base* CloneVariation(const std::string & variation);
+			void Merge(Operation::_Base * aClone);
 
 		private:
+			// In-memory copy for a worker thread, no output file
+			hDataMcMatching(const hDataMcMatching & other);
+			
 			const std::string mFileName;
 
 			// Output file
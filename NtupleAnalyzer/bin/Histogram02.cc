@@ -61,8 +61,8 @@ namespace Histogram02
     }
     
     histo1D["Met"]->Fill(ev.MetPt(t));
-    histo1D["MetNoAllMuons"]->Fill(MetLepPt(ev.MetPx(t), ev.MetPy(t), ev), w);
-    histo1D["MetNoAllTightMuons"]->Fill(MetTightLepPt(ev.MetPx(t), ev.MetPy(t), ev), w);
+    histo1D["MetNoAllMuons"]->Fill(ev.MetLepPt(t), w);
+    histo1D["MetNoAllTightMuons"]->Fill(ev.MetTightLepPt(t), w);
     
     Int_t countTightIsoMuon = 0;
     Int_t IndexTightIsoMuon[2] = {-99,-99};
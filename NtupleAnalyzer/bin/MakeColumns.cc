@@ -0,0 +1,39 @@
+////////////////////////////////////////////////////////////////////////////
+//            Column cache of an ntuple for repeated analysis passes      //
+////////////////////////////////////////////////////////////////////////////
+
+#include "EventData.h"
+#include "Operation.h"
+
+// std includes
+#include <string>
+#include <iostream>
+
+using namespace std;
+
+int main(int argc, char ** argv)
+{
+  if(argc < 4){
+    cerr << "Program need more than this parameter " << endl;
+    cerr << "Example:   MakeColumns  sampleName(ex:wjets or met or ...)   isMC(0 or 1)   folder(ex:/tmp/columns)   [maxEvents]" << endl;
+    cerr << "The analysis programs then run on the cache with sampleName = col:folder/sampleName" << endl;
+    return 1;
+  }
+  
+  int  isMC;
+  sscanf(argv[2], "%d", &isMC);
+  
+  int nev = 1000000000;
+  if ( argc >= 5 ) sscanf ( argv[4], "%d", &nev );
+  
+  string dir = argv[3];
+  dir += "/";
+  dir += argv[1];
+  
+  cout << "Writing the columns of " << argv[1] << " in " << dir << endl;
+  
+  EventData ev(argv[1], nev, isMC);
+  if ( !ev.WriteColumns(dir) ) return 1;
+  
+  return 0;
+}
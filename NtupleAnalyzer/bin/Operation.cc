@@ -3,12 +3,15 @@
 #include "Histogram02.h"
 #include <iostream>
 #include <fstream>
+#include <sstream>
+#include <chrono>
 
 #include <TH1D.h>
 #include <math.h>
 #include <TLorentzVector.h>
 
 #include <memory>
+#include <algorithm>
 
 #include "DataFormats/Math/interface/deltaR.h"
 #include "DataFormats/Math/interface/deltaPhi.h"
@@ -92,6 +95,16 @@ namespace Operation
   }
   
   
+  /// ----------------------------------------------
+  /// Output name of a systematic variation, ex: out_3.root -> out_3_JESUp.root
+  std::string VariationFileName(const std::string & fileName, const std::string & variation){
+    size_t dot = fileName.rfind('.');
+    size_t slash = fileName.rfind('/');
+    if ( dot==std::string::npos || (slash!=std::string::npos && dot<slash) ) return fileName + "_" + variation;
+    return fileName.substr(0, dot) + "_" + variation + fileName.substr(dot);
+  }
+  
+  
   /// ----------------------------------------------
   /// PFMuon Tight Selection
   bool PFMuonTightCuts(EventData& ev , int i, double pt, double eta){
@@ -439,10 +452,10 @@ namespace Operation
   /// PFLepton Tight Selection 
   bool PFLepTightCuts(EventData& ev , int i, double pt, double eta){
     bool send=false;
-    if(ev.LepType()=="m" ){
+    if(ev.LepType()==EventData::LepMuon){
       send = PFMuonTightCuts( ev , i, pt, eta);  
     }
-    else if(ev.LepType()=="e"){
+    else if(ev.LepType()==EventData::LepElec){
       send = PFElecTightCuts( ev , i, pt,eta);
     }
     return send;
@@ -453,10 +466,10 @@ namespace Operation
   /// PFLepton Loose Selection 
   bool PFLepLooseCuts(EventData& ev , int i, double pt, double eta){
     bool send=false;
-    if(ev.LepType()=="m" ){
+    if(ev.LepType()==EventData::LepMuon){
       send = PFMuonLooseCuts( ev , i, pt, eta);  
     }
-    else if(ev.LepType()=="e"){
+    else if(ev.LepType()==EventData::LepElec){
       send = PFElecVetoCuts( ev , i, pt,eta);
     }
     return send;
@@ -537,13 +550,8 @@ namespace Operation
     double Metx = MetPx;
     double Mety = MetPy;
     if( ev.MetType()>9){  // pf or tc Met
-      for(int i=0; i<ev.NPFLep(); i++ ){
-	//if( PFLepTightCuts(ev ,i ) )
-	//{
-	Metx =  Metx + ev.PFLepPx(i);
-	Mety =  Mety + ev.PFLepPy(i);
-	//}
-      }
+      Metx =  Metx + ev.PFLepSumPx();
+      Mety =  Mety + ev.PFLepSumPy();
     }	
     return sqrt( Metx*Metx + Mety*Mety );
   }
@@ -555,12 +563,8 @@ namespace Operation
     double Metx = MetPx;
     double Mety = MetPy;
     if( ev.MetType()>9){  // pf or tc Met
-      for(int i=0; i<ev.NPFLep(); i++ ){
-	if( PFLepTightCuts(ev ,i, 20, 2.1) ){
-	  Metx =  Metx + ev.PFLepPx(i);
-	  Mety =  Mety + ev.PFLepPy(i);
-	}
-      }
+      Metx =  Metx + ev.PFTightLepSumPx();
+      Mety =  Mety + ev.PFTightLepSumPy();
     }	
     return sqrt( Metx*Metx + Mety*Mety );
   }
@@ -572,13 +576,8 @@ namespace Operation
     double Metx = MetPx;
     double Mety = MetPy;
     if( ev.MetType()>9){  // pf or tc Met 
-      for(int i=0; i<ev.NPFLep(); i++ ){
-	//if( PFLepTightCuts(ev ,i) )
-	//{  
-	Metx =  Metx + ev.PFLepPx(i);
-	Mety =  Mety + ev.PFLepPy(i);
-	//}
-      }
+      Metx =  Metx + ev.PFLepSumPx();
+      Mety =  Mety + ev.PFLepSumPy();
     }
     return atan2( Mety,Metx);  
   }
@@ -646,113 +645,127 @@ namespace Operation
 
   
   /// ----------------------------------------------
-  /// JetIndex Selection
-  int JetIndex(int ind, EventData & ev){
-    int send= 99;
-    if( ev.JetType()=="calo"){
-      int njets=0;
+  /// JetIndex Selection: indices of all selected jets, leading jet first
+  void FillJetIndex(vector<int> & index, EventData & ev){
+    index.clear();
+    if( ev.JetType()==EventData::JetCalo){
       for (int i=0; i<ev.NCaloAK4Jets(); i++){
 	if( ev.CaloAK4JetPtCor(i)>ev.SecJetCut()){
-	  if(njets==ind)send=i;
-	  njets++ ;
+	  index.push_back(i);
 	}
       }
     }
-    else if(ev.JetType()=="pf" || (ev.JetType()=="widepf" && ind==0)){
-      int njets=0;
-      for (int i=0; i<ev.NPFAK4Jets(); i++){
-	if( ev.PFAK4JetPtCor(i)>ev.SecJetCut() 
-	    && fabs(ev.PFAK4JetEta(i))< 2.5
+    else if(ev.JetType()==EventData::JetPF || ev.JetType()==EventData::JetWidePF){
+      EventData::PFAK4JetView jets = ev.PFAK4Jets();
+      EventData::Span<Double_t> ptcor = jets.PtCor();
+      EventData::Span<Double_t> eta   = jets.Eta();
+      EventData::Span<Double_t> nhf   = jets.NeuHadEngFrac();
+      EventData::Span<Double_t> nef   = jets.NeuEmEngFrac();
+      double secJetCut = ev.SecJetCut();
+      for (int i=0; i<ptcor.size(); i++){
+	if( ptcor[i]>secJetCut 
+	    && fabs(eta[i])< 2.5
 	    //&& LepInJet2(i , ev )==false
 	    //&& JetIso(i, ev)
-	    && ev.PFAK4JetNeuHadEngFrac(i)<0.7
-            && ev.PFAK4JetNeuEmEngFrac(i)<0.9 
+	    && nhf[i]<0.7
+            && nef[i]<0.9 
 	    && JetPuId(i, ev )
 	    //&& ev.PFAK4JetIDLOOSE(i) > 0
 	    ){
-	  if(njets==ind)send=i;
-	  njets++ ;
+	  index.push_back(i);
 	}
       }
     }
-    else if(ev.JetType()=="widepf" && ind>0){
-      int ixjet1 = JetIndex(0, ev);
-      int njets=1;
-      if(ixjet1>=0 && ixjet1<99){
-	TLorentzVector leadJet;
-	TLorentzVector radJet;
-	leadJet.SetPtEtaPhiE(ev.PFAK4JetPtCor(ixjet1), ev.PFAK4JetEta(ixjet1) , ev.PFAK4JetPhi(ixjet1) , ev.PFAK4JetE(ixjet1));
-	for (int i=0; i<ev.NPFAK4Jets(); i++){
-	  if(i<=ixjet1) continue;
-	  radJet.SetPtEtaPhiE(ev.PFAK4JetPtCor(i), ev.PFAK4JetEta(i), ev.PFAK4JetPhi(i), ev.PFAK4JetE(i));
-	  if(ev.PFAK4JetPtCor(i)>30.0 && abs(ev.PFAK4JetEta(i))<2.5 && radJet.DeltaR(leadJet)<1.1){
-	    leadJet+=radJet;
-	    continue;
-	  }
-	  if(ev.PFAK4JetPtCor(i)>ev.SecJetCut() && abs(ev.PFAK4JetEta(i))<4.5 && LepInJet2(i,ev)==false){
-	    if(njets==ind){
-	      send=i;
-	    }
-	    njets++ ;
-	  }
+    
+    // widepf: the jets after the leading one are those outside its wide-jet cone
+    if(ev.JetType()==EventData::JetWidePF && !index.empty()){
+      int ixjet1 = index[0];
+      index.resize(1);
+      TLorentzVector leadJet;
+      TLorentzVector radJet;
+      leadJet.SetPtEtaPhiE(ev.PFAK4JetPtCor(ixjet1), ev.PFAK4JetEta(ixjet1) , ev.PFAK4JetPhi(ixjet1) , ev.PFAK4JetE(ixjet1));
+      for (int i=0; i<ev.NPFAK4Jets(); i++){
+	if(i<=ixjet1) continue;
+	radJet.SetPtEtaPhiE(ev.PFAK4JetPtCor(i), ev.PFAK4JetEta(i), ev.PFAK4JetPhi(i), ev.PFAK4JetE(i));
+	if(ev.PFAK4JetPtCor(i)>30.0 && abs(ev.PFAK4JetEta(i))<2.5 && radJet.DeltaR(leadJet)<1.1){
+	  leadJet+=radJet;
+	  continue;
+	}
+	if(ev.PFAK4JetPtCor(i)>ev.SecJetCut() && abs(ev.PFAK4JetEta(i))<4.5 && LepInJet2(i,ev)==false){
+	  index.push_back(i);
 	}
       }
-      else send = 99;
     }
-    else send = 99;
-    
-    return send; 
+  }
+  
+  int JetIndex(int ind, EventData & ev){
+    EventData::JetCache & cache = ev.Cache();
+    if(!cache.hasJetIndex){
+      FillJetIndex(cache.jetIndex, ev);
+      cache.hasJetIndex = true;
+    }
+    if(ind>=0 && ind<(int)cache.jetIndex.size()) return cache.jetIndex[ind];
+    return 99; 
   } 
 
 
   /// ----------------------------------------------
   /// WideJetIndex Selection
-  int WideJetIndex(int ind, EventData & ev){
-    int send= 99;
-    if(ind==0){
-      send = JetIndex(0, ev);
-    }
-    else{
-      int ixjet1 = JetIndex(0, ev);
-      int njets  = 1;
-      if(ixjet1>=0 && ixjet1<99){
-	TLorentzVector leadJet;
-	TLorentzVector radJet;
-	leadJet.SetPtEtaPhiE(ev.PFAK4JetPtCor(ixjet1), ev.PFAK4JetEta(ixjet1) , ev.PFAK4JetPhi(ixjet1) , ev.PFAK4JetE(ixjet1));
-	for(int i=0; i<ev.NPFAK4Jets(); i++){
-	  if(i==ixjet1) continue;
-	  radJet.SetPtEtaPhiE(ev.PFAK4JetPtCor(i), ev.PFAK4JetEta(i), ev.PFAK4JetPhi(i), ev.PFAK4JetE(i));
-	  if(ev.PFAK4JetPtCor(i)>30.0 && abs(ev.PFAK4JetEta(i))<2.5 && radJet.DeltaR(leadJet)<1.1){
-	    leadJet+=radJet;
-	    continue;
-	  }
-	  if(ev.PFAK4JetPtCor(i)>ev.SecJetCut() && abs(ev.PFAK4JetEta(i))<4.5 && LepInJet2(i,ev)==false){
-	    if(njets==ind){
-	      send=i;
-	      break;
-	    }
-	    njets++ ;
-	  }
-	}
+  void FillWideJetIndex(vector<int> & index, EventData & ev){
+    index.clear();
+    int ixjet1 = JetIndex(0, ev);
+    if(ixjet1<0 || ixjet1>=99) return;
+    
+    index.push_back(ixjet1);
+    TLorentzVector leadJet;
+    TLorentzVector radJet;
+    leadJet.SetPtEtaPhiE(ev.PFAK4JetPtCor(ixjet1), ev.PFAK4JetEta(ixjet1) , ev.PFAK4JetPhi(ixjet1) , ev.PFAK4JetE(ixjet1));
+    for(int i=0; i<ev.NPFAK4Jets(); i++){
+      if(i==ixjet1) continue;
+      radJet.SetPtEtaPhiE(ev.PFAK4JetPtCor(i), ev.PFAK4JetEta(i), ev.PFAK4JetPhi(i), ev.PFAK4JetE(i));
+      if(ev.PFAK4JetPtCor(i)>30.0 && abs(ev.PFAK4JetEta(i))<2.5 && radJet.DeltaR(leadJet)<1.1){
+	leadJet+=radJet;
+	continue;
+      }
+      if(ev.PFAK4JetPtCor(i)>ev.SecJetCut() && abs(ev.PFAK4JetEta(i))<4.5 && LepInJet2(i,ev)==false){
+	index.push_back(i);
       }
-      else send = 99;
     }
-    return send; 
+  }
+  
+  int WideJetIndex(int ind, EventData & ev){
+    EventData::JetCache & cache = ev.Cache();
+    if(ind==0) return JetIndex(0, ev);
+    if(!cache.hasWideJetIndex){
+      FillWideJetIndex(cache.wideJetIndex, ev);
+      cache.hasWideJetIndex = true;
+    }
+    if(ind>0 && ind<(int)cache.wideJetIndex.size()) return cache.wideJetIndex[ind];
+    return 99; 
   }
 
   
   /// ----------------------------------------------
   /// Find Number of Jets
   int JetNumber(EventData & ev){
+    EventData::JetCache & cache = ev.Cache();
+    if(!cache.hasJetNumber){
+      cache.jetNumber = CountJets(ev);
+      cache.hasJetNumber = true;
+    }
+    return cache.jetNumber;
+  }
+  
+  int CountJets(EventData & ev){
     int njets=0;
-    if( ev.JetType()=="calo"){
+    if( ev.JetType()==EventData::JetCalo){
       for (int i=0; i<ev.NCaloAK4Jets(); i++){
 	if( ev.CaloAK4JetPtCor(i)>ev.SecJetCut()){
 	  njets++ ;
 	}
       }
     }
-    else if(ev.JetType()=="pf"){
+    else if(ev.JetType()==EventData::JetPF){
       for (int i=0; i<ev.NPFAK4Jets(); i++){
 	if( ev.PFAK4JetPtCor(i)>ev.SecJetCut() 
 	    && abs(ev.PFAK4JetEta(i)) < 4.5
@@ -763,7 +776,7 @@ namespace Operation
 	}
       }
     }
-    else if(ev.JetType()=="widepf"){
+    else if(ev.JetType()==EventData::JetWidePF){
       int useAlgo = 0;
       
       if(useAlgo == 0){ //Phat's method
@@ -837,6 +850,15 @@ namespace Operation
   /// ----------------------------------------------
   /// Find Number of Jets in WideJet1 system
   int WideJetNumber(EventData & ev){
+    EventData::JetCache & cache = ev.Cache();
+    if(!cache.hasWideJetNumber){
+      cache.wideJetNumber = CountWideJets(ev);
+      cache.hasWideJetNumber = true;
+    }
+    return cache.wideJetNumber;
+  }
+  
+  int CountWideJets(EventData & ev){
     int njets   = 0;
     int useAlgo = 0;
     
@@ -906,6 +928,15 @@ namespace Operation
   /// ----------------------------------------------
   /// WideJet1 LorentzVector
   TLorentzVector WideJet1(EventData & ev){
+    EventData::JetCache & cache = ev.Cache();
+    if(!cache.hasWideJet1){
+      cache.wideJet1 = BuildWideJet1(ev);
+      cache.hasWideJet1 = true;
+    }
+    return cache.wideJet1;
+  }
+  
+  TLorentzVector BuildWideJet1(EventData & ev){
     int ixjet1= JetIndex(0, ev);
     TLorentzVector leadJet;
     TLorentzVector radJet;
@@ -928,105 +959,351 @@ namespace Operation
   
   /// ----------------------------------------------
   /// Manager
-  Manager::Manager(const std::string & logFileName) : mLogFileName(logFileName){}
-  Manager::~Manager() {}
+  Manager::Manager(const std::string & logFileName) : mLogFileName(logFileName), mReorderEvents(0){
+    AddVariation("nominal", 0., EventData::JERNone);
+  }
+  Manager::~Manager() {
+    for(size_t k=0; k<mVariationOps.size(); k++) delete mVariationOps[k];
+  }
   void Manager::Add(Operation::_Base * aOp){
     Manager::OpData tempData;
     tempData.op = aOp;
-    tempData.ng = 0.0;
-    mOperations.push_back(tempData);
+    tempData.Clear();
+    mChains[0].ops.push_back(tempData);
+  }
+  
+  void Manager::AddVariation(const std::string & name, float energyScale, int jerMode){
+    Manager::Chain chain;
+    chain.name = name;
+    chain.energyScale = energyScale;
+    chain.jerMode = jerMode;
+    chain.ng_total = 0.0;
+    mChains.push_back(chain);
+  }
+  
+  void Manager::AddVariations(const std::string & list){
+    std::stringstream names(list);
+    std::string name;
+    while ( std::getline(names, name, ',') ){
+      if      ( name=="JESUp" )      AddVariation(name,  1., EventData::JERNone);
+      else if ( name=="JESDown" )    AddVariation(name, -1., EventData::JERNone);
+      else if ( name=="JERCentral" ) AddVariation(name,  0., EventData::JERCentral);
+      else if ( name=="JERUp" )      AddVariation(name,  0., EventData::JERUp);
+      else if ( name=="JERDown" )    AddVariation(name,  0., EventData::JERDown);
+      else if ( name.size() )        cerr << "Unknown variation " << name << ", ignored" << endl;
+    }
+  }
+  
+  void Manager::SetReordering(Long64_t profileEvents){
+    mReorderEvents = profileEvents;
+  }
+  
+  void Manager::BuildVariations(){
+    for(size_t v=1; v<mChains.size(); v++){
+      if ( mChains[v].ops.size() ) continue;
+      
+      for(size_t k=0; k<mChains[0].ops.size(); k++){
+	Manager::OpData tempData;
+	tempData.op = mChains[0].ops[k].op->CloneVariation(mChains[v].name);
+	tempData.Clear();
+	if ( !tempData.op ){
+	  cerr << "Operation" << *(mChains[0].ops[k].op) << " has no copy for variations, skipping " << mChains[v].name << endl;
+	  for(size_t i=0; i<mChains[v].ops.size(); i++) delete mChains[v].ops[i].op;
+	  mChains[v].ops.clear();
+	  break;
+	}
+	mChains[v].ops.push_back(tempData);
+      }
+      
+      if ( mChains[v].ops.empty() ){
+	mChains.erase(mChains.begin()+v);
+	v--;
+	continue;
+      }
+      for(size_t k=0; k<mChains[v].ops.size(); k++) mVariationOps.push_back(mChains[v].ops[k].op);
+    }
   }
   
   
   /// ----------------------------------------------
   /// Run
   void Manager::Run(EventData & ev) {
+    BuildVariations();
+    
     // Clear counters
     double ng_all = 0.0;
-    double ng_total = 0.0;
-    std::vector<Manager::OpData>::iterator i = mOperations.begin();
-    
-    while ( i != mOperations.end() ){
-      i->ng = 0.0;
-      ++i;
+    for(size_t v=0; v<mChains.size(); v++){
+      mChains[v].ng_total = 0.0;
+      mChains[v].order.clear();
+      for(size_t k=0; k<mChains[v].ops.size(); k++) mChains[v].ops[k].Clear();
     }
-
+    
+    EventLoop(ev, mChains, ng_all, mReorderEvents, false);
+    
+    // Output the information about the run to the log file
+    OutputResults(mLogFileName.c_str(), ng_all, mChains[0].ng_total);  
+    OutputJSON(ng_all);
+  }
+  
+  
+  /// ----------------------------------------------
+  /// Event loop over the chains of operations, every variation sees the event read once
+  void Manager::EventLoop(EventData & ev, std::vector<Chain> & chains, double & ng_all, Long64_t reorderEvents, bool profileOnly) {
+    Long64_t nEvents = 0;
+    
     // Main event loop
     // Just keep going until max events is hit or we finish the file
     while ( ev.GetNextEvent() ){
       // Sum the total event weight
       ng_all += ev.Weight();
       
-      // Loop over the operations
-      i = mOperations.begin();
-      while ( i != mOperations.end() ){
-	// Call the filter
+      for(size_t v=0; v<chains.size(); v++){
+	std::vector<OpData> & ops = chains[v].ops;
+	std::vector<size_t> & order = chains[v].order;
+	if ( v>0 && ops.empty() ) continue;
+	ev.SetVariation(chains[v].energyScale, chains[v].jerMode);
 	
-	if ( !i->op->Process(ev) ) 
-	  break; // break on failure
+	// Loop over the operations in the run order, the declared position of the cut
+	// that rejects the event is kept for the counters
+	size_t failed = ops.size();
+	std::vector<char> & ran = chains[v].ran;
+	ran.assign(ops.size(), 0);
+	for(size_t k=0; k<ops.size(); k++){
+	  size_t d = order.size() ? order[k] : k;
+	  ran[d] = 1;
+	  if ( !RunOperation(ops[d], ev) ){
+	    failed = d;
+	    break; // break on failure
+	  }
+	}
 	
-	// Filter passed, save weight
-	i->ng += ev.Weight();
-
-	++i;
-      }
+	// A reordered cut may reject the event before cuts declared ahead of it in its block
+	// ran. Those are run now in the declared order, for the counters only: the first one
+	// that fails is where the declared cut flow loses the event
+	for(size_t d=0; d<failed && failed<ops.size(); d++){
+	  if ( ran[d] ) continue;
+	  if ( !RunOperation(ops[d], ev) ) failed = d;
+	}
+	
+	// Counters in the declared order: every operation up to the rejecting one saw the
+	// event, the ones before it passed it
+	double w = ev.Weight();
+	for(size_t d=0; d<ops.size() && d<=failed; d++){
+	  ops[d].nCalls++;
+	  if ( d == failed ) break;
+	  ops[d].ng  += w;
+	  ops[d].ng2 += w*w;
+	  ops[d].nPass++;
+	}
+	
+	// If we aren't at the end continue without adding total
+	if ( failed < ops.size() ) continue;
+	
+	// Sum the total that passes all the operations
+	chains[v].ng_total += ev.Weight();
+	
+        // 			int flg_trg80=0;
+        // 			string strtrg = ev.HLTNames();
+        //			if (strtrg.find("HLT_CentralJet80_MET80")!=string::npos ) flg_trg80=1;
       
-      // If we aren't at the end continue without adding total
-      if ( i != mOperations.end() ) continue;
       
-      // Sum the total that passes all the operations
-      ng_total += ev.Weight();
       
-      // 			int flg_trg80=0;
-      // 			string strtrg = ev.HLTNames();
-      //			if (strtrg.find("HLT_CentralJet80_MET80")!=string::npos ) flg_trg80=1;
+        //int ixjet1= JetIndex(0, ev);
+        //int ixjet2= JetIndex(1, ev);
       
+        //if(flg_trg80==0) cout << "\"" << ev.run()  <<  ":"  << ev.event() <<  "\",    " <<  ev.run() <<  "," << ev.lumi() <<   endl;
+        //else cout << "..............\"" << ev.run()  <<  ":"  << ev.event() <<  "\",    " <<  ev.run() <<  "," << ev.lumi() <<   endl;
       
+        //cout << ev.run()  <<  "    "  << ev.lumi() << "    "  <<   ev.event() <<   endl;
       
-      //int ixjet1= JetIndex(0, ev);
-      //int ixjet2= JetIndex(1, ev);
       
-      //if(flg_trg80==0) cout << "\"" << ev.run()  <<  ":"  << ev.event() <<  "\",    " <<  ev.run() <<  "," << ev.lumi() <<   endl;
-      //else cout << "..............\"" << ev.run()  <<  ":"  << ev.event() <<  "\",    " <<  ev.run() <<  "," << ev.lumi() <<   endl;
+        //cout << "CALO:" << ev.MetPt(0)  <<  "   PF:"  << ev.MetPt(10) <<  "  TC:" <<  ev.MetPt(20)  <<   endl;
       
-      //cout << ev.run()  <<  "    "  << ev.lumi() << "    "  <<   ev.event() <<   endl;
+        //cout<< MetMuPt( ev.MetPx(10) , ev.MetPy(10) , ev )  << "  Tiv: " << ev.LowTIV()  <<  " DeltaPhi:  "  
+        //<<  deltaPhi( ev.PFAK4JetPhi(ixjet1) ,  ev.PFAK4JetPhi(ixjet2) )  << "  jetPt: "  <<  ev.PFAK4JetPtCor(ixjet1) 
+        //<<  "   "    << ev.PFAK4JetPtCor(ixjet2)   <<endl; 
       
+        //cout << ev.PFLepPy(1) << " " << ev.PFMuonPy(1) <<  " "  <<  ev.NPFLep() <<  " " <<  ev.NPFMuon() <<   endl; 
       
-      //cout << "CALO:" << ev.MetPt(0)  <<  "   PF:"  << ev.MetPt(10) <<  "  TC:" <<  ev.MetPt(20)  <<   endl;
+        /*
+  	for(int i=0; i<100; i++){
+  	double w = ev.PDFWeight(i) * ev.PDFWeights(0) /ev.PDFWeight(0);
+  	//double w = ev.PDFWeightAlphaS(i) * ev.PDFWeights(0) / ev.PDFWeightAlphaS(0);
+  	//cout <<  w <<  "   " << ev.PDFWeight(i)  <<  "   " << ev.PDFWeight(i) <<  "   ..."  << ev.PDFWeights(i)  <<  endl;
+	
+	
+  	//cout << "----------------------------" <<  endl;
+  	}
+  	cout << "----------------------------" <<  endl;  
+        */
       
-      //cout<< MetMuPt( ev.MetPx(10) , ev.MetPy(10) , ev )  << "  Tiv: " << ev.LowTIV()  <<  " DeltaPhi:  "  
-      //<<  deltaPhi( ev.PFAK4JetPhi(ixjet1) ,  ev.PFAK4JetPhi(ixjet2) )  << "  jetPt: "  <<  ev.PFAK4JetPtCor(ixjet1) 
-      //<<  "   "    << ev.PFAK4JetPtCor(ixjet2)   <<endl; 
       
-      //cout << ev.PFLepPy(1) << " " << ev.PFMuonPy(1) <<  " "  <<  ev.NPFLep() <<  " " <<  ev.NPFMuon() <<   endl; 
+        //cout << ev.PFLepPt(0)  <<  "  " <<  ev.LepType()  <<  "  " <<   PFElecTightCuts(ev , 0)  << endl;
       
-      /*
-	for(int i=0; i<100; i++){
-	double w = ev.PDFWeight(i) * ev.PDFWeights(0) /ev.PDFWeight(0);
-	//double w = ev.PDFWeightAlphaS(i) * ev.PDFWeights(0) / ev.PDFWeightAlphaS(0);
-	//cout <<  w <<  "   " << ev.PDFWeight(i)  <<  "   " << ev.PDFWeight(i) <<  "   ..."  << ev.PDFWeights(i)  <<  endl;
-	
-	
-	//cout << "----------------------------" <<  endl;
-	}
-	cout << "----------------------------" <<  endl;  
-      */
       
+        /*
+  	for(int i=0; i<ev.NGenPar(); i++){
+  	//if( ( abs(ev.GenParId(i) )>10 || abs(ev.GenParId(i) ) <17 ) && ev.GenParStatus(i)==1){
+  	cout <<   ev.GenParId(i)  << "   mother:" <<  ev.GenParDoughterOf(i)  <<  "  pt:" << ev.GenParPt(i) << endl;
+  	}
+  	}*/
       
-      //cout << ev.PFLepPt(0)  <<  "  " <<  ev.LepType()  <<  "  " <<   PFElecTightCuts(ev , 0)  << endl;
+      }
       
+      // Profiling done, commuting cuts run cheapest per rejected event first
+      if ( reorderEvents > 0 && ++nEvents == reorderEvents ){
+	for(size_t v=0; v<chains.size(); v++) Reorder(chains[v]);
+	if ( profileOnly ) break;
+      }
+    }
+    
+    ev.SetVariation(0., EventData::JERNone);
+  }
+  
+  
+  // Process with the timing of the operation
+  bool Manager::RunOperation(OpData & data, EventData & ev) {
+    std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+    bool pass = data.op->Process(ev);
+    data.time += std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+    data.nRuns++;
+    return pass;
+  }
+  
+  
+  /// ----------------------------------------------
+  /// Order of the commuting blocks from the counters of the profiling events
+  void Manager::Reorder(Chain & chain) {
+    std::vector<OpData> & ops = chain.ops;
+    
+    // time per rejected event, a cut that rejected nothing goes last in its block
+    std::vector<double> cost(ops.size());
+    chain.order.clear();
+    for(size_t k=0; k<ops.size(); k++){
+      Long64_t rejected = ops[k].nCalls - ops[k].nPass;
+      cost[k] = rejected > 0 ? ops[k].time / rejected : 1e30;
+      chain.order.push_back(k);
+    }
+    
+    size_t first = 0;
+    while ( first < ops.size() ){
+      size_t last = first;
+      while ( last < ops.size() && ops[last].op->Commutes() ) last++;
+      if ( last == first ){
+	first++;
+	continue;
+      }
+      std::stable_sort(chain.order.begin()+first, chain.order.begin()+last,
+		       [&cost](size_t a, size_t b) { return cost[a] < cost[b]; });
+      first = last;
+    }
+  }
+  
+  
+  /// ----------------------------------------------
+  /// Run on several threads
+  void Manager::Run(const std::string & sample, UInt_t maxEvents, int isMC, int nThreads) {
+    BuildVariations();
+    
+    // Every worker needs its own copy of each operation
+    std::vector<Manager::Worker*> workers;
+    bool parallel = nThreads > 1;
+    for(int t=0; t<nThreads && parallel; t++){
+      Manager::Worker * worker = new Manager::Worker;
+      worker->ev = 0;
+      worker->ng_all = 0.0;
+      worker->reorderEvents = mReorderEvents;
+      workers.push_back(worker);
       
-      /*
-	for(int i=0; i<ev.NGenPar(); i++){
-	//if( ( abs(ev.GenParId(i) )>10 || abs(ev.GenParId(i) ) <17 ) && ev.GenParStatus(i)==1){
-	cout <<   ev.GenParId(i)  << "   mother:" <<  ev.GenParDoughterOf(i)  <<  "  pt:" << ev.GenParPt(i) << endl;
+      for(size_t v=0; v<mChains.size() && parallel; v++){
+	Manager::Chain chain = mChains[v];
+	chain.ng_total = 0.0;
+	chain.ops.clear();
+	chain.order.clear();
+	
+	std::vector<Manager::OpData>::iterator i = mChains[v].ops.begin();
+	while ( i != mChains[v].ops.end() ){
+	  Manager::OpData tempData;
+	  tempData.op = i->op->Clone();
+	  tempData.Clear();
+	  if ( !tempData.op ){
+	    cerr << "Operation" << *(i->op) << " can not be cloned, running on a single thread" << endl;
+	    parallel = false;
+	    break;
+	  }
+	  chain.ops.push_back(tempData);
+	  ++i;
 	}
-	}*/
-      
+	worker->chains.push_back(chain);
+      }
+    }
+    
+    if ( !parallel ){
+      for(size_t t=0; t<workers.size(); t++){
+	for(size_t v=0; v<workers[t]->chains.size(); v++)
+	  for(size_t k=0; k<workers[t]->chains[v].ops.size(); k++) delete workers[t]->chains[v].ops[k].op;
+	delete workers[t];
+      }
+      EventData ev(sample, maxEvents, isMC);
+      Run(ev);
+      return;
+    }
+    
+    // Readers are opened here, only the event loops run concurrently
+    TThread::Initialize();
+    for(int t=0; t<nThreads; t++) workers[t]->ev = new EventData(sample, maxEvents, isMC);
+    
+    // ranges end on file boundaries where possible, a thread then reads whole files
+    std::vector<Long64_t> bounds = workers[0]->ev->SplitEntries(nThreads);
+    for(int t=0; t<nThreads; t++){
+      size_t b = t+1 < (int) bounds.size() ? t : bounds.size()-1;
+      size_t e = t+1 < (int) bounds.size() ? t+1 : bounds.size()-1;
+      workers[t]->ev->SetEntryRange( bounds[b], bounds[e] );
+    }
+    
+    // One run order for every worker: the first reader profiles its first events alone,
+    // the others start with its order
+    if ( mReorderEvents > 0 ){
+      EventLoop(*(workers[0]->ev), workers[0]->chains, workers[0]->ng_all, mReorderEvents, true);
+      for(int t=0; t<nThreads; t++){
+	workers[t]->reorderEvents = 0;
+	for(size_t v=0; v<mChains.size(); v++) workers[t]->chains[v].order = workers[0]->chains[v].order;
+      }
+    }
+    
+    std::vector<std::thread> threads;
+    for(int t=0; t<nThreads; t++) threads.push_back( std::thread(Manager::RunWorker, workers[t]) );
+    for(int t=0; t<nThreads; t++) threads[t].join();
+    
+    // Merge in worker order, so the result does not depend on the scheduling
+    double ng_all = 0.0;
+    for(size_t v=0; v<mChains.size(); v++){
+      mChains[v].ng_total = 0.0;
+      mChains[v].order = workers[0]->chains[v].order;   // the same for every worker
+      for(size_t k=0; k<mChains[v].ops.size(); k++) mChains[v].ops[k].Clear();
+    }
+    
+    for(int t=0; t<nThreads; t++){
+      ng_all += workers[t]->ng_all;
+      for(size_t v=0; v<mChains.size(); v++){
+	mChains[v].ng_total += workers[t]->chains[v].ng_total;
+	for(size_t k=0; k<mChains[v].ops.size(); k++){
+	  mChains[v].ops[k].Add( workers[t]->chains[v].ops[k] );
+	  mChains[v].ops[k].op->Merge( workers[t]->chains[v].ops[k].op );
+	  delete workers[t]->chains[v].ops[k].op;
+	}
+      }
+      delete workers[t]->ev;
+      delete workers[t];
     }
     
     // Output the information about the run to the log file
-    OutputResults(mLogFileName.c_str(), ng_all, ng_total);  
+    OutputResults(mLogFileName.c_str(), ng_all, mChains[0].ng_total);  
+    OutputJSON(ng_all);
+  }
+  
+  void Manager::RunWorker(Manager::Worker * worker) {
+    EventLoop(*(worker->ev), worker->chains, worker->ng_all, worker->reorderEvents, false);
   }
 
   
@@ -1043,13 +1320,98 @@ namespace Operation
     // 		outfile << "Total events processed by all operations: " << ng_all << endl;
     // 		outfile << "Total events passing all operations: " << ng_total << endl;
     
-    std::vector<Manager::OpData>::iterator i = mOperations.begin();
-    while ( i != mOperations.end() ){
-      cout << "Events surviving " << *(i->op) << ": " << i->ng  << endl;
-      outfile << "Events surviving " << *(i->op)  << ": " << i->ng << endl;
+    for(size_t v=0; v<mChains.size(); v++){
+      if ( v>0 && mChains[v].ops.size() ){
+	cout << "Variation " << mChains[v].name << endl;
+	outfile << "Variation " << mChains[v].name << endl;
+      }
+      
+      std::vector<Manager::OpData>::iterator i = mChains[v].ops.begin();
+      while ( i != mChains[v].ops.end() ){
+	cout << "Events surviving " << *(i->op) << ": " << i->ng  << endl;
+	outfile << "Events surviving " << *(i->op)  << ": " << i->ng << endl;
+	
+	++i;
+      }
+      
+      for(size_t k=0; k<mChains[v].order.size(); k++){
+	if ( mChains[v].order[k] == k ) continue;
+	cout << "Cuts reordered after " << mReorderEvents << " events, run order:" << endl;
+	for(size_t j=0; j<mChains[v].order.size(); j++) cout << "  " << *(mChains[v].ops[ mChains[v].order[j] ].op) << endl;
+	break;
+      }
+    }
+  }
+  
+  
+  /// ----------------------------------------------
+  /// OutputJSON
+  static std::string JSONString(const std::string & text){
+    std::string quoted = "\"";
+    for(size_t k=0; k<text.size(); k++){
+      if ( text[k]=='"' || text[k]=='\\' ) quoted += '\\';
+      if ( text[k]=='\n' ) { quoted += "\\n"; continue; }
+      quoted += text[k];
+    }
+    return quoted + "\"";
+  }
+  
+  void Manager::OutputJSON(double ng_all){
+    std::string jsonFileName = mLogFileName;
+    if ( jsonFileName.size() > 4 && jsonFileName.substr(jsonFileName.size()-4) == ".log" ) jsonFileName.erase(jsonFileName.size()-4);
+    jsonFileName += ".json";
+    
+    ofstream outfile(jsonFileName.c_str());
+    if ( !outfile ){
+      cerr << "Can not write the cut flow to " << jsonFileName << endl;
+      return;
+    }
+    outfile.precision(10);
+    
+    outfile << "{" << endl;
+    outfile << "  \"log\": " << JSONString(mLogFileName) << "," << endl;
+    outfile << "  \"events\": " << ( mChains[0].ops.size() ? mChains[0].ops[0].nCalls : 0 ) << "," << endl;
+    outfile << "  \"weighted\": " << ng_all << "," << endl;
+    outfile << "  \"variations\": [" << endl;
+    
+    for(size_t v=0; v<mChains.size(); v++){
+      double time = 0.0;
+      for(size_t k=0; k<mChains[v].ops.size(); k++) time += mChains[v].ops[k].time;
+      
+      outfile << "    {" << endl;
+      outfile << "      \"name\": " << JSONString(mChains[v].name) << "," << endl;
+      outfile << "      \"passed\": " << mChains[v].ng_total << "," << endl;
+      outfile << "      \"time\": " << time << "," << endl;
+      outfile << "      \"operations\": [" << endl;
       
-      ++i;
+      for(size_t k=0; k<mChains[v].ops.size(); k++){
+	const OpData & o = mChains[v].ops[k];
+	std::ostringstream name;
+	name << *(o.op);
+	
+	size_t position = k;
+	for(size_t j=0; j<mChains[v].order.size(); j++) if ( mChains[v].order[j] == k ) position = j;
+	
+	outfile << "        { \"name\": " << JSONString(name.str())
+		<< ", \"position\": " << position
+		<< ", \"calls\": " << o.nCalls
+		<< ", \"runs\": " << o.nRuns
+		<< ", \"passed\": " << o.nPass
+		<< ", \"weighted\": " << o.ng
+		<< ", \"sumw2\": " << o.ng2
+		<< ", \"rejection\": " << ( o.nCalls ? 1. - double(o.nPass)/o.nCalls : 0. )
+		<< ", \"time\": " << o.time
+		<< ", \"timeFraction\": " << ( time > 0 ? o.time/time : 0. )
+		<< " }" << ( k+1 < mChains[v].ops.size() ? "," : "" ) << endl;
+      }
+      outfile << "      ]" << endl;
+      outfile << "    }" << ( v+1 < mChains.size() ? "," : "" ) << endl;
     }
+    
+    outfile << "  ]" << endl;
+    outfile << "}" << endl;
+    
+    cout << "Cut flow and timing written to " << jsonFileName << endl;
   }
   
   
@@ -1057,6 +1419,10 @@ namespace Operation
   /// Base
   _Base::_Base() {}
   _Base::~_Base(){}
+  _Base* _Base::Clone() { return 0; }
+  void _Base::Merge(_Base * aClone) {}
+  _Base* _Base::CloneVariation(const std::string & variation) { return Clone(); }
+  bool _Base::Commutes() { return false; }
   
   // Just definition of the operator
   std::ostream& operator << (std::ostream& ostrm, _Base& m){
@@ -1103,8 +1469,8 @@ namespace Operation
       genpt = ev.GenParPt(i);
       break;
     }
-    if(MetLepPt(ev.MetPx(10), ev.MetPy(10), ev) < 0.7*genpt){
-      std::cout<<"MetLepPt = "<<MetLepPt(ev.MetPx(10), ev.MetPy(10), ev)<<", GenPt = "<<genpt<<std::endl;
+    if(ev.MetLepPt(10) < 0.7*genpt){
+      std::cout<<"MetLepPt = "<<ev.MetLepPt(10)<<", GenPt = "<<genpt<<std::endl;
       std::cout<<"if(run=="<<ev.run()<<" && lumi=="<<ev.lumi()<<" && event=="<<ev.event()<<") return true;"<<std::endl;
     }
     return true;
@@ -1191,7 +1557,7 @@ namespace Operation
   CutMet::~CutMet() {}
   
   bool CutMet::Process(EventData & ev){
-    if( (mNoLep == 0 && MetLepPt( ev.MetPx(ev.MetType()) , ev.MetPy(ev.MetType()) , ev )  > mCut ) || 
+    if( (mNoLep == 0 && ev.MetLepPt(ev.MetType())  > mCut ) || 
 	(mNoLep == 1 && ev.MetPt( ev.MetType() ) > mCut) ){
       return true;
     } 
@@ -1214,12 +1580,12 @@ namespace Operation
   bool CutNoiseClean::Process(EventData & ev){
     bool send=false;
     
-    if( ev.JetType()=="calo"){
+    if( ev.JetType()==EventData::JetCalo){
       if(ev.CaloAK4JetIDTIGHT(0)==1){
 	send=true;
       }
     }
-    else if(ev.JetType()=="pf"){
+    else if(ev.JetType()==EventData::JetPF){
       int ixjet1= JetIndex(0, ev);
       int ixjet2= JetIndex(1, ev);
       
@@ -1245,7 +1611,7 @@ namespace Operation
 	send=true;
       }
     }
-    else if(ev.JetType()=="widepf"){ 
+    else if(ev.JetType()==EventData::JetWidePF){ 
       int ixjet1 = 99;
       int ixjet2 = 99;
       int njets  = 0;
@@ -1325,12 +1691,12 @@ namespace Operation
   
   bool CutJet1::Process(EventData & ev){
     bool send=false;
-    if( ev.JetType()=="calo"){
+    if( ev.JetType()==EventData::JetCalo){
       if( ev.CaloAK4JetPtCor(0)>mJetPt &&  abs(ev.CaloAK4JetEta(0))<mJetEta ){
 	send=true;
       }
     }
-    else if(ev.JetType()=="pf"){
+    else if(ev.JetType()==EventData::JetPF){
       int ixjet1= JetIndex(0, ev);
       if( ixjet1<99 &&  ev.PFAK4JetPtCor(ixjet1)>mJetPt 
          && fabs(ev.PFAK4JetEta(ixjet1))<mJetEta 
@@ -1342,7 +1708,7 @@ namespace Operation
  	return true;
       }
     }
-    else if(ev.JetType()=="widepf"){
+    else if(ev.JetType()==EventData::JetWidePF){
       TLorentzVector leadJet = WideJet1(ev);    
       if(leadJet.Pt()>mJetPt && fabs(leadJet.Eta())<mJetEta)
 	send=true;
@@ -1365,7 +1731,7 @@ namespace Operation
   
   bool CutJet1BTag::Process(EventData & ev){
     bool send=false;
-    if(ev.JetType()=="pf"){
+    if(ev.JetType()==EventData::JetPF){
       int ixjet1= JetIndex(0, ev);
       if( ixjet1<99 &&  ev.PFAK4JetBTagCombSecVtx(ixjet1)>mCombinedSecondaryVertex ){
 	send=true;
@@ -1390,7 +1756,7 @@ namespace Operation
   
   bool CutJet2::Process(EventData & ev){
     bool send=false;
-    if(ev.JetType()=="pf" || ev.JetType()=="widepf"){
+    if(ev.JetType()==EventData::JetPF || ev.JetType()==EventData::JetWidePF){
       if(JetNumber(ev)==1)
 	send = true;
       else if(JetNumber(ev)>1){
@@ -1440,14 +1806,14 @@ namespace Operation
   
   bool CutDeltaPhi1::Process(EventData & ev){
     bool send=false;
-    if( ev.JetType()=="calo"){
-      if( abs( deltaPhi( ev.CaloAK4JetPhi(0), MetLepPhi( ev.MetPx(ev.MetType()) , ev.MetPy(ev.MetType()) , ev ) ) ) >mCut1  ){
+    if( ev.JetType()==EventData::JetCalo){
+      if( abs( deltaPhi( ev.CaloAK4JetPhi(0), ev.MetLepPhi(ev.MetType()) ) ) >mCut1  ){
 	send=true;
       }
     }
-    if( ev.JetType()=="pf"){
+    if( ev.JetType()==EventData::JetPF){
       int ixjet1= JetIndex(0, ev);
-      if(ixjet1<99 &&   abs( deltaPhi( ev.PFAK4JetPhi(ixjet1), MetLepPhi( ev.MetPx(ev.MetType()) , ev.MetPy(ev.MetType()) , ev ) ) ) <mCut1  ){
+      if(ixjet1<99 &&   abs( deltaPhi( ev.PFAK4JetPhi(ixjet1), ev.MetLepPhi(ev.MetType()) ) ) <mCut1  ){
 	send=true;
       }  
     }
@@ -1468,18 +1834,18 @@ namespace Operation
   
   bool CutDeltaPhi2::Process(EventData & ev){
     bool  send=false;
-    if( ev.JetType()=="calo"){
+    if( ev.JetType()==EventData::JetCalo){
       bool  accept =false;
       if(JetNumber(ev)==1) accept =true;
-      if(JetNumber(ev)==2 && abs( deltaPhi( ev.CaloAK4JetPhi(1), MetLepPhi( ev.MetPx(ev.MetType()) , ev.MetPy(ev.MetType()) , ev ) ) ) >mCut1 ) accept=true;
+      if(JetNumber(ev)==2 && abs( deltaPhi( ev.CaloAK4JetPhi(1), ev.MetLepPhi(ev.MetType()) ) ) >mCut1 ) accept=true;
       if(accept) send=true;
     }
-    if( ev.JetType()=="pf"){
+    if( ev.JetType()==EventData::JetPF){
       bool  accept =false;
       int ixjet2= JetIndex(1, ev);
       if(JetNumber(ev)==1) accept =true;
       if(ixjet2<99 &&  JetNumber(ev)>1 && abs( deltaPhi( ev.PFAK4JetPhi(ixjet2), 
-							 MetLepPhi( ev.MetPx(ev.MetType()) , ev.MetPy(ev.MetType()) , ev ) ) ) >mCut1 ) accept=true;
+							 ev.MetLepPhi(ev.MetType()) ) ) >mCut1 ) accept=true;
       if(accept) send=true;
     }
     
@@ -1499,13 +1865,13 @@ namespace Operation
   
   bool CutDeltaPhi3::Process(EventData & ev){
     bool  send=false;
-    if( ev.JetType()=="calo"){
+    if( ev.JetType()==EventData::JetCalo){
       bool accept = false;
       if(JetNumber(ev)==1) accept =true;
       if(JetNumber(ev)>1 && abs( deltaPhi( ev.CaloAK4JetPhi(1) , ev.CaloAK4JetPhi(2) ) )  >mCut1 ) accept=true;
       if(accept) send=true;
     }
-    else if(ev.JetType()=="pf"){
+    else if(ev.JetType()==EventData::JetPF){
       bool accept = false;
       int  ixjet1 = JetIndex(0, ev);
       int  ixjet2 = JetIndex(1, ev);			
@@ -1514,7 +1880,7 @@ namespace Operation
       if(ixjet2<99 && ixjet1<99 &&   JetNumber(ev)>1 && abs( deltaPhi( ev.PFAK4JetPhi(ixjet1),  ev.PFAK4JetPhi(ixjet2)  ) ) < mCut1 ) accept=true;
       if(accept) send=true;
     }
-    else if(ev.JetType()=="widepf"){
+    else if(ev.JetType()==EventData::JetWidePF){
       bool accept = false;
       TLorentzVector leadJet = WideJet1(ev);
       int ixjet1 = WideJetIndex(0, ev);
@@ -1544,7 +1910,7 @@ namespace Operation
 
   bool CutWideDeltaPhi3::Process(EventData & ev) {
     bool  send=false;
-    if(ev.JetType()=="pf" || ev.JetType()=="widepf"){
+    if(ev.JetType()==EventData::JetPF || ev.JetType()==EventData::JetWidePF){
       bool accept = false;
       TLorentzVector leadJet = WideJet1(ev); 
       int ixjet1 = WideJetIndex(0, ev);
@@ -1761,7 +2127,7 @@ namespace Operation
     for(int i=0; i<ev.NGenPar(); i++){
       if(abs(ev.GenParId(i))==mPdgId 
 	 && ev.GenParStatus(i)==3 && ev.GenParPt(i) > mGenPt 
-	 && MetLepPt(ev.MetPx(ev.MetType()), ev.MetPy(ev.MetType()), ev)> mMet
+	 && ev.MetLepPt(ev.MetType())> mMet
 	 ){
         send=true;
 	break;
@@ -1784,7 +2150,7 @@ namespace Operation
     bool send = false;	
     for(int i=0; i<ev.NGenPar(); i++){
       if((abs(ev.GenParId(i))==mPdgId && ev.GenParStatus(i)==3 && ev.GenParPt(i) > mGenPt) 
-	 || MetLepPt(ev.MetPx(ev.MetType()), ev.MetPy(ev.MetType()), ev)> mMet
+	 || ev.MetLepPt(ev.MetType())> mMet
 	 ){
         send=true;
 	break;
@@ -1860,11 +2226,9 @@ namespace Operation
     int IsoLepIndex=0; 
     //int  LepCharge=0;
     
-    int isoLepPseq[20], isoLepMseq[20], isoLepPnum=0,isoLepMnum=0; //=0 for isoMuPnum,isoMuMnum
-    
-    for (int i=0; i<20; i++){
-      isoLepPseq[i]=0; isoLepMseq[i]=0;
-    }
+    // one slot per lepton, the collections are no longer bound by MAXMUON
+    vector<int> isoLepPseq(ev.NPFLep(), 0), isoLepMseq(ev.NPFLep(), 0);
+    int isoLepPnum=0,isoLepMnum=0; //=0 for isoMuPnum,isoMuMnum
     
     bool  check2=true;
     for(int i=0; i<ev.NPFLep(); i++ ){
@@ -2098,4 +2462,150 @@ namespace Operation
     ostrm << "  Cut Tau :............";
     return ostrm;
   }
+  
+  
+  /// ----------------------------------------------
+  /// Cut efficiency for several cut points in one pass
+  MultiCutEff::MultiCutEff(const std::string & logFileName) : mLogFileName(logFileName), mIsClone(false), mOwnsOps(false) {}
+  
+  MultiCutEff::~MultiCutEff(){
+    if(mOwnsOps){
+      for(size_t i=0; i<mCuts.size(); i++) delete mCuts[i];
+      for(size_t k=0; k<mConfigs.size(); k++) delete mConfigs[k].op;
+    }
+    if(mIsClone) return;
+    ofstream outfile(mLogFileName.c_str(), ios::app);
+    for(size_t k=0; k<mConfigs.size(); k++){
+      // cut flow of the configuration, in the order the cuts were added
+      for(size_t i=0; i<mCuts.size(); i++){
+	if(!(mConfigs[k].mask & (1u << i))) continue;
+	double ng = i < mConfigs[k].ngCut.size() ? mConfigs[k].ngCut[i] : 0.0;
+	cout << "Events surviving configuration " << mConfigs[k].name << *mCuts[i] << ": " << ng << endl;
+	outfile << "Events surviving configuration " << mConfigs[k].name << *mCuts[i] << ": " << ng << endl;
+      }
+      cout << "Events surviving configuration " << mConfigs[k].name << ": " << mConfigs[k].ng << endl;
+      outfile << "Events surviving configuration " << mConfigs[k].name << ": " << mConfigs[k].ng << endl;
+    }
+  }
+  
+  void MultiCutEff::AddCut(Operation::_Base * aCut){
+    if(mCuts.size() >= 32){
+      cerr << "MultiCutEff: at most 32 cuts are supported, ignoring " << *aCut << endl;
+      return;
+    }
+    mCuts.push_back(aCut);
+  }
+  
+  void MultiCutEff::AddConfig(const std::string & name, unsigned int mask, Operation::_Base * aOp){
+    if(mConfigs.size() >= 32){
+      cerr << "MultiCutEff: at most 32 configurations are supported, ignoring " << name << endl;
+      return;
+    }
+    MultiCutEff::ConfigData tempData;
+    tempData.name = name;
+    tempData.mask = mask;
+    tempData.op   = aOp;
+    tempData.ng   = 0.0;
+    mConfigs.push_back(tempData);
+  }
+  
+  // Configurations that require each cut. Built on the first event, once all
+  // cuts and configurations are known, whatever order they were added in
+  void MultiCutEff::BuildUsedBy(){
+    mUsedBy.assign(mCuts.size(), 0);
+    for(size_t k=0; k<mConfigs.size(); k++){
+      mConfigs[k].ngCut.resize(mCuts.size(), 0.0);
+      for(size_t i=0; i<mCuts.size(); i++){
+	if(mConfigs[k].mask & (1u << i)) mUsedBy[i] |= (1u << k);
+      }
+    }
+  }
+  
+  bool MultiCutEff::Process(EventData & ev){
+    if(mUsedBy.size() != mCuts.size()) BuildUsedBy();
+    
+    // Pass bitmask over configurations, a cut is skipped once nobody needs it
+    unsigned int pass = 0;
+    for(size_t k=0; k<mConfigs.size(); k++) pass |= (1u << k);
+    
+    for(size_t i=0; i<mCuts.size() && pass; i++){
+      if(!(pass & mUsedBy[i])) continue;
+      if(!mCuts[i]->Process(ev)) pass &= ~mUsedBy[i];
+      // configurations still alive after a cut they require
+      unsigned int alive = pass & mUsedBy[i];
+      for(size_t k=0; alive; k++, alive >>= 1){
+	if(alive & 1u) mConfigs[k].ngCut[i] += ev.Weight();
+      }
+    }
+    
+    for(size_t k=0; k<mConfigs.size(); k++){
+      if(!(pass & (1u << k))) continue;
+      mConfigs[k].ng += ev.Weight();
+      if(mConfigs[k].op) mConfigs[k].op->Process(ev);
+    }
+    return true;
+  }
+  
+  Operation::_Base* MultiCutEff::Clone(){
+    // the clone owns copies of the cuts and configuration operations
+    MultiCutEff * clone = new MultiCutEff(*this);
+    clone->mIsClone = true;
+    clone->mOwnsOps = true;
+    bool ok = true;
+    for(size_t i=0; i<mCuts.size(); i++){
+      clone->mCuts[i] = mCuts[i]->Clone();
+      if(!clone->mCuts[i]) ok = false;
+    }
+    for(size_t k=0; k<mConfigs.size(); k++){
+      clone->mConfigs[k].ng = 0.0;
+      clone->mConfigs[k].ngCut.assign(clone->mConfigs[k].ngCut.size(), 0.0);
+      clone->mConfigs[k].op = mConfigs[k].op ? mConfigs[k].op->Clone() : 0;
+      if(mConfigs[k].op && !clone->mConfigs[k].op) ok = false;
+    }
+    if(!ok){
+      delete clone;
+      return 0;
+    }
+    return clone;
+  }
+  
+  Operation::_Base* MultiCutEff::CloneVariation(const std::string & variation){
+    // same as Clone, but the copy writes its own log and histograms
+    MultiCutEff * clone = new MultiCutEff(*this);
+    clone->mLogFileName = VariationFileName(mLogFileName, variation);
+    clone->mOwnsOps = true;
+    bool ok = true;
+    for(size_t i=0; i<mCuts.size(); i++){
+      clone->mCuts[i] = mCuts[i]->Clone();
+      if(!clone->mCuts[i]) ok = false;
+    }
+    for(size_t k=0; k<mConfigs.size(); k++){
+      clone->mConfigs[k].ng = 0.0;
+      clone->mConfigs[k].ngCut.assign(clone->mConfigs[k].ngCut.size(), 0.0);
+      clone->mConfigs[k].op = mConfigs[k].op ? mConfigs[k].op->CloneVariation(variation) : 0;
+      if(mConfigs[k].op && !clone->mConfigs[k].op) ok = false;
+    }
+    if(!ok){
+      clone->mIsClone = true;
+      delete clone;
+      return 0;
+    }
+    return clone;
+  }
+  
+  void MultiCutEff::Merge(Operation::_Base * aClone){
+    MultiCutEff * clone = dynamic_cast<MultiCutEff*>(aClone);
+    if(!clone) return;
+    for(size_t k=0; k<mConfigs.size(); k++){
+      mConfigs[k].ng += clone->mConfigs[k].ng;
+      if(mConfigs[k].ngCut.size() < clone->mConfigs[k].ngCut.size()) mConfigs[k].ngCut.resize(clone->mConfigs[k].ngCut.size(), 0.0);
+      for(size_t i=0; i<clone->mConfigs[k].ngCut.size(); i++) mConfigs[k].ngCut[i] += clone->mConfigs[k].ngCut[i];
+      if(mConfigs[k].op) mConfigs[k].op->Merge( clone->mConfigs[k].op );
+    }
+  }
+  
+  std::ostream& MultiCutEff::Description(std::ostream &ostrm){
+    ostrm << "  " << mCuts.size() << " cuts in " << mConfigs.size() << " configurations :............";
+    return ostrm;
+  }
 }
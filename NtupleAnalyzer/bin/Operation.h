@@ -7,9 +7,11 @@
 // Using streams
 #include <iostream>
 #include <vector>
+#include <thread>
 
 // ROOT stuff
 #include "TFile.h"
+#include "TThread.h"
 #include "TH1D.h"
 #include "TH2D.h"
 #include "TLorentzVector.h"
@@ -39,6 +41,11 @@ namespace Operation
   
   TLorentzVector WideJet1(EventData & eventData);
   
+  // Uncached versions, the functions above keep their result in EventData::Cache()
+  int     CountJets(EventData & eventData);
+  int     CountWideJets(EventData & eventData);
+  TLorentzVector BuildWideJet1(EventData & eventData);
+  
   double  electronWeight(double pt, double eta);
   double  muonWeight(double pt, double eta); 
   double  muonWeightLoose(double pt, double eta);
@@ -54,6 +61,9 @@ namespace Operation
   
   vector<double> generate_flat10_weights(TH1D* data_npu_estimated, int puVersion);
   
+  // Output file name of a systematic variation: the tag goes in front of the extension
+  std::string VariationFileName(const std::string & fileName, const std::string & variation);
+  
   class _Base 
   {
   public:
@@ -63,6 +73,17 @@ namespace Operation
   public:
     virtual bool Process(EventData & eventData) = 0; // Update the event
     virtual std::ostream& Description(std::ostream& ostrm) = 0;
+    
+    // Copy used by a worker thread of Manager::Run, 0 if the operation can not run in parallel
+    virtual _Base* Clone();
+    // Add the results collected by a clone back into this operation
+    virtual void Merge(_Base * aClone);
+    // Copy run by Manager on a systematic variation, operations with an output write it
+    // under VariationFileName. Defaults to Clone
+    virtual _Base* CloneVariation(const std::string & variation);
+    // True for a pure cut, its result does not depend on the operations run before it
+    // and Manager may swap it with a neighbouring one (see Manager::SetReordering)
+    virtual bool Commutes();
   };
   
   std::ostream& operator << (std::ostream& ostrm, _Base& m);
@@ -79,22 +100,83 @@ namespace Operation
     void Add(Operation::_Base * aOp);
     void Remove(Operation::_Base * aOp);
     
+    // Add a systematic variation (jet energy scale shift in units of PFAK4uncer and an
+    // EventData JER mode). At Run the nominal chain is copied with CloneVariation and
+    // every variation is processed in the same event loop as the nominal one
+    void AddVariation(const std::string & name, float energyScale, int jerMode);
+    // Comma separated list of JESUp, JESDown, JERCentral, JERUp, JERDown
+    void AddVariations(const std::string & list);
+    
+    // Run the first profileEvents events in the declared order, then every block of
+    // neighbouring commuting cuts in order of time per rejected event. Operations that do
+    // not commute (histogrammers) stay in place and see the same events as before.
+    // The cut flow stays the one of the declared order: when a cut rejects an event, the
+    // cuts declared before it in its block that did not run yet are run for the counters,
+    // so the saving is on the cuts declared after it. Threaded runs profile on the first
+    // reader and use its order on every worker
+    void SetReordering(Long64_t profileEvents);
+    
     // Run the analysis
     void Run(EventData & eventData );
     
+    // Run the analysis on nThreads worker threads, each with its own reader,
+    // its own share of the entries and a clone of the operation chain
+    void Run(const std::string & sample, UInt_t maxEvents, int isMC, int nThreads);
+    
   private:
     // Status output helper function
     void OutputResults(const std::string & dataSet, double ng_all, double ng_total );
+    // Cut flow with timing per operation, written next to the log as <log>.json
+    void OutputJSON(double ng_all);
     
     
     struct OpData 
     { 
       Operation::_Base *op;
-      double ng;
+      double ng;          // weighted pass count
+      double ng2;         // sum of squared weights of the passing events
+      Long64_t nCalls;    // events reaching the operation in the declared order
+      Long64_t nPass;
+      Long64_t nRuns;     // calls of Process, differs from nCalls for a reordered cut
+      double time;        // wall time spent in Process, seconds
+      
+      void Clear() { ng = ng2 = time = 0.0; nCalls = nPass = nRuns = 0; }
+      void Add(const OpData & o) { ng += o.ng; ng2 += o.ng2; nCalls += o.nCalls; nPass += o.nPass; nRuns += o.nRuns; time += o.time; }
     };
     
+    // Chain of operations run with one variation, the nominal one is the first
+    struct Chain 
+    {
+      std::string name;
+      float energyScale;
+      int jerMode;
+      std::vector<OpData> ops;
+      std::vector<size_t> order;   // run order of ops after the profiling, empty before
+      std::vector<char> ran;       // ops run on the current event
+      double ng_total;
+    };
+    
+    struct Worker 
+    {
+      EventData *ev;
+      std::vector<Chain> chains;
+      double ng_all;
+      Long64_t reorderEvents;
+    };
+    
+    // profileOnly returns once the first reorderEvents events have set the run order
+    static void EventLoop(EventData & ev, std::vector<Chain> & chains, double & ng_all, Long64_t reorderEvents, bool profileOnly);
+    static bool RunOperation(OpData & data, EventData & ev);
+    static void Reorder(Chain & chain);
+    static void RunWorker(Worker * worker);
+    
+    // Fill the variation chains from the nominal one
+    void BuildVariations();
+    
     std::string mLogFileName;
-    std::vector<OpData> mOperations;
+    Long64_t mReorderEvents;
+    std::vector<Chain> mChains;
+    std::vector<Operation::_Base*> mVariationOps;   // owned
   };
   
   //------------------Histogram Class---------------------------------------------------------
@@ -128,6 +210,7 @@ namespace Operation
     ~PrintEvent();
     bool Process(EventData & eventData);
     std::ostream& Description(std::ostream& ostrm);
+    Operation::_Base* Clone() { return new PrintEvent(*this); }
   private:
     double mRun;
     double mLumi;
@@ -144,6 +227,8 @@ namespace Operation
 
     bool Process(EventData & eventData);
     std::ostream& Description(std::ostream& ostrm);
+    Operation::_Base* Clone() { return new GoodVertexCut(*this); }
+    bool Commutes() { return true; }
   };
 
   
@@ -155,6 +240,8 @@ namespace Operation
     ~CutNoiseClean();
     bool Process(EventData & eventData);
     std::ostream& Description(std::ostream& ostrm);
+    Operation::_Base* Clone() { return new CutNoiseClean(*this); }
+    bool Commutes() { return true; }
   private:
     double mJetfHPD;
     double mJetfRBX;
@@ -171,6 +258,8 @@ namespace Operation
     ~CutMet();
     bool Process(EventData & eventData);
     std::ostream& Description(std::ostream& ostrm);
+    Operation::_Base* Clone() { return new CutMet(*this); }
+    bool Commutes() { return true; }
   private:
     double mCut;
     bool mNoLep;
@@ -184,6 +273,8 @@ namespace Operation
     ~CutMetElec();
     bool Process(EventData & eventData);
     std::ostream& Description(std::ostream& ostrm);
+    Operation::_Base* Clone() { return new CutMetElec(*this); }
+    bool Commutes() { return true; }
   private:
     double mCut;
   };
@@ -196,6 +287,8 @@ namespace Operation
     ~CutHLT();
     bool Process(EventData & eventData);
     std::ostream& Description(std::ostream& ostrm);
+    Operation::_Base* Clone() { return new CutHLT(*this); }
+    bool Commutes() { return true; }
   private:
     int mBit;
   };
@@ -208,6 +301,8 @@ namespace Operation
     ~CutNJet();
     bool Process(EventData & eventData);
     std::ostream& Description(std::ostream& ostrm);
+    Operation::_Base* Clone() { return new CutNJet(*this); }
+    bool Commutes() { return true; }
   private:
     int mCut;
   };  
@@ -220,6 +315,8 @@ namespace Operation
     ~CutWideNJet();
     bool Process(EventData & eventData);
     std::ostream& Description(std::ostream& ostrm);
+    Operation::_Base* Clone() { return new CutWideNJet(*this); }
+    bool Commutes() { return true; }
   private:
     int mCut;
   };
@@ -232,6 +329,8 @@ namespace Operation
     ~CutJet1();
     bool Process(EventData & eventData);
     std::ostream& Description(std::ostream& ostrm);
+    Operation::_Base* Clone() { return new CutJet1(*this); }
+    bool Commutes() { return true; }
   private:
     double mJetPt;
     double mJetEta;
@@ -247,6 +346,8 @@ namespace Operation
     ~CutJet1BTag();
     bool Process(EventData & eventData);
     std::ostream& Description(std::ostream& ostrm);
+    Operation::_Base* Clone() { return new CutJet1BTag(*this); }
+    bool Commutes() { return true; }
   private:
     double mCombinedSecondaryVertex;
   }; 
@@ -259,6 +360,8 @@ namespace Operation
     ~CutJet2();
     bool Process(EventData & eventData);
     std::ostream& Description(std::ostream& ostrm);
+    Operation::_Base* Clone() { return new CutJet2(*this); }
+    bool Commutes() { return true; }
   private:
     double mJetPt;
     double mJetEta;
@@ -272,6 +375,8 @@ namespace Operation
     ~CutWideJet1();
     bool Process(EventData & eventData);
     std::ostream& Description(std::ostream& ostrm);
+    Operation::_Base* Clone() { return new CutWideJet1(*this); }
+    bool Commutes() { return true; }
   private:
     double mJetPt;
     double mJetEta;
@@ -287,6 +392,8 @@ namespace Operation
     ~CutDeltaPhi1();
     bool Process(EventData & eventData);
     std::ostream& Description(std::ostream& ostrm);
+    Operation::_Base* Clone() { return new CutDeltaPhi1(*this); }
+    bool Commutes() { return true; }
   private:
     double mCut1;
   };
@@ -299,6 +406,8 @@ namespace Operation
     ~CutDeltaPhi2();
     bool Process(EventData & eventData);
     std::ostream& Description(std::ostream& ostrm);
+    Operation::_Base* Clone() { return new CutDeltaPhi2(*this); }
+    bool Commutes() { return true; }
   private:
     double mCut1;
   };
@@ -311,6 +420,8 @@ namespace Operation
     ~CutDeltaPhi3();
     bool Process(EventData & eventData);
     std::ostream& Description(std::ostream& ostrm);
+    Operation::_Base* Clone() { return new CutDeltaPhi3(*this); }
+    bool Commutes() { return true; }
   private:
     double mCut1;
   };	
@@ -323,6 +434,8 @@ namespace Operation
     ~CutWideDeltaPhi3();
     bool Process(EventData & eventData);
     std::ostream& Description(std::ostream& ostrm);
+    Operation::_Base* Clone() { return new CutWideDeltaPhi3(*this); }
+    bool Commutes() { return true; }
   private:
     double mCut1;
   };	
@@ -335,6 +448,8 @@ namespace Operation
     ~NoIsoMuon();
     bool Process(EventData & eventData);
     std::ostream& Description(std::ostream& ostrm);
+    Operation::_Base* Clone() { return new NoIsoMuon(*this); }
+    bool Commutes() { return true; }
   private:
     double mPt;  
   };	
@@ -347,6 +462,8 @@ namespace Operation
     ~IsoMuon();
     bool Process(EventData & eventData);
     std::ostream& Description(std::ostream& ostrm);
+    Operation::_Base* Clone() { return new IsoMuon(*this); }
+    bool Commutes() { return true; }
   private:
     double mPt;  
   };	
@@ -359,6 +476,7 @@ namespace Operation
     ~CutAbnormalEvents();
     bool Process(EventData & eventData);
     std::ostream& Description(std::ostream& ostrm);
+    Operation::_Base* Clone() { return new CutAbnormalEvents(*this); }
   private:
     vector<int> mRun;
     vector<int> mEvt;
@@ -372,6 +490,8 @@ namespace Operation
     ~CutElecMuon();
     bool Process(EventData & eventData);
     std::ostream& Description(std::ostream& ostrm);
+    Operation::_Base* Clone() { return new CutElecMuon(*this); }
+    bool Commutes() { return true; }
   private:
     double mCut;  
   };
@@ -384,6 +504,8 @@ namespace Operation
     ~CutTIV();
     bool Process(EventData & eventData);
     std::ostream& Description(std::ostream& ostrm);
+    Operation::_Base* Clone() { return new CutTIV(*this); }
+    bool Commutes() { return true; }
   private:
     double mCut;  
   };
@@ -396,6 +518,8 @@ namespace Operation
     ~CutTau();
     bool Process(EventData & eventData);
     std::ostream& Description(std::ostream& ostrm);
+    Operation::_Base* Clone() { return new CutTau(*this); }
+    bool Commutes() { return true; }
   private:
     double mPF, mAgainstLepton;  
   };
@@ -408,6 +532,7 @@ namespace Operation
     ~GenParExist();
     bool Process(EventData & eventData);
     std::ostream& Description(std::ostream& ostrm);
+    Operation::_Base* Clone() { return new GenParExist(*this); }
   private:
     int mPdgId;  
   };
@@ -420,6 +545,7 @@ namespace Operation
     ~GenParMassWindow();
     bool Process(EventData & eventData);
     std::ostream& Description(std::ostream& ostrm);
+    Operation::_Base* Clone() { return new GenParMassWindow(*this); }
   private:
     int mPdgId;  
     double mLowM;
@@ -434,6 +560,7 @@ namespace Operation
     ~GenZmumu ();
     bool Process(EventData & eventData);
     std::ostream& Description(std::ostream& ostrm);
+    Operation::_Base* Clone() { return new GenZmumu(*this); }
   private:
     int mPdgId;
   };	
@@ -446,6 +573,7 @@ namespace Operation
     ~GenParPt ();
     bool Process(EventData & eventData);
     std::ostream& Description(std::ostream& ostrm);
+    Operation::_Base* Clone() { return new GenParPt(*this); }
   private:
     int mPdgId;
     double mPt;
@@ -460,6 +588,7 @@ namespace Operation
     ~GenParPtAndMET ();
     bool Process(EventData & eventData);
     std::ostream& Description(std::ostream& ostrm);
+    Operation::_Base* Clone() { return new GenParPtAndMET(*this); }
   private:
     int mPdgId;
     double mGenPt;
@@ -475,6 +604,7 @@ namespace Operation
     ~GenParPtOrMET ();
     bool Process(EventData & eventData);
     std::ostream& Description(std::ostream& ostrm);
+    Operation::_Base* Clone() { return new GenParPtOrMET(*this); }
   private:
     int mPdgId;
     double mGenPt;
@@ -490,6 +620,7 @@ namespace Operation
     ~WsignSelection();
     bool Process(EventData & eventData);
     std::ostream& Description(std::ostream& ostrm);
+    Operation::_Base* Clone() { return new WsignSelection(*this); }
   private:
     double mCharge;  
   };
@@ -502,6 +633,7 @@ namespace Operation
     ~ZSelection();
     bool Process(EventData & eventData);
     std::ostream& Description(std::ostream& ostrm);
+    Operation::_Base* Clone() { return new ZSelection(*this); }
   private:
     double mCharge;
   };	
@@ -514,6 +646,7 @@ namespace Operation
     ~PFLepIso();
     bool Process(EventData & eventData);
     std::ostream& Description(std::ostream& ostrm);
+    Operation::_Base* Clone() { return new PFLepIso(*this); }
   private:
     double mPt;
     double mEta;
@@ -527,6 +660,8 @@ namespace Operation
     ~NoPFMuon();
     bool Process(EventData & eventData);
     std::ostream& Description(std::ostream& ostrm);
+    Operation::_Base* Clone() { return new NoPFMuon(*this); }
+    bool Commutes() { return true; }
   private:
     double mPt;
     double mEta;   
@@ -540,10 +675,46 @@ namespace Operation
     ~NoPFElec();
     bool Process(EventData & eventData);
     std::ostream& Description(std::ostream& ostrm);
+    Operation::_Base* Clone() { return new NoPFElec(*this); }
+    bool Commutes() { return true; }
   private:
     double mPt;
     double mEta;   
   };	
+  
+  //----------------------Cut efficiency for several cut points in one pass-------------------
+  // Every cut is evaluated once per event. A configuration is the set of cuts
+  // it requires (bit i = cut i); its operation runs when all of them passed.
+  class MultiCutEff : public Operation::_Base 
+  {
+  public:
+    MultiCutEff(const std::string & logFileName);
+    ~MultiCutEff();
+    void AddCut(Operation::_Base * aCut);
+    void AddConfig(const std::string & name, unsigned int mask, Operation::_Base * aOp);
+    bool Process(EventData & eventData);
+    std::ostream& Description(std::ostream& ostrm);
+    Operation::_Base* Clone();
+    Operation::_Base* CloneVariation(const std::string & variation);
+    void Merge(Operation::_Base * aClone);
+  private:
+    struct ConfigData 
+    { 
+      std::string name;
+      unsigned int mask;
+      Operation::_Base *op;
+      double ng;
+      std::vector<double> ngCut;   // events passing the required cuts up to cut i
+    };
+    void BuildUsedBy();
+    
+    std::string mLogFileName;
+    bool mIsClone;
+    bool mOwnsOps;
+    std::vector<Operation::_Base*> mCuts;
+    std::vector<unsigned int> mUsedBy;   // configurations that require cut i, built on the first event
+    std::vector<ConfigData> mConfigs;
+  };
 }
 
 #include "Operation.cc"
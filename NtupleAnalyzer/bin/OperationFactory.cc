@@ -0,0 +1,195 @@
+#include "OperationFactory.h"
+
+#include <fstream>
+#include <sstream>
+#include <set>
+#include <stdlib.h>
+
+using namespace std;
+using namespace Operation;
+using namespace Histogram01;
+using namespace Histogram02;
+
+namespace Operation 
+{
+  
+  static double D(const vector<string> & a, size_t i, double def = 0) { return i < a.size() ? atof(a[i].c_str()) : def; }
+  static int    I(const vector<string> & a, size_t i, int def = 0)    { return i < a.size() ? atoi(a[i].c_str()) : def; }
+  
+  ChainBuilder::ChainBuilder(const std::string & outputPrefix) : mOutputPrefix(outputPrefix), mReorderEvents(0) {}
+  
+  ChainBuilder::~ChainBuilder() 
+  {
+    for(size_t i=0; i<mOps.size(); i++) delete mOps[i];
+  }
+  
+  
+  std::map<std::string, ChainBuilder::Entry> & ChainBuilder::Registry()
+  {
+    static map<string, Entry> registry;
+    if ( !registry.empty() ) return registry;
+    
+    // cuts
+    registry["PrintEvent"]       = Entry( "ddd"  , "run lumi event"                      , [](const Args & a, const string &) -> _Base* { return new PrintEvent(D(a,0), D(a,1), D(a,2)); } );
+    registry["GoodVertexCut"]    = Entry( ""     , ""                                    , [](const Args &  , const string &) -> _Base* { return new GoodVertexCut(); } );
+    registry["CutNoiseClean"]    = Entry( "ddidd", "fHPD fRBX n90Hits emfMin emfMax"     , [](const Args & a, const string &) -> _Base* { return new CutNoiseClean(D(a,0), D(a,1), I(a,2), D(a,3), D(a,4)); } );
+    registry["CutMet"]           = Entry( "dB"   , "met [nolep]"                         , [](const Args & a, const string &) -> _Base* { return new CutMet(D(a,0), I(a,1)); } );
+    registry["CutMetElec"]       = Entry( "d"    , "met"                                 , [](const Args & a, const string &) -> _Base* { return new CutMetElec(D(a,0)); } );
+    registry["CutHLT"]           = Entry( "i"    , "bit"                                 , [](const Args & a, const string &) -> _Base* { return new CutHLT(I(a,0)); } );
+    registry["CutNJet"]          = Entry( "i"    , "maxJets"                             , [](const Args & a, const string &) -> _Base* { return new CutNJet(I(a,0)); } );
+    registry["CutWideNJet"]      = Entry( "i"    , "maxJets"                             , [](const Args & a, const string &) -> _Base* { return new CutWideNJet(I(a,0)); } );
+    registry["CutJet1"]          = Entry( "dddd" , "pt eta emfMin emfMax"                , [](const Args & a, const string &) -> _Base* { return new CutJet1(D(a,0), D(a,1), D(a,2), D(a,3)); } );
+    registry["CutJet1BTag"]      = Entry( "d"    , "csv"                                 , [](const Args & a, const string &) -> _Base* { return new CutJet1BTag(D(a,0)); } );
+    registry["CutJet2"]          = Entry( "dd"   , "pt eta"                              , [](const Args & a, const string &) -> _Base* { return new CutJet2(D(a,0), D(a,1)); } );
+    registry["CutWideJet1"]      = Entry( "dddd" , "pt eta emfMin emfMax"                , [](const Args & a, const string &) -> _Base* { return new CutWideJet1(D(a,0), D(a,1), D(a,2), D(a,3)); } );
+    registry["CutDeltaPhi1"]     = Entry( "d"    , "dphi"                                , [](const Args & a, const string &) -> _Base* { return new CutDeltaPhi1(D(a,0)); } );
+    registry["CutDeltaPhi2"]     = Entry( "d"    , "dphi"                                , [](const Args & a, const string &) -> _Base* { return new CutDeltaPhi2(D(a,0)); } );
+    registry["CutDeltaPhi3"]     = Entry( "d"    , "dphi"                                , [](const Args & a, const string &) -> _Base* { return new CutDeltaPhi3(D(a,0)); } );
+    registry["CutWideDeltaPhi3"] = Entry( "d"    , "dphi"                                , [](const Args & a, const string &) -> _Base* { return new CutWideDeltaPhi3(D(a,0)); } );
+    registry["NoIsoMuon"]        = Entry( "d"    , "pt"                                  , [](const Args & a, const string &) -> _Base* { return new NoIsoMuon(D(a,0)); } );
+    registry["IsoMuon"]          = Entry( "d"    , "pt"                                  , [](const Args & a, const string &) -> _Base* { return new IsoMuon(D(a,0)); } );
+    registry["CutElecMuon"]      = Entry( "d"    , "cut"                                 , [](const Args & a, const string &) -> _Base* { return new CutElecMuon(D(a,0)); } );
+    registry["CutTIV"]           = Entry( "d"    , "tiv"                                 , [](const Args & a, const string &) -> _Base* { return new CutTIV(D(a,0)); } );
+    registry["CutTau"]           = Entry( "ii"   , "pf againstLepton"                    , [](const Args & a, const string &) -> _Base* { return new CutTau(I(a,0), I(a,1)); } );
+    registry["GenParExist"]      = Entry( "i"    , "pdgId"                               , [](const Args & a, const string &) -> _Base* { return new GenParExist(I(a,0)); } );
+    registry["GenParMassWindow"] = Entry( "idd"  , "pdgId lowM highM"                    , [](const Args & a, const string &) -> _Base* { return new GenParMassWindow(I(a,0), D(a,1), D(a,2)); } );
+    registry["GenZmumu"]         = Entry( "i"    , "pdgId"                               , [](const Args & a, const string &) -> _Base* { return new GenZmumu(I(a,0)); } );
+    registry["GenParPt"]         = Entry( "id"   , "pdgId pt"                            , [](const Args & a, const string &) -> _Base* { return new GenParPt(I(a,0), D(a,1)); } );
+    registry["GenParPtAndMET"]   = Entry( "idd"  , "pdgId genPt met"                     , [](const Args & a, const string &) -> _Base* { return new GenParPtAndMET(I(a,0), D(a,1), D(a,2)); } );
+    registry["GenParPtOrMET"]    = Entry( "idd"  , "pdgId genPt met"                     , [](const Args & a, const string &) -> _Base* { return new GenParPtOrMET(I(a,0), D(a,1), D(a,2)); } );
+    registry["WsignSelection"]   = Entry( "d"    , "charge"                              , [](const Args & a, const string &) -> _Base* { return new WsignSelection(D(a,0)); } );
+    registry["ZSelection"]       = Entry( "d"    , "charge"                              , [](const Args & a, const string &) -> _Base* { return new ZSelection(D(a,0)); } );
+    registry["PFLepIso"]         = Entry( "dd"   , "pt eta"                              , [](const Args & a, const string &) -> _Base* { return new PFLepIso(D(a,0), D(a,1)); } );
+    registry["NoPFMuon"]         = Entry( "dd"   , "pt eta"                              , [](const Args & a, const string &) -> _Base* { return new NoPFMuon(D(a,0), D(a,1)); } );
+    registry["NoPFElec"]         = Entry( "dd"   , "pt eta"                              , [](const Args & a, const string &) -> _Base* { return new NoPFElec(D(a,0), D(a,1)); } );
+    
+    // histogrammers
+    registry["Histogrammer"]     = Entry( "s"    , "output.root"                         , [](const Args & a, const string & p) -> _Base* { return new Histogrammer(p+a[0]); } );
+    registry["hHLTEff"]          = Entry( "s"    , "output.root"                         , [](const Args & a, const string & p) -> _Base* { return new hHLTEff(p+a[0]); } );
+    registry["hDataMcMatching"]  = Entry( "s"    , "output.root"                         , [](const Args & a, const string & p) -> _Base* { return new hDataMcMatching(p+a[0]); } );
+    registry["hWZAnalysis"]      = Entry( "s"    , "output.root"                         , [](const Args & a, const string & p) -> _Base* { return new hWZAnalysis(p+a[0]); } );
+    registry["hWSourceAnalysis"] = Entry( "s"    , "output.root"                         , [](const Args & a, const string & p) -> _Base* { return new hWSourceAnalysis(p+a[0]); } );
+    registry["hTauAnalysis"]     = Entry( "s"    , "output.root"                         , [](const Args & a, const string & p) -> _Base* { return new hTauAnalysis(p+a[0]); } );
+    registry["hMuonAna"]         = Entry( "s"    , "output.root"                         , [](const Args & a, const string & p) -> _Base* { return new hMuonAna(p+a[0]); } );
+    
+    return registry;
+  }
+  
+  
+  bool ChainBuilder::CheckArgs(const Entry & entry, const Args & args, std::string & error)
+  {
+    size_t nRequired = 0;
+    for(size_t k=0; k<entry.args.size(); k++) if ( islower(entry.args[k]) ) nRequired++;
+    if ( args.size() < nRequired || args.size() > entry.args.size() ){
+      error = "expects " + entry.usage;
+      return false;
+    }
+    
+    for(size_t k=0; k<args.size(); k++){
+      char type = tolower(entry.args[k]);
+      const char * begin = args[k].c_str();
+      char * end = 0;
+      if ( type == 'd' ) strtod(begin, &end);
+      if ( type == 'i' || type == 'b' ) strtol(begin, &end, 10);
+      if ( type == 's' ) continue;
+      if ( end == begin || *end != 0 || ( type == 'b' && args[k] != "0" && args[k] != "1" ) ){
+	error = "parameter '" + args[k] + "' is not " + ( type == 'd' ? "a number" : type == 'i' ? "an integer" : "0 or 1" ) + ", expects " + entry.usage;
+	return false;
+      }
+    }
+    return true;
+  }
+  
+  
+  bool ChainBuilder::Read(const std::string & configFile)
+  {
+    ifstream in(configFile.c_str());
+    if ( !in ){
+      cerr << "ChainBuilder: can not read " << configFile << endl;
+      return false;
+    }
+    
+    map<string, Entry> & registry = Registry();
+    set<string> outputs;
+    bool ok = true;
+    int nLine = 0;
+    string line;
+    
+    while ( getline(in, line) ){
+      nLine++;
+      size_t hash = line.find('#');
+      if ( hash != string::npos ) line.erase(hash);
+      
+      istringstream fields(line);
+      string name, arg;
+      Args args;
+      if ( !(fields >> name) ) continue;
+      while ( fields >> arg ) args.push_back(arg);
+      
+      if ( name == "Reorder" ){
+	char * end = 0;
+	if ( args.size() == 1 ) mReorderEvents = strtoll(args[0].c_str(), &end, 10);
+	if ( args.size() != 1 || *end != 0 || mReorderEvents <= 0 ){
+	  cerr << configFile << ":" << nLine << ": Reorder expects nEvents > 0" << endl;
+	  ok = false;
+	}
+	continue;
+      }
+      
+      map<string, Entry>::iterator entry = registry.find(name);
+      string error;
+      if ( entry == registry.end() ) error = "unknown operation " + name;
+      else if ( !CheckArgs(entry->second, args, error) ) error = name + " " + error;
+      else if ( entry->second.args == "s" && !outputs.insert(args[0]).second ) error = "output " + args[0] + " is used twice";
+      
+      if ( !error.empty() ){
+	cerr << configFile << ":" << nLine << ": " << error << endl;
+	ok = false;
+	continue;
+      }
+      
+      mNames.push_back(name);
+      mOps.push_back( entry->second.maker(args, mOutputPrefix) );
+    }
+    
+    if ( ok && mOps.empty() ){
+      cerr << configFile << ": no operation" << endl;
+      ok = false;
+    }
+    if ( ok && outputs.empty() ) cerr << configFile << ": warning, no histogrammer in the chain, only the cut flow is written" << endl;
+    
+    return ok;
+  }
+  
+  
+  void ChainBuilder::AddTo(Manager & manager)
+  {
+    for(size_t i=0; i<mOps.size(); i++) manager.Add(mOps[i]);
+    if ( mReorderEvents > 0 ) manager.SetReordering(mReorderEvents);
+  }
+  
+  
+  std::ostream& ChainBuilder::Description(std::ostream& ostrm)
+  {
+    if ( mReorderEvents > 0 ) ostrm << "Commuting cuts reordered after " << mReorderEvents << " events" << endl;
+    for(size_t i=0; i<mOps.size(); i++){
+      ostrm.width(3);
+      ostrm << i << " " << *mOps[i] << endl;
+    }
+    return ostrm;
+  }
+  
+  
+  std::ostream& ChainBuilder::Usage(std::ostream& ostrm)
+  {
+    map<string, Entry> & registry = Registry();
+    ostrm << "  Reorder           nEvents" << endl;
+    for(map<string, Entry>::iterator i=registry.begin(); i!=registry.end(); ++i){
+      ostrm << "  " << i->first;
+      for(size_t k=i->first.size(); k<18; k++) ostrm << " ";
+      ostrm << i->second.usage << endl;
+    }
+    return ostrm;
+  }
+  
+}
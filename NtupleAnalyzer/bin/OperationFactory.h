@@ -0,0 +1,65 @@
+#ifndef OperationFactory_h
+#define OperationFactory_h
+
+#include "EventData.h"
+#include "Operation.h"
+#include "Histogram01.h"
+#include "Histogram02.h"
+
+#include <iostream>
+#include <string>
+#include <vector>
+#include <map>
+
+namespace Operation 
+{
+  //----------------------Operation chain read from a configuration file------------------------
+  // One operation per line, the class name followed by its constructor parameters:
+  //     CutJet1          110 2.5 0.02 0.98
+  //     hDataMcMatching  AnaMonoJet_3.root
+  // The output file of a histogrammer is written after outputPrefix ("folder/sample_").
+  // Everything after a # is a comment. A line "Reorder nEvents" lets the Manager
+  // reorder the commuting cuts after nEvents profiling events
+  class ChainBuilder 
+  {
+  public:
+    ChainBuilder(const std::string & outputPrefix);
+    ~ChainBuilder();   // deletes the operations
+    
+    // Read and check the whole file, every error is printed and makes it return false
+    bool Read(const std::string & configFile);
+    
+    // Add the chain to the manager, in the order of the file
+    void AddTo(Manager & manager);
+    
+    std::ostream& Description(std::ostream& ostrm);
+    
+    // Known operations with their parameters
+    static std::ostream& Usage(std::ostream& ostrm);
+    
+  private:
+    typedef std::vector<std::string> Args;
+    typedef Operation::_Base* (*Maker)(const Args & args, const std::string & outputPrefix);
+    
+    // args: one letter per parameter, d (double), i (int), b (0 or 1), s (string),
+    // upper case for the optional ones
+    struct Entry 
+    {
+      Entry() : maker(0) {}
+      Entry(const std::string & a, const std::string & u, Maker m) : args(a), usage(u), maker(m) {}
+      std::string args;
+      std::string usage;
+      Maker maker;
+    };
+    static std::map<std::string, Entry> & Registry();
+    static bool CheckArgs(const Entry & entry, const Args & args, std::string & error);
+    
+    std::string mOutputPrefix;
+    Long64_t mReorderEvents;
+    std::vector<std::string> mNames;
+    std::vector<Operation::_Base*> mOps;
+  };
+}
+
+#include "OperationFactory.cc"
+#endif
@@ -10,15 +10,23 @@
 #include <map>
 #include <stdio.h>
 #include <stdlib.h>
+#include <ctype.h>
 #include "TH1D.h"
 
 
 #include <TString.h>
 #include <TFile.h>
 
+#include <unistd.h>
+#include <dirent.h>
+#include <fcntl.h>
+#include <sys/wait.h>
+#include <sstream>
+
 #include "Histogram01.h"
 #include "Histogram02.h"
 #include "Constants.h"
+#include "HistMerger.h"
 
 
 using namespace Histogram01;
@@ -27,15 +35,367 @@ using namespace Constants;
 using namespace std;
 
 
+//------------------------------------------------------------------------------------------------
+// Local scheduler: the sample is split in entry ranges, given to the analysis program as
+// sample@first-last, and the chunks run as child processes on this machine
+
+struct Chunk
+{
+	string name;      // sample@first-last
+	int    tries;
+	pid_t  pid;
+	bool   done;
+};
+
+
+// Start one chunk, its output goes to folder/sample@first-last.out
+pid_t StartChunk(const vector<string> & args, const string & outFile)
+{
+	pid_t pid = fork();
+	if ( pid != 0 ) return pid;
+
+	int fd = open(outFile.c_str(), O_WRONLY | O_CREAT | O_TRUNC, 0644);
+	if ( fd >= 0 ) { dup2(fd, 1); dup2(fd, 2); close(fd); }
+
+	vector<char*> cargs;
+	for(size_t i=0; i<args.size(); i++) cargs.push_back( (char*) args[i].c_str() );
+	cargs.push_back(0);
+	execvp(cargs[0], &cargs[0]);
+	_exit(127);
+}
+
+
+// Files of folder starting with prefix
+vector<string> ListFiles(const string & folder, const string & prefix)
+{
+	vector<string> files;
+	DIR * dir = opendir(folder.c_str());
+	if ( !dir ) return files;
+	struct dirent * entry;
+	while ( (entry = readdir(dir)) )
+	{
+		string name = entry->d_name;
+		if ( name.compare(0, prefix.size(), prefix) == 0 ) files.push_back(name);
+	}
+	closedir(dir);
+	return files;
+}
+
+
+// Remove what a previous try of a chunk left, the log files are opened in append mode
+void CleanChunk(const string & folder, const string & chunk)
+{
+	vector<string> files = ListFiles(folder, chunk);
+	for(size_t i=0; i<files.size(); i++)
+	{
+		if ( files[i].size() > 4 && files[i].substr(files[i].size()-4) == ".out" ) continue;
+		unlink( (folder + "/" + files[i]).c_str() );
+	}
+}
+
+
+// One line of a cut flow written by Manager::OutputJSON: its numbers, the key of each
+// number and the text around them (text has one element more than values)
+struct JSONLine
+{
+	vector<string> text;
+	vector<string> keys;
+	vector<double> values;
+};
+
+
+JSONLine ParseJSONLine(const string & line)
+{
+	JSONLine parsed;
+	string text, lastString;
+	size_t i = 0;
+	while ( i < line.size() )
+	{
+		char c = line[i];
+		if ( c == '"' )
+		{
+			size_t start = i++;
+			while ( i < line.size() && line[i] != '"' ) i += line[i] == '\\' ? 2 : 1;
+			if ( i > line.size() ) i = line.size();
+			lastString = line.substr(start+1, i-start-1);
+			if ( i < line.size() ) i++;
+			text += line.substr(start, i-start);
+		}
+		else if ( c == '-' || c == '.' || isdigit(c) )
+		{
+			char * end;
+			double value = strtod(line.c_str()+i, &end);
+			parsed.text.push_back(text);
+			parsed.keys.push_back(lastString);
+			parsed.values.push_back(value);
+			text.clear();
+			i = end - line.c_str();
+		}
+		else
+		{
+			text += c;
+			i++;
+		}
+	}
+	parsed.text.push_back(text);
+	return parsed;
+}
+
+
+// Add up the <chunk>.json cut flows into <sample>.json: counts, weights and times are
+// summed, the rejection and time fraction of each operation computed again
+bool MergeCutFlows(const string & folder, const string & sample, const vector<Chunk> & chunks)
+{
+	vector<JSONLine> lines;
+	for(size_t k=0; k<chunks.size(); k++)
+	{
+		ifstream json( (folder + "/" + chunks[k].name + ".json").c_str() );
+		if ( !json )
+		{
+			// programs without an operation Manager write no cut flow
+			if ( k == 0 ) return true;
+			cerr << "No cut flow " << chunks[k].name << ".json" << endl;
+			return false;
+		}
+
+		string line;
+		size_t n = 0;
+		while ( getline(json, line) )
+		{
+			// the log file name is the only text that differs between the chunks
+			for(size_t at = line.find(chunks[k].name); at != string::npos; at = line.find(chunks[k].name, at+sample.size()))
+				line.replace(at, chunks[k].name.size(), sample);
+
+			JSONLine parsed = ParseJSONLine(line);
+			if ( k == 0 ) lines.push_back(parsed);
+			else if ( n < lines.size() && lines[n].text == parsed.text && lines[n].keys == parsed.keys )
+			{
+				for(size_t i=0; i<parsed.values.size(); i++)
+					if ( parsed.keys[i] != "position" ) lines[n].values[i] += parsed.values[i];
+			}
+			else
+			{
+				cerr << "Cut flow of " << chunks[k].name << " does not match the first chunk" << endl;
+				return false;
+			}
+			n++;
+		}
+	}
+
+	ofstream outfile( (folder + "/" + sample + ".json").c_str() );
+	outfile.precision(10);
+	double variationTime = 0.;
+	for(size_t n=0; n<lines.size(); n++)
+	{
+		JSONLine & line = lines[n];
+		map<string, double> value;
+		for(size_t i=0; i<line.values.size(); i++) value[ line.keys[i] ] = line.values[i];
+
+		// the time of a variation comes before the list of its operations
+		if ( value.count("time") && !value.count("calls") ) variationTime = value["time"];
+
+		for(size_t i=0; i<line.values.size(); i++)
+		{
+			if ( !value.count("calls") ) continue;
+			if ( line.keys[i] == "rejection" )    line.values[i] = value["calls"] > 0 ? 1. - value["passed"]/value["calls"] : 0.;
+			if ( line.keys[i] == "timeFraction" ) line.values[i] = variationTime > 0 ? value["time"]/variationTime : 0.;
+		}
+
+		for(size_t i=0; i<line.values.size(); i++) outfile << line.text[i] << line.values[i];
+		outfile << line.text.back() << endl;
+	}
+	return true;
+}
+
+
+// Merge the histogram files of the chunks and add up the "Events surviving" counts of their logs
+// and their JSON cut flows
+bool MergeChunks(const string & folder, const string & sample, const vector<Chunk> & chunks, int nThreads)
+{
+	bool ok = true;
+
+	vector<string> outputs = ListFiles(folder, chunks[0].name);
+	for(size_t i=0; i<outputs.size(); i++)
+	{
+		string suffix = outputs[i].substr( chunks[0].name.size() );
+		if ( suffix.size() < 5 || suffix.substr(suffix.size()-5) != ".root" ) continue;
+
+		HistMerger merger(nThreads);
+		for(size_t k=0; k<chunks.size(); k++) ok = merger.addGroup(folder + "/" + chunks[k].name + suffix) && ok;
+		if ( !merger.writeSum(folder + "/" + sample + suffix) )
+		{
+			cerr << "Merging failed: " << sample << suffix << endl;
+			ok = false;
+		}
+	}
+
+	// the log lines are in the same order for every chunk
+	vector<string> lines;
+	vector<double> counts;
+	for(size_t k=0; k<chunks.size(); k++)
+	{
+		ifstream log( (folder + "/" + chunks[k].name + ".log").c_str() );
+		string line;
+		size_t n = 0;
+		while ( getline(log, line) )
+		{
+			size_t colon = line.rfind(": ");
+			bool isCount = line.compare(0, 16, "Events surviving") == 0 && colon != string::npos;
+			double ng = isCount ? atof( line.c_str()+colon+2 ) : 0.;
+			if ( isCount ) line = line.substr(0, colon+2);
+			if ( k == 0 ) { lines.push_back(line); counts.push_back(ng); }
+			else if ( n < lines.size() && lines[n] == line ) counts[n] += ng;
+			else
+			{
+				cerr << "Log of " << chunks[k].name << " does not match the first chunk" << endl;
+				ok = false;
+				break;
+			}
+			n++;
+		}
+	}
+
+	ofstream outfile( (folder + "/" + sample + ".log").c_str(), ios::app );
+	for(size_t n=0; n<lines.size(); n++)
+	{
+		if ( lines[n].compare(0, 16, "Events surviving") == 0 ) outfile << lines[n] << counts[n] << endl;
+		else outfile << lines[n] << endl;
+	}
+
+	ok = MergeCutFlows(folder, sample, chunks) && ok;
+
+	if ( ok ) for(size_t k=0; k<chunks.size(); k++) CleanChunk(folder, chunks[k].name);
+	return ok;
+}
+
+
+int RunLocal(int argc, char ** argv)
+{
+	if ( argc < 9 )
+	{
+		cerr << "Example:  SubmitCondor  wjets   AnaMonoJet   isMC(0 or 1)   mode(cuteff or cutorder)   local   nWorkers   cuts(jet,met,jetmet)   folder(./results/...)   [retries]" << endl;
+		return 1;
+	}
+
+	string sample  = argv[1];
+	string program = argv[2];
+	string isMC    = argv[3];
+	string mode    = argv[4];
+	int nWorkers   = atoi(argv[6]);
+	string cuts    = argv[7];
+	string folder  = Constants::outputDir + "results/" + argv[8];
+	int retries    = argc >= 10 ? atoi(argv[9]) : 2;
+	if ( nWorkers < 1 ) nWorkers = 1;
+
+	// a few chunks per worker, so a failed or slow chunk does not hold the others.
+	// The chunks end on file boundaries where possible, so most of them read whole files
+	Long64_t nentries = 0;
+	vector<Long64_t> bounds;
+	{
+		EventData ev(sample, 1000000000, atoi(isMC.c_str()));
+		nentries = ev.Entries();
+		bounds   = ev.SplitEntries( nentries < 4*nWorkers ? (nentries > 0 ? nentries : 1) : 4*nWorkers );
+	}
+	int nChunks = bounds.size()-1;
+
+	vector<Chunk> chunks;
+	for(int k=0; k<nChunks; k++)
+	{
+		stringstream name;
+		name << sample << "@" << bounds[k] << "-" << bounds[k+1];
+		Chunk chunk;
+		chunk.name  = name.str();
+		chunk.tries = 0;
+		chunk.pid   = 0;
+		chunk.done  = false;
+		chunks.push_back(chunk);
+	}
+
+	cout << "Running " << program << " on " << sample << ": " << nentries << " entries in " << nChunks << " chunks, " << nWorkers << " workers" << endl;
+
+	size_t next = 0;
+	int running = 0;
+	int failed  = 0;
+	vector<size_t> queue;
+	for(size_t k=0; k<chunks.size(); k++) queue.push_back(k);
+
+	while ( next < queue.size() || running > 0 )
+	{
+		// fill the free workers
+		while ( running < nWorkers && next < queue.size() )
+		{
+			Chunk & chunk = chunks[ queue[next++] ];
+			vector<string> args;
+			args.push_back(program);
+			args.push_back(chunk.name);
+			args.push_back("1000000000");
+			if ( mode == "cuteff" ) args.push_back("all");
+			args.push_back(isMC);
+			args.push_back(cuts);
+			args.push_back(argv[8]);
+
+			CleanChunk(folder, chunk.name);
+			chunk.tries++;
+			chunk.pid = StartChunk(args, folder + "/" + chunk.name + ".out");
+			if ( chunk.pid < 0 )
+			{
+				cerr << "Can not start " << chunk.name << endl;
+				failed++;
+				continue;
+			}
+			running++;
+		}
+
+		int status;
+		pid_t pid = wait(&status);
+		if ( pid < 0 ) break;
+
+		for(size_t k=0; k<chunks.size(); k++)
+		{
+			if ( chunks[k].pid != pid ) continue;
+			running--;
+			chunks[k].pid = 0;
+			if ( WIFEXITED(status) && WEXITSTATUS(status) == 0 )
+			{
+				chunks[k].done = true;
+				cout << "Done " << chunks[k].name << endl;
+			}
+			else if ( chunks[k].tries <= retries )
+			{
+				cout << "Failed " << chunks[k].name << ", retrying" << endl;
+				queue.push_back(k);
+			}
+			else
+			{
+				cerr << "Failed " << chunks[k].name << " after " << chunks[k].tries << " tries, see " << folder << "/" << chunks[k].name << ".out" << endl;
+				failed++;
+			}
+		}
+	}
+
+	if ( failed > 0 )
+	{
+		cerr << failed << " chunk(s) failed, the outputs are not merged" << endl;
+		return 1;
+	}
+
+	cout << "Merging " << nChunks << " chunks in " << folder << endl;
+	return MergeChunks(folder, sample, chunks, nWorkers) ? 0 : 1;
+}
+
+
 int main(int argc, char ** argv)
 {
-	if ( argc < 4 ) 
+	if ( argc < 5 ) 
 	{
 		cerr << "Program need more than this parameter " << endl;
 		cerr << "Example:  SubmitCondor  wjets   AnaMonoJet   isMC(0 or 1)   mode(cuteff or cutorder) " << endl;
+		cerr << "   or  :  SubmitCondor  wjets   AnaMonoJet   isMC(0 or 1)   mode(cuteff or cutorder)   local   nWorkers   cuts(jet,met,jetmet)   folder(./results/...)   [retries]" << endl;
 		return 1;
 	}
 
+	if ( argc >= 6 && string(argv[5]) == "local" ) return RunLocal(argc, argv);
+
 	string conout    = Constants::condorOutDir;
 	string conbin    = Constants::condorBin; 
 
@@ -76,34 +436,31 @@ int main(int argc, char ** argv)
 	else if( mode== "cuteff")
 	{
 
-		for(int i=0; i<9; i++)
-		{
-			ofstream file1;
-			file1.open( argv[1] );
+		// AnaMonoJetCutEff fills all cut numbers in one pass, a single job is enough
+		ofstream file1;
+		file1.open( argv[1] );
 	
-			file1 << "universe = vanilla"  << endl;
-			file1 << "Executable =" << conbin << argv[2]  << endl;
-			file1 << "Arguments ="  <<  argv[1]   << "  1000000000  "  << i << " " <<  argv[3]  << " " << argv[2]  <<  endl;  
-			file1 << "Requirements = Memory >= 199 &&OpSys == \"LINUX\"&& (Arch != \"DUMMY\" )" << endl;
-			file1 << "Should_Transfer_Files = YES"<< endl;
-			file1 << "WhenToTransferOutput = ON_EXIT"<< endl;
-			file1 << "getenv = true"<< endl;
-			file1 << "initialdir =" <<  conout   << endl;
-			file1 << "Output     =" <<  conout  << argv[1]  << "_$(Cluster)_$(Process).out"<< endl;
-			file1 << "Error      =" <<  conout  << argv[1]  << "_$(Cluster)_$(Process).err"<< endl;
-			file1 << "Log        =" <<  conout  << argv[1]  << "_$(Cluster)_$(Process).log"<< endl;
-			file1 << "notify_user = "<< endl;
-			file1 << "Queue 1"<< endl;	
-		
-			file1.close();
-		
-			string cmd = "condor_submit ";
-			cmd += argv[1];
-		
-		
-			system( cmd.c_str() );
-
-		}
+		file1 << "universe = vanilla"  << endl;
+		file1 << "Executable =" << conbin << argv[2]  << endl;
+		file1 << "Arguments ="  <<  argv[1]   << "  1000000000  all " <<  argv[3]  << " " << argv[2]  <<  endl;  
+		file1 << "Requirements = Memory >= 199 &&OpSys == \"LINUX\"&& (Arch != \"DUMMY\" )" << endl;
+		file1 << "Should_Transfer_Files = YES"<< endl;
+		file1 << "WhenToTransferOutput = ON_EXIT"<< endl;
+		file1 << "getenv = true"<< endl;
+		file1 << "initialdir =" <<  conout   << endl;
+		file1 << "Output     =" <<  conout  << argv[1]  << "_$(Cluster)_$(Process).out"<< endl;
+		file1 << "Error      =" <<  conout  << argv[1]  << "_$(Cluster)_$(Process).err"<< endl;
+		file1 << "Log        =" <<  conout  << argv[1]  << "_$(Cluster)_$(Process).log"<< endl;
+		file1 << "notify_user = "<< endl;
+		file1 << "Queue 1"<< endl;	
+	
+		file1.close();
+	
+		string cmd = "condor_submit ";
+		cmd += argv[1];
+	
+	
+		system( cmd.c_str() );
 	}
 
 
@@ -11,6 +11,11 @@ NtupleAnalyzerTemplate = cms.EDAnalyzer(
     'NtupleAnalyzer',
     debugMode               = cms.bool(False),
     includeNonPFCollection  = cms.bool(False),
+    compactOutput           = cms.bool(False), # Double_t leaves written as Float_t, EventData reads them back as double
+    compactMantissaBits     = cms.int32(0),    # 2-22: mantissa bits kept for the compactTruncated leaves
+    compactTruncated        = cms.vstring("EngFrac", "fHPD", "fRBX", "Emf"),
+    branchSelection         = cms.vstring("keep *"), # "keep/drop <pattern>", last match wins, e.g. "drop PFTauDis*"
+    validateLabelIndex      = cms.bool(False), # check the cached b-tag/tau ID positions on every read
     #
     TriggerTag              = cms.untracked.InputTag('TriggerResults::HLT'),
     triggerUsed             = cms.double(0), #Use to skip noTrig
@@ -24,7 +24,7 @@
 
 // user include files
 #include "FWCore/Framework/interface/Frameworkfwd.h"
-#include "FWCore/Framework/interface/EDAnalyzer.h"
+#include "FWCore/Framework/interface/one/EDAnalyzer.h"
 
 #include "FWCore/Framework/interface/Event.h"
 #include "FWCore/Framework/interface/MakerMacros.h"
@@ -52,7 +52,317 @@ using namespace edm;
 using namespace reco;
 using namespace std;
 
-class NtupleAnalyzer : public edm::EDAnalyzer 
+///------------------------------------------------
+/// Positions of a fixed list of labels in the (label, value) pairs of a PAT object.
+/// They are looked up on the first object of each run, the later reads are indexed
+///------------------------------------------------
+class LabelIndex
+{
+public:
+  LabelIndex(const char* const* labels, int n) : mLabels(labels, labels+n), mIndex(n, -1), mResolved(false) {}
+  
+  void Reset() { mResolved = false; }
+  const std::string & Label(int i) const { return mLabels[i]; }
+  
+  // index of label i in pairs, -1 if the object does not have it
+  int Find(const std::vector<std::pair<std::string,float> > & pairs, int i, bool validate)
+  {
+    int k = mIndex[i];
+    if( !mResolved || k>=(int)pairs.size() || (validate && k>=0 && pairs[k].first!=mLabels[i]) ){
+      if( mResolved ) edm::LogWarning("NtupleAnalyzer") << "Label " << mLabels[i] << " moved, resolving the label indices again";
+      Resolve(pairs);
+      k = mIndex[i];
+    }
+    return k;
+  }
+  
+private:
+  void Resolve(const std::vector<std::pair<std::string,float> > & pairs)
+  {
+    for(size_t i=0; i<mLabels.size(); i++){
+      mIndex[i] = -1;
+      for(size_t k=0; k<pairs.size(); k++)
+	if( pairs[k].first==mLabels[i] ){ mIndex[i] = k; break; }
+    }
+    mResolved = true;
+  }
+  
+  std::vector<std::string> mLabels;
+  std::vector<int>         mIndex;
+  bool                     mResolved;
+};
+
+// b-tag discriminators of the PF jets
+enum {
+  kBTagTrackCountingHighEff = 0,
+  kBTagTrackCountingHighPur,
+  kBTagJetProbability,
+  kBTagJetBProbability,
+  kBTagPfCombinedInclusiveSecondaryVertexV2,
+  kBTagCombinedSecondaryVertex,
+  kBTagCombinedSecondaryVertexMVA,
+  nBTagLabels
+};
+static const char* const bTagLabels[] = {
+  "trackCountingHighEffBJetTags",
+  "trackCountingHighPurBJetTags",
+  "jetProbabilityBJetTags",
+  "jetBProbabilityBJetTags",
+  "pfCombinedInclusiveSecondaryVertexV2BJetTags",
+  "combinedSecondaryVertexBJetTags",
+  "combinedSecondaryVertexMVABJetTags"
+};
+
+// tau IDs of the PF taus
+enum {
+  kTauAgainstElectronLoose = 0,
+  kTauAgainstElectronLooseMVA5,
+  kTauAgainstElectronMedium,
+  kTauAgainstElectronMediumMVA5,
+  kTauAgainstElectronTight,
+  kTauAgainstElectronTightMVA5,
+  kTauAgainstElectronVTightMVA5,
+  kTauAgainstElectronVLooseMVA5,
+  kTauAgainstMuonLoose3,
+  kTauAgainstMuonMedium2,
+  kTauAgainstMuonMedium,
+  kTauAgainstMuonTight3,
+  kTauByCombinedIsolationDeltaBetaCorrRaw3Hits,
+  kTauByLooseCombinedIsolationDeltaBetaCorr3Hits,
+  kTauByMediumCombinedIsolationDeltaBetaCorr3Hits,
+  kTauByTightCombinedIsolationDeltaBetaCorr3Hits,
+  kTauDecayModeFinding,
+  kTauDecayModeFindingNewDMs,
+  kTauChargedIsoPtSum,
+  kTauNeutralIsoPtSum,
+  kTauPuCorrPtSum,
+  nTauIDLabels
+};
+static const char* const tauIDLabels[] = {
+  "againstElectronLoose",
+  "againstElectronLooseMVA5",
+  "againstElectronMedium",
+  "againstElectronMediumMVA5",
+  "againstElectronTight",
+  "againstElectronTightMVA5",
+  "againstElectronVTightMVA5",
+  "againstElectronVLooseMVA5",
+  "againstMuonLoose3",
+  "againstMuonMedium2",
+  "againstMuonMedium",
+  "againstMuonTight3",
+  "byCombinedIsolationDeltaBetaCorrRaw3Hits",
+  "byLooseCombinedIsolationDeltaBetaCorr3Hits",
+  "byMediumCombinedIsolationDeltaBetaCorr3Hits",
+  "byTightCombinedIsolationDeltaBetaCorr3Hits",
+  "decayModeFinding",
+  "decayModeFindingNewDMs",
+  "chargedIsoPtSum",
+  "neutralIsoPtSum",
+  "puCorrPtSum"
+};
+
+///------------------------------------------------
+/// Table driven filler of one collection. Every field has a branch name ('%' stands
+/// for the collection prefix), a leaf type ('D' or 'I') and an extractor. The values
+/// are kept column by column, and fields whose branch is dropped are not extracted
+///------------------------------------------------
+template<class T> class Filler
+{
+public:
+  typedef double (*Getter)(const T &);
+  struct Field
+  {
+    const char* name;
+    char        type;
+    Getter      get;
+  };
+  
+  Filler(const std::string & prefix, const std::string & counter, const Field* fields, int nFields, int maxSize) :
+    mFields(fields, fields+nFields), mColumn(nFields), mActive(nFields, true), mPrefix(prefix), mCounter(counter),
+    mMax(maxSize), mN(0)
+  {
+    int nD = 0, nI = 0;
+    for(int f=0; f<nFields; f++){
+      std::string name = fields[f].name;
+      size_t pos = name.find('%');
+      if( pos!=std::string::npos ) name.replace(pos, 1, prefix);
+      mNames.push_back(name);
+      mColumn[f] = fields[f].type=='I' ? nI++ : nD++;
+    }
+    mD.assign(nD*maxSize, 0.);
+    mI.assign(nI*maxSize, 0);
+  }
+  
+  int                 Size() const                { return mFields.size(); }
+  const std::string & Name(int f) const           { return mNames[f]; }
+  const std::string & Prefix() const              { return mPrefix; }
+  const std::string & Counter() const             { return mCounter; }
+  int               & N()                         { return mN; }
+  void                SetActive(int f, bool on)   { mActive[f] = on; }
+  
+  void * Address(int f)
+  {
+    return mFields[f].type=='I' ? (void*) &mI[mColumn[f]*mMax] : (void*) &mD[mColumn[f]*mMax];
+  }
+  
+  std::string LeafList(int f) const
+  {
+    return mNames[f] + "[" + mCounter + "]/" + mFields[f].type;
+  }
+  
+  // value of the named field for object i, for the debug printout
+  double Value(const std::string & name, int i) const
+  {
+    for(size_t f=0; f<mFields.size(); f++)
+      if( mNames[f]==name ) return mFields[f].type=='I' ? mI[mColumn[f]*mMax+i] : mD[mColumn[f]*mMax+i];
+    return -999.;
+  }
+  
+  void Fill(const std::vector<T> & objects)
+  {
+    mN = std::min((int) objects.size(), mMax);
+    for(size_t f=0; f<mFields.size(); f++){
+      if( !mActive[f] ) continue;
+      Getter get = mFields[f].get;
+      if( mFields[f].type=='I' ){
+	int * column = &mI[mColumn[f]*mMax];
+	for(int i=0; i<mN; i++) column[i] = (int) get(objects[i]);
+      }
+      else{
+	double * column = &mD[mColumn[f]*mMax];
+	for(int i=0; i<mN; i++) column[i] = get(objects[i]);
+      }
+    }
+  }
+  
+private:
+  std::vector<Field>       mFields;
+  std::vector<std::string> mNames;
+  std::vector<int>         mColumn;
+  std::vector<bool>        mActive;
+  std::vector<double>      mD;
+  std::vector<int>         mI;
+  std::string              mPrefix;
+  std::string              mCounter;
+  int                      mMax;
+  int                      mN;
+};
+
+
+///------------------------------------------------
+/// PF jets: the stored jet is energy scale corrected, the jet ID and b-tags are read
+/// from the uncorrected one. gen is only set for MC
+///------------------------------------------------
+struct JetInput
+{
+  const pat::Jet     * cor;
+  pat::Jet             raw;
+  const reco::GenJet * gen;
+  bool                 mc;
+  float                bTag[nBTagLabels];
+};
+
+// JER data/MC scale factors in bins of |eta|: central, up, down
+static double JER(double eta, int var)
+{
+  static const double etaMax[5] = { 0.5, 1.1, 1.7, 2.3, 5.0 };
+  static const double sf[5][3]  = { {1.052, 0.990, 1.115}, {1.057, 1.001, 1.114}, {1.096, 1.032, 1.161},
+				    {1.134, 1.042, 1.228}, {1.288, 1.089, 1.488} };
+  for(int i=0; i<5; i++)
+    if( fabs(eta)<etaMax[i] ) return sf[i][var];
+  return -999.;
+}
+
+#define JET_FIELD(name, type, value) { name, type, [](const JetInput & j) -> double { (void) j; return (value); } }
+
+static const Filler<JetInput>::Field jetFields[] = {
+  JET_FIELD("%JetE"                       , 'D', j.raw.energy()),
+  JET_FIELD("%JetPt"                      , 'D', j.raw.pt()),
+  JET_FIELD("%JetPx"                      , 'D', j.raw.momentum().X()),
+  JET_FIELD("%JetPy"                      , 'D', j.raw.momentum().Y()),
+  JET_FIELD("%JetPz"                      , 'D', j.raw.momentum().Z()),
+  JET_FIELD("%JetEta"                     , 'D', j.cor->eta()),
+  JET_FIELD("%JetPhi"                     , 'D', j.cor->phi()),
+  //
+  JET_FIELD("%JetfHPD"                    , 'D', j.raw.jetID().fHPD),
+  JET_FIELD("%JetfRBX"                    , 'D', j.raw.jetID().fRBX),
+  JET_FIELD("%JetN90Hits"                 , 'D', j.raw.jetID().n90Hits),
+  JET_FIELD("%JetN90"                     , 'I', j.cor->n90()),
+  JET_FIELD("%JetSigEta"                  , 'D', j.cor->etaetaMoment()),
+  JET_FIELD("%JetSigPhi"                  , 'D', j.cor->phiphiMoment()),
+  JET_FIELD("%JetIDEmf"                   , 'D', j.raw.jetID().restrictedEMF),
+  //
+  JET_FIELD("%JetECor"                    , 'D', j.cor->energy()),
+  JET_FIELD("%JetPtCor"                   , 'D', j.cor->pt()),
+  JET_FIELD("%JetPxCor"                   , 'D', j.cor->momentum().X()),
+  JET_FIELD("%JetPyCor"                   , 'D', j.cor->momentum().Y()),
+  JET_FIELD("%JetPzCor"                   , 'D', j.cor->momentum().Z()),
+  //
+  JET_FIELD("%JetBtagTkCountHighEff"      , 'D', j.bTag[kBTagTrackCountingHighEff]),
+  JET_FIELD("%JetBtagTkCountHighPur"      , 'D', j.bTag[kBTagTrackCountingHighPur]),
+  JET_FIELD("%JetBtagJetProbability"      , 'D', j.bTag[kBTagJetProbability]),
+  JET_FIELD("%JetBtagJetBProbability"     , 'D', j.bTag[kBTagJetBProbability]),
+  JET_FIELD("%JetBTagCSVv2"               , 'D', j.bTag[kBTagPfCombinedInclusiveSecondaryVertexV2]),
+  JET_FIELD("%JetBTagCombSecVtx"          , 'D', j.bTag[kBTagCombinedSecondaryVertex]),
+  JET_FIELD("%JetBTagCombSecVtxMVA"       , 'D', j.bTag[kBTagCombinedSecondaryVertexMVA]),
+  //
+  JET_FIELD("%JetFlavour"                 , 'I', j.mc ? j.raw.partonFlavour() : 0),
+  JET_FIELD("%JetGenPartonFlavour"        , 'I', j.mc && j.raw.genParton() ? j.raw.genParton()->pdgId() : 0),
+  //
+  JET_FIELD("%JetNeuEmEngFrac"            , 'D', j.cor->neutralEmEnergyFraction()),
+  JET_FIELD("%JetChaEmEngFrac"            , 'D', j.cor->chargedEmEnergyFraction()),
+  JET_FIELD("%JetChaHadEngFrac"           , 'D', j.cor->chargedHadronEnergyFraction()),
+  JET_FIELD("%JetNeuHadEngFrac"           , 'D', j.cor->neutralHadronEnergyFraction()),
+  //
+  JET_FIELD("%JetChaEmEng"                , 'D', j.cor->chargedEmEnergy()),
+  JET_FIELD("%JetNeuEmEng"                , 'D', j.cor->neutralEmEnergy()),
+  JET_FIELD("%JetChaHadEng"               , 'D', j.cor->chargedHadronEnergy()),
+  JET_FIELD("%JetNeuHadEng"               , 'D', j.cor->neutralHadronEnergy()),
+  JET_FIELD("%JetPhotEng"                 , 'D', j.cor->photonEnergy()),
+  JET_FIELD("%JetElecEng"                 , 'D', j.cor->electronEnergy()),
+  JET_FIELD("%JetMuonEng"                 , 'D', j.cor->muonEnergy()),
+  JET_FIELD("%JetHFHadEng"                , 'D', j.cor->HFHadronEnergy()),
+  JET_FIELD("%JetHFEmEng"                 , 'D', j.cor->HFEMEnergy()),
+  JET_FIELD("%JetChaMuEng"                , 'D', j.cor->chargedMuEnergy()),
+  //
+  JET_FIELD("%JetNumOfChaMu"              , 'I', j.cor->chargedMultiplicity()),
+  JET_FIELD("%JetNumOfMuon"               , 'I', j.cor->muonMultiplicity()),
+  JET_FIELD("%JetNumOfPhot"               , 'I', j.cor->photonMultiplicity()),
+  JET_FIELD("%JetNumOfElec"               , 'I', j.cor->electronMultiplicity()),
+  JET_FIELD("%JetNumOfNeu"                , 'I', j.cor->neutralMultiplicity()),
+  JET_FIELD("%JetNumOfCha"                , 'I', j.cor->chargedMultiplicity()),
+  JET_FIELD("%JetNumOfNeuHad"             , 'I', j.cor->neutralHadronMultiplicity()),
+  JET_FIELD("%JetNumOfChaHad"             , 'I', j.cor->chargedHadronMultiplicity()),
+  JET_FIELD("%JetNumOfHFHad"              , 'I', j.cor->HFHadronMultiplicity()),
+  JET_FIELD("%JetNumOfHFEM"               , 'I', j.cor->HFEMMultiplicity()),
+  //
+  JET_FIELD("%JetNumOfDaughters"          , 'I', j.cor->numberOfDaughters()),
+  JET_FIELD("%JetIDLOOSE"                 , 'I', 0),//pfjetIDFunctorLoose
+  JET_FIELD("%JetIDTIGHT"                 , 'I', 0),//pfjetIDFunctorTight
+  JET_FIELD("%JetPUFullJetId"             , 'D', j.cor->userFloat("pileupJetId:fullDiscriminant")),
+  JET_FIELD("%uncer"                      , 'D', 0.),
+  /// Gen jets
+  JET_FIELD("Gen%JetE"                    , 'D', j.gen ? j.gen->energy()         : -999.),
+  JET_FIELD("Gen%JetPt"                   , 'D', j.gen ? j.gen->pt()             : -999.),
+  JET_FIELD("Gen%JetPx"                   , 'D', j.gen ? j.gen->momentum().X()   : -999.),
+  JET_FIELD("Gen%JetPy"                   , 'D', j.gen ? j.gen->momentum().Y()   : -999.),
+  JET_FIELD("Gen%JetPz"                   , 'D', j.gen ? j.gen->momentum().Z()   : -999.),
+  JET_FIELD("Gen%JetEta"                  , 'D', j.gen ? j.gen->eta()            : -999.),
+  JET_FIELD("Gen%JetPhi"                  , 'D', j.gen ? j.gen->phi()            : -999.),
+  JET_FIELD("Gen%JetEmEnergy"             , 'D', j.gen ? j.gen->emEnergy()       : -999.),
+  JET_FIELD("Gen%JetHadEnergy"            , 'D', j.gen ? j.gen->hadEnergy()      : -999.),
+  //
+  JET_FIELD("%JERCentral"                 , 'D', j.gen ? JER(j.cor->eta(), 0)    : -999.),
+  JET_FIELD("%JERUp"                      , 'D', j.gen ? JER(j.cor->eta(), 1)    : -999.),
+  JET_FIELD("%JERDown"                    , 'D', j.gen ? JER(j.cor->eta(), 2)    : -999.)
+};
+static const int nJetFields = sizeof(jetFields)/sizeof(jetFields[0]);
+
+#undef JET_FIELD
+
+
+class NtupleAnalyzer : public edm::one::EDAnalyzer<edm::one::SharedResources, edm::one::WatchRuns>
 {
 public:
   explicit NtupleAnalyzer(const edm::ParameterSet&);
@@ -61,12 +371,21 @@ public:
 private:
   virtual void beginJob();
   virtual void beginRun(const edm::Run&, const edm::EventSetup&);
+  virtual void endRun(const edm::Run&, const edm::EventSetup&);
   virtual void analyze(const edm::Event&, const edm::EventSetup&);
   virtual void endJob();
   void FirstValue();
   float deltaPhi(float v1, float v2);
   float deltaR(float eta1, float phi1, float eta2, float phi2);
   float checkPtMatch(float v1, float v2);
+  TBranch* Branch(const char* name, void* address, const std::string & leaflist);
+  void FillCompactLeaves();
+  template<class T> void Book(Filler<T> & filler);
+  void FillJets(const edm::View<pat::Jet> & jets, LabelIndex & bTagIndex, Filler<JetInput> & filler);
+  float BTag(LabelIndex & index, const pat::Jet & jet, int i);
+  float TauID(const pat::Tau & tau, int i);
+  bool Keep(const std::string & name) const;
+  bool Booked(const std::string & pattern) const;
   
   ///------------------------------------------------
   /// member data
@@ -99,6 +418,20 @@ private:
   //
   edm::InputTag puJetIdTag_;
   //
+  edm::EDGetTokenT<edm::View<pat::Jet> >             PFJetToken_;
+  edm::EDGetTokenT<edm::View<pat::Jet> >             PFJetAK8Token_;
+  edm::EDGetTokenT<edm::View<pat::MET> >             PFMETToken_;
+  edm::EDGetTokenT<edm::View<pat::MET> >             PatMETsPFToken_;
+  edm::EDGetTokenT<edm::View<pat::Muon> >            PFMuonToken_;
+  edm::EDGetTokenT<edm::View<pat::Electron> >        PFElectronToken_;
+  edm::EDGetTokenT<pat::TauCollection>               PFTauToken_;
+  edm::EDGetTokenT<edm::View<pat::Photon> >          PhotonToken_;
+  edm::EDGetTokenT<reco::VertexCollection>           VertexToken_;
+  edm::EDGetTokenT<reco::BeamSpot>                   BeamSpotToken_;
+  edm::EDGetTokenT<std::vector<PileupSummaryInfo> >  PileupToken_;
+  edm::EDGetTokenT<reco::GenParticleCollection>      GenParticleToken_;
+  edm::EDGetTokenT<std::vector<double> >             PdfWeightsToken_;
+  //
   double JetPtCutTag;
   double JetEtaCutTag;
   double METThresholdTag;
@@ -114,6 +447,43 @@ private:
   int    debugMode;
   //
   bool   includeNonPFCollection;
+  //
+  // compact output: /D leaves are written as /F from a float copy of their array, made
+  // just before the tree is filled. The compactTruncated ones keep only
+  // compactMantissaBits of the mantissa
+  bool   compactOutput;
+  int    compactMantissaBits;
+  std::vector<std::string> compactTruncated;
+  struct CompactLeaf
+  {
+    const double*      source;
+    const int*         counter;   // 0 for a fixed length
+    int                length;    // elements per counter entry, or the fixed length
+    bool               truncate;
+    TBranch*           branch;
+    std::vector<float> staging;
+  };
+  std::vector<CompactLeaf> compactLeaves;
+  //
+  // branchSelection: "keep <pattern>" / "drop <pattern>" rules, the last matching one
+  // wins. A collection is only filled when its counter branch is booked
+  std::vector<std::pair<bool,std::string> > branchRules;
+  std::set<std::string> bookedBranches;
+  bool   fillPFAK4Jets;
+  bool   fillPFAK8Jets;
+  bool   fillPFMuon;
+  bool   fillPFElec;
+  bool   fillPFTau;
+  bool   fillPFTauDis;
+  bool   fillPhot;
+  bool   fillGenPar;
+  bool   fillPDFWeights;
+  //
+  // discriminator positions, validateLabelIndex checks the cached position on every read
+  bool       validateLabelIndex;
+  LabelIndex bTagIndexAK4;
+  LabelIndex bTagIndexAK8;
+  LabelIndex tauIDIndex;
   ///------------------------------------------------
   /// HLT  L1, L1Tech
   ///------------------------------------------------
@@ -291,180 +661,11 @@ private:
   //int     mNGenAK8Jets; 
   
   ///------------------------------------------------
-  /// PF AK4Jets
-  ///------------------------------------------------
-  int     mNPFAK4Jets;
-  int     mPFAK4JetN90[MAXJET];
-  int     mPFAK4JetNtrkPF[MAXJET];
-  int     mPFAK4JetNtrkVtx[MAXJET];
-  double  mPFAK4JetE[MAXJET];
-  double  mPFAK4JetPt[MAXJET];
-  double  mPFAK4JetPx[MAXJET];
-  double  mPFAK4JetPy[MAXJET];
-  double  mPFAK4JetPz[MAXJET];
-  double  mPFAK4JetEta[MAXJET];
-  double  mPFAK4JetPhi[MAXJET];
-  double  mPFAK4JetfHPD[MAXJET];
-  double  mPFAK4JetfRBX[MAXJET];
-  double  mPFAK4JetN90Hits[MAXJET];
-  double  mPFAK4JetSigEta[MAXJET];
-  double  mPFAK4JetSigPhi[MAXJET];
-  double  mPFAK4JetIDEmf[MAXJET];
-  double  mPFAK4JetECor[MAXJET];
-  double  mPFAK4JetPtCor[MAXJET];
-  double  mPFAK4JetPxCor[MAXJET];
-  double  mPFAK4JetPyCor[MAXJET];
-  double  mPFAK4JetPzCor[MAXJET];
-  //
-  double  mPFAK4JetBtagTkCountHighEff[MAXJET];
-  double  mPFAK4JetBtagTkCountHighPur[MAXJET];
-  double  mPFAK4JetBtagJetProbability[MAXJET];
-  double  mPFAK4JetBtagJetBProbability[MAXJET];
-  double  mPFAK4JetBTagCSVv2[MAXJET];
-  double  mPFAK4JetBTagCombSecVtx[MAXJET];
-  double  mPFAK4JetBTagCombSecVtxMVA[MAXJET];
-  //
-  int     mPFAK4JetFlavour[MAXJET]; // algorithmic jet flavour definition
-  int     mPFAK4JetGenPartonFlavour[MAXJET]; // flavour of the parton matched to jet (0 if no match)   
-  //
-  double  mPFAK4JetNeuEmEngFrac[MAXJET];
-  double  mPFAK4JetChaEmEngFrac[MAXJET];
-  double  mPFAK4JetChaHadEngFrac[MAXJET];
-  double  mPFAK4JetNeuHadEngFrac[MAXJET];
-  //
-  double  mPFAK4JetChaEmEng[MAXJET];
-  double  mPFAK4JetNeuEmEng[MAXJET];
-  double  mPFAK4JetChaHadEng[MAXJET];
-  double  mPFAK4JetNeuHadEng[MAXJET];
-  double  mPFAK4JetPhotEng[MAXJET];
-  double  mPFAK4JetElecEng[MAXJET];
-  double  mPFAK4JetMuonEng[MAXJET];
-  double  mPFAK4JetHFHadEng[MAXJET];
-  double  mPFAK4JetHFEmEng[MAXJET];		
-  double  mPFAK4JetChaMuEng[MAXJET];
-  //
-  int     mPFAK4JetNumOfChaMu[MAXJET];
-  int     mPFAK4JetNumOfMuon[MAXJET];
-  int     mPFAK4JetNumOfPhot[MAXJET];
-  int     mPFAK4JetNumOfElec[MAXJET];		
-  int     mPFAK4JetNumOfNeu[MAXJET];
-  int     mPFAK4JetNumOfCha[MAXJET];
-  int     mPFAK4JetNumOfNeuHad[MAXJET];
-  int     mPFAK4JetNumOfChaHad[MAXJET];
-  int     mPFAK4JetNumOfDaughters[MAXJET];
-  int     mPFAK4JetIDLOOSE[MAXJET];
-  int     mPFAK4JetIDTIGHT[MAXJET];
-  double     mPFAK4JetPUFullJetId[MAXJET];
-  int     mPFAK4JetNumOfHFHad[MAXJET];
-  int     mPFAK4JetNumOfHFEM[MAXJET];
-  //
-  double  mPFAK4uncer[MAXJET];
-
-  ///------------------------------------------------
-  /// PF AK8Jets
+  /// PF AK4 and AK8 Jets
   ///------------------------------------------------
-  int     mNPFAK8Jets;
-  int     mPFAK8JetN90[MAXJET];
-  int     mPFAK8JetNtrkPF[MAXJET];
-  int     mPFAK8JetNtrkVtx[MAXJET];
-  double  mPFAK8JetE[MAXJET];
-  double  mPFAK8JetPt[MAXJET];
-  double  mPFAK8JetPx[MAXJET];
-  double  mPFAK8JetPy[MAXJET];
-  double  mPFAK8JetPz[MAXJET];
-  double  mPFAK8JetEta[MAXJET];
-  double  mPFAK8JetPhi[MAXJET];
-  double  mPFAK8JetfHPD[MAXJET];
-  double  mPFAK8JetfRBX[MAXJET];
-  double  mPFAK8JetN90Hits[MAXJET];
-  double  mPFAK8JetSigEta[MAXJET];
-  double  mPFAK8JetSigPhi[MAXJET];
-  double  mPFAK8JetIDEmf[MAXJET];
-  double  mPFAK8JetECor[MAXJET];
-  double  mPFAK8JetPtCor[MAXJET];
-  double  mPFAK8JetPxCor[MAXJET];
-  double  mPFAK8JetPyCor[MAXJET];
-  double  mPFAK8JetPzCor[MAXJET];
-  //
-  double  mPFAK8JetBtagTkCountHighEff[MAXJET];
-  double  mPFAK8JetBtagTkCountHighPur[MAXJET];
-  double  mPFAK8JetBtagJetProbability[MAXJET];
-  double  mPFAK8JetBtagJetBProbability[MAXJET];
-  double  mPFAK8JetBTagCSVv2[MAXJET];
-  double  mPFAK8JetBTagCombSecVtx[MAXJET];
-  double  mPFAK8JetBTagCombSecVtxMVA[MAXJET];
-  //
-  int     mPFAK8JetFlavour[MAXJET]; // algorithmic jet flavour definition
-  int     mPFAK8JetGenPartonFlavour[MAXJET]; // flavour of the parton matched to jet (0 if no match)   
-  //
-  double  mPFAK8JetNeuEmEngFrac[MAXJET];
-  double  mPFAK8JetChaEmEngFrac[MAXJET];
-  double  mPFAK8JetChaHadEngFrac[MAXJET];
-  double  mPFAK8JetNeuHadEngFrac[MAXJET];
-  //
-  double  mPFAK8JetChaEmEng[MAXJET];
-  double  mPFAK8JetNeuEmEng[MAXJET];
-  double  mPFAK8JetChaHadEng[MAXJET];
-  double  mPFAK8JetNeuHadEng[MAXJET];
-  double  mPFAK8JetPhotEng[MAXJET];
-  double  mPFAK8JetElecEng[MAXJET];
-  double  mPFAK8JetMuonEng[MAXJET];
-  double  mPFAK8JetHFHadEng[MAXJET];
-  double  mPFAK8JetHFEmEng[MAXJET];		
-  double  mPFAK8JetChaMuEng[MAXJET];
-  //
-  int     mPFAK8JetNumOfChaMu[MAXJET];
-  int     mPFAK8JetNumOfMuon[MAXJET];
-  int     mPFAK8JetNumOfPhot[MAXJET];
-  int     mPFAK8JetNumOfElec[MAXJET];		
-  int     mPFAK8JetNumOfNeu[MAXJET];
-  int     mPFAK8JetNumOfCha[MAXJET];
-  int     mPFAK8JetNumOfNeuHad[MAXJET];
-  int     mPFAK8JetNumOfChaHad[MAXJET];
-  int     mPFAK8JetNumOfDaughters[MAXJET];
-  int     mPFAK8JetIDLOOSE[MAXJET];
-  int     mPFAK8JetIDTIGHT[MAXJET];
-  double     mPFAK8JetPUFullJetId[MAXJET];
-  int     mPFAK8JetNumOfHFHad[MAXJET];
-  int     mPFAK8JetNumOfHFEM[MAXJET];
-  //
-  double  mPFAK8uncer[MAXJET];
-  
-  ///------------------------------------------------
-  /// Gen AK4 Jets (for PF)
-  ///------------------------------------------------
-  double  mGenPFAK4JetE[MAXJET];
-  double  mGenPFAK4JetPt[MAXJET];
-  double  mGenPFAK4JetPx[MAXJET];
-  double  mGenPFAK4JetPy[MAXJET];
-  double  mGenPFAK4JetPz[MAXJET];
-  double  mGenPFAK4JetEta[MAXJET];
-  double  mGenPFAK4JetPhi[MAXJET];
-  double  mGenPFAK4JetEmEnergy[MAXJET];
-  double  mGenPFAK4JetHadEnergy[MAXJET];
-  //int     mNGenPFAK4Jets; 
-  //
-  double  mPFAK4JERCentral[MAXJET];
-  double  mPFAK4JERUp[MAXJET];
-  double  mPFAK4JERDown[MAXJET];
-  
-  ///------------------------------------------------
-  /// Gen AK8 Jets (for PF)
-  ///------------------------------------------------
-  double  mGenPFAK8JetE[MAXJET];
-  double  mGenPFAK8JetPt[MAXJET];
-  double  mGenPFAK8JetPx[MAXJET];
-  double  mGenPFAK8JetPy[MAXJET];
-  double  mGenPFAK8JetPz[MAXJET];
-  double  mGenPFAK8JetEta[MAXJET];
-  double  mGenPFAK8JetPhi[MAXJET];
-  double  mGenPFAK8JetEmEnergy[MAXJET];
-  double  mGenPFAK8JetHadEnergy[MAXJET];
-  //int     mNGenPFAK8Jets; 
-  //
-  double  mPFAK8JERCentral[MAXJET];
-  double  mPFAK8JERUp[MAXJET];
-  double  mPFAK8JERDown[MAXJET];
+  std::vector<JetInput> jetInputs;
+  Filler<JetInput>      jetFillerAK4;
+  Filler<JetInput>      jetFillerAK8;
   
   ///------------------------------------------------
   /// MET
@@ -890,14 +1091,38 @@ private:
 
 
 NtupleAnalyzer::NtupleAnalyzer(const edm::ParameterSet& iConfig):
-  hltConfig_()
+  bTagIndexAK4(bTagLabels, nBTagLabels),
+  bTagIndexAK8(bTagLabels, nBTagLabels),
+  tauIDIndex(tauIDLabels, nTauIDLabels),
+  hltConfig_(),
+  jetFillerAK4("PFAK4", "NPFAK4Jets", jetFields, nJetFields, MAXJET),
+  jetFillerAK8("PFAK8", "NPFAK8Jets", jetFields, nJetFields, MAXJET)
 {
+  jetInputs.reserve(MAXJET);
+  // the tree belongs to TFileService, events are serialized on it
+  usesResource("TFileService");
   mtree                  = fs->make<TTree>("ntuple","ntuple");
   WeightTag              = iConfig.getParameter<double>("weight");
   
   //
   debugMode              = iConfig.getParameter<bool>("debugMode");
   includeNonPFCollection = iConfig.getParameter<bool>("includeNonPFCollection");
+  compactOutput          = iConfig.getParameter<bool>("compactOutput");
+  compactMantissaBits    = iConfig.getParameter<int>("compactMantissaBits");
+  compactTruncated       = iConfig.getParameter<std::vector<std::string> >("compactTruncated");
+  validateLabelIndex     = iConfig.getParameter<bool>("validateLabelIndex");
+  
+  //
+  std::vector<std::string> branchSelection = iConfig.getParameter<std::vector<std::string> >("branchSelection");
+  for(size_t i=0; i<branchSelection.size(); i++){
+    std::istringstream rule(branchSelection[i]);
+    std::string action, pattern, extra;
+    rule >> action >> pattern;
+    if( (action!="keep" && action!="drop") || pattern.empty() || (rule >> extra) )
+      throw cms::Exception("Configuration") << "NtupleAnalyzer: invalid branchSelection rule '" << branchSelection[i] 
+					    << "', expected 'keep <pattern>' or 'drop <pattern>'\n";
+    branchRules.push_back( std::make_pair(action=="keep", pattern) );
+  }
   
   //
   TriggerTag_            = iConfig.getUntrackedParameter<edm::InputTag>("TriggerTag");
@@ -944,6 +1169,26 @@ NtupleAnalyzer::NtupleAnalyzer(const edm::ParameterSet& iConfig):
   tiv_cone_              = iConfig.getParameter<double>("TIV_cone_thr");
   tiv_inner_cone_        = iConfig.getParameter<double>("TIV_inner_cone_thr");
   Tracks_                = iConfig.getUntrackedParameter<edm::InputTag>("Tracks");
+  
+  // Products read in analyze()
+  PFJetToken_            = consumes<edm::View<pat::Jet> >(PFJetTag_);
+  PFJetAK8Token_         = consumes<edm::View<pat::Jet> >(PFJetAK8Tag_);
+  PFMETToken_            = consumes<edm::View<pat::MET> >(PFMETTag_);
+  PatMETsPFToken_        = consumes<edm::View<pat::MET> >(edm::InputTag("patMETsPF"));
+  PFMuonToken_           = consumes<edm::View<pat::Muon> >(PFMuonTag_);
+  PFElectronToken_       = consumes<edm::View<pat::Electron> >(PFElectronTag_);
+  PFTauToken_            = consumes<pat::TauCollection>(PFTauTag_);
+  PhotonToken_           = consumes<edm::View<pat::Photon> >(edm::InputTag("slimmedPhotons"));
+  VertexToken_           = consumes<reco::VertexCollection>(edm::InputTag("offlineSlimmedPrimaryVertices"));
+  BeamSpotToken_         = consumes<reco::BeamSpot>(edm::InputTag("offlineBeamSpot"));
+  if(isMCTag){
+    PileupToken_         = consumes<std::vector<PileupSummaryInfo> >(edm::InputTag("addPileupInfo"));
+    GenParticleToken_    = consumes<reco::GenParticleCollection>(edm::InputTag("prunedGenParticles"));
+    // PDF weights, or any other PDF set
+    if(isSignalTag==1.) PdfWeightsToken_ = consumes<std::vector<double> >(edm::InputTag("pdfWeights1:cteq66"));
+    if(isSignalTag==2.) PdfWeightsToken_ = consumes<std::vector<double> >(edm::InputTag("pdfWeights2:MSTW2008nlo68cl"));
+    if(isSignalTag==3.) PdfWeightsToken_ = consumes<std::vector<double> >(edm::InputTag("pdfWeights3:NNPDF20"));
+  }
 }
 
 
@@ -981,6 +1226,10 @@ void NtupleAnalyzer::beginRun(const edm::Run& iRun, const edm::EventSetup& iSetu
   bool changed;
   hltConfig_.init(iRun, iSetup, TriggerTag_.process(), changed);
   
+  bTagIndexAK4.Reset();
+  bTagIndexAK8.Reset();
+  tauIDIndex.Reset();
+  
   try{
     hltBit1_=(hltConfig_.triggerNames()).size();  // default setting -- trigger not found
     hltBit2_=(hltConfig_.triggerNames()).size();  // default setting -- trigger not found
@@ -1012,6 +1261,11 @@ void NtupleAnalyzer::beginRun(const edm::Run& iRun, const edm::EventSetup& iSetu
   }
 }
 
+
+void NtupleAnalyzer::endRun(const edm::Run& iRun, const edm::EventSetup& iSetup)
+{
+}
+
 // ------------ method called to for each event  ------------
 
 void NtupleAnalyzer::analyze(const edm::Event& iEvent, const edm::EventSetup& iSetup)
@@ -1224,7 +1478,7 @@ void NtupleAnalyzer::analyze(const edm::Event& iEvent, const edm::EventSetup& iS
   ///--------------------------------------------------------------------------
   if(isMCTag){
     Handle<std::vector< PileupSummaryInfo > >  PupInfo;
-    iEvent.getByLabel(edm::InputTag("addPileupInfo"), PupInfo);
+    iEvent.getByToken(PileupToken_, PupInfo);
     
     std::vector<PileupSummaryInfo>::const_iterator PVI;
     
@@ -1292,187 +1546,10 @@ void NtupleAnalyzer::analyze(const edm::Event& iEvent, const edm::EventSetup& iS
   ///-------------------------------------------------------------------------- 
   /// AK4PFJet
   ///--------------------------------------------------------------------------
-  edm::Handle<edm::View<pat::Jet> > JetHand;
-  iEvent.getByLabel(PFJetTag_,JetHand);
-  int jeti=0;
-    
-  for(unsigned int ind=0; ind<(*JetHand).size() && ind<MAXJET; ind++){
-    const pat::Jet& jet2 = (*JetHand)[ind];
-    const pat::Jet& jet = (*JetHand)[ind].correctedJet("Uncorrected");
-    
-    if( jet2.pt() < JetPtCutTag ) continue;
-    
-    mPFAK4JetIDLOOSE[jeti]              = 0.;//pfjetIDFunctorLoose(jet2);
-    mPFAK4JetIDTIGHT[jeti]              = 0.;//pfjetIDFunctorTight(jet2); 
-    
-    mPFAK4JetPUFullJetId[jeti]          = jet2.userFloat("pileupJetId:fullDiscriminant");
-        
-    mPFAK4JetPt[jeti]                   = jet.pt();
-    mPFAK4JetPx[jeti]                   = jet.momentum().X();
-    mPFAK4JetPy[jeti]                   = jet.momentum().Y();
-    mPFAK4JetPz[jeti]                   = jet.momentum().Z();
-    mPFAK4JetE[jeti]                    = jet.energy();
-    
-    mPFAK4JetEta[jeti]                  = jet2.eta();
-    mPFAK4JetPhi[jeti]                  = jet2.phi();		
-    mPFAK4JetN90[jeti]                  = jet2.n90();
-    mPFAK4JetNumOfDaughters[jeti]       = jet2.numberOfDaughters();
-    
-    ///use uncorrected jet for jetID
-    mPFAK4JetN90Hits[jeti]              = jet.jetID().n90Hits ;
-    mPFAK4JetfHPD[jeti]                 = jet.jetID().fHPD ;
-    mPFAK4JetfRBX[jeti]                 = jet.jetID().fRBX ;
-    mPFAK4JetIDEmf[jeti]                = jet.jetID().restrictedEMF;
-    
-    mPFAK4JetSigEta[jeti]               = jet2.etaetaMoment();
-    mPFAK4JetSigPhi[jeti]               = jet2.phiphiMoment();
-    mPFAK4JetPtCor[jeti]                = jet2.pt();
-    mPFAK4JetPxCor[jeti]                = jet2.momentum().X();
-    mPFAK4JetPyCor[jeti]                = jet2.momentum().Y();
-    mPFAK4JetPzCor[jeti]                = jet2.momentum().Z();
-    mPFAK4JetECor[jeti]                 = jet2.energy();
-
-    ///JPT or PFJet specific information
-    mPFAK4JetNumOfMuon[jeti]            = jet2.muonMultiplicity();
-    mPFAK4JetNumOfChaMu[jeti]           = jet2.chargedMultiplicity();
-
-    mPFAK4JetChaEmEng[jeti]             = jet2.chargedEmEnergy();
-    mPFAK4JetNeuEmEng[jeti]             = jet2.neutralEmEnergy();
-    mPFAK4JetChaHadEng[jeti]            = jet2.chargedHadronEnergy();
-    mPFAK4JetNeuHadEng[jeti]            = jet2.neutralHadronEnergy();
-    mPFAK4JetPhotEng[jeti]              = jet2.photonEnergy();
-    mPFAK4JetElecEng[jeti]              = jet2.electronEnergy();
-    mPFAK4JetMuonEng[jeti]              = jet2.muonEnergy();
-    mPFAK4JetHFHadEng[jeti]             = jet2.HFHadronEnergy();
-    mPFAK4JetHFEmEng[jeti]              = jet2.HFEMEnergy();
-    
-    //Relative to uncorrected jet energy
-    mPFAK4JetNeuEmEngFrac[jeti]         = jet2.neutralEmEnergyFraction();
-    mPFAK4JetChaEmEngFrac[jeti]         = jet2.chargedEmEnergyFraction();
-    mPFAK4JetChaHadEngFrac[jeti]        = jet2.chargedHadronEnergyFraction();
-    mPFAK4JetNeuHadEngFrac[jeti]        = jet2.neutralHadronEnergyFraction();
-    
-    mPFAK4JetNumOfChaHad[jeti]          = jet2.chargedHadronMultiplicity();
-    mPFAK4JetNumOfNeuHad[jeti]          = jet2.neutralHadronMultiplicity();
-    mPFAK4JetNumOfPhot[jeti]            = jet2.photonMultiplicity();
-    mPFAK4JetNumOfElec[jeti]            = jet2.electronMultiplicity();
-    mPFAK4JetNumOfHFHad[jeti]           = jet2.HFHadronMultiplicity();
-    mPFAK4JetNumOfHFEM[jeti]            = jet2.HFEMMultiplicity();
-    
-    mPFAK4JetChaMuEng[jeti]             = jet2.chargedMuEnergy();
-     
-    mPFAK4JetNumOfNeu[jeti]             = jet2.neutralMultiplicity();
-    mPFAK4JetNumOfCha[jeti]             = jet2.chargedMultiplicity();
-    
-    mPFAK4JetBtagTkCountHighEff[jeti]   = jet.bDiscriminator("trackCountingHighEffBJetTags");
-    mPFAK4JetBtagTkCountHighPur[jeti]   = jet.bDiscriminator("trackCountingHighPurBJetTags");
-    mPFAK4JetBtagJetProbability[jeti]   = jet.bDiscriminator("jetProbabilityBJetTags");
-    mPFAK4JetBtagJetBProbability[jeti]  = jet.bDiscriminator("jetBProbabilityBJetTags");
-    mPFAK4JetBTagCSVv2[jeti]            = jet.bDiscriminator("pfCombinedInclusiveSecondaryVertexV2BJetTags");
-    mPFAK4JetBTagCombSecVtx[jeti]       = jet.bDiscriminator("combinedSecondaryVertexBJetTags");
-    mPFAK4JetBTagCombSecVtxMVA[jeti]    = jet.bDiscriminator("combinedSecondaryVertexMVABJetTags");  
-   
-    ///-----------Jets Uncertanity --------------------------------------------------------
-    if(isMCTag){
-      //jecUnc->setJetEta(jet2.eta() ); // Give rapidity of jet you want tainty on
-      //jecUnc->setJetPt( jet2.pt() );// Also give the corrected pt of the jet you want the uncertainty on
-      // The following function gives the relative uncertainty in the jet Pt.
-      // i.e. ptCorSmeared = (1 +- uncer) * ptCor  
-      //mPFAK4uncer[jeti] =    jecUnc->getUncertainty(true); 
-      // In principle, boolean controls if uncertainty on +ve or -ve side is returned (asymmetric errors) but not yet implemented.
-
-      // Addition by Jyothsna: Jet flavour needed for b-tagging
-      // Store algorithmic jet flavour definition
-      mPFAK4JetFlavour[jeti] = jet.partonFlavour();
-      // flavour of the parton matched to jet (0 if no match)
-      mPFAK4JetGenPartonFlavour[jeti] = (jet.genParton() == nullptr) ? 0 : jet.genParton()->pdgId();
-      
-      if(jet2.genJet()!= 0){
-	  mGenPFAK4JetPt[jeti]        = jet2.genJet()->pt();
-	  mGenPFAK4JetE[jeti]         = jet2.genJet()->energy();
-	  mGenPFAK4JetPx[jeti]        = jet2.genJet()->momentum().X();
-	  mGenPFAK4JetPy[jeti]        = jet2.genJet()->momentum().Y();
-	  mGenPFAK4JetPz[jeti]        = jet2.genJet()->momentum().z();
-	  mGenPFAK4JetEta[jeti]       = jet2.genJet()->eta();
-	  mGenPFAK4JetPhi[jeti]       = jet2.genJet()->phi();
-	  mGenPFAK4JetEmEnergy[jeti]  = jet2.genJet()->emEnergy();
-	  mGenPFAK4JetHadEnergy[jeti] = jet2.genJet()->emEnergy();  
-	  if(fabs(mPFAK4JetEta[jeti])<0.5){
-	    mPFAK4JERCentral[jeti] = 1.052;
-	    mPFAK4JERUp[jeti]      = 0.990;
-	    mPFAK4JERDown[jeti]    = 1.115;
-	  } 
-	  else if(fabs(mPFAK4JetEta[jeti])>=0.5 && fabs(mPFAK4JetEta[jeti])<1.1){
-	    mPFAK4JERCentral[jeti] = 1.057;
-	    mPFAK4JERUp[jeti]      = 1.001;
-	    mPFAK4JERDown[jeti]    = 1.114;
-	  }
-	  else if(fabs(mPFAK4JetEta[jeti])>=1.1 && fabs(mPFAK4JetEta[jeti])<1.7){
-	    mPFAK4JERCentral[jeti] = 1.096;
-	    mPFAK4JERUp[jeti]      = 1.032;
-	    mPFAK4JERDown[jeti]    = 1.161;
-	  }
-	  else if(fabs(mPFAK4JetEta[jeti])>=1.7 && fabs(mPFAK4JetEta[jeti])<2.3){
-	    mPFAK4JERCentral[jeti] = 1.134;
-	    mPFAK4JERUp[jeti]      = 1.042;
-	    mPFAK4JERDown[jeti]    = 1.228;
-	  }
-	  else if(fabs(mPFAK4JetEta[jeti])>=2.3 && fabs(mPFAK4JetEta[jeti])<5.0){
-	    mPFAK4JERCentral[jeti] = 1.288;
-	    mPFAK4JERUp[jeti]      = 1.089;
-	    mPFAK4JERDown[jeti]    = 1.488;
-	  }
-	  else{
-	    mPFAK4JERCentral[jeti] = -999.;
-	    mPFAK4JERUp[jeti]      = -999.;
-	    mPFAK4JERDown[jeti]    = -999.;
-	  }
-	}
-	else {
-	  mGenPFAK4JetPt[jeti]        = -999;
-	  mGenPFAK4JetE[jeti]         = -999;
-	  mGenPFAK4JetPx[jeti]        = -999;
-	  mGenPFAK4JetPy[jeti]        = -999;
-	  mGenPFAK4JetPz[jeti]        = -999;
-	  mGenPFAK4JetEta[jeti]       = -999;
-	  mGenPFAK4JetPhi[jeti]       = -999;
-	  mGenPFAK4JetEmEnergy[jeti]  = -999;
-	  mGenPFAK4JetHadEnergy[jeti] = -999;
-	  mPFAK4JERCentral[jeti]      = -999.;
-	  mPFAK4JERUp[jeti]           = -999.;
-	  mPFAK4JERDown[jeti]         = -999.;
-	}
-    }
-    else{
-      mPFAK4uncer[jeti]           = 0.;
-      mGenPFAK4JetPt[jeti]        = -999;
-      mGenPFAK4JetE[jeti]         = -999;
-      mGenPFAK4JetPx[jeti]        = -999;
-      mGenPFAK4JetPy[jeti]        = -999;
-      mGenPFAK4JetPz[jeti]        = -999;
-      mGenPFAK4JetEta[jeti]       = -999;
-      mGenPFAK4JetPhi[jeti]       = -999;
-      mGenPFAK4JetEmEnergy[jeti]  = -999;
-      mGenPFAK4JetHadEnergy[jeti] = -999;
-      mPFAK4JERCentral[jeti]      = -999.;
-      mPFAK4JERUp[jeti]           = -999.;
-      mPFAK4JERDown[jeti]         = -999.;
-    }		
-    jeti++;
-  }
-  mNPFAK4Jets = jeti; 
-  if(debugMode){
-    cout<<"N(PFJet): "<<mNPFAK4Jets<<endl;
-  }
-  if(debugMode && mNPFAK4Jets>0){
-    cout<<"PFJet0: Pt= "<<mPFAK4JetPtCor[0]<<", Eta= "<<mPFAK4JetEta[0]<<", Phi= "<<mPFAK4JetPhi[0]<<", PUJetID= "<<mPFAK4JetPUFullJetId[0]<<endl;
-    cout<<"      : NHEF= "<<mPFAK4JetNeuHadEngFrac[0]<<", CHEF= "<<mPFAK4JetChaHadEngFrac[0]<<", NEMF= "<<mPFAK4JetNeuEmEngFrac[0]<<", CEMF= "<<mPFAK4JetChaEmEngFrac[0]<<endl;
-    cout<<"      : MuEF= "<<mPFAK4JetMuonEng[0]/mPFAK4JetE[0]<<", ElecEF= "<<mPFAK4JetElecEng[0]/mPFAK4JetE[0]<<", PhotonEF= "<<mPFAK4JetPhotEng[0]/mPFAK4JetE[0]<<endl;
-  }
-  if(debugMode && mNPFAK4Jets>1){
-    cout<<"PFJet1: Pt= "<<mPFAK4JetPtCor[1]<<", Eta= "<<mPFAK4JetEta[1]<<", Phi= "<<mPFAK4JetPhi[1]<<", PUJetID= "<<mPFAK4JetPUFullJetId[1]<<endl;
-    cout<<"      : NHEF= "<<mPFAK4JetNeuHadEngFrac[1]<<", CHEF= "<<mPFAK4JetChaHadEngFrac[1]<<", NEMF= "<<mPFAK4JetNeuEmEngFrac[1]<<", CEMF= "<<mPFAK4JetChaEmEngFrac[1]<<endl;
-    cout<<"      : MuEF= "<<mPFAK4JetMuonEng[1]/mPFAK4JetE[1]<<", ElecEF= "<<mPFAK4JetElecEng[1]/mPFAK4JetE[1]<<", PhotonEF= "<<mPFAK4JetPhotEng[1]/mPFAK4JetE[1]<<endl;
+  if(fillPFAK4Jets){
+    edm::Handle<edm::View<pat::Jet> > JetHand;
+    iEvent.getByToken(PFJetToken_,JetHand);
+    FillJets(*JetHand, bTagIndexAK4, jetFillerAK4);
   }
   
   
@@ -1480,187 +1557,10 @@ void NtupleAnalyzer::analyze(const edm::Event& iEvent, const edm::EventSetup& iS
   ///-------------------------------------------------------------------------- 
   /// AK8PFJet
   ///--------------------------------------------------------------------------
-  edm::Handle<edm::View<pat::Jet> > JetHandAK8;
-  iEvent.getByLabel(PFJetAK8Tag_,JetHandAK8);
-  jeti=0;
-    
-  for(unsigned int ind=0; ind<(*JetHandAK8).size() && ind<MAXJET; ind++){
-    const pat::Jet& jet2 = (*JetHandAK8)[ind];
-    const pat::Jet& jet = (*JetHandAK8)[ind].correctedJet("Uncorrected");
-    
-    if( jet2.pt() < JetPtCutTag ) continue;
-    
-    mPFAK8JetIDLOOSE[jeti]              = 0.;//pfjetIDFunctorLoose(jet2);
-    mPFAK8JetIDTIGHT[jeti]              = 0.;//pfjetIDFunctorTight(jet2); 
-    
-    mPFAK8JetPUFullJetId[jeti]          = jet2.userFloat("pileupJetId:fullDiscriminant");
-        
-    mPFAK8JetPt[jeti]                   = jet.pt();
-    mPFAK8JetPx[jeti]                   = jet.momentum().X();
-    mPFAK8JetPy[jeti]                   = jet.momentum().Y();
-    mPFAK8JetPz[jeti]                   = jet.momentum().Z();
-    mPFAK8JetE[jeti]                    = jet.energy();
-    
-    mPFAK8JetEta[jeti]                  = jet2.eta();
-    mPFAK8JetPhi[jeti]                  = jet2.phi();		
-    mPFAK8JetN90[jeti]                  = jet2.n90();
-    mPFAK8JetNumOfDaughters[jeti]       = jet2.numberOfDaughters();
-    
-    ///use uncorrected jet for jetID
-    mPFAK8JetN90Hits[jeti]              = jet.jetID().n90Hits ;
-    mPFAK8JetfHPD[jeti]                 = jet.jetID().fHPD ;
-    mPFAK8JetfRBX[jeti]                 = jet.jetID().fRBX ;
-    mPFAK8JetIDEmf[jeti]                = jet.jetID().restrictedEMF;
-    
-    mPFAK8JetSigEta[jeti]               = jet2.etaetaMoment();
-    mPFAK8JetSigPhi[jeti]               = jet2.phiphiMoment();
-    mPFAK8JetPtCor[jeti]                = jet2.pt();
-    mPFAK8JetPxCor[jeti]                = jet2.momentum().X();
-    mPFAK8JetPyCor[jeti]                = jet2.momentum().Y();
-    mPFAK8JetPzCor[jeti]                = jet2.momentum().Z();
-    mPFAK8JetECor[jeti]                 = jet2.energy();
-
-    ///JPT or PFJet specific information
-    mPFAK8JetNumOfMuon[jeti]            = jet2.muonMultiplicity();
-    mPFAK8JetNumOfChaMu[jeti]           = jet2.chargedMultiplicity();
-
-    mPFAK8JetChaEmEng[jeti]             = jet2.chargedEmEnergy();
-    mPFAK8JetNeuEmEng[jeti]             = jet2.neutralEmEnergy();
-    mPFAK8JetChaHadEng[jeti]            = jet2.chargedHadronEnergy();
-    mPFAK8JetNeuHadEng[jeti]            = jet2.neutralHadronEnergy();
-    mPFAK8JetPhotEng[jeti]              = jet2.photonEnergy();
-    mPFAK8JetElecEng[jeti]              = jet2.electronEnergy();
-    mPFAK8JetMuonEng[jeti]              = jet2.muonEnergy();
-    mPFAK8JetHFHadEng[jeti]             = jet2.HFHadronEnergy();
-    mPFAK8JetHFEmEng[jeti]              = jet2.HFEMEnergy();
-    
-    //Relative to uncorrected jet energy
-    mPFAK8JetNeuEmEngFrac[jeti]         = jet2.neutralEmEnergyFraction();
-    mPFAK8JetChaEmEngFrac[jeti]         = jet2.chargedEmEnergyFraction();
-    mPFAK8JetChaHadEngFrac[jeti]        = jet2.chargedHadronEnergyFraction();
-    mPFAK8JetNeuHadEngFrac[jeti]        = jet2.neutralHadronEnergyFraction();
-    
-    mPFAK8JetNumOfChaHad[jeti]          = jet2.chargedHadronMultiplicity();
-    mPFAK8JetNumOfNeuHad[jeti]          = jet2.neutralHadronMultiplicity();
-    mPFAK8JetNumOfPhot[jeti]            = jet2.photonMultiplicity();
-    mPFAK8JetNumOfElec[jeti]            = jet2.electronMultiplicity();
-    mPFAK8JetNumOfHFHad[jeti]           = jet2.HFHadronMultiplicity();
-    mPFAK8JetNumOfHFEM[jeti]            = jet2.HFEMMultiplicity();
-    
-    mPFAK8JetChaMuEng[jeti]             = jet2.chargedMuEnergy();
-     
-    mPFAK8JetNumOfNeu[jeti]             = jet2.neutralMultiplicity();
-    mPFAK8JetNumOfCha[jeti]             = jet2.chargedMultiplicity();
-    
-    mPFAK8JetBtagTkCountHighEff[jeti]   = jet.bDiscriminator("trackCountingHighEffBJetTags");
-    mPFAK8JetBtagTkCountHighPur[jeti]   = jet.bDiscriminator("trackCountingHighPurBJetTags");
-    mPFAK8JetBtagJetProbability[jeti]   = jet.bDiscriminator("jetProbabilityBJetTags");
-    mPFAK8JetBtagJetBProbability[jeti]  = jet.bDiscriminator("jetBProbabilityBJetTags");
-    mPFAK8JetBTagCSVv2[jeti]            = jet.bDiscriminator("pfCombinedInclusiveSecondaryVertexV2BJetTags");
-    mPFAK8JetBTagCombSecVtx[jeti]       = jet.bDiscriminator("combinedSecondaryVertexBJetTags");
-    mPFAK8JetBTagCombSecVtxMVA[jeti]    = jet.bDiscriminator("combinedSecondaryVertexMVABJetTags");  
-   
-    ///-----------Jets Uncertanity --------------------------------------------------------
-    if(isMCTag){
-      //jecUnc->setJetEta(jet2.eta() ); // Give rapidity of jet you want tainty on
-      //jecUnc->setJetPt( jet2.pt() );// Also give the corrected pt of the jet you want the uncertainty on
-      // The following function gives the relative uncertainty in the jet Pt.
-      // i.e. ptCorSmeared = (1 +- uncer) * ptCor  
-      //mPFAK8uncer[jeti] =    jecUnc->getUncertainty(true); 
-      // In principle, boolean controls if uncertainty on +ve or -ve side is returned (asymmetric errors) but not yet implemented.
-
-      // Addition by Jyothsna: Jet flavour needed for b-tagging
-      // Store algorithmic jet flavour definition
-      mPFAK8JetFlavour[jeti] = jet.partonFlavour();
-      // flavour of the parton matched to jet (0 if no match)
-      mPFAK8JetGenPartonFlavour[jeti] = (jet.genParton() == nullptr) ? 0 : jet.genParton()->pdgId();
-      
-      if(jet2.genJet()!= 0){
-	  mGenPFAK8JetPt[jeti]        = jet2.genJet()->pt();
-	  mGenPFAK8JetE[jeti]         = jet2.genJet()->energy();
-	  mGenPFAK8JetPx[jeti]        = jet2.genJet()->momentum().X();
-	  mGenPFAK8JetPy[jeti]        = jet2.genJet()->momentum().Y();
-	  mGenPFAK8JetPz[jeti]        = jet2.genJet()->momentum().z();
-	  mGenPFAK8JetEta[jeti]       = jet2.genJet()->eta();
-	  mGenPFAK8JetPhi[jeti]       = jet2.genJet()->phi();
-	  mGenPFAK8JetEmEnergy[jeti]  = jet2.genJet()->emEnergy();
-	  mGenPFAK8JetHadEnergy[jeti] = jet2.genJet()->emEnergy();  
-	  if(fabs(mPFAK8JetEta[jeti])<0.5){
-	    mPFAK8JERCentral[jeti] = 1.052;
-	    mPFAK8JERUp[jeti]      = 0.990;
-	    mPFAK8JERDown[jeti]    = 1.115;
-	  } 
-	  else if(fabs(mPFAK8JetEta[jeti])>=0.5 && fabs(mPFAK8JetEta[jeti])<1.1){
-	    mPFAK8JERCentral[jeti] = 1.057;
-	    mPFAK8JERUp[jeti]      = 1.001;
-	    mPFAK8JERDown[jeti]    = 1.114;
-	  }
-	  else if(fabs(mPFAK8JetEta[jeti])>=1.1 && fabs(mPFAK8JetEta[jeti])<1.7){
-	    mPFAK8JERCentral[jeti] = 1.096;
-	    mPFAK8JERUp[jeti]      = 1.032;
-	    mPFAK8JERDown[jeti]    = 1.161;
-	  }
-	  else if(fabs(mPFAK8JetEta[jeti])>=1.7 && fabs(mPFAK8JetEta[jeti])<2.3){
-	    mPFAK8JERCentral[jeti] = 1.134;
-	    mPFAK8JERUp[jeti]      = 1.042;
-	    mPFAK8JERDown[jeti]    = 1.228;
-	  }
-	  else if(fabs(mPFAK8JetEta[jeti])>=2.3 && fabs(mPFAK8JetEta[jeti])<5.0){
-	    mPFAK8JERCentral[jeti] = 1.288;
-	    mPFAK8JERUp[jeti]      = 1.089;
-	    mPFAK8JERDown[jeti]    = 1.488;
-	  }
-	  else{
-	    mPFAK8JERCentral[jeti] = -999.;
-	    mPFAK8JERUp[jeti]      = -999.;
-	    mPFAK8JERDown[jeti]    = -999.;
-	  }
-	}
-	else {
-	  mGenPFAK8JetPt[jeti]        = -999;
-	  mGenPFAK8JetE[jeti]         = -999;
-	  mGenPFAK8JetPx[jeti]        = -999;
-	  mGenPFAK8JetPy[jeti]        = -999;
-	  mGenPFAK8JetPz[jeti]        = -999;
-	  mGenPFAK8JetEta[jeti]       = -999;
-	  mGenPFAK8JetPhi[jeti]       = -999;
-	  mGenPFAK8JetEmEnergy[jeti]  = -999;
-	  mGenPFAK8JetHadEnergy[jeti] = -999;
-	  mPFAK8JERCentral[jeti]      = -999.;
-	  mPFAK8JERUp[jeti]           = -999.;
-	  mPFAK8JERDown[jeti]         = -999.;
-	}
-    }
-    else{
-      mPFAK8uncer[jeti]           = 0.;
-      mGenPFAK8JetPt[jeti]        = -999;
-      mGenPFAK8JetE[jeti]         = -999;
-      mGenPFAK8JetPx[jeti]        = -999;
-      mGenPFAK8JetPy[jeti]        = -999;
-      mGenPFAK8JetPz[jeti]        = -999;
-      mGenPFAK8JetEta[jeti]       = -999;
-      mGenPFAK8JetPhi[jeti]       = -999;
-      mGenPFAK8JetEmEnergy[jeti]  = -999;
-      mGenPFAK8JetHadEnergy[jeti] = -999;
-      mPFAK8JERCentral[jeti]      = -999.;
-      mPFAK8JERUp[jeti]           = -999.;
-      mPFAK8JERDown[jeti]         = -999.;
-    }		
-    jeti++;
-  }
-  mNPFAK8Jets = jeti; 
-  if(debugMode){
-    cout<<"N(PFJet): "<<mNPFAK8Jets<<endl;
-  }
-  if(debugMode && mNPFAK8Jets>0){
-    cout<<"PFJet0: Pt= "<<mPFAK8JetPtCor[0]<<", Eta= "<<mPFAK8JetEta[0]<<", Phi= "<<mPFAK8JetPhi[0]<<", PUJetID= "<<mPFAK8JetPUFullJetId[0]<<endl;
-    cout<<"      : NHEF= "<<mPFAK8JetNeuHadEngFrac[0]<<", CHEF= "<<mPFAK8JetChaHadEngFrac[0]<<", NEMF= "<<mPFAK8JetNeuEmEngFrac[0]<<", CEMF= "<<mPFAK8JetChaEmEngFrac[0]<<endl;
-    cout<<"      : MuEF= "<<mPFAK8JetMuonEng[0]/mPFAK8JetE[0]<<", ElecEF= "<<mPFAK8JetElecEng[0]/mPFAK8JetE[0]<<", PhotonEF= "<<mPFAK8JetPhotEng[0]/mPFAK8JetE[0]<<endl;
-  }
-  if(debugMode && mNPFAK8Jets>1){
-    cout<<"PFJet1: Pt= "<<mPFAK8JetPtCor[1]<<", Eta= "<<mPFAK8JetEta[1]<<", Phi= "<<mPFAK8JetPhi[1]<<", PUJetID= "<<mPFAK8JetPUFullJetId[1]<<endl;
-    cout<<"      : NHEF= "<<mPFAK8JetNeuHadEngFrac[1]<<", CHEF= "<<mPFAK8JetChaHadEngFrac[1]<<", NEMF= "<<mPFAK8JetNeuEmEngFrac[1]<<", CEMF= "<<mPFAK8JetChaEmEngFrac[1]<<endl;
-    cout<<"      : MuEF= "<<mPFAK8JetMuonEng[1]/mPFAK8JetE[1]<<", ElecEF= "<<mPFAK8JetElecEng[1]/mPFAK8JetE[1]<<", PhotonEF= "<<mPFAK8JetPhotEng[1]/mPFAK8JetE[1]<<endl;
+  if(fillPFAK8Jets){
+    edm::Handle<edm::View<pat::Jet> > JetHandAK8;
+    iEvent.getByToken(PFJetAK8Token_,JetHandAK8);
+    FillJets(*JetHandAK8, bTagIndexAK8, jetFillerAK8);
   }
   
   
@@ -1759,7 +1659,7 @@ void NtupleAnalyzer::analyze(const edm::Event& iEvent, const edm::EventSetup& iS
   /// PF MetsType1 Corrected
   ///--------------------------------------------------------------------------
   edm::Handle<edm::View<pat::MET> > PFMetType1Hand;
-  iEvent.getByLabel(PFMETTag_,PFMetType1Hand);
+  iEvent.getByToken(PFMETToken_,PFMetType1Hand);
   if(PFMetType1Hand.isValid()){
     const edm::View<pat::MET> & pfmetsType1 = *PFMetType1Hand;
     mMetPt[10]    = pfmetsType1[0].et();
@@ -1777,7 +1677,7 @@ void NtupleAnalyzer::analyze(const edm::Event& iEvent, const edm::EventSetup& iS
   /// PF Mets
   ///--------------------------------------------------------------------------
   Handle<View<pat::MET> > PFMetHand;
-  iEvent.getByLabel("patMETsPF", PFMetHand);
+  iEvent.getByToken(PatMETsPFToken_, PFMetHand);
   if(PFMetHand.isValid()){
     const View<pat::MET> & pfmets = *PFMetHand;
     //
@@ -1838,7 +1738,7 @@ void NtupleAnalyzer::analyze(const edm::Event& iEvent, const edm::EventSetup& iS
 
    reco::Vertex primaryvtx;
   Handle<reco::VertexCollection> recVtxs;
-  iEvent.getByLabel("offlineSlimmedPrimaryVertices",recVtxs);
+  iEvent.getByToken(VertexToken_,recVtxs);
   //iEvent.getByLabel("goodVertices",recVtxs);
   int  pvind=0;
   for(unsigned int ind=0;ind<recVtxs->size();ind++){
@@ -1862,7 +1762,7 @@ void NtupleAnalyzer::analyze(const edm::Event& iEvent, const edm::EventSetup& iS
   ///--------------------------------------------------------------------------
   BeamSpot beamSpot;
   Handle<reco::BeamSpot> beamSpotHandle;
-  iEvent.getByLabel("offlineBeamSpot", beamSpotHandle);
+  iEvent.getByToken(BeamSpotToken_, beamSpotHandle);
   if (beamSpotHandle.isValid()){
     beamSpot = *beamSpotHandle;
   } 
@@ -1876,189 +1776,191 @@ void NtupleAnalyzer::analyze(const edm::Event& iEvent, const edm::EventSetup& iS
   ///-------------------------------------------------------------------------- 
   /// PFMuons
   ///--------------------------------------------------------------------------
-  edm::Handle<edm::View<pat::Muon> > MuonHand;
-  iEvent.getByLabel(PFMuonTag_,MuonHand);
-  int muoni=0;
-  for(unsigned int ind=0; ind<(*MuonHand).size() && ind<MAXMUON; ind++){ 
-    const pat::Muon& muon             = (*MuonHand)[ind];
-    mPFMuonPt[muoni]                  = muon.pt();
-    mPFMuonEt[muoni]                  = muon.et();
-    mPFMuonE[muoni]                   = muon.energy();
-    mPFMuonPx[muoni]                  = muon.momentum().X();
-    mPFMuonPy[muoni]                  = muon.momentum().Y();
-    mPFMuonPz[muoni]                  = muon.momentum().Z();
-    mPFMuonEta[muoni]                 = muon.eta();
-    mPFMuonPhi[muoni]                 = muon.phi();
-    mPFMuonCharge[muoni]              = muon.charge();
-    //
-    mPFMuonIsGlobal[muoni]            = muon.isGlobalMuon();
-    mPFMuonIsStandAlone[muoni]        = muon.isStandAloneMuon();
-    mPFMuonIsTracker[muoni]           = muon.isTrackerMuon();
-    mPFMuonIsPF[muoni]                = muon.isPFMuon();
-    //
-    mPFMuonIsTight[muoni]             = muon.isTightMuon(primaryvtx);
-    mPFMuonIsLoose[muoni]             = muon.isLooseMuon();
-    //
-    mPFMuonChargedHadronIso[muoni]    = muon.chargedHadronIso();
-    mPFMuonPhotonIso[muoni]           = muon.photonIso();
-    mPFMuonNeutralHadronIso[muoni]    = muon.neutralHadronIso();
-    mPFMuonisGMPT[muoni]              = muon.muonID("GlobalMuonPromptTight");
-    mPFMuonR04ChargedHadronPt[muoni]  = muon.pfIsolationR04().sumChargedHadronPt;
-    mPFMuonR04NeutralHadronEt[muoni]  = muon.pfIsolationR04().sumNeutralHadronEt;
-    mPFMuonR04PhotonEt[muoni]         = muon.pfIsolationR04().sumPhotonEt;
-    mPFMuonR04PUPt[muoni]             = muon.pfIsolationR04().sumPUPt;
-    //
-    mPFMuonNumOfMatches[muoni]        = muon.numberOfMatches(); 
-    mPFMuonNumOfMatchesStation[muoni] = muon.numberOfMatchedStations();
-    // Global Track
-    if(muon.globalTrack().isNonnull()){
-      mPFMuonGlobChi2Norm[muoni]            = muon.globalTrack()->normalizedChi2();
-      mPFMuonGlobNumOfValidMuonHits[muoni]  = muon.globalTrack()->hitPattern().numberOfValidMuonHits();
-    }
-    else{
-      mPFMuonGlobChi2Norm[muoni]            = 999.;
-      mPFMuonGlobNumOfValidMuonHits[muoni]  = 999.;
-    }
-    // BestTrack
-    if(muon.muonBestTrack().isNonnull()){
-      mPFMuonBestTrkdxy[muoni]              = fabs(muon.muonBestTrack()->dxy(primaryvtx.position()));
-      mPFMuonBestTrkdz[muoni]               = fabs(muon.muonBestTrack()->dz(primaryvtx.position()));
-    }
-    else{
-      mPFMuonBestTrkdxy[muoni]              = 999.;
-      mPFMuonBestTrkdz[muoni]               = 999.;
-    }
-    // InnerTrack
-    if(muon.innerTrack().isNonnull()){
-      mPFMuoninnertrackPt[muoni]     = muon.innerTrack()->pt();
-      mPFMuonnValidHits[muoni]       = muon.innerTrack()->numberOfValidHits();
-      mPFMuonnValidPixelHits[muoni]  = muon.innerTrack()->hitPattern().numberOfValidPixelHits();
-      mPFMuondxy[muoni]              = muon.innerTrack()->dxy(primaryvtx.position());
-      mPFMuondz[muoni]               = muon.vz() - primaryvtx.position().z();
-    }
-    else{
-      mPFMuoninnertrackPt[muoni]     = 999.;
-      mPFMuonnValidHits[muoni]       = 999.;
-      mPFMuonnValidPixelHits[muoni]  = 999.;
-      mPFMuondxy[muoni]              = 999.;
-      mPFMuondz[muoni]               = 999.;
-    }
-    // GlobalMuon
-    if(muon.isGlobalMuon() && muon.combinedMuon().isNonnull()){
-      mPFMuonCombChi2Norm[muoni]    = muon.combinedMuon()->normalizedChi2();
-      mPFMuonCombValidHits[muoni]   = muon.combinedMuon()->found();
-      mPFMuonCombLostHits[muoni]    = muon.combinedMuon()->lost();
-      mPFMuonCombPt[muoni]          = muon.combinedMuon()->pt();
-      mPFMuonCombPz[muoni]          = muon.combinedMuon()->pz();
-      mPFMuonCombP[muoni]           = muon.combinedMuon()->p();
-      mPFMuonCombEta[muoni]         = muon.combinedMuon()->eta();
-      mPFMuonCombPhi[muoni]         = muon.combinedMuon()->phi();
-      mPFMuonCombChi2[muoni]        = muon.combinedMuon()->chi2();
-      mPFMuonCombCharge[muoni]      = muon.combinedMuon()->charge();
-      mPFMuonCombQOverPError[muoni] = muon.combinedMuon()->qoverpError();		
-      mPFMuonCombNdof[muoni]        = muon.combinedMuon()->ndof();
-      mPFMuonCombVx[muoni]          = muon.combinedMuon()->vx();
-      mPFMuonCombVy[muoni]          = muon.combinedMuon()->vy();
-      mPFMuonCombVz[muoni]          = muon.combinedMuon()->vz();
-      mPFMuonCombD0[muoni]          = muon.combinedMuon()->d0();
-      mPFMuonCombDz[muoni]          = muon.combinedMuon()->dz();
-    } 
-    else{
-      mPFMuonCombChi2Norm[muoni]    = 999.;
-      mPFMuonCombValidHits[muoni]   = 999.;
-      mPFMuonCombLostHits[muoni]    = 999.;
-      mPFMuonCombPt[muoni]          = 999.;
-      mPFMuonCombPz[muoni]          = 999.;
-      mPFMuonCombP[muoni]           = 999.;
-      mPFMuonCombEta[muoni]         = 999.;
-      mPFMuonCombPhi[muoni]         = 999.;
-      mPFMuonCombChi2[muoni]        = 999.;
-      mPFMuonCombCharge[muoni]      = 999.;
-      mPFMuonCombQOverPError[muoni] = 999.;
-      mPFMuonCombNdof[muoni]        = 999.;
-      mPFMuonCombVx[muoni]          = 999.;
-      mPFMuonCombVy[muoni]          = 999.;
-      mPFMuonCombVz[muoni]          = 999.;
-      mPFMuonCombD0[muoni]          = 999.;
-      mPFMuonCombDz[muoni]          = 999.;
-    }
-    // StandAloneMuon
-    if(muon.standAloneMuon().isNonnull()){
-      mPFMuonStandChi2Norm[muoni]    = muon.standAloneMuon()->normalizedChi2();
-      mPFMuonStandValidHits[muoni]   = muon.standAloneMuon()->found();
-      mPFMuonStandLostHits[muoni]    = muon.standAloneMuon()->lost();
-      mPFMuonStandPt[muoni]          = muon.standAloneMuon()->pt();
-      mPFMuonStandPz[muoni]          = muon.standAloneMuon()->pz();
-      mPFMuonStandP[muoni]           = muon.standAloneMuon()->p();
-      mPFMuonStandEta[muoni]         = muon.standAloneMuon()->eta();
-      mPFMuonStandPhi[muoni]         = muon.standAloneMuon()->phi();
-      mPFMuonStandChi2[muoni]        = muon.standAloneMuon()->chi2();
-      mPFMuonStandCharge[muoni]      = muon.standAloneMuon()->charge();
-      mPFMuonStandQOverPError[muoni] = muon.standAloneMuon()->qoverpError();
-    } 
-    else{
-      mPFMuonStandChi2Norm[muoni]    = 999.; 
-      mPFMuonStandValidHits[muoni]   = 999.; 
-      mPFMuonStandLostHits[muoni]    = 999.; 
-      mPFMuonStandPt[muoni]          = 999.; 
-      mPFMuonStandPz[muoni]          = 999.; 
-      mPFMuonStandP[muoni]           = 999.; 
-      mPFMuonStandEta[muoni]         = 999.; 
-      mPFMuonStandPhi[muoni]         = 999.; 
-      mPFMuonStandChi2[muoni]        = 999.; 
-      mPFMuonStandCharge[muoni]      = 999.; 
-      mPFMuonStandQOverPError[muoni] = 999.; 
-    }
-    // Track
-    if(muon.track().isNonnull()){
-      mPFMuonTrkChi2Norm[muoni]    = muon.track()->normalizedChi2();
-      mPFMuonTrkValidHits[muoni]   = muon.track()->found();
-      mPFMuonTrkLostHits[muoni]    = muon.track()->lost();
-      mPFMuonTrkPt[muoni]          = muon.track()->pt();
-      mPFMuonTrkPz[muoni]          = muon.track()->pz();
-      mPFMuonTrkP[muoni]           = muon.track()->p();
-      mPFMuonTrkEta[muoni]         = muon.track()->eta();
-      mPFMuonTrkPhi[muoni]         = muon.track()->phi();
-      mPFMuonTrkChi2[muoni]        = muon.track()->chi2();
-      mPFMuonTrkCharge[muoni]      = muon.track()->charge();
-      mPFMuonTrkQOverPError[muoni] = muon.track()->qoverpError();
-      mPFMuonTrkDxy[muoni]         = muon.track()->dxy( beamSpotHandle->position() );
-      mPFMuonTrkNumOfValidPixHits[muoni] =  muon.track()->hitPattern().numberOfValidPixelHits();
-      mPFMuonTrkLayerWithMeasurement[muoni] = muon.track()->hitPattern().trackerLayersWithMeasurement(); 
-    }
-    else{
-      mPFMuonTrkChi2Norm[muoni]    = 999.; 
-      mPFMuonTrkValidHits[muoni]   = 999.; 
-      mPFMuonTrkLostHits[muoni]    = 999.; 
-      mPFMuonTrkPt[muoni]          = 999.; 
-      mPFMuonTrkPz[muoni]          = 999.; 
-      mPFMuonTrkP[muoni]           = 999.; 
-      mPFMuonTrkEta[muoni]         = 999.; 
-      mPFMuonTrkPhi[muoni]         = 999.; 
-      mPFMuonTrkChi2[muoni]        = 999.; 
-      mPFMuonTrkCharge[muoni]      = 999.; 
-      mPFMuonTrkQOverPError[muoni] = 999.; 
-      mPFMuonTrkDxy[muoni]         = 999.;
-      mPFMuonTrkNumOfValidPixHits[muoni] = 999.;
-      mPFMuonTrkLayerWithMeasurement[muoni] = 999.;
+  if(fillPFMuon){
+    edm::Handle<edm::View<pat::Muon> > MuonHand;
+    iEvent.getByToken(PFMuonToken_,MuonHand);
+    int muoni=0;
+    for(unsigned int ind=0; ind<(*MuonHand).size() && ind<MAXMUON; ind++){ 
+      const pat::Muon& muon             = (*MuonHand)[ind];
+      mPFMuonPt[muoni]                  = muon.pt();
+      mPFMuonEt[muoni]                  = muon.et();
+      mPFMuonE[muoni]                   = muon.energy();
+      mPFMuonPx[muoni]                  = muon.momentum().X();
+      mPFMuonPy[muoni]                  = muon.momentum().Y();
+      mPFMuonPz[muoni]                  = muon.momentum().Z();
+      mPFMuonEta[muoni]                 = muon.eta();
+      mPFMuonPhi[muoni]                 = muon.phi();
+      mPFMuonCharge[muoni]              = muon.charge();
+      //
+      mPFMuonIsGlobal[muoni]            = muon.isGlobalMuon();
+      mPFMuonIsStandAlone[muoni]        = muon.isStandAloneMuon();
+      mPFMuonIsTracker[muoni]           = muon.isTrackerMuon();
+      mPFMuonIsPF[muoni]                = muon.isPFMuon();
+      //
+      mPFMuonIsTight[muoni]             = muon.isTightMuon(primaryvtx);
+      mPFMuonIsLoose[muoni]             = muon.isLooseMuon();
+      //
+      mPFMuonChargedHadronIso[muoni]    = muon.chargedHadronIso();
+      mPFMuonPhotonIso[muoni]           = muon.photonIso();
+      mPFMuonNeutralHadronIso[muoni]    = muon.neutralHadronIso();
+      mPFMuonisGMPT[muoni]              = muon.muonID("GlobalMuonPromptTight");
+      mPFMuonR04ChargedHadronPt[muoni]  = muon.pfIsolationR04().sumChargedHadronPt;
+      mPFMuonR04NeutralHadronEt[muoni]  = muon.pfIsolationR04().sumNeutralHadronEt;
+      mPFMuonR04PhotonEt[muoni]         = muon.pfIsolationR04().sumPhotonEt;
+      mPFMuonR04PUPt[muoni]             = muon.pfIsolationR04().sumPUPt;
+      //
+      mPFMuonNumOfMatches[muoni]        = muon.numberOfMatches(); 
+      mPFMuonNumOfMatchesStation[muoni] = muon.numberOfMatchedStations();
+      // Global Track
+      if(muon.globalTrack().isNonnull()){
+        mPFMuonGlobChi2Norm[muoni]            = muon.globalTrack()->normalizedChi2();
+        mPFMuonGlobNumOfValidMuonHits[muoni]  = muon.globalTrack()->hitPattern().numberOfValidMuonHits();
+      }
+      else{
+        mPFMuonGlobChi2Norm[muoni]            = 999.;
+        mPFMuonGlobNumOfValidMuonHits[muoni]  = 999.;
+      }
+      // BestTrack
+      if(muon.muonBestTrack().isNonnull()){
+        mPFMuonBestTrkdxy[muoni]              = fabs(muon.muonBestTrack()->dxy(primaryvtx.position()));
+        mPFMuonBestTrkdz[muoni]               = fabs(muon.muonBestTrack()->dz(primaryvtx.position()));
+      }
+      else{
+        mPFMuonBestTrkdxy[muoni]              = 999.;
+        mPFMuonBestTrkdz[muoni]               = 999.;
+      }
+      // InnerTrack
+      if(muon.innerTrack().isNonnull()){
+        mPFMuoninnertrackPt[muoni]     = muon.innerTrack()->pt();
+        mPFMuonnValidHits[muoni]       = muon.innerTrack()->numberOfValidHits();
+        mPFMuonnValidPixelHits[muoni]  = muon.innerTrack()->hitPattern().numberOfValidPixelHits();
+        mPFMuondxy[muoni]              = muon.innerTrack()->dxy(primaryvtx.position());
+        mPFMuondz[muoni]               = muon.vz() - primaryvtx.position().z();
+      }
+      else{
+        mPFMuoninnertrackPt[muoni]     = 999.;
+        mPFMuonnValidHits[muoni]       = 999.;
+        mPFMuonnValidPixelHits[muoni]  = 999.;
+        mPFMuondxy[muoni]              = 999.;
+        mPFMuondz[muoni]               = 999.;
+      }
+      // GlobalMuon
+      if(muon.isGlobalMuon() && muon.combinedMuon().isNonnull()){
+        mPFMuonCombChi2Norm[muoni]    = muon.combinedMuon()->normalizedChi2();
+        mPFMuonCombValidHits[muoni]   = muon.combinedMuon()->found();
+        mPFMuonCombLostHits[muoni]    = muon.combinedMuon()->lost();
+        mPFMuonCombPt[muoni]          = muon.combinedMuon()->pt();
+        mPFMuonCombPz[muoni]          = muon.combinedMuon()->pz();
+        mPFMuonCombP[muoni]           = muon.combinedMuon()->p();
+        mPFMuonCombEta[muoni]         = muon.combinedMuon()->eta();
+        mPFMuonCombPhi[muoni]         = muon.combinedMuon()->phi();
+        mPFMuonCombChi2[muoni]        = muon.combinedMuon()->chi2();
+        mPFMuonCombCharge[muoni]      = muon.combinedMuon()->charge();
+        mPFMuonCombQOverPError[muoni] = muon.combinedMuon()->qoverpError();		
+        mPFMuonCombNdof[muoni]        = muon.combinedMuon()->ndof();
+        mPFMuonCombVx[muoni]          = muon.combinedMuon()->vx();
+        mPFMuonCombVy[muoni]          = muon.combinedMuon()->vy();
+        mPFMuonCombVz[muoni]          = muon.combinedMuon()->vz();
+        mPFMuonCombD0[muoni]          = muon.combinedMuon()->d0();
+        mPFMuonCombDz[muoni]          = muon.combinedMuon()->dz();
+      } 
+      else{
+        mPFMuonCombChi2Norm[muoni]    = 999.;
+        mPFMuonCombValidHits[muoni]   = 999.;
+        mPFMuonCombLostHits[muoni]    = 999.;
+        mPFMuonCombPt[muoni]          = 999.;
+        mPFMuonCombPz[muoni]          = 999.;
+        mPFMuonCombP[muoni]           = 999.;
+        mPFMuonCombEta[muoni]         = 999.;
+        mPFMuonCombPhi[muoni]         = 999.;
+        mPFMuonCombChi2[muoni]        = 999.;
+        mPFMuonCombCharge[muoni]      = 999.;
+        mPFMuonCombQOverPError[muoni] = 999.;
+        mPFMuonCombNdof[muoni]        = 999.;
+        mPFMuonCombVx[muoni]          = 999.;
+        mPFMuonCombVy[muoni]          = 999.;
+        mPFMuonCombVz[muoni]          = 999.;
+        mPFMuonCombD0[muoni]          = 999.;
+        mPFMuonCombDz[muoni]          = 999.;
+      }
+      // StandAloneMuon
+      if(muon.standAloneMuon().isNonnull()){
+        mPFMuonStandChi2Norm[muoni]    = muon.standAloneMuon()->normalizedChi2();
+        mPFMuonStandValidHits[muoni]   = muon.standAloneMuon()->found();
+        mPFMuonStandLostHits[muoni]    = muon.standAloneMuon()->lost();
+        mPFMuonStandPt[muoni]          = muon.standAloneMuon()->pt();
+        mPFMuonStandPz[muoni]          = muon.standAloneMuon()->pz();
+        mPFMuonStandP[muoni]           = muon.standAloneMuon()->p();
+        mPFMuonStandEta[muoni]         = muon.standAloneMuon()->eta();
+        mPFMuonStandPhi[muoni]         = muon.standAloneMuon()->phi();
+        mPFMuonStandChi2[muoni]        = muon.standAloneMuon()->chi2();
+        mPFMuonStandCharge[muoni]      = muon.standAloneMuon()->charge();
+        mPFMuonStandQOverPError[muoni] = muon.standAloneMuon()->qoverpError();
+      } 
+      else{
+        mPFMuonStandChi2Norm[muoni]    = 999.; 
+        mPFMuonStandValidHits[muoni]   = 999.; 
+        mPFMuonStandLostHits[muoni]    = 999.; 
+        mPFMuonStandPt[muoni]          = 999.; 
+        mPFMuonStandPz[muoni]          = 999.; 
+        mPFMuonStandP[muoni]           = 999.; 
+        mPFMuonStandEta[muoni]         = 999.; 
+        mPFMuonStandPhi[muoni]         = 999.; 
+        mPFMuonStandChi2[muoni]        = 999.; 
+        mPFMuonStandCharge[muoni]      = 999.; 
+        mPFMuonStandQOverPError[muoni] = 999.; 
+      }
+      // Track
+      if(muon.track().isNonnull()){
+        mPFMuonTrkChi2Norm[muoni]    = muon.track()->normalizedChi2();
+        mPFMuonTrkValidHits[muoni]   = muon.track()->found();
+        mPFMuonTrkLostHits[muoni]    = muon.track()->lost();
+        mPFMuonTrkPt[muoni]          = muon.track()->pt();
+        mPFMuonTrkPz[muoni]          = muon.track()->pz();
+        mPFMuonTrkP[muoni]           = muon.track()->p();
+        mPFMuonTrkEta[muoni]         = muon.track()->eta();
+        mPFMuonTrkPhi[muoni]         = muon.track()->phi();
+        mPFMuonTrkChi2[muoni]        = muon.track()->chi2();
+        mPFMuonTrkCharge[muoni]      = muon.track()->charge();
+        mPFMuonTrkQOverPError[muoni] = muon.track()->qoverpError();
+        mPFMuonTrkDxy[muoni]         = muon.track()->dxy( beamSpotHandle->position() );
+        mPFMuonTrkNumOfValidPixHits[muoni] =  muon.track()->hitPattern().numberOfValidPixelHits();
+        mPFMuonTrkLayerWithMeasurement[muoni] = muon.track()->hitPattern().trackerLayersWithMeasurement(); 
+      }
+      else{
+        mPFMuonTrkChi2Norm[muoni]    = 999.; 
+        mPFMuonTrkValidHits[muoni]   = 999.; 
+        mPFMuonTrkLostHits[muoni]    = 999.; 
+        mPFMuonTrkPt[muoni]          = 999.; 
+        mPFMuonTrkPz[muoni]          = 999.; 
+        mPFMuonTrkP[muoni]           = 999.; 
+        mPFMuonTrkEta[muoni]         = 999.; 
+        mPFMuonTrkPhi[muoni]         = 999.; 
+        mPFMuonTrkChi2[muoni]        = 999.; 
+        mPFMuonTrkCharge[muoni]      = 999.; 
+        mPFMuonTrkQOverPError[muoni] = 999.; 
+        mPFMuonTrkDxy[muoni]         = 999.;
+        mPFMuonTrkNumOfValidPixHits[muoni] = 999.;
+        mPFMuonTrkLayerWithMeasurement[muoni] = 999.;
+      }
+      muoni++;
+      if(muoni>=MAXMUON) break;
     }
-    muoni++;
-    if(muoni>=MAXMUON) break;
-  }
-  mNPFMuon=muoni;
-  if(debugMode){
-    cout<<"NPFMuons: "<<mNPFMuon<<endl;
-    if(mNPFMuon>0){
-      cout<<"PFMuon0: Pt= "<<mPFMuonPt[0]
-	  <<", Eta= "<<mPFMuonEta[0]
-	  <<", Phi= "<<mPFMuonPhi[0]
-	  <<", R04ChargedHadronPt= "<<mPFMuonR04ChargedHadronPt[0]
-	  <<", R04NeutralHadronEt= "<<mPFMuonR04NeutralHadronEt[0]
-	  <<", R04PhotonEt= "<<mPFMuonR04PhotonEt[0]
-	  <<", R04PUPt="<<mPFMuonR04PUPt[muoni]
-	  <<", Tight= "<<mPFMuonIsTight[0]
-	  <<", Loose= "<<mPFMuonIsLoose[0]
-	  <<endl;
+    mNPFMuon=muoni;
+    if(debugMode){
+      cout<<"NPFMuons: "<<mNPFMuon<<endl;
+      if(mNPFMuon>0){
+        cout<<"PFMuon0: Pt= "<<mPFMuonPt[0]
+  	  <<", Eta= "<<mPFMuonEta[0]
+  	  <<", Phi= "<<mPFMuonPhi[0]
+  	  <<", R04ChargedHadronPt= "<<mPFMuonR04ChargedHadronPt[0]
+  	  <<", R04NeutralHadronEt= "<<mPFMuonR04NeutralHadronEt[0]
+  	  <<", R04PhotonEt= "<<mPFMuonR04PhotonEt[0]
+  	  <<", R04PUPt="<<mPFMuonR04PUPt[muoni]
+  	  <<", Tight= "<<mPFMuonIsTight[0]
+  	  <<", Loose= "<<mPFMuonIsLoose[0]
+  	  <<endl;
+      }
     }
   }
 
@@ -2066,89 +1968,91 @@ void NtupleAnalyzer::analyze(const edm::Event& iEvent, const edm::EventSetup& iS
   ///-------------------------------------------------------------------------- 
   /// PFElectrons
   ///--------------------------------------------------------------------------
-  edm::Handle<edm::View<pat::Electron> > ElecHand;
-  iEvent.getByLabel(PFElectronTag_,ElecHand);
-  int eleci=0;
-  for(unsigned int ind=0; ind<(*ElecHand).size() && ind<MAXELEC; ind++){ 
-    const pat::Electron& elec = (*ElecHand)[ind];
+  if(fillPFElec){
+    edm::Handle<edm::View<pat::Electron> > ElecHand;
+    iEvent.getByToken(PFElectronToken_,ElecHand);
+    int eleci=0;
+    for(unsigned int ind=0; ind<(*ElecHand).size() && ind<MAXELEC; ind++){ 
+      const pat::Electron& elec = (*ElecHand)[ind];
     
-    mPFElecE[eleci]                    = elec.energy();
-    mPFElecPt[eleci]                   = elec.pt();
-    mPFElecPx[eleci]                   = elec.px();
-    mPFElecPy[eleci]                   = elec.py();
-    mPFElecPz[eleci]                   = elec.pz();
-    mPFElecEta[eleci]                  = elec.eta();
-    mPFElecPhi[eleci]                  = elec.phi();
-    mPFElecCharge[eleci]               = elec.charge();
+      mPFElecE[eleci]                    = elec.energy();
+      mPFElecPt[eleci]                   = elec.pt();
+      mPFElecPx[eleci]                   = elec.px();
+      mPFElecPy[eleci]                   = elec.py();
+      mPFElecPz[eleci]                   = elec.pz();
+      mPFElecEta[eleci]                  = elec.eta();
+      mPFElecPhi[eleci]                  = elec.phi();
+      mPFElecCharge[eleci]               = elec.charge();
     
-    mPFElecCharHadIso[eleci]           = elec.chargedHadronIso();
-    mPFElecPhoIso[eleci]               = elec.photonIso();
-    mPFElecNeuHadIso[eleci]            = elec.neutralHadronIso();
-    //mPFElecMva[eleci]                  = elec.mva();
+      mPFElecCharHadIso[eleci]           = elec.chargedHadronIso();
+      mPFElecPhoIso[eleci]               = elec.photonIso();
+      mPFElecNeuHadIso[eleci]            = elec.neutralHadronIso();
+      //mPFElecMva[eleci]                  = elec.mva();
     
-    mPFElecEffArea[eleci]              = 0.;
+      mPFElecEffArea[eleci]              = 0.;
     
-    mPFElecdxy[eleci]                  = elec.gsfTrack()->dxy(primaryvtx.position());
-    mPFElecdz[eleci]                   = elec.gsfTrack()->dz(primaryvtx.position());
+      mPFElecdxy[eleci]                  = elec.gsfTrack()->dxy(primaryvtx.position());
+      mPFElecdz[eleci]                   = elec.gsfTrack()->dz(primaryvtx.position());
     
-    mPFElecIsEB[eleci]                 = elec.isEB();
-    mPFElecHadOverEm[eleci]            = elec.hadronicOverEm();
-    mPFElecHcalOverEm[eleci]           = elec.hcalOverEcal();
-    mPFElecSupClusOverP[eleci]         = elec.eSuperClusterOverP();
+      mPFElecIsEB[eleci]                 = elec.isEB();
+      mPFElecHadOverEm[eleci]            = elec.hadronicOverEm();
+      mPFElecHcalOverEm[eleci]           = elec.hcalOverEcal();
+      mPFElecSupClusOverP[eleci]         = elec.eSuperClusterOverP();
     
-    //mPFElecInnerHits[eleci]            = elec.gsfTrack()->trackerExpectedHitsInner().numberOfHits();
-    mPFElecConvDist[eleci]             = elec.convDist();//convInfo.dist();
-    mPFElecConvDcot[eleci]             = elec.convDcot();//convInfo.dcot();
+      //mPFElecInnerHits[eleci]            = elec.gsfTrack()->trackerExpectedHitsInner().numberOfHits();
+      mPFElecConvDist[eleci]             = elec.convDist();//convInfo.dist();
+      mPFElecConvDcot[eleci]             = elec.convDcot();//convInfo.dcot();
     
-    mPFElecEcalDrivenSeed[eleci]       = elec.ecalDrivenSeed();
-    mPFElecdB[eleci]                   = elec.dB();
-    mPFElecNumOfValidHits[eleci]       = elec.gsfTrack()->numberOfValidHits();
-    mPFElecdr03HcalTowerSumEt[eleci]   = elec.dr03HcalTowerSumEt();//hcalIso();
-    mPFElecdr03EcalRecHitSumEt[eleci]  = elec.dr03EcalRecHitSumEt();//ecalIso();
-    mPFElecdr03TkSumPt[eleci]          = elec.dr03TkSumPt(); //trackIso();
-    mPFElecNormChi2[eleci]             = elec.gsfTrack()->normalizedChi2();
-    mPFElecfbrem[eleci]                = elec.fbrem();
-    mPFElecDEtaSuTrAtVtx[eleci]        = elec.deltaEtaSuperClusterTrackAtVtx();
-    mPFElecDPhiSuTrAtVtx[eleci]        = elec.deltaPhiSuperClusterTrackAtVtx();
-    mPFElecHadronicOverEm[eleci]       = elec.hadronicOverEm();
-    mPFElecHcalOverEcal[eleci]         = elec.hcalOverEcal();
-    mPFElecSuperClusOverP[eleci]       = elec.eSuperClusterOverP();
-    mPFElecetaeta[eleci]               = elec.sigmaEtaEta();
-    mPFElecietaieta[eleci]             = elec.sigmaIetaIeta();
+      mPFElecEcalDrivenSeed[eleci]       = elec.ecalDrivenSeed();
+      mPFElecdB[eleci]                   = elec.dB();
+      mPFElecNumOfValidHits[eleci]       = elec.gsfTrack()->numberOfValidHits();
+      mPFElecdr03HcalTowerSumEt[eleci]   = elec.dr03HcalTowerSumEt();//hcalIso();
+      mPFElecdr03EcalRecHitSumEt[eleci]  = elec.dr03EcalRecHitSumEt();//ecalIso();
+      mPFElecdr03TkSumPt[eleci]          = elec.dr03TkSumPt(); //trackIso();
+      mPFElecNormChi2[eleci]             = elec.gsfTrack()->normalizedChi2();
+      mPFElecfbrem[eleci]                = elec.fbrem();
+      mPFElecDEtaSuTrAtVtx[eleci]        = elec.deltaEtaSuperClusterTrackAtVtx();
+      mPFElecDPhiSuTrAtVtx[eleci]        = elec.deltaPhiSuperClusterTrackAtVtx();
+      mPFElecHadronicOverEm[eleci]       = elec.hadronicOverEm();
+      mPFElecHcalOverEcal[eleci]         = elec.hcalOverEcal();
+      mPFElecSuperClusOverP[eleci]       = elec.eSuperClusterOverP();
+      mPFElecetaeta[eleci]               = elec.sigmaEtaEta();
+      mPFElecietaieta[eleci]             = elec.sigmaIetaIeta();
     
-    mPFeidLoose[eleci]                 = ((int)elec.electronID("eidLoose") & 1);
-    mPFeidRobustHighEnergy[eleci]      = ((int)elec.electronID("eidRobustHighEnergy") & 1);
-    mPFeidRobustLoose[eleci]           = ((int)elec.electronID("eidRobustLoose") & 1);
-    mPFeidRobustTight[eleci]           = ((int)elec.electronID("eidRobustTight") & 1);
-    mPFeidTight[eleci]                 = ((int)elec.electronID("eidTight") & 1);
-    //mPFevspi[eleci]                    = ((int)elec.electronID("pf_evspi") & 1);
-    //mPFevsmu[eleci]                    = ((int)elec.electronID("pf_evsmu") & 1);
-
-    //ID
-    //float ooemoop                      = (1.0/elec.ecalEnergy() - elec.eSuperClusterOverP()/elec.ecalEnergy());
-    //bool vtxFitConversion              = ConversionTools::hasMatchedConversion(elec, conversions_h, beamSpotHandle->position());
-    mPFElecIsTight[eleci]              = 0.;
-    mPFElecIsMedium[eleci]             = 0.;
-    mPFElecIsLoose[eleci]              = 0.;
-    mPFElecIsVeto[eleci]               = 0.;
+      mPFeidLoose[eleci]                 = ((int)elec.electronID("eidLoose") & 1);
+      mPFeidRobustHighEnergy[eleci]      = ((int)elec.electronID("eidRobustHighEnergy") & 1);
+      mPFeidRobustLoose[eleci]           = ((int)elec.electronID("eidRobustLoose") & 1);
+      mPFeidRobustTight[eleci]           = ((int)elec.electronID("eidRobustTight") & 1);
+      mPFeidTight[eleci]                 = ((int)elec.electronID("eidTight") & 1);
+      //mPFevspi[eleci]                    = ((int)elec.electronID("pf_evspi") & 1);
+      //mPFevsmu[eleci]                    = ((int)elec.electronID("pf_evsmu") & 1);
+
+      //ID
+      //float ooemoop                      = (1.0/elec.ecalEnergy() - elec.eSuperClusterOverP()/elec.ecalEnergy());
+      //bool vtxFitConversion              = ConversionTools::hasMatchedConversion(elec, conversions_h, beamSpotHandle->position());
+      mPFElecIsTight[eleci]              = 0.;
+      mPFElecIsMedium[eleci]             = 0.;
+      mPFElecIsLoose[eleci]              = 0.;
+      mPFElecIsVeto[eleci]               = 0.;
     
-    eleci++;
-    if(eleci>=MAXELEC) break;
-  }
-  mNPFElec=eleci;
-  if(debugMode){
-    cout<<"NPFElectrons: "<<mNPFElec<<endl;
-    if(mNPFElec>0){
-      cout<<"PFElec0: Pt= "<<mPFElecPt[0]
-	  <<", Eta= "<<mPFElecEta[0]
-	  <<", Phi= "<<mPFElecPhi[0]
-	  <<", CharHadIso= "<<mPFElecCharHadIso[0]
-	  <<", PhoIso= "<<mPFElecPhoIso[0]
-	  <<", NeuHadIso= "<<mPFElecNeuHadIso[0]
-	  <<", EffArea= "<<mPFElecEffArea[0]
-	  <<", Tight= "<<mPFElecIsTight[0]
-	  <<", Veto= "<<mPFElecIsVeto[0]
-	  <<endl;
+      eleci++;
+      if(eleci>=MAXELEC) break;
+    }
+    mNPFElec=eleci;
+    if(debugMode){
+      cout<<"NPFElectrons: "<<mNPFElec<<endl;
+      if(mNPFElec>0){
+        cout<<"PFElec0: Pt= "<<mPFElecPt[0]
+  	  <<", Eta= "<<mPFElecEta[0]
+  	  <<", Phi= "<<mPFElecPhi[0]
+  	  <<", CharHadIso= "<<mPFElecCharHadIso[0]
+  	  <<", PhoIso= "<<mPFElecPhoIso[0]
+  	  <<", NeuHadIso= "<<mPFElecNeuHadIso[0]
+  	  <<", EffArea= "<<mPFElecEffArea[0]
+  	  <<", Tight= "<<mPFElecIsTight[0]
+  	  <<", Veto= "<<mPFElecIsVeto[0]
+  	  <<endl;
+      }
     }
   }
   
@@ -2156,114 +2060,120 @@ void NtupleAnalyzer::analyze(const edm::Event& iEvent, const edm::EventSetup& iS
   ///-------------------------------------------------------------------------- 
   /// PFTaus
   ///--------------------------------------------------------------------------
-  edm::Handle<pat::TauCollection> TauHand;
-  iEvent.getByLabel(PFTauTag_,TauHand);
-  int taui=0;
+  if(fillPFTau){
+    edm::Handle<pat::TauCollection> TauHand;
+    iEvent.getByToken(PFTauToken_,TauHand);
+    int taui=0;
   
-  for(unsigned int ind=0; ind<(*TauHand).size() && ind<MAXTAU; ind++){ 
-    const pat::Tau& tau = (*TauHand)[ind];
+    for(unsigned int ind=0; ind<(*TauHand).size() && ind<MAXTAU; ind++){ 
+      const pat::Tau& tau = (*TauHand)[ind];
     
-    mPFTauPt[taui]                                             = tau.pt();
-    mPFTauPx[taui]                                             = tau.momentum().X();
-    mPFTauPy[taui]                                             = tau.momentum().Y();
-    mPFTauPz[taui]                                             = tau.momentum().Z();
-    mPFTauE[taui]                                              = tau.energy();
-    mPFTauEta[taui]                                            = tau.eta();
-    mPFTauPhi[taui]                                            = tau.phi();
-    mPFTauCharge[taui]                                         = tau.charge();
+      mPFTauPt[taui]                                             = tau.pt();
+      mPFTauPx[taui]                                             = tau.momentum().X();
+      mPFTauPy[taui]                                             = tau.momentum().Y();
+      mPFTauPz[taui]                                             = tau.momentum().Z();
+      mPFTauE[taui]                                              = tau.energy();
+      mPFTauEta[taui]                                            = tau.eta();
+      mPFTauPhi[taui]                                            = tau.phi();
+      mPFTauCharge[taui]                                         = tau.charge();
     
-    //ID
-    mPFTauDisAgainstElectronLoose[taui]                        = tau.tauID("againstElectronLoose");
-    mPFTauDisAgainstElectronLooseMVA5[taui]                    = tau.tauID("againstElectronLooseMVA5");
-    mPFTauDisAgainstElectronMedium[taui]                       = tau.tauID("againstElectronMedium");
-    mPFTauDisAgainstElectronMediumMVA5[taui]                   = tau.tauID("againstElectronMediumMVA5");
-    mPFTauDisAgainstElectronTight[taui]                        = tau.tauID("againstElectronTight");
-    mPFTauDisAgainstElectronTightMVA5[taui]                    = tau.tauID("againstElectronTightMVA5");
-    mPFTauDisAgainstElectronVTightMVA3[taui]                   = tau.tauID("againstElectronVTightMVA5");
-
-    mPFTauDisAgainstElectronVLooseMVA5[taui]                   = tau.tauID("againstElectronVLooseMVA5");
-    // 
-    mPFTauDisAgainstMuonLoose3[taui]                           = tau.tauID("againstMuonLoose3");
-    mPFTauDisAgainstMuonMedium2[taui]                          = tau.tauID("againstMuonMedium2");
-    mPFTauDisAgainstMuonMedium[taui]                           = tau.tauID("againstMuonMedium");
-    mPFTauDisAgainstMuonTight3[taui]                           = tau.tauID("againstMuonTight3");
-    //
-
-    mPFTauDisByCombinedIsolationDeltaBetaCorrRaw3Hits[taui]    = tau.tauID("byCombinedIsolationDeltaBetaCorrRaw3Hits");
-    //
-
-    mPFTauDisByLooseCombinedIsolationDeltaBetaCorr3Hits[taui]  = tau.tauID("byLooseCombinedIsolationDeltaBetaCorr3Hits");
-
-    mPFTauDisByMediumCombinedIsolationDeltaBetaCorr3Hits[taui] = tau.tauID("byMediumCombinedIsolationDeltaBetaCorr3Hits");
-    //
-    mPFTauDisByTightCombinedIsolationDeltaBetaCorr3Hits[taui]  = tau.tauID("byTightCombinedIsolationDeltaBetaCorr3Hits");
-
-    //
-    mPFTauDisDecayModeFinding[taui]                              = tau.tauID("decayModeFinding");
-    mPFTauDisDecayModeFindingNewDMs[taui]                        = tau.tauID("decayModeFindingNewDMs");
-    mPFTauChargedIsoPtSum[taui]                                  = tau.tauID("chargedIsoPtSum");
-    mPFTauNeutralIsoPtSum[taui]                                  = tau.tauID("neutralIsoPtSum");
-    mPFTauPUCorrPtSum[taui]                                      = tau.tauID("puCorrPtSum");
-
-
-    //GenJet Pt
-    mPFTauJetPt[taui]  =  -99.;
-    mPFTauJetEta[taui] =  -99.;
-    mPFTauJetPhi[taui] =  -99.;
-    if(isMCTag && tau.genJet()!= 0){
-      mPFTauJetPt[taui]  =  tau.genJet()->pt();
-      mPFTauJetEta[taui] =  tau.genJet()->eta();
-      mPFTauJetPhi[taui] =  tau.genJet()->phi();
-    }
+      //ID
+      if(fillPFTauDis){
+        mPFTauDisAgainstElectronLoose[taui]                        = TauID(tau, kTauAgainstElectronLoose);
+        mPFTauDisAgainstElectronLooseMVA5[taui]                    = TauID(tau, kTauAgainstElectronLooseMVA5);
+        mPFTauDisAgainstElectronMedium[taui]                       = TauID(tau, kTauAgainstElectronMedium);
+        mPFTauDisAgainstElectronMediumMVA5[taui]                   = TauID(tau, kTauAgainstElectronMediumMVA5);
+        mPFTauDisAgainstElectronTight[taui]                        = TauID(tau, kTauAgainstElectronTight);
+        mPFTauDisAgainstElectronTightMVA5[taui]                    = TauID(tau, kTauAgainstElectronTightMVA5);
+        mPFTauDisAgainstElectronVTightMVA3[taui]                   = TauID(tau, kTauAgainstElectronVTightMVA5);
+
+        mPFTauDisAgainstElectronVLooseMVA5[taui]                   = TauID(tau, kTauAgainstElectronVLooseMVA5);
+        // 
+        mPFTauDisAgainstMuonLoose3[taui]                           = TauID(tau, kTauAgainstMuonLoose3);
+        mPFTauDisAgainstMuonMedium2[taui]                          = TauID(tau, kTauAgainstMuonMedium2);
+        mPFTauDisAgainstMuonMedium[taui]                           = TauID(tau, kTauAgainstMuonMedium);
+        mPFTauDisAgainstMuonTight3[taui]                           = TauID(tau, kTauAgainstMuonTight3);
+        //
+
+        mPFTauDisByCombinedIsolationDeltaBetaCorrRaw3Hits[taui]    = TauID(tau, kTauByCombinedIsolationDeltaBetaCorrRaw3Hits);
+        //
+
+        mPFTauDisByLooseCombinedIsolationDeltaBetaCorr3Hits[taui]  = TauID(tau, kTauByLooseCombinedIsolationDeltaBetaCorr3Hits);
+
+        mPFTauDisByMediumCombinedIsolationDeltaBetaCorr3Hits[taui] = TauID(tau, kTauByMediumCombinedIsolationDeltaBetaCorr3Hits);
+        //
+        mPFTauDisByTightCombinedIsolationDeltaBetaCorr3Hits[taui]  = TauID(tau, kTauByTightCombinedIsolationDeltaBetaCorr3Hits);
+
+        //
+        mPFTauDisDecayModeFinding[taui]                              = TauID(tau, kTauDecayModeFinding);
+        mPFTauDisDecayModeFindingNewDMs[taui]                        = TauID(tau, kTauDecayModeFindingNewDMs);
+      }
+      mPFTauChargedIsoPtSum[taui]                                  = TauID(tau, kTauChargedIsoPtSum);
+      mPFTauNeutralIsoPtSum[taui]                                  = TauID(tau, kTauNeutralIsoPtSum);
+      mPFTauPUCorrPtSum[taui]                                      = TauID(tau, kTauPuCorrPtSum);
+
+
+      //GenJet Pt
+      mPFTauJetPt[taui]  =  -99.;
+      mPFTauJetEta[taui] =  -99.;
+      mPFTauJetPhi[taui] =  -99.;
+      if(isMCTag && tau.genJet()!= 0){
+        mPFTauJetPt[taui]  =  tau.genJet()->pt();
+        mPFTauJetEta[taui] =  tau.genJet()->eta();
+        mPFTauJetPhi[taui] =  tau.genJet()->phi();
+      }
     
-    taui++;  
-    if(taui>=MAXTAU) break; 
-  }
+      taui++;  
+      if(taui>=MAXTAU) break; 
+    }
   
-  mNPFTau = taui;
-  if(debugMode && mNPFTau>0){
-    cout<<"PFTau0: Pt= "<<mPFTauPt[0]
-	<<", Eta= "<<mPFTauEta[0]
-	<<", Phi= "<<mPFTauPhi[0]
-      //<<", ByDecayMode= "<<mPFTauDisDecayModeFinding[0]
-      //<<", ByLooseCombinedIsolationDeltaBetaCorr= "<<mPFTauDisByLooseCombinedIsolationDeltaBetaCorr[0]
-	<<endl;
+    mNPFTau = taui;
+    if(debugMode && mNPFTau>0){
+      cout<<"PFTau0: Pt= "<<mPFTauPt[0]
+  	<<", Eta= "<<mPFTauEta[0]
+  	<<", Phi= "<<mPFTauPhi[0]
+        //<<", ByDecayMode= "<<mPFTauDisDecayModeFinding[0]
+        //<<", ByLooseCombinedIsolationDeltaBetaCorr= "<<mPFTauDisByLooseCombinedIsolationDeltaBetaCorr[0]
+  	<<endl;
+    }
   }
   
   
   ///-------------------------------------------------------------------------- 
   /// Photons
   ///--------------------------------------------------------------------------
-  edm::Handle<edm::View<pat::Photon> > PhotHand;
-  iEvent.getByLabel("slimmedPhotons",PhotHand);
-  int photi=0;
-  if(PhotHand.isValid()){
-    for(unsigned int ind=0; ind<(*PhotHand).size() && ind<MAXPHOT; ind++){ 
-      const pat::Photon& phot = (*PhotHand)[ind];
+  if(fillPhot){
+    edm::Handle<edm::View<pat::Photon> > PhotHand;
+    iEvent.getByToken(PhotonToken_,PhotHand);
+    int photi=0;
+    if(PhotHand.isValid()){
+      for(unsigned int ind=0; ind<(*PhotHand).size() && ind<MAXPHOT; ind++){ 
+        const pat::Photon& phot = (*PhotHand)[ind];
       
-      mPhotPt[photi]  = phot.pt() ;
-      mPhotPx[photi]  = phot.momentum().X() ;
-      mPhotPy[photi]  = phot.momentum().Y() ;
-      mPhotPz[photi]  = phot.momentum().Z() ;
-      mPhotE[photi]   = phot.energy() ;
-      mPhotEta[photi] = phot.eta() ;
-      mPhotPhi[photi] = phot.phi() ;
-      mPhotE1x5[eleci]= phot.e1x5(); 
-      mPhotE2x5[photi]= phot.e2x5(); 
-      mPhotE5x5[photi]= phot.e5x5(); 
-      mPhotSigEta[photi] = phot.sigmaEtaEta();
-      //mPhotSigPhi[photi] = phot.sigmaPhiPhi();
-      mPhotEcalIso04[photi] = phot.ecalIso(); 
-      mPhotHcalIso04[photi] = phot.hcalIso();
-      mPhotTrackIso04[photi] = phot.trackIso();
+        mPhotPt[photi]  = phot.pt() ;
+        mPhotPx[photi]  = phot.momentum().X() ;
+        mPhotPy[photi]  = phot.momentum().Y() ;
+        mPhotPz[photi]  = phot.momentum().Z() ;
+        mPhotE[photi]   = phot.energy() ;
+        mPhotEta[photi] = phot.eta() ;
+        mPhotPhi[photi] = phot.phi() ;
+        mPhotE1x5[photi]= phot.e1x5(); 
+        mPhotE2x5[photi]= phot.e2x5(); 
+        mPhotE5x5[photi]= phot.e5x5(); 
+        mPhotSigEta[photi] = phot.sigmaEtaEta();
+        //mPhotSigPhi[photi] = phot.sigmaPhiPhi();
+        mPhotEcalIso04[photi] = phot.ecalIso(); 
+        mPhotHcalIso04[photi] = phot.hcalIso();
+        mPhotTrackIso04[photi] = phot.trackIso();
       
-      mPhotHasPixSeed[photi] = phot.hasPixelSeed();
-      mPhotIsPhot[photi]     = phot.isPhoton();   
+        mPhotHasPixSeed[photi] = phot.hasPixelSeed();
+        mPhotIsPhot[photi]     = phot.isPhoton();   
       
-      photi++;
+        photi++;
+      }
     }
+    mNPhot = photi;
   }
-  mNPhot = photi;
   
   
   ///-------------------------------------------------------------------------- 
@@ -2271,10 +2181,10 @@ void NtupleAnalyzer::analyze(const edm::Event& iEvent, const edm::EventSetup& iS
   ///--------------------------------------------------------------------------
   mNGenPar = 0;
  
-  if(isMCTag) {
+  if(isMCTag && fillGenPar) {
 		/// Gen Particles
 		Handle<reco::GenParticleCollection>  GenParHand;
-		iEvent.getByLabel("prunedGenParticles", GenParHand);
+		iEvent.getByToken(GenParticleToken_, GenParHand);
 
 		int igcount=0;
 		
@@ -2323,12 +2233,11 @@ void NtupleAnalyzer::analyze(const edm::Event& iEvent, const edm::EventSetup& iS
   ///-------------------------------------------------------------------------- 
   /// PDF
   ///--------------------------------------------------------------------------
-  if(isMCTag && isSignalTag==1.){
+  if(isMCTag && isSignalTag==1. && fillPDFWeights){
     
     ///----------PDF Weight from file---------------------------------------
-    edm::InputTag pdfWeightTag("pdfWeights1:cteq66"); // or any other PDF set
     edm::Handle<std::vector<double> > weightHandle;
-    iEvent.getByLabel(pdfWeightTag, weightHandle);
+    iEvent.getByToken(PdfWeightsToken_, weightHandle);
     
     std::vector<double> weights = (*weightHandle);
     //std::cout << "Event weight for central PDF:" << weights[0] << std::endl;
@@ -2340,12 +2249,11 @@ void NtupleAnalyzer::analyze(const edm::Event& iEvent, const edm::EventSetup& iS
     mNPdfWeights1 = nmembers;  
   }
   
-  if(isMCTag && isSignalTag==2.){
+  if(isMCTag && isSignalTag==2. && fillPDFWeights){
   
     ///----------PDF Weight from file---------------------------------------
-    edm::InputTag pdfWeightTag("pdfWeights2:MSTW2008nlo68cl"); // or any other PDF set
     edm::Handle<std::vector<double> > weightHandle;
-    iEvent.getByLabel(pdfWeightTag, weightHandle);
+    iEvent.getByToken(PdfWeightsToken_, weightHandle);
     
     std::vector<double> weights = (*weightHandle);
     //std::cout << "Event weight for central PDF:" << weights[0] << std::endl;
@@ -2357,11 +2265,10 @@ void NtupleAnalyzer::analyze(const edm::Event& iEvent, const edm::EventSetup& iS
     mNPdfWeights = nmembers;  
   }
   
-  if(isMCTag && isSignalTag==3.){
+  if(isMCTag && isSignalTag==3. && fillPDFWeights){
     ///----------PDF Weight from file---------------------------------------
-    edm::InputTag pdfWeightTag("pdfWeights3:NNPDF20"); // or any other PDF set
     edm::Handle<std::vector<double> > weightHandle;
-    iEvent.getByLabel(pdfWeightTag, weightHandle);
+    iEvent.getByToken(PdfWeightsToken_, weightHandle);
     
     std::vector<double> weights = (*weightHandle);
     //std::cout << "Event weight for central PDF:" << weights[0] << std::endl;
@@ -2447,526 +2354,536 @@ void NtupleAnalyzer::analyze(const edm::Event& iEvent, const edm::EventSetup& iS
   ///-------------------------------------------------------------------------- 
   /// Fill tree
   ///--------------------------------------------------------------------------
+  if( compactOutput ) FillCompactLeaves();
   mtree->Fill();
 }
 
 
 // ------------ method called once each job just before starting event loop  ------------
+///------------------------------------------------
+/// Book a leaf list branch, Double_t leaves are written as Float_t in compact mode
+///------------------------------------------------
+TBranch* NtupleAnalyzer::Branch(const char* name, void* address, const std::string & leaflist)
+{
+  if( !Keep(name) ) return 0;
+  
+  // an array needs its counter branch
+  std::string counter;
+  size_t open = leaflist.find('['), close = leaflist.find(']');
+  if( open!=std::string::npos && close!=std::string::npos ){
+    counter = leaflist.substr(open+1, close-open-1);
+    if( counter.find_first_not_of("0123456789")!=std::string::npos && !bookedBranches.count(counter) ){
+      edm::LogWarning("NtupleAnalyzer") << "Branch " << name << " dropped, its counter " << counter << " is not booked";
+      return 0;
+    }
+  }
+  bookedBranches.insert(name);
+  
+  if( !compactOutput || leaflist.size()<3 || leaflist.compare(leaflist.size()-2, 2, "/D")!=0 )
+    return mtree->Branch(name, address, leaflist.c_str());
+  
+  CompactLeaf leaf;
+  leaf.source   = (const double*) address;
+  leaf.counter  = 0;
+  leaf.length   = 1;
+  leaf.truncate = false;
+  if( !counter.empty() ){
+    if( counter.find_first_not_of("0123456789")==std::string::npos ) leaf.length = atoi(counter.c_str());
+    else leaf.counter = (const int*) mtree->GetBranch(counter.c_str())->GetAddress();
+  }
+  for(size_t i=0; i<compactTruncated.size(); i++)
+    if( std::string(name).find(compactTruncated[i])!=std::string::npos ) leaf.truncate = compactMantissaBits>=2 && compactMantissaBits<23;
+  
+  // arrays with a counter start small, FillCompactLeaves grows them
+  leaf.staging.resize( leaf.counter ? 16 : leaf.length );
+  std::string leaves = leaflist;
+  leaves[leaves.size()-1] = 'F';
+  leaf.branch = mtree->Branch(name, &leaf.staging[0], leaves.c_str());
+  compactLeaves.push_back(leaf);
+  return leaf.branch;
+}
+
+
+///------------------------------------------------
+/// Float copies of the compact leaves, rounded to compactMantissaBits for the truncated ones
+///------------------------------------------------
+static float TruncateMantissa(float value, int bits)
+{
+  uint32_t word;
+  memcpy(&word, &value, sizeof(word));
+  uint32_t drop = 23 - bits;
+  word += 1u << (drop-1);
+  word &= ~((1u << drop) - 1);
+  memcpy(&value, &word, sizeof(word));
+  return value;
+}
+
+void NtupleAnalyzer::FillCompactLeaves()
+{
+  for(size_t i=0; i<compactLeaves.size(); i++){
+    CompactLeaf & leaf = compactLeaves[i];
+    int n = leaf.counter ? *leaf.counter * leaf.length : leaf.length;
+    if( n<=0 ) continue;
+    if( int(leaf.staging.size())<n ) leaf.staging.resize(n);
+    // the copy moves when it grows (or when compactLeaves did while booking)
+    if( leaf.branch->GetAddress()!=(char*) &leaf.staging[0] ) leaf.branch->SetAddress(&leaf.staging[0]);
+    
+    for(int k=0; k<n; k++) leaf.staging[k] = leaf.source[k];
+    if( leaf.truncate )
+      for(int k=0; k<n; k++) leaf.staging[k] = TruncateMantissa(leaf.staging[k], compactMantissaBits);
+  }
+}
+
+
+///------------------------------------------------
+/// branchSelection, shell wildcards, everything is kept by default
+///------------------------------------------------
+bool NtupleAnalyzer::Keep(const std::string & name) const
+{
+  bool keep = true;
+  for(size_t i=0; i<branchRules.size(); i++)
+    if( fnmatch(branchRules[i].second.c_str(), name.c_str(), 0)==0 ) keep = branchRules[i].first;
+  return keep;
+}
+
+
+bool NtupleAnalyzer::Booked(const std::string & pattern) const
+{
+  for(std::set<std::string>::const_iterator it=bookedBranches.begin(); it!=bookedBranches.end(); ++it)
+    if( fnmatch(pattern.c_str(), it->c_str(), 0)==0 ) return true;
+  return false;
+}
+
+
+///------------------------------------------------
+/// Discriminators by cached position, same values as bDiscriminator() and tauID()
+///------------------------------------------------
+float NtupleAnalyzer::BTag(LabelIndex & index, const pat::Jet & jet, int i)
+{
+  const std::vector<std::pair<std::string,float> > & pairs = jet.getPairDiscri();
+  int k = index.Find(pairs, i, validateLabelIndex);
+  return k<0 ? -1000. : pairs[k].second;
+}
+
+
+float NtupleAnalyzer::TauID(const pat::Tau & tau, int i)
+{
+  const std::vector<pat::Tau::IdPair> & pairs = tau.tauIDs();
+  int k = tauIDIndex.Find(pairs, i, validateLabelIndex);
+  // tauID() throws for a missing ID
+  return k<0 ? tau.tauID(tauIDIndex.Label(i)) : pairs[k].second;
+}
+
+
+///------------------------------------------------
+/// Table driven collections: book the kept fields, fill the selected jets
+///------------------------------------------------
+template<class T> void NtupleAnalyzer::Book(Filler<T> & filler)
+{
+  Branch(filler.Counter().c_str(), &filler.N(), filler.Counter() + "/I");
+  for(int f=0; f<filler.Size(); f++)
+    filler.SetActive(f, Branch(filler.Name(f).c_str(), filler.Address(f), filler.LeafList(f))!=0);
+}
+
+
+void NtupleAnalyzer::FillJets(const edm::View<pat::Jet> & jets, LabelIndex & bTagIndex, Filler<JetInput> & filler)
+{
+  jetInputs.clear();
+  for(unsigned int ind=0; ind<jets.size() && ind<MAXJET; ind++){
+    if( jets[ind].pt() < JetPtCutTag ) continue;
+    
+    jetInputs.push_back( JetInput() );
+    JetInput & j = jetInputs.back();
+    j.cor = &jets[ind];
+    j.raw = jets[ind].correctedJet("Uncorrected");
+    j.mc  = isMCTag;
+    j.gen = isMCTag ? j.cor->genJet() : 0;
+    for(int b=0; b<nBTagLabels; b++) j.bTag[b] = BTag(bTagIndex, j.raw, b);
+  }
+  filler.Fill(jetInputs);
+  
+  if(debugMode){
+    const std::string & prefix = filler.Prefix();
+    cout<<"N("<<prefix<<"): "<<filler.N()<<endl;
+    for(int i=0; i<filler.N() && i<2; i++){
+      double e = filler.Value(prefix+"JetE", i);
+      cout<<prefix<<i<<": Pt= "<<filler.Value(prefix+"JetPtCor", i)<<", Eta= "<<filler.Value(prefix+"JetEta", i)
+	  <<", Phi= "<<filler.Value(prefix+"JetPhi", i)<<", PUJetID= "<<filler.Value(prefix+"JetPUFullJetId", i)<<endl;
+      cout<<"      : NHEF= "<<filler.Value(prefix+"JetNeuHadEngFrac", i)<<", CHEF= "<<filler.Value(prefix+"JetChaHadEngFrac", i)
+	  <<", NEMF= "<<filler.Value(prefix+"JetNeuEmEngFrac", i)<<", CEMF= "<<filler.Value(prefix+"JetChaEmEngFrac", i)<<endl;
+      cout<<"      : MuEF= "<<filler.Value(prefix+"JetMuonEng", i)/e<<", ElecEF= "<<filler.Value(prefix+"JetElecEng", i)/e
+	  <<", PhotonEF= "<<filler.Value(prefix+"JetPhotEng", i)/e<<endl;
+    }
+  }
+}
+
+
 void NtupleAnalyzer::beginJob()
 {
   ///-------------------------------------------------------------------------- 
   /// General event information
   ///--------------------------------------------------------------------------
-  mtree->Branch("run"                                                ,&mRun                                               ,"run/I");
-  mtree->Branch("event"                                              ,&mEvent                                             ,"event/L");
-  mtree->Branch("lumi"                                               ,&mLumi                                              ,"lumi/I");	
-  mtree->Branch("bx"                                                 ,&mBX                                                ,"bx/I");
+  Branch("run"                                                ,&mRun                                               ,"run/I");
+  Branch("event"                                              ,&mEvent                                             ,"event/L");
+  Branch("lumi"                                               ,&mLumi                                              ,"lumi/I");	
+  Branch("bx"                                                 ,&mBX                                                ,"bx/I");
   //
-  mtree->Branch("npvm1"                                              ,&mnpvm1                                             ,"npvm1/I");
-  mtree->Branch("npv0"                                               ,&mnpv0                                              ,"npv0/I");
-  mtree->Branch("npvp1"                                              ,&mnpvp1                                             ,"npvp1/I");
-  mtree->Branch("ptHat"                                              ,&WeightTag                                          ,"ptHat/D");	
+  Branch("npvm1"                                              ,&mnpvm1                                             ,"npvm1/I");
+  Branch("npv0"                                               ,&mnpv0                                              ,"npv0/I");
+  Branch("npvp1"                                              ,&mnpvp1                                             ,"npvp1/I");
+  Branch("ptHat"                                              ,&WeightTag                                          ,"ptHat/D");	
   //
-  mtree->Branch("CaloTowerdEx"                                       ,&mCaloTowerdEx                                      ,"CaloTowerdEx/D");	
-  mtree->Branch("CaloTowerdEy"                                       ,&mCaloTowerdEy                                      ,"CaloTowerdEy/D");	
+  Branch("CaloTowerdEx"                                       ,&mCaloTowerdEx                                      ,"CaloTowerdEx/D");	
+  Branch("CaloTowerdEy"                                       ,&mCaloTowerdEy                                      ,"CaloTowerdEy/D");	
   //
-  mtree->Branch("fastJetRho"                                         ,&mfastJetRho                                        ,"fastJetRho/D");
+  Branch("fastJetRho"                                         ,&mfastJetRho                                        ,"fastJetRho/D");
   
     
   ///-------------------------------------------------------------------------- 
-  /// PF AK4 Jets
+  /// PF AK4 and AK8 Jets
   ///-------------------------------------------------------------------------- 
-  mtree->Branch("NPFAK4Jets"                                         ,&mNPFAK4Jets                                        ,"NPFAK4Jets/I");
-  mtree->Branch("PFAK4JetE"                                          ,mPFAK4JetE                                          ,"PFAK4JetE[NPFAK4Jets]/D");
-  mtree->Branch("PFAK4JetPt"                                         ,mPFAK4JetPt                                         ,"PFAK4JetPt[NPFAK4Jets]/D");
-  mtree->Branch("PFAK4JetPx"                                         ,mPFAK4JetPx                                         ,"PFAK4JetPx[NPFAK4Jets]/D");
-  mtree->Branch("PFAK4JetPy"                                         ,mPFAK4JetPy                                         ,"PFAK4JetPy[NPFAK4Jets]/D");
-  mtree->Branch("PFAK4JetPz"                                         ,mPFAK4JetPz                                         ,"PFAK4JetPz[NPFAK4Jets]/D");
-  mtree->Branch("PFAK4JetEta"                                        ,mPFAK4JetEta                                        ,"PFAK4JetEta[NPFAK4Jets]/D");
-  mtree->Branch("PFAK4JetPhi"                                        ,mPFAK4JetPhi                                        ,"PFAK4JetPhi[NPFAK4Jets]/D");
-  //
-  mtree->Branch("PFAK4JetfHPD"                                       ,mPFAK4JetfHPD                                       ,"PFAK4JetfHPD[NPFAK4Jets]/D"); 
-  mtree->Branch("PFAK4JetfRBX"                                       ,mPFAK4JetfRBX                                       ,"PFAK4JetfRBX[NPFAK4Jets]/D"); 
-  mtree->Branch("PFAK4JetN90Hits"                                    ,mPFAK4JetN90Hits                                    ,"PFAK4JetN90Hits[NPFAK4Jets]/D"); 
-  mtree->Branch("PFAK4JetN90"                                        ,mPFAK4JetN90                                        ,"PFAK4JetN90[NPFAK4Jets]/I"); 
-  mtree->Branch("PFAK4JetSigEta"                                     ,mPFAK4JetSigEta                                     ,"PFAK4JetSigEta[NPFAK4Jets]/D"); 
-  mtree->Branch("PFAK4JetSigPhi"                                     ,mPFAK4JetSigPhi                                     ,"PFAK4JetSigPhi[NPFAK4Jets]/D"); 
-  mtree->Branch("PFAK4JetIDEmf"                                      ,mPFAK4JetIDEmf                                      ,"PFAK4JetIDEmf[NPFAK4Jets]/D"); 
-  //
-  mtree->Branch("PFAK4JetECor"                                       ,mPFAK4JetECor                                       ,"PFAK4JetECor[NPFAK4Jets]/D");
-  mtree->Branch("PFAK4JetPtCor"                                      ,mPFAK4JetPtCor                                      ,"PFAK4JetPtCor[NPFAK4Jets]/D");
-  mtree->Branch("PFAK4JetPxCor"                                      ,mPFAK4JetPxCor                                      ,"PFAK4JetPxCor[NPFAK4Jets]/D");
-  mtree->Branch("PFAK4JetPyCor"                                      ,mPFAK4JetPyCor                                      ,"PFAK4JetPyCor[NPFAK4Jets]/D");
-  mtree->Branch("PFAK4JetPzCor"                                      ,mPFAK4JetPzCor                                      ,"PFAK4JetPzCor[NPFAK4Jets]/D");
-  //
-  mtree->Branch("PFAK4JetBtagTkCountHighEff"                         ,mPFAK4JetBtagTkCountHighEff                         ,"PFAK4JetBtagTkCountHighEff[NPFAK4Jets]/D");
-  mtree->Branch("PFAK4JetBtagTkCountHighPur"                         ,mPFAK4JetBtagTkCountHighPur                         ,"PFAK4JetBtagTkCountHighPur[NPFAK4Jets]/D");
-  mtree->Branch("PFAK4JetBtagJetProbability"                         ,mPFAK4JetBtagJetProbability                         ,"PFAK4JetBtagJetProbability[NPFAK4Jets]/D");
-  mtree->Branch("PFAK4JetBtagJetBProbability"                        ,mPFAK4JetBtagJetBProbability                        ,"PFAK4JetBtagJetBProbability[NPFAK4Jets]/D");
-  mtree->Branch("PFAK4JetBTagCSVv2"                           ,mPFAK4JetBTagCSVv2                           ,"PFAK4JetBTagCSVv2[NPFAK4Jets]/D");
-  mtree->Branch("PFAK4JetBTagCombSecVtx"                             ,mPFAK4JetBTagCombSecVtx                             ,"PFAK4JetBTagCombSecVtx[NPFAK4Jets]/D");
-  mtree->Branch("PFAK4JetBTagCombSecVtxMVA"                          ,mPFAK4JetBTagCombSecVtxMVA                          ,"PFAK4JetBTagCombSecVtxMVA[NPFAK4Jets]/D");
-  //
-  mtree->Branch("PFAK4JetFlavour"                                    ,mPFAK4JetFlavour                                    ,"PFAK4JetFlavour[NPFAK4Jets]/I");
-  mtree->Branch("PFAK4JetGenPartonFlavour"                           ,mPFAK4JetGenPartonFlavour                           ,"PFAK4JetGenPartonFlavour[NPFAK4Jets]/I");
-  //
-  mtree->Branch("PFAK4JetNeuEmEngFrac"                               ,mPFAK4JetNeuEmEngFrac                               ,"PFAK4JetNeuEmEngFrac[NPFAK4Jets]/D"); 
-  mtree->Branch("PFAK4JetChaEmEngFrac"                               ,mPFAK4JetChaEmEngFrac                               ,"PFAK4JetChaEmEngFrac[NPFAK4Jets]/D"); 
-  mtree->Branch("PFAK4JetChaHadEngFrac"                              ,mPFAK4JetChaHadEngFrac                              ,"PFAK4JetChaHadEngFrac[NPFAK4Jets]/D"); 
-  mtree->Branch("PFAK4JetNeuHadEngFrac"                              ,mPFAK4JetNeuHadEngFrac                              ,"PFAK4JetNeuHadEngFrac[NPFAK4Jets]/D");
-  // 
-  mtree->Branch("PFAK4JetChaEmEng"                                   ,mPFAK4JetChaEmEng                                   ,"PFAK4JetChaEmEng[NPFAK4Jets]/D"); 
-  mtree->Branch("PFAK4JetNeuEmEng"                                   ,mPFAK4JetNeuEmEng                                   ,"PFAK4JetNeuEmEng[NPFAK4Jets]/D"); 
-  mtree->Branch("PFAK4JetChaHadEng"                                  ,mPFAK4JetChaHadEng                                  ,"PFAK4JetChaHadEng[NPFAK4Jets]/D"); 
-  mtree->Branch("PFAK4JetNeuHadEng"                                  ,mPFAK4JetNeuHadEng                                  ,"PFAK4JetNeuHadEng[NPFAK4Jets]/D");
-  mtree->Branch("PFAK4JetPhotEng"                                    ,mPFAK4JetPhotEng                                    ,"PFAK4JetPhotEng[NPFAK4Jets]/D"); 
-  mtree->Branch("PFAK4JetElecEng"                                    ,mPFAK4JetElecEng                                    ,"PFAK4JetElecEng[NPFAK4Jets]/D");
-  mtree->Branch("PFAK4JetMuonEng"                                    ,mPFAK4JetMuonEng                                    ,"PFAK4JetMuonEng[NPFAK4Jets]/D"); 
-  mtree->Branch("PFAK4JetHFHadEng"                                   ,mPFAK4JetHFHadEng                                   ,"PFAK4JetHFHadEng[NPFAK4Jets]/D"); 
-  mtree->Branch("PFAK4JetHFEmEng"                                    ,mPFAK4JetHFEmEng                                    ,"PFAK4JetHFEmEng[NPFAK4Jets]/D"); 
-  mtree->Branch("PFAK4JetChaMuEng"                                   ,mPFAK4JetChaMuEng                                   ,"PFAK4JetChaMuEng[NPFAK4Jets]/D"); 
-  //
-  mtree->Branch("PFAK4JetNumOfChaMu"                                 ,mPFAK4JetNumOfChaMu                                 ,"PFAK4JetNumOfChaMu[NPFAK4Jets]/I"); 
-  mtree->Branch("PFAK4JetNumOfMuon"                                  ,mPFAK4JetNumOfMuon                                  ,"PFAK4JetNumOfMuon[NPFAK4Jets]/I"); 
-  mtree->Branch("PFAK4JetNumOfPhot"                                  ,mPFAK4JetNumOfPhot                                  ,"PFAK4JetNumOfPhot[NPFAK4Jets]/I"); 
-  mtree->Branch("PFAK4JetNumOfElec"                                  ,mPFAK4JetNumOfElec                                  ,"PFAK4JetNumOfElec[NPFAK4Jets]/I"); 
-  mtree->Branch("PFAK4JetNumOfNeu"                                   ,mPFAK4JetNumOfNeu                                   ,"PFAK4JetNumOfNeu[NPFAK4Jets]/I"); 
-  mtree->Branch("PFAK4JetNumOfCha"                                   ,mPFAK4JetNumOfCha                                   ,"PFAK4JetNumOfCha[NPFAK4Jets]/I"); 
-  mtree->Branch("PFAK4JetNumOfNeuHad"                                ,mPFAK4JetNumOfNeuHad                                ,"PFAK4JetNumOfNeuHad[NPFAK4Jets]/I"); 
-  mtree->Branch("PFAK4JetNumOfChaHad"                                ,mPFAK4JetNumOfChaHad                                ,"PFAK4JetNumOfChaHad[NPFAK4Jets]/I"); 
-  mtree->Branch("PFAK4JetNumOfHFHad"                                 ,mPFAK4JetNumOfHFHad                                 ,"PFAK4JetNumOfHFHad[NPFAK4Jets]/I"); 
-  mtree->Branch("PFAK4JetNumOfHFEM"                                  ,mPFAK4JetNumOfHFEM                                  ,"PFAK4JetNumOfHFEM[NPFAK4Jets]/I"); 
-  //
-  mtree->Branch("PFAK4JetNumOfDaughters"                             ,mPFAK4JetNumOfDaughters                             ,"PFAK4JetNumOfDaughters[NPFAK4Jets]/I");
-  mtree->Branch("PFAK4JetIDLOOSE"                                    ,mPFAK4JetIDLOOSE                                    ,"PFAK4JetIDLOOSE[NPFAK4Jets]/I");
-  mtree->Branch("PFAK4JetIDTIGHT"                                    ,mPFAK4JetIDTIGHT                                    ,"PFAK4JetIDTIGHT[NPFAK4Jets]/I");
-  mtree->Branch("PFAK4JetPUFullJetId"                                ,mPFAK4JetPUFullJetId                                ,"PFAK4JetPUFullJetId[NPFAK4Jets]/D");
-  mtree->Branch("PFAK4uncer"                                         ,mPFAK4uncer                                         ,"PFAK4uncer[NPFAK4Jets]/D");
-  /// Gen PFAK4 Jets
-  mtree->Branch("GenPFAK4JetE"                                       ,mGenPFAK4JetE                                       ,"GenPFAK4JetE[NPFAK4Jets]/D");
-  mtree->Branch("GenPFAK4JetPt"                                      ,mGenPFAK4JetPt                                      ,"GenPFAK4JetPt[NPFAK4Jets]/D");
-  mtree->Branch("GenPFAK4JetPx"                                      ,mGenPFAK4JetPx                                      ,"GenPFAK4JetPx[NPFAK4Jets]/D");
-  mtree->Branch("GenPFAK4JetPy"                                      ,mGenPFAK4JetPy                                      ,"GenPFAK4JetPy[NPFAK4Jets]/D");
-  mtree->Branch("GenPFAK4JetPz"                                      ,mGenPFAK4JetPz                                      ,"GenPFAK4JetPz[NPFAK4Jets]/D");
-  mtree->Branch("GenPFAK4JetEta"                                     ,mGenPFAK4JetEta                                     ,"GenPFAK4JetEta[NPFAK4Jets]/D");
-  mtree->Branch("GenPFAK4JetPhi"                                     ,mGenPFAK4JetPhi                                     ,"GenPFAK4JetPhi[NPFAK4Jets]/D");
-  mtree->Branch("GenPFAK4JetEmEnergy"                                ,mGenPFAK4JetEmEnergy                                ,"GenPFAK4JetEmEnergy[NPFAK4Jets]/D");
-  mtree->Branch("GenPFAK4JetHadEnergy"                               ,mGenPFAK4JetHadEnergy                               ,"GenPFAK4JetHadEnergy[NPFAK4Jets]/D");
-  //
-  mtree->Branch("PFAK4JERCentral"                                    ,mPFAK4JERCentral                                    ,"PFAK4JERCentral[NPFAK4Jets]/D");
-  mtree->Branch("PFAK4JERUp"                                         ,mPFAK4JERUp                                         ,"PFAK4JERUp[NPFAK4Jets]/D");
-  mtree->Branch("PFAK4JERDown"                                       ,mPFAK4JERDown                                       ,"PFAK4JERDown[NPFAK4Jets]/D");
-
-
-  ///-------------------------------------------------------------------------- 
-  /// PF AK8 Jets
-  ///-------------------------------------------------------------------------- 
-  mtree->Branch("NPFAK8Jets"                                         ,&mNPFAK8Jets                                        ,"NPFAK8Jets/I");
-  mtree->Branch("PFAK8JetE"                                          ,mPFAK8JetE                                          ,"PFAK8JetE[NPFAK8Jets]/D");
-  mtree->Branch("PFAK8JetPt"                                         ,mPFAK8JetPt                                         ,"PFAK8JetPt[NPFAK8Jets]/D");
-  mtree->Branch("PFAK8JetPx"                                         ,mPFAK8JetPx                                         ,"PFAK8JetPx[NPFAK8Jets]/D");
-  mtree->Branch("PFAK8JetPy"                                         ,mPFAK8JetPy                                         ,"PFAK8JetPy[NPFAK8Jets]/D");
-  mtree->Branch("PFAK8JetPz"                                         ,mPFAK8JetPz                                         ,"PFAK8JetPz[NPFAK8Jets]/D");
-  mtree->Branch("PFAK8JetEta"                                        ,mPFAK8JetEta                                        ,"PFAK8JetEta[NPFAK8Jets]/D");
-  mtree->Branch("PFAK8JetPhi"                                        ,mPFAK8JetPhi                                        ,"PFAK8JetPhi[NPFAK8Jets]/D");
-  //
-  mtree->Branch("PFAK8JetfHPD"                                       ,mPFAK8JetfHPD                                       ,"PFAK8JetfHPD[NPFAK8Jets]/D"); 
-  mtree->Branch("PFAK8JetfRBX"                                       ,mPFAK8JetfRBX                                       ,"PFAK8JetfRBX[NPFAK8Jets]/D"); 
-  mtree->Branch("PFAK8JetN90Hits"                                    ,mPFAK8JetN90Hits                                    ,"PFAK8JetN90Hits[NPFAK8Jets]/D"); 
-  mtree->Branch("PFAK8JetN90"                                        ,mPFAK8JetN90                                        ,"PFAK8JetN90[NPFAK8Jets]/I"); 
-  mtree->Branch("PFAK8JetSigEta"                                     ,mPFAK8JetSigEta                                     ,"PFAK8JetSigEta[NPFAK8Jets]/D"); 
-  mtree->Branch("PFAK8JetSigPhi"                                     ,mPFAK8JetSigPhi                                     ,"PFAK8JetSigPhi[NPFAK8Jets]/D"); 
-  mtree->Branch("PFAK8JetIDEmf"                                      ,mPFAK8JetIDEmf                                      ,"PFAK8JetIDEmf[NPFAK8Jets]/D"); 
-  //
-  mtree->Branch("PFAK8JetECor"                                       ,mPFAK8JetECor                                       ,"PFAK8JetECor[NPFAK8Jets]/D");
-  mtree->Branch("PFAK8JetPtCor"                                      ,mPFAK8JetPtCor                                      ,"PFAK8JetPtCor[NPFAK8Jets]/D");
-  mtree->Branch("PFAK8JetPxCor"                                      ,mPFAK8JetPxCor                                      ,"PFAK8JetPxCor[NPFAK8Jets]/D");
-  mtree->Branch("PFAK8JetPyCor"                                      ,mPFAK8JetPyCor                                      ,"PFAK8JetPyCor[NPFAK8Jets]/D");
-  mtree->Branch("PFAK8JetPzCor"                                      ,mPFAK8JetPzCor                                      ,"PFAK8JetPzCor[NPFAK8Jets]/D");
-  //
-  mtree->Branch("PFAK8JetBtagTkCountHighEff"                         ,mPFAK8JetBtagTkCountHighEff                         ,"PFAK8JetBtagTkCountHighEff[NPFAK8Jets]/D");
-  mtree->Branch("PFAK8JetBtagTkCountHighPur"                         ,mPFAK8JetBtagTkCountHighPur                         ,"PFAK8JetBtagTkCountHighPur[NPFAK8Jets]/D");
-  mtree->Branch("PFAK8JetBtagJetProbability"                         ,mPFAK8JetBtagJetProbability                         ,"PFAK8JetBtagJetProbability[NPFAK8Jets]/D");
-  mtree->Branch("PFAK8JetBtagJetBProbability"                        ,mPFAK8JetBtagJetBProbability                        ,"PFAK8JetBtagJetBProbability[NPFAK8Jets]/D");
-  mtree->Branch("PFAK8JetBTagCSVv2"                           ,mPFAK8JetBTagCSVv2                           ,"PFAK8JetBTagCSVv2[NPFAK8Jets]/D");
-  mtree->Branch("PFAK8JetBTagCombSecVtx"                             ,mPFAK8JetBTagCombSecVtx                             ,"PFAK8JetBTagCombSecVtx[NPFAK8Jets]/D");
-  mtree->Branch("PFAK8JetBTagCombSecVtxMVA"                          ,mPFAK8JetBTagCombSecVtxMVA                          ,"PFAK8JetBTagCombSecVtxMVA[NPFAK8Jets]/D");
-  //
-  mtree->Branch("PFAK8JetFlavour"                                    ,mPFAK8JetFlavour                                    ,"PFAK8JetFlavour[NPFAK8Jets]/I");
-  mtree->Branch("PFAK8JetGenPartonFlavour"                           ,mPFAK8JetGenPartonFlavour                           ,"PFAK8JetGenPartonFlavour[NPFAK8Jets]/I");
-  //
-  mtree->Branch("PFAK8JetNeuEmEngFrac"                               ,mPFAK8JetNeuEmEngFrac                               ,"PFAK8JetNeuEmEngFrac[NPFAK8Jets]/D"); 
-  mtree->Branch("PFAK8JetChaEmEngFrac"                               ,mPFAK8JetChaEmEngFrac                               ,"PFAK8JetChaEmEngFrac[NPFAK8Jets]/D"); 
-  mtree->Branch("PFAK8JetChaHadEngFrac"                              ,mPFAK8JetChaHadEngFrac                              ,"PFAK8JetChaHadEngFrac[NPFAK8Jets]/D"); 
-  mtree->Branch("PFAK8JetNeuHadEngFrac"                              ,mPFAK8JetNeuHadEngFrac                              ,"PFAK8JetNeuHadEngFrac[NPFAK8Jets]/D");
-  // 
-  mtree->Branch("PFAK8JetChaEmEng"                                   ,mPFAK8JetChaEmEng                                   ,"PFAK8JetChaEmEng[NPFAK8Jets]/D"); 
-  mtree->Branch("PFAK8JetNeuEmEng"                                   ,mPFAK8JetNeuEmEng                                   ,"PFAK8JetNeuEmEng[NPFAK8Jets]/D"); 
-  mtree->Branch("PFAK8JetChaHadEng"                                  ,mPFAK8JetChaHadEng                                  ,"PFAK8JetChaHadEng[NPFAK8Jets]/D"); 
-  mtree->Branch("PFAK8JetNeuHadEng"                                  ,mPFAK8JetNeuHadEng                                  ,"PFAK8JetNeuHadEng[NPFAK8Jets]/D");
-  mtree->Branch("PFAK8JetPhotEng"                                    ,mPFAK8JetPhotEng                                    ,"PFAK8JetPhotEng[NPFAK8Jets]/D"); 
-  mtree->Branch("PFAK8JetElecEng"                                    ,mPFAK8JetElecEng                                    ,"PFAK8JetElecEng[NPFAK8Jets]/D");
-  mtree->Branch("PFAK8JetMuonEng"                                    ,mPFAK8JetMuonEng                                    ,"PFAK8JetMuonEng[NPFAK8Jets]/D"); 
-  mtree->Branch("PFAK8JetHFHadEng"                                   ,mPFAK8JetHFHadEng                                   ,"PFAK8JetHFHadEng[NPFAK8Jets]/D"); 
-  mtree->Branch("PFAK8JetHFEmEng"                                    ,mPFAK8JetHFEmEng                                    ,"PFAK8JetHFEmEng[NPFAK8Jets]/D"); 
-  mtree->Branch("PFAK8JetChaMuEng"                                   ,mPFAK8JetChaMuEng                                   ,"PFAK8JetChaMuEng[NPFAK8Jets]/D"); 
-  //
-  mtree->Branch("PFAK8JetNumOfChaMu"                                 ,mPFAK8JetNumOfChaMu                                 ,"PFAK8JetNumOfChaMu[NPFAK8Jets]/I"); 
-  mtree->Branch("PFAK8JetNumOfMuon"                                  ,mPFAK8JetNumOfMuon                                  ,"PFAK8JetNumOfMuon[NPFAK8Jets]/I"); 
-  mtree->Branch("PFAK8JetNumOfPhot"                                  ,mPFAK8JetNumOfPhot                                  ,"PFAK8JetNumOfPhot[NPFAK8Jets]/I"); 
-  mtree->Branch("PFAK8JetNumOfElec"                                  ,mPFAK8JetNumOfElec                                  ,"PFAK8JetNumOfElec[NPFAK8Jets]/I"); 
-  mtree->Branch("PFAK8JetNumOfNeu"                                   ,mPFAK8JetNumOfNeu                                   ,"PFAK8JetNumOfNeu[NPFAK8Jets]/I"); 
-  mtree->Branch("PFAK8JetNumOfCha"                                   ,mPFAK8JetNumOfCha                                   ,"PFAK8JetNumOfCha[NPFAK8Jets]/I"); 
-  mtree->Branch("PFAK8JetNumOfNeuHad"                                ,mPFAK8JetNumOfNeuHad                                ,"PFAK8JetNumOfNeuHad[NPFAK8Jets]/I"); 
-  mtree->Branch("PFAK8JetNumOfChaHad"                                ,mPFAK8JetNumOfChaHad                                ,"PFAK8JetNumOfChaHad[NPFAK8Jets]/I"); 
-  mtree->Branch("PFAK8JetNumOfHFHad"                                 ,mPFAK8JetNumOfHFHad                                 ,"PFAK8JetNumOfHFHad[NPFAK8Jets]/I"); 
-  mtree->Branch("PFAK8JetNumOfHFEM"                                  ,mPFAK8JetNumOfHFEM                                  ,"PFAK8JetNumOfHFEM[NPFAK8Jets]/I"); 
-  //
-  mtree->Branch("PFAK8JetNumOfDaughters"                             ,mPFAK8JetNumOfDaughters                             ,"PFAK8JetNumOfDaughters[NPFAK8Jets]/I");
-  mtree->Branch("PFAK8JetIDLOOSE"                                    ,mPFAK8JetIDLOOSE                                    ,"PFAK8JetIDLOOSE[NPFAK8Jets]/I");
-  mtree->Branch("PFAK8JetIDTIGHT"                                    ,mPFAK8JetIDTIGHT                                    ,"PFAK8JetIDTIGHT[NPFAK8Jets]/I");
-  mtree->Branch("PFAK8JetPUFullJetId"                                ,mPFAK8JetPUFullJetId                                ,"PFAK8JetPUFullJetId[NPFAK8Jets]/D");
-  mtree->Branch("PFAK8uncer"                                         ,mPFAK8uncer                                         ,"PFAK8uncer[NPFAK8Jets]/D");
-  /// Gen PFAK8 Jets
-  mtree->Branch("GenPFAK8JetE"                                       ,mGenPFAK8JetE                                       ,"GenPFAK8JetE[NPFAK8Jets]/D");
-  mtree->Branch("GenPFAK8JetPt"                                      ,mGenPFAK8JetPt                                      ,"GenPFAK8JetPt[NPFAK8Jets]/D");
-  mtree->Branch("GenPFAK8JetPx"                                      ,mGenPFAK8JetPx                                      ,"GenPFAK8JetPx[NPFAK8Jets]/D");
-  mtree->Branch("GenPFAK8JetPy"                                      ,mGenPFAK8JetPy                                      ,"GenPFAK8JetPy[NPFAK8Jets]/D");
-  mtree->Branch("GenPFAK8JetPz"                                      ,mGenPFAK8JetPz                                      ,"GenPFAK8JetPz[NPFAK8Jets]/D");
-  mtree->Branch("GenPFAK8JetEta"                                     ,mGenPFAK8JetEta                                     ,"GenPFAK8JetEta[NPFAK8Jets]/D");
-  mtree->Branch("GenPFAK8JetPhi"                                     ,mGenPFAK8JetPhi                                     ,"GenPFAK8JetPhi[NPFAK8Jets]/D");
-  mtree->Branch("GenPFAK8JetEmEnergy"                                ,mGenPFAK8JetEmEnergy                                ,"GenPFAK8JetEmEnergy[NPFAK8Jets]/D");
-  mtree->Branch("GenPFAK8JetHadEnergy"                               ,mGenPFAK8JetHadEnergy                               ,"GenPFAK8JetHadEnergy[NPFAK8Jets]/D");
-  //
-  mtree->Branch("PFAK8JERCentral"                                    ,mPFAK8JERCentral                                    ,"PFAK8JERCentral[NPFAK8Jets]/D");
-  mtree->Branch("PFAK8JERUp"                                         ,mPFAK8JERUp                                         ,"PFAK8JERUp[NPFAK8Jets]/D");
-  mtree->Branch("PFAK8JERDown"                                       ,mPFAK8JERDown                                       ,"PFAK8JERDown[NPFAK8Jets]/D");
+  Book(jetFillerAK4);
+  Book(jetFillerAK8);
 
   ///-------------------------------------------------------------------------- 
   /// MET
   ///-------------------------------------------------------------------------- 
-  mtree->Branch("NMet"                                               ,&mNMet                                              ,"NMet/I");
-  mtree->Branch("MetPt"                                              ,mMetPt                                              ,"MetPt[NMet]/D");
-  mtree->Branch("MetPx"                                              ,mMetPx                                              ,"MetPx[NMet]/D");
-  mtree->Branch("MetPy"                                              ,mMetPy                                              ,"MetPy[NMet]/D");
-  mtree->Branch("MetPhi"                                             ,mMetPhi                                             ,"MetPhi[NMet]/D");
-  mtree->Branch("MetSumEt"                                           ,mMetSumEt                                           ,"MetSumEt[NMet]/D");
-  mtree->Branch("MetSign"                                            ,mMetSign                                            ,"MetSign[NMet]/D");
+  Branch("NMet"                                               ,&mNMet                                              ,"NMet/I");
+  Branch("MetPt"                                              ,mMetPt                                              ,"MetPt[NMet]/D");
+  Branch("MetPx"                                              ,mMetPx                                              ,"MetPx[NMet]/D");
+  Branch("MetPy"                                              ,mMetPy                                              ,"MetPy[NMet]/D");
+  Branch("MetPhi"                                             ,mMetPhi                                             ,"MetPhi[NMet]/D");
+  Branch("MetSumEt"                                           ,mMetSumEt                                           ,"MetSumEt[NMet]/D");
+  Branch("MetSign"                                            ,mMetSign                                            ,"MetSign[NMet]/D");
   
   ///-------------------------------------------------------------------------- 
   /// MHT
   ///--------------------------------------------------------------------------  
-  mtree->Branch("MHTPt"                                              ,&mMHTPt                                             ,"MHTPt/D");
-  mtree->Branch("MHTPhi"                                             ,&mMHTPhi                                            ,"MHTPhi/D");
-  mtree->Branch("MHTSign"                                            ,&mMHTSign                                           ,"MHTSign/D");
+  Branch("MHTPt"                                              ,&mMHTPt                                             ,"MHTPt/D");
+  Branch("MHTPhi"                                             ,&mMHTPhi                                            ,"MHTPhi/D");
+  Branch("MHTSign"                                            ,&mMHTSign                                           ,"MHTSign/D");
   
   ///-------------------------------------------------------------------------- 
   /// PF Muons
   ///-------------------------------------------------------------------------- 
-  mtree->Branch("NPFMuon"                                            ,&mNPFMuon                                           ,"NPFMuon/I");
-  mtree->Branch("PFMuonPt"                                           ,mPFMuonPt                                           ,"PFMuonPt[NPFMuon]/D");               
-  mtree->Branch("PFMuonEt"                                           ,mPFMuonEt                                           ,"PFMuonEt[NPFMuon]/D");             
-  mtree->Branch("PFMuonE"                                            ,mPFMuonE                                            ,"PFMuonE[NPFMuon]/D");                
-  mtree->Branch("PFMuonPx"                                           ,mPFMuonPx                                           ,"PFMuonPx[NPFMuon]/D");               
-  mtree->Branch("PFMuonPy"                                           ,mPFMuonPy                                           ,"PFMuonPy[NPFMuon]/D");               
-  mtree->Branch("PFMuonPz"                                           ,mPFMuonPz                                           ,"PFMuonPz[NPFMuon]/D");               
-  mtree->Branch("PFMuonEta"                                          ,mPFMuonEta                                          ,"PFMuonEta[NPFMuon]/D");              
-  mtree->Branch("PFMuonPhi"                                          ,mPFMuonPhi                                          ,"PFMuonPhi[NPFMuon]/D");              
-  mtree->Branch("PFMuonCharge"                                       ,mPFMuonCharge                                       ,"PFMuonCharge[NPFMuon]/I");           
-  //
-  mtree->Branch("PFMuonIsGlobal"                                     ,mPFMuonIsGlobal                                     ,"PFMuonIsGlobal[NPFMuon]/I");         
-  mtree->Branch("PFMuonIsStandAlone"                                 ,mPFMuonIsStandAlone                                 ,"PFMuonIsStandAlone[NPFMuon]/I");     
-  mtree->Branch("PFMuonIsTracker"                                    ,mPFMuonIsTracker                                    ,"PFMuonIsTracker[NPFMuon]/I");     
-  mtree->Branch("PFMuonIsPF"                                         ,mPFMuonIsPF                                         ,"PFMuonIsPF[NPFMuon]/I");
-  //
-  mtree->Branch("PFMuonIsTight"                                      ,mPFMuonIsTight                                      ,"PFMuonIsTight[NPFMuon]/I");     
-  mtree->Branch("PFMuonIsLoose"                                      ,mPFMuonIsLoose                                      ,"PFMuonIsLoose[NPFMuon]/I");
-  //
-  mtree->Branch("PFMuonChargedHadronIso"                             ,mPFMuonChargedHadronIso                             ,"PFMuonChargedHadronIso[NPFMuon]/D"); 
-  mtree->Branch("PFMuonPhotonIso"                                    ,mPFMuonPhotonIso                                    ,"PFMuonPhotonIso[NPFMuon]/D");        
-  mtree->Branch("PFMuonNeutralHadronIso"                             ,mPFMuonNeutralHadronIso                             ,"PFMuonNeutralHadronIso[NPFMuon]/D"); 
-  mtree->Branch("PFMuonisGMPT"                                       ,mPFMuonisGMPT                                       ,"PFMuonisGMPT[NPFMuon]/I");
-  mtree->Branch("PFMuonR04ChargedHadronPt"                           ,mPFMuonR04ChargedHadronPt                           ,"PFMuonR04ChargedHadronPt[NPFMuon]/D");
-  mtree->Branch("PFMuonR04NeutralHadronEt"                           ,mPFMuonR04NeutralHadronEt                           ,"PFMuonR04NeutralHadronEt[NPFMuon]/D");
-  mtree->Branch("PFMuonR04PhotonEt"                                  ,mPFMuonR04PhotonEt                                  ,"PFMuonR04PhotonEt[NPFMuon]/D");
-  mtree->Branch("PFMuonR04PUPt"                                      ,mPFMuonR04PUPt                                      ,"PFMuonR04PUPt[NPFMuon]/D"); 
+  Branch("NPFMuon"                                            ,&mNPFMuon                                           ,"NPFMuon/I");
+  Branch("PFMuonPt"                                           ,mPFMuonPt                                           ,"PFMuonPt[NPFMuon]/D");               
+  Branch("PFMuonEt"                                           ,mPFMuonEt                                           ,"PFMuonEt[NPFMuon]/D");             
+  Branch("PFMuonE"                                            ,mPFMuonE                                            ,"PFMuonE[NPFMuon]/D");                
+  Branch("PFMuonPx"                                           ,mPFMuonPx                                           ,"PFMuonPx[NPFMuon]/D");               
+  Branch("PFMuonPy"                                           ,mPFMuonPy                                           ,"PFMuonPy[NPFMuon]/D");               
+  Branch("PFMuonPz"                                           ,mPFMuonPz                                           ,"PFMuonPz[NPFMuon]/D");               
+  Branch("PFMuonEta"                                          ,mPFMuonEta                                          ,"PFMuonEta[NPFMuon]/D");              
+  Branch("PFMuonPhi"                                          ,mPFMuonPhi                                          ,"PFMuonPhi[NPFMuon]/D");              
+  Branch("PFMuonCharge"                                       ,mPFMuonCharge                                       ,"PFMuonCharge[NPFMuon]/I");           
+  //
+  Branch("PFMuonIsGlobal"                                     ,mPFMuonIsGlobal                                     ,"PFMuonIsGlobal[NPFMuon]/I");         
+  Branch("PFMuonIsStandAlone"                                 ,mPFMuonIsStandAlone                                 ,"PFMuonIsStandAlone[NPFMuon]/I");     
+  Branch("PFMuonIsTracker"                                    ,mPFMuonIsTracker                                    ,"PFMuonIsTracker[NPFMuon]/I");     
+  Branch("PFMuonIsPF"                                         ,mPFMuonIsPF                                         ,"PFMuonIsPF[NPFMuon]/I");
+  //
+  Branch("PFMuonIsTight"                                      ,mPFMuonIsTight                                      ,"PFMuonIsTight[NPFMuon]/I");     
+  Branch("PFMuonIsLoose"                                      ,mPFMuonIsLoose                                      ,"PFMuonIsLoose[NPFMuon]/I");
+  //
+  Branch("PFMuonChargedHadronIso"                             ,mPFMuonChargedHadronIso                             ,"PFMuonChargedHadronIso[NPFMuon]/D"); 
+  Branch("PFMuonPhotonIso"                                    ,mPFMuonPhotonIso                                    ,"PFMuonPhotonIso[NPFMuon]/D");        
+  Branch("PFMuonNeutralHadronIso"                             ,mPFMuonNeutralHadronIso                             ,"PFMuonNeutralHadronIso[NPFMuon]/D"); 
+  Branch("PFMuonisGMPT"                                       ,mPFMuonisGMPT                                       ,"PFMuonisGMPT[NPFMuon]/I");
+  Branch("PFMuonR04ChargedHadronPt"                           ,mPFMuonR04ChargedHadronPt                           ,"PFMuonR04ChargedHadronPt[NPFMuon]/D");
+  Branch("PFMuonR04NeutralHadronEt"                           ,mPFMuonR04NeutralHadronEt                           ,"PFMuonR04NeutralHadronEt[NPFMuon]/D");
+  Branch("PFMuonR04PhotonEt"                                  ,mPFMuonR04PhotonEt                                  ,"PFMuonR04PhotonEt[NPFMuon]/D");
+  Branch("PFMuonR04PUPt"                                      ,mPFMuonR04PUPt                                      ,"PFMuonR04PUPt[NPFMuon]/D"); 
   // 
-  mtree->Branch("PFMuonNumOfMatches"                                 ,mPFMuonNumOfMatches                                 ,"PFMuonNumOfMatches[NPFMuon]/I");  
-  mtree->Branch("PFMuonNumOfMatchesStation"                          ,mPFMuonNumOfMatchesStation                          ,"PFMuonNumOfMatchesStation[NPFMuon]/I"); 
-  //
-  mtree->Branch("PFMuonGlobChi2Norm"                                 ,mPFMuonGlobChi2Norm                                 ,"PFMuonGlobChi2Norm[NPFMuon]/D");  
-  mtree->Branch("PFMuonGlobNumOfValidMuonHits"                       ,mPFMuonGlobNumOfValidMuonHits                       ,"PFMuonGlobNumOfValidMuonHits[NPFMuon]/I"); 
-  //
-  mtree->Branch("PFMuonBestTrkdxy"                                   ,mPFMuonBestTrkdxy                                   ,"PFMuonBestTrkdxy[NPFMuon]/D");  
-  mtree->Branch("PFMuonBestTrkdz"                                    ,mPFMuonBestTrkdz                                    ,"PFMuonBestTrkdz[NPFMuon]/D");
-  //
-  mtree->Branch("PFMuoninnertrackPt"                                 ,mPFMuoninnertrackPt                                 ,"PFMuoninnertrackPt[NPFMuon]/D");     
-  mtree->Branch("PFMuonnValidHits"                                   ,mPFMuonnValidHits                                   ,"PFMuonnValidHits[NPFMuon]/I");       
-  mtree->Branch("PFMuonnValidPixelHits"                              ,mPFMuonnValidPixelHits                              ,"PFMuonnValidPixelHits[NPFMuon]/I");  
-  mtree->Branch("PFMuondxy"                                          ,mPFMuondxy                                          ,"PFMuondxy[NPFMuon]/D");              
-  mtree->Branch("PFMuondz"                                           ,mPFMuondz                                           ,"PFMuondz[NPFMuon]/D");               
-  //
-  mtree->Branch("PFMuonCombChi2Norm"                                 ,mPFMuonCombChi2Norm                                 ,"PFMuonCombChi2Norm[NPFMuon]/D");    
-  mtree->Branch("PFMuonCombValidHits"                                ,mPFMuonCombValidHits                                ,"PFMuonCombValidHits[NPFMuon]/I");   
-  mtree->Branch("PFMuonCombLostHits"                                 ,mPFMuonCombLostHits                                 ,"PFMuonCombLostHits[NPFMuon]/I");    
-  mtree->Branch("PFMuonCombPt"                                       ,mPFMuonCombPt                                       ,"PFMuonCombPt[NPFMuon]/D");          
-  mtree->Branch("PFMuonCombPz"                                       ,mPFMuonCombPz                                       ,"PFMuonCombPz[NPFMuon]/D");          
-  mtree->Branch("PFMuonCombP"                                        ,mPFMuonCombP                                        ,"PFMuonCombP[NPFMuon]/D");           
-  mtree->Branch("PFMuonCombEta"                                      ,mPFMuonCombEta                                      ,"PFMuonCombEta[NPFMuon]/D");         
-  mtree->Branch("PFMuonCombPhi"                                      ,mPFMuonCombPhi                                      ,"PFMuonCombPhi[NPFMuon]/D");         
-  mtree->Branch("PFMuonCombChi2"                                     ,mPFMuonCombChi2                                     ,"PFMuonCombChi2[NPFMuon]/D");        
-  mtree->Branch("PFMuonCombCharge"                                   ,mPFMuonCombCharge                                   ,"PFMuonCombCharge[NPFMuon]/D");      
-  mtree->Branch("PFMuonCombQOverPError"                              ,mPFMuonCombQOverPError                              ,"PFMuonCombQOverPError[NPFMuon]/D"); 
-  mtree->Branch("PFMuonCombNdof"                                     ,mPFMuonCombNdof                                     ,"PFMuonCombNdof[NPFMuon]/D");        
-  mtree->Branch("PFMuonCombVx"                                       ,mPFMuonCombVx                                       ,"PFMuonCombVx[NPFMuon]/D");          
-  mtree->Branch("PFMuonCombVy"                                       ,mPFMuonCombVy                                       ,"PFMuonCombVy[NPFMuon]/D");          
-  mtree->Branch("PFMuonCombVz"                                       ,mPFMuonCombVz                                       ,"PFMuonCombVz[NPFMuon]/D");          
-  mtree->Branch("PFMuonCombD0"                                       ,mPFMuonCombD0                                       ,"PFMuonCombD0[NPFMuon]/D");          
-  mtree->Branch("PFMuonCombDz"                                       ,mPFMuonCombDz                                       ,"PFMuonCombDz[NPFMuon]/D");          
-  //
-  mtree->Branch("PFMuonStandChi2Norm"                                ,mPFMuonStandChi2Norm                                ,"PFMuonStandChi2Norm[NPFMuon]/D");   
-  mtree->Branch("PFMuonStandValidHits"                               ,mPFMuonStandValidHits                               ,"PFMuonStandValidHits[NPFMuon]/I");  
-  mtree->Branch("PFMuonStandLostHits"                                ,mPFMuonStandLostHits                                ,"PFMuonStandLostHits[NPFMuon]/I");   
-  mtree->Branch("PFMuonStandPt"                                      ,mPFMuonStandPt                                      ,"PFMuonStandPt[NPFMuon]/D");         
-  mtree->Branch("PFMuonStandPz"                                      ,mPFMuonStandPz                                      ,"PFMuonStandPz[NPFMuon]/D");         
-  mtree->Branch("PFMuonStandP"                                       ,mPFMuonStandP                                       ,"PFMuonStandP[NPFMuon]/D");         
-  mtree->Branch("PFMuonStandEta"                                     ,mPFMuonStandEta                                     ,"PFMuonStandEta[NPFMuon]/D");        
-  mtree->Branch("PFMuonStandPhi"                                     ,mPFMuonStandPhi                                     ,"PFMuonStandPhi[NPFMuon]/D");        
-  mtree->Branch("PFMuonStandChi2"                                    ,mPFMuonStandChi2                                    ,"PFMuonStandChi2[NPFMuon]/D");
-  mtree->Branch("PFMuonStandCharge"                                  ,mPFMuonStandCharge                                  ,"PFMuonStandCharge[NPFMuon]/D");
-  mtree->Branch("PFMuonStandQOverPError"                             ,mPFMuonStandQOverPError                             ,"PFMuonStandQOverPError[NPFMuon]/D" );
-  //
-  mtree->Branch("PFMuonTrkChi2Norm"                                  ,mPFMuonTrkChi2Norm                                  ,"PFMuonTrkChi2Norm[NPFMuon]/D"); 
-  mtree->Branch("PFMuonTrkValidHits"                                 ,mPFMuonTrkValidHits                                 ,"PFMuonTrkValidHits[NPFMuon]/I");   
-  mtree->Branch("PFMuonTrkLostHits"                                  ,mPFMuonTrkLostHits                                  ,"PFMuonTrkLostHits[NPFMuon]/I");
-  mtree->Branch("PFMuonTrkPt"                                        ,mPFMuonTrkPt                                        ,"PFMuonTrkPt[NPFMuon]/D");     
-  mtree->Branch("PFMuonTrkPz"                                        ,mPFMuonTrkPz                                        ,"PFMuonTrkPz[NPFMuon]/D");
-  mtree->Branch("PFMuonTrkP"                                         ,mPFMuonTrkP                                         ,"PFMuonTrkP[NPFMuon]/D");           
-  mtree->Branch("PFMuonTrkEta"                                       ,mPFMuonTrkEta                                       ,"PFMuonTrkEt[NPFMuon]/D");         
-  mtree->Branch("PFMuonTrkPhi"                                       ,mPFMuonTrkPhi                                       ,"PFMuonTrkPhi[NPFMuon]/D");         
-  mtree->Branch("PFMuonTrkChi2"                                      ,mPFMuonTrkChi2                                      ,"PFMuonTrkChi2[NPFMuon]/D");        
-  mtree->Branch("PFMuonTrkCharge"                                    ,mPFMuonTrkCharge                                    ,"PFMuonTrkCharge[NPFMuon]/D");      
-  mtree->Branch("PFMuonTrkQOverPError"                               ,mPFMuonTrkQOverPError                               ,"PFMuonTrkQOverPError[NPFMuon]/D"); 
-  mtree->Branch("PFMuonTrkDxy"                                       ,mPFMuonTrkDxy                                       ,"PFMuonTrkDxy[NPFMuon]/D");    
-  mtree->Branch("PFMuonTrkNumOfValidPixHits"                         ,mPFMuonTrkNumOfValidPixHits                         ,"PFMuonTrkNumOfValidPixHits[NPFMuon]/D"); 
-  mtree->Branch("PFMuonTrkLayerWithMeasurement"                      ,mPFMuonTrkLayerWithMeasurement                      ,"PFMuonTrkLayerWithMeasurement[NPFMuon]/I");
+  Branch("PFMuonNumOfMatches"                                 ,mPFMuonNumOfMatches                                 ,"PFMuonNumOfMatches[NPFMuon]/I");  
+  Branch("PFMuonNumOfMatchesStation"                          ,mPFMuonNumOfMatchesStation                          ,"PFMuonNumOfMatchesStation[NPFMuon]/I"); 
+  //
+  Branch("PFMuonGlobChi2Norm"                                 ,mPFMuonGlobChi2Norm                                 ,"PFMuonGlobChi2Norm[NPFMuon]/D");  
+  Branch("PFMuonGlobNumOfValidMuonHits"                       ,mPFMuonGlobNumOfValidMuonHits                       ,"PFMuonGlobNumOfValidMuonHits[NPFMuon]/I"); 
+  //
+  Branch("PFMuonBestTrkdxy"                                   ,mPFMuonBestTrkdxy                                   ,"PFMuonBestTrkdxy[NPFMuon]/D");  
+  Branch("PFMuonBestTrkdz"                                    ,mPFMuonBestTrkdz                                    ,"PFMuonBestTrkdz[NPFMuon]/D");
+  //
+  Branch("PFMuoninnertrackPt"                                 ,mPFMuoninnertrackPt                                 ,"PFMuoninnertrackPt[NPFMuon]/D");     
+  Branch("PFMuonnValidHits"                                   ,mPFMuonnValidHits                                   ,"PFMuonnValidHits[NPFMuon]/I");       
+  Branch("PFMuonnValidPixelHits"                              ,mPFMuonnValidPixelHits                              ,"PFMuonnValidPixelHits[NPFMuon]/I");  
+  Branch("PFMuondxy"                                          ,mPFMuondxy                                          ,"PFMuondxy[NPFMuon]/D");              
+  Branch("PFMuondz"                                           ,mPFMuondz                                           ,"PFMuondz[NPFMuon]/D");               
+  //
+  Branch("PFMuonCombChi2Norm"                                 ,mPFMuonCombChi2Norm                                 ,"PFMuonCombChi2Norm[NPFMuon]/D");    
+  Branch("PFMuonCombValidHits"                                ,mPFMuonCombValidHits                                ,"PFMuonCombValidHits[NPFMuon]/I");   
+  Branch("PFMuonCombLostHits"                                 ,mPFMuonCombLostHits                                 ,"PFMuonCombLostHits[NPFMuon]/I");    
+  Branch("PFMuonCombPt"                                       ,mPFMuonCombPt                                       ,"PFMuonCombPt[NPFMuon]/D");          
+  Branch("PFMuonCombPz"                                       ,mPFMuonCombPz                                       ,"PFMuonCombPz[NPFMuon]/D");          
+  Branch("PFMuonCombP"                                        ,mPFMuonCombP                                        ,"PFMuonCombP[NPFMuon]/D");           
+  Branch("PFMuonCombEta"                                      ,mPFMuonCombEta                                      ,"PFMuonCombEta[NPFMuon]/D");         
+  Branch("PFMuonCombPhi"                                      ,mPFMuonCombPhi                                      ,"PFMuonCombPhi[NPFMuon]/D");         
+  Branch("PFMuonCombChi2"                                     ,mPFMuonCombChi2                                     ,"PFMuonCombChi2[NPFMuon]/D");        
+  Branch("PFMuonCombCharge"                                   ,mPFMuonCombCharge                                   ,"PFMuonCombCharge[NPFMuon]/D");      
+  Branch("PFMuonCombQOverPError"                              ,mPFMuonCombQOverPError                              ,"PFMuonCombQOverPError[NPFMuon]/D"); 
+  Branch("PFMuonCombNdof"                                     ,mPFMuonCombNdof                                     ,"PFMuonCombNdof[NPFMuon]/D");        
+  Branch("PFMuonCombVx"                                       ,mPFMuonCombVx                                       ,"PFMuonCombVx[NPFMuon]/D");          
+  Branch("PFMuonCombVy"                                       ,mPFMuonCombVy                                       ,"PFMuonCombVy[NPFMuon]/D");          
+  Branch("PFMuonCombVz"                                       ,mPFMuonCombVz                                       ,"PFMuonCombVz[NPFMuon]/D");          
+  Branch("PFMuonCombD0"                                       ,mPFMuonCombD0                                       ,"PFMuonCombD0[NPFMuon]/D");          
+  Branch("PFMuonCombDz"                                       ,mPFMuonCombDz                                       ,"PFMuonCombDz[NPFMuon]/D");          
+  //
+  Branch("PFMuonStandChi2Norm"                                ,mPFMuonStandChi2Norm                                ,"PFMuonStandChi2Norm[NPFMuon]/D");   
+  Branch("PFMuonStandValidHits"                               ,mPFMuonStandValidHits                               ,"PFMuonStandValidHits[NPFMuon]/I");  
+  Branch("PFMuonStandLostHits"                                ,mPFMuonStandLostHits                                ,"PFMuonStandLostHits[NPFMuon]/I");   
+  Branch("PFMuonStandPt"                                      ,mPFMuonStandPt                                      ,"PFMuonStandPt[NPFMuon]/D");         
+  Branch("PFMuonStandPz"                                      ,mPFMuonStandPz                                      ,"PFMuonStandPz[NPFMuon]/D");         
+  Branch("PFMuonStandP"                                       ,mPFMuonStandP                                       ,"PFMuonStandP[NPFMuon]/D");         
+  Branch("PFMuonStandEta"                                     ,mPFMuonStandEta                                     ,"PFMuonStandEta[NPFMuon]/D");        
+  Branch("PFMuonStandPhi"                                     ,mPFMuonStandPhi                                     ,"PFMuonStandPhi[NPFMuon]/D");        
+  Branch("PFMuonStandChi2"                                    ,mPFMuonStandChi2                                    ,"PFMuonStandChi2[NPFMuon]/D");
+  Branch("PFMuonStandCharge"                                  ,mPFMuonStandCharge                                  ,"PFMuonStandCharge[NPFMuon]/D");
+  Branch("PFMuonStandQOverPError"                             ,mPFMuonStandQOverPError                             ,"PFMuonStandQOverPError[NPFMuon]/D" );
+  //
+  Branch("PFMuonTrkChi2Norm"                                  ,mPFMuonTrkChi2Norm                                  ,"PFMuonTrkChi2Norm[NPFMuon]/D"); 
+  Branch("PFMuonTrkValidHits"                                 ,mPFMuonTrkValidHits                                 ,"PFMuonTrkValidHits[NPFMuon]/I");   
+  Branch("PFMuonTrkLostHits"                                  ,mPFMuonTrkLostHits                                  ,"PFMuonTrkLostHits[NPFMuon]/I");
+  Branch("PFMuonTrkPt"                                        ,mPFMuonTrkPt                                        ,"PFMuonTrkPt[NPFMuon]/D");     
+  Branch("PFMuonTrkPz"                                        ,mPFMuonTrkPz                                        ,"PFMuonTrkPz[NPFMuon]/D");
+  Branch("PFMuonTrkP"                                         ,mPFMuonTrkP                                         ,"PFMuonTrkP[NPFMuon]/D");           
+  Branch("PFMuonTrkEta"                                       ,mPFMuonTrkEta                                       ,"PFMuonTrkEt[NPFMuon]/D");         
+  Branch("PFMuonTrkPhi"                                       ,mPFMuonTrkPhi                                       ,"PFMuonTrkPhi[NPFMuon]/D");         
+  Branch("PFMuonTrkChi2"                                      ,mPFMuonTrkChi2                                      ,"PFMuonTrkChi2[NPFMuon]/D");        
+  Branch("PFMuonTrkCharge"                                    ,mPFMuonTrkCharge                                    ,"PFMuonTrkCharge[NPFMuon]/D");      
+  Branch("PFMuonTrkQOverPError"                               ,mPFMuonTrkQOverPError                               ,"PFMuonTrkQOverPError[NPFMuon]/D"); 
+  Branch("PFMuonTrkDxy"                                       ,mPFMuonTrkDxy                                       ,"PFMuonTrkDxy[NPFMuon]/D");    
+  Branch("PFMuonTrkNumOfValidPixHits"                         ,mPFMuonTrkNumOfValidPixHits                         ,"PFMuonTrkNumOfValidPixHits[NPFMuon]/D"); 
+  Branch("PFMuonTrkLayerWithMeasurement"                      ,mPFMuonTrkLayerWithMeasurement                      ,"PFMuonTrkLayerWithMeasurement[NPFMuon]/I");
   
   ///-------------------------------------------------------------------------- 
   /// PF Electrons
   ///-------------------------------------------------------------------------- 
-  mtree->Branch("NPFElec"                                            ,&mNPFElec                                           ,"NPFElec/I");
-  mtree->Branch("PFElecCharge"                                       ,mPFElecCharge                                       ,"PFElecCharge[NPFElec]/I");
-  mtree->Branch("PFElecIsEB"                                         ,mPFElecIsEB                                         ,"PFElecIsEB[NPFElec]/I");  
-  //
-  mtree->Branch("PFElecE"                                            ,mPFElecE                                            ,"PFElecE[NPFElec]/D");                    
-  mtree->Branch("PFElecPt"                                           ,mPFElecPt                                           ,"PFElecPt[NPFElec]/D");                  
-  mtree->Branch("PFElecPx"                                           ,mPFElecPx                                           ,"PFElecPx[NPFElec]/D");                  
-  mtree->Branch("PFElecPy"                                           ,mPFElecPy                                           ,"PFElecPy[NPFElec]/D");                  
-  mtree->Branch("PFElecPz"                                           ,mPFElecPz                                           ,"PFElecPz[NPFElec]/D");                  
-  mtree->Branch("PFElecEta"                                          ,mPFElecEta                                          ,"PFElecEta[NPFElec]/D");                
-  mtree->Branch("PFElecPhi"                                          ,mPFElecPhi                                          ,"PFElecPhi[NPFElec]/D");                
-  mtree->Branch("PFElecCharHadIso"                                   ,mPFElecCharHadIso                                   ,"PFElecCharHadIso[NPFElec]/D");  
-  mtree->Branch("PFElecPhoIso"                                       ,mPFElecPhoIso                                       ,"PFElecPhoIso[NPFElec]/D");          
-  mtree->Branch("PFElecNeuHadIso"                                    ,mPFElecNeuHadIso                                    ,"PFElecNeuHadIso[NPFElec]/D");    
-  mtree->Branch("PFElecMva"                                          ,mPFElecMva                                          ,"PFElecMva[NPFElec]/D"); 
-  mtree->Branch("PFElecEffArea"                                      ,mPFElecEffArea                                      ,"PFElecEffArea[NPFElec]/D");
-  //
-  mtree->Branch("PFElecdxy"                                          ,mPFElecdxy                                          ,"PFElecdxy[NPFElec]/D");                
-  mtree->Branch("PFElecdz"                                           ,mPFElecdz                                           ,"PFElecdz[NPFElec]/D");                  
-  mtree->Branch("PFElecHadOverEm"                                    ,mPFElecHadOverEm                                    ,"PFElecHadOverEm[NPFElec]/D");    
-  mtree->Branch("PFElecHcalOverEm"                                   ,mPFElecHcalOverEm                                   ,"PFElecHcalOverEm[NPFElec]/D");  
-  mtree->Branch("PFElecSupClusOverP"                                 ,mPFElecSupClusOverP                                 ,"PFElecSupClusOverP[NPFElec]/D");
-  mtree->Branch("PFElecInnerHits"                                    ,mPFElecInnerHits                                    ,"PFElecInnerHits[NPFElec]/D");    
-  mtree->Branch("PFElecConvDist"                                     ,mPFElecConvDist                                     ,"PFElecConvDist[NPFElec]/D");      
-  mtree->Branch("PFElecConvDcot"                                     ,mPFElecConvDcot                                     ,"PFElecConvDcot[NPFElec]/D");
-  //
-  mtree->Branch("PFElecEcalDrivenSeed"                               ,mPFElecEcalDrivenSeed                               ,"PFElecEcalDrivenSeed[NPFElec]/I");
-  mtree->Branch("PFElecdB"                                           ,mPFElecdB                                           ,"PFElecdB[NPFElec]/I");
-  mtree->Branch("PFElecNumOfValidHits"                               ,mPFElecNumOfValidHits                               ,"PFElecNumOfValidHits[NPFElec]/I");
-  mtree->Branch("PFElecdr03HcalTowerSumEt"                           ,mPFElecdr03HcalTowerSumEt                           ,"PFElecdr03HcalTowerSumEt[NPFElec]/D");
-  mtree->Branch("PFElecdr03EcalRecHitSumEt"                          ,mPFElecdr03EcalRecHitSumEt                          ,"PFElecdr03EcalRecHitSumEt[NPFElec]/D");
-  mtree->Branch("PFElecdr03TkSumPt"                                  ,mPFElecdr03TkSumPt                                  ,"PFElecdr03TkSumPt[NPFElec]/D");
-  mtree->Branch("PFElecNormChi2"                                     ,mPFElecNormChi2                                     ,"PFElecNormChi2[NPFElec]/D");
-  mtree->Branch("PFElecfbrem"                                        ,mPFElecfbrem                                        ,"PFElecfbrem[NPFElec]/D");
-  mtree->Branch("PFElecDEtaSuTrAtVtx"                                ,mPFElecDEtaSuTrAtVtx                                ,"PFElecDEtaSuTrAtVtx[NPFElec]/D");
-  mtree->Branch("PFElecDPhiSuTrAtVtx"                                ,mPFElecDPhiSuTrAtVtx                                ,"PFElecDPhiSuTrAtVtx[NPFElec]/D");
-  mtree->Branch("PFElecHadronicOverEm"                               ,mPFElecHadronicOverEm                               ,"PFElecHadronicOverEm[NPFElec]/D");
-  mtree->Branch("PFElecHcalOverEcal"                                 ,mPFElecHcalOverEcal                                 ,"PFElecHcalOverEcal[NPFElec]/D");
-  mtree->Branch("PFElecSuperClusOverP"                               ,mPFElecSuperClusOverP                               ,"PFElecSuperClusOverP[NPFElec]/D");
-  mtree->Branch("PFElecetaeta"                                       ,mPFElecetaeta                                       ,"PFElecetaeta[NPFElec]/D");
-  mtree->Branch("PFElecietaieta"                                     ,mPFElecietaieta                                     ,"PFElecietaieta[NPFElec]/D");
-  //
-  mtree->Branch("PFeidLoose"                                         ,mPFeidLoose                                         ,"PFeidLoose[NPFElec]/I");
-  mtree->Branch("PFeidRobustHighEnergy"                              ,mPFeidRobustHighEnergy                              ,"PFeidRobustHighEnergy[NPFElec]/I");
-  mtree->Branch("PFeidRobustLoose"                                   ,mPFeidRobustLoose                                   ,"PFeidRobustLoose[NPFElec]/I");
-  mtree->Branch("PFeidRobustTight"                                   ,mPFeidRobustTight                                   ,"PFeidRobustTight[NPFElec]/I");
-  mtree->Branch("PFeidTight"                                         ,mPFeidTight                                         ,"PFeidTight[NPFElec]/I");
-  mtree->Branch("PFevspi"                                            ,mPFevspi                                            ,"PFevspi[NPFElec]/I");
-  mtree->Branch("PFevsmu"                                            ,mPFevsmu                                            ,"PFevsmu[NPFElec]/I");
-  //
-  mtree->Branch("PFElecIsTight"                                      ,mPFElecIsTight                                      ,"PFElecIsTight[NPFElec]/I");     
-  mtree->Branch("PFElecIsMedium"                                     ,mPFElecIsMedium                                     ,"PFElecIsMedium[NPFElec]/I");
-  mtree->Branch("PFElecIsLoose"                                      ,mPFElecIsLoose                                      ,"PFElecIsLoose[NPFElec]/I");     
-  mtree->Branch("PFElecIsVeto"                                       ,mPFElecIsVeto                                       ,"PFElecIsVeto[NPFElec]/I");
+  Branch("NPFElec"                                            ,&mNPFElec                                           ,"NPFElec/I");
+  Branch("PFElecCharge"                                       ,mPFElecCharge                                       ,"PFElecCharge[NPFElec]/I");
+  Branch("PFElecIsEB"                                         ,mPFElecIsEB                                         ,"PFElecIsEB[NPFElec]/I");  
+  //
+  Branch("PFElecE"                                            ,mPFElecE                                            ,"PFElecE[NPFElec]/D");                    
+  Branch("PFElecPt"                                           ,mPFElecPt                                           ,"PFElecPt[NPFElec]/D");                  
+  Branch("PFElecPx"                                           ,mPFElecPx                                           ,"PFElecPx[NPFElec]/D");                  
+  Branch("PFElecPy"                                           ,mPFElecPy                                           ,"PFElecPy[NPFElec]/D");                  
+  Branch("PFElecPz"                                           ,mPFElecPz                                           ,"PFElecPz[NPFElec]/D");                  
+  Branch("PFElecEta"                                          ,mPFElecEta                                          ,"PFElecEta[NPFElec]/D");                
+  Branch("PFElecPhi"                                          ,mPFElecPhi                                          ,"PFElecPhi[NPFElec]/D");                
+  Branch("PFElecCharHadIso"                                   ,mPFElecCharHadIso                                   ,"PFElecCharHadIso[NPFElec]/D");  
+  Branch("PFElecPhoIso"                                       ,mPFElecPhoIso                                       ,"PFElecPhoIso[NPFElec]/D");          
+  Branch("PFElecNeuHadIso"                                    ,mPFElecNeuHadIso                                    ,"PFElecNeuHadIso[NPFElec]/D");    
+  Branch("PFElecMva"                                          ,mPFElecMva                                          ,"PFElecMva[NPFElec]/D"); 
+  Branch("PFElecEffArea"                                      ,mPFElecEffArea                                      ,"PFElecEffArea[NPFElec]/D");
+  //
+  Branch("PFElecdxy"                                          ,mPFElecdxy                                          ,"PFElecdxy[NPFElec]/D");                
+  Branch("PFElecdz"                                           ,mPFElecdz                                           ,"PFElecdz[NPFElec]/D");                  
+  Branch("PFElecHadOverEm"                                    ,mPFElecHadOverEm                                    ,"PFElecHadOverEm[NPFElec]/D");    
+  Branch("PFElecHcalOverEm"                                   ,mPFElecHcalOverEm                                   ,"PFElecHcalOverEm[NPFElec]/D");  
+  Branch("PFElecSupClusOverP"                                 ,mPFElecSupClusOverP                                 ,"PFElecSupClusOverP[NPFElec]/D");
+  Branch("PFElecInnerHits"                                    ,mPFElecInnerHits                                    ,"PFElecInnerHits[NPFElec]/D");    
+  Branch("PFElecConvDist"                                     ,mPFElecConvDist                                     ,"PFElecConvDist[NPFElec]/D");      
+  Branch("PFElecConvDcot"                                     ,mPFElecConvDcot                                     ,"PFElecConvDcot[NPFElec]/D");
+  //
+  Branch("PFElecEcalDrivenSeed"                               ,mPFElecEcalDrivenSeed                               ,"PFElecEcalDrivenSeed[NPFElec]/I");
+  Branch("PFElecdB"                                           ,mPFElecdB                                           ,"PFElecdB[NPFElec]/I");
+  Branch("PFElecNumOfValidHits"                               ,mPFElecNumOfValidHits                               ,"PFElecNumOfValidHits[NPFElec]/I");
+  Branch("PFElecdr03HcalTowerSumEt"                           ,mPFElecdr03HcalTowerSumEt                           ,"PFElecdr03HcalTowerSumEt[NPFElec]/D");
+  Branch("PFElecdr03EcalRecHitSumEt"                          ,mPFElecdr03EcalRecHitSumEt                          ,"PFElecdr03EcalRecHitSumEt[NPFElec]/D");
+  Branch("PFElecdr03TkSumPt"                                  ,mPFElecdr03TkSumPt                                  ,"PFElecdr03TkSumPt[NPFElec]/D");
+  Branch("PFElecNormChi2"                                     ,mPFElecNormChi2                                     ,"PFElecNormChi2[NPFElec]/D");
+  Branch("PFElecfbrem"                                        ,mPFElecfbrem                                        ,"PFElecfbrem[NPFElec]/D");
+  Branch("PFElecDEtaSuTrAtVtx"                                ,mPFElecDEtaSuTrAtVtx                                ,"PFElecDEtaSuTrAtVtx[NPFElec]/D");
+  Branch("PFElecDPhiSuTrAtVtx"                                ,mPFElecDPhiSuTrAtVtx                                ,"PFElecDPhiSuTrAtVtx[NPFElec]/D");
+  Branch("PFElecHadronicOverEm"                               ,mPFElecHadronicOverEm                               ,"PFElecHadronicOverEm[NPFElec]/D");
+  Branch("PFElecHcalOverEcal"                                 ,mPFElecHcalOverEcal                                 ,"PFElecHcalOverEcal[NPFElec]/D");
+  Branch("PFElecSuperClusOverP"                               ,mPFElecSuperClusOverP                               ,"PFElecSuperClusOverP[NPFElec]/D");
+  Branch("PFElecetaeta"                                       ,mPFElecetaeta                                       ,"PFElecetaeta[NPFElec]/D");
+  Branch("PFElecietaieta"                                     ,mPFElecietaieta                                     ,"PFElecietaieta[NPFElec]/D");
+  //
+  Branch("PFeidLoose"                                         ,mPFeidLoose                                         ,"PFeidLoose[NPFElec]/I");
+  Branch("PFeidRobustHighEnergy"                              ,mPFeidRobustHighEnergy                              ,"PFeidRobustHighEnergy[NPFElec]/I");
+  Branch("PFeidRobustLoose"                                   ,mPFeidRobustLoose                                   ,"PFeidRobustLoose[NPFElec]/I");
+  Branch("PFeidRobustTight"                                   ,mPFeidRobustTight                                   ,"PFeidRobustTight[NPFElec]/I");
+  Branch("PFeidTight"                                         ,mPFeidTight                                         ,"PFeidTight[NPFElec]/I");
+  Branch("PFevspi"                                            ,mPFevspi                                            ,"PFevspi[NPFElec]/I");
+  Branch("PFevsmu"                                            ,mPFevsmu                                            ,"PFevsmu[NPFElec]/I");
+  //
+  Branch("PFElecIsTight"                                      ,mPFElecIsTight                                      ,"PFElecIsTight[NPFElec]/I");     
+  Branch("PFElecIsMedium"                                     ,mPFElecIsMedium                                     ,"PFElecIsMedium[NPFElec]/I");
+  Branch("PFElecIsLoose"                                      ,mPFElecIsLoose                                      ,"PFElecIsLoose[NPFElec]/I");     
+  Branch("PFElecIsVeto"                                       ,mPFElecIsVeto                                       ,"PFElecIsVeto[NPFElec]/I");
   
   ///-------------------------------------------------------------------------- 
   /// PF Taus
   ///--------------------------------------------------------------------------
-  mtree->Branch("NPFTau"                                             ,&mNPFTau                                            ,"NPFTau/I");
-  mtree->Branch("PFTauE"                                             ,mPFTauE                                             ,"PFTauE[NPFTau]/D" );
-  mtree->Branch("PFTauPt"                                            ,mPFTauPt                                            ,"PFTauPt[NPFTau]/D" );
-  mtree->Branch("PFTauPx"                                            ,mPFTauPx                                            ,"PFTauPx[NPFTau]/D" );
-  mtree->Branch("PFTauPy"                                            ,mPFTauPy                                            ,"PFTauPy[NPFTau]/D" );
-  mtree->Branch("PFTauPz"                                            ,mPFTauPz                                            ,"PFTauPz[NPFTau]/D" );
-  mtree->Branch("PFTauEta"                                           ,mPFTauEta                                           ,"PFTauEta[NPFTau]/D" );
-  mtree->Branch("PFTauPhi"                                           ,mPFTauPhi                                           ,"PFTauPhi[NPFTau]/D" );
-  mtree->Branch("PFTauCharge"                                        ,mPFTauCharge                                        ,"PFTauCharge[NPFTau]/I");
-  //
-  mtree->Branch("PFTauDisAgainstElectronLoose"                       ,mPFTauDisAgainstElectronLoose                       ,"PFTauDisAgainstElectronLoose[NPFTau]/D");
-  mtree->Branch("PFTauDisAgainstElectronLooseMVA5"                   ,mPFTauDisAgainstElectronLooseMVA5                   ,"PFTauDisAgainstElectronLooseMVA5[NPFTau]/D");
-  mtree->Branch("PFTauDisAgainstElectronMedium"                      ,mPFTauDisAgainstElectronMedium                      ,"PFTauDisAgainstElectronMedium[NPFTau]/D");
-  mtree->Branch("PFTauDisAgainstElectronMediumMVA5"                  ,mPFTauDisAgainstElectronMediumMVA5                  ,"PFTauDisAgainstElectronMediumMVA5[NPFTau]/D");
-  mtree->Branch("PFTauDisAgainstElectronTight"                       ,mPFTauDisAgainstElectronTight                       ,"PFTauDisAgainstElectronTight[NPFTau]/D");
-  mtree->Branch("PFTauDisAgainstElectronTightMVA5"                   ,mPFTauDisAgainstElectronTightMVA5                   ,"PFTauDisAgainstElectronTightMVA5[NPFTau]/D");
-  mtree->Branch("PFTauDisAgainstElectronVLooseMVA5"                  ,mPFTauDisAgainstElectronVLooseMVA5                  ,"PFTauDisAgainstElectronVLooseMVA5[NPFTau]/D");
-  mtree->Branch("PFTauDisAgainstElectronVTightMVA3"                  ,mPFTauDisAgainstElectronVTightMVA3                  ,"PFTauDisAgainstElectronVTightMVA3[NPFTau]/D");
-  mtree->Branch("PFTauDisAgainstMuonLoose2"                          ,mPFTauDisAgainstMuonLoose2                          ,"PFTauDisAgainstMuonLoose2[NPFTau]/D");
-  mtree->Branch("PFTauDisAgainstMuonMedium2"                         ,mPFTauDisAgainstMuonMedium2                         ,"PFTauDisAgainstMuonMedium2[NPFTau]/D");
-  mtree->Branch("PFTauDisAgainstMuonMedium"                          ,mPFTauDisAgainstMuonMedium                          ,"PFTauDisAgainstMuonMedium[NPFTau]/D");
-  mtree->Branch("PFTauDisAgainstMuonTight3"                          ,mPFTauDisAgainstMuonTight3                          ,"PFTauDisAgainstMuonTight3[NPFTau]/D");
-  mtree->Branch("PFTauDisByCombinedIsolationDeltaBetaCorrRaw3Hits"   ,mPFTauDisByCombinedIsolationDeltaBetaCorrRaw3Hits   ,"PFTauDisByCombinedIsolationDeltaBetaCorrRaw3Hits[NPFTau]/D");
-  mtree->Branch("PFTauDisByLooseCombinedIsolationDeltaBetaCorr3Hits" ,mPFTauDisByLooseCombinedIsolationDeltaBetaCorr3Hits ,"PFTauDisByLooseCombinedIsolationDeltaBetaCorr3Hits[NPFTau]/D");
-  mtree->Branch("PFTauDisByMediumCombinedIsolationDeltaBetaCorr3Hits",mPFTauDisByMediumCombinedIsolationDeltaBetaCorr3Hits,"PFTauDisByMediumCombinedIsolationDeltaBetaCorr3Hits[NPFTau]/D");
-  mtree->Branch("PFTauDisByTightCombinedIsolationDeltaBetaCorr3Hits" ,mPFTauDisByTightCombinedIsolationDeltaBetaCorr3Hits ,"PFTauDisByTightCombinedIsolationDeltaBetaCorr3Hits[NPFTau]/D");
-  mtree->Branch("PFTauDisDecayModeFinding"                           ,mPFTauDisDecayModeFinding                           ,"PFTauDisDecayModeFinding[NPFTau]/D");
-  mtree->Branch("PFTauDisDecayModeFindingNewDMs"                     ,mPFTauDisDecayModeFindingNewDMs                     ,"PFTauDisDecayModeFindingNewDMs[NPFTau]/D");
-  mtree->Branch("PFTauPUCorrPtSum"                                   ,mPFTauPUCorrPtSum                                   ,"PFTauPUCorrPtSum[NPFTau]/D");
-  mtree->Branch("PFTauNeutralIsoPtSum"                               ,mPFTauNeutralIsoPtSum                               ,"PFTauNeutralIsoPtSum[NPFTau]/D");
-  mtree->Branch("PFTauChargedIsoPtSum"                               ,mPFTauChargedIsoPtSum                               ,"PFTauChargedIsoPtSum[NPFTau]/D");
-  //
-  mtree->Branch("PFTauJetPt"                                         ,mPFTauJetPt                                         ,"PFTauJetPt[NPFTau]/D"); 
-  mtree->Branch("PFTauJetEta"                                        ,mPFTauJetEta                                        ,"PFTauJetEta[NPFTau]/D"); 
-  mtree->Branch("PFTauJetPhi"                                        ,mPFTauJetPhi                                        ,"PFTauJetPhi[NPFTau]/D");
+  Branch("NPFTau"                                             ,&mNPFTau                                            ,"NPFTau/I");
+  Branch("PFTauE"                                             ,mPFTauE                                             ,"PFTauE[NPFTau]/D" );
+  Branch("PFTauPt"                                            ,mPFTauPt                                            ,"PFTauPt[NPFTau]/D" );
+  Branch("PFTauPx"                                            ,mPFTauPx                                            ,"PFTauPx[NPFTau]/D" );
+  Branch("PFTauPy"                                            ,mPFTauPy                                            ,"PFTauPy[NPFTau]/D" );
+  Branch("PFTauPz"                                            ,mPFTauPz                                            ,"PFTauPz[NPFTau]/D" );
+  Branch("PFTauEta"                                           ,mPFTauEta                                           ,"PFTauEta[NPFTau]/D" );
+  Branch("PFTauPhi"                                           ,mPFTauPhi                                           ,"PFTauPhi[NPFTau]/D" );
+  Branch("PFTauCharge"                                        ,mPFTauCharge                                        ,"PFTauCharge[NPFTau]/I");
+  //
+  Branch("PFTauDisAgainstElectronLoose"                       ,mPFTauDisAgainstElectronLoose                       ,"PFTauDisAgainstElectronLoose[NPFTau]/D");
+  Branch("PFTauDisAgainstElectronLooseMVA5"                   ,mPFTauDisAgainstElectronLooseMVA5                   ,"PFTauDisAgainstElectronLooseMVA5[NPFTau]/D");
+  Branch("PFTauDisAgainstElectronMedium"                      ,mPFTauDisAgainstElectronMedium                      ,"PFTauDisAgainstElectronMedium[NPFTau]/D");
+  Branch("PFTauDisAgainstElectronMediumMVA5"                  ,mPFTauDisAgainstElectronMediumMVA5                  ,"PFTauDisAgainstElectronMediumMVA5[NPFTau]/D");
+  Branch("PFTauDisAgainstElectronTight"                       ,mPFTauDisAgainstElectronTight                       ,"PFTauDisAgainstElectronTight[NPFTau]/D");
+  Branch("PFTauDisAgainstElectronTightMVA5"                   ,mPFTauDisAgainstElectronTightMVA5                   ,"PFTauDisAgainstElectronTightMVA5[NPFTau]/D");
+  Branch("PFTauDisAgainstElectronVLooseMVA5"                  ,mPFTauDisAgainstElectronVLooseMVA5                  ,"PFTauDisAgainstElectronVLooseMVA5[NPFTau]/D");
+  Branch("PFTauDisAgainstElectronVTightMVA3"                  ,mPFTauDisAgainstElectronVTightMVA3                  ,"PFTauDisAgainstElectronVTightMVA3[NPFTau]/D");
+  Branch("PFTauDisAgainstMuonLoose2"                          ,mPFTauDisAgainstMuonLoose2                          ,"PFTauDisAgainstMuonLoose2[NPFTau]/D");
+  Branch("PFTauDisAgainstMuonMedium2"                         ,mPFTauDisAgainstMuonMedium2                         ,"PFTauDisAgainstMuonMedium2[NPFTau]/D");
+  Branch("PFTauDisAgainstMuonMedium"                          ,mPFTauDisAgainstMuonMedium                          ,"PFTauDisAgainstMuonMedium[NPFTau]/D");
+  Branch("PFTauDisAgainstMuonTight3"                          ,mPFTauDisAgainstMuonTight3                          ,"PFTauDisAgainstMuonTight3[NPFTau]/D");
+  Branch("PFTauDisByCombinedIsolationDeltaBetaCorrRaw3Hits"   ,mPFTauDisByCombinedIsolationDeltaBetaCorrRaw3Hits   ,"PFTauDisByCombinedIsolationDeltaBetaCorrRaw3Hits[NPFTau]/D");
+  Branch("PFTauDisByLooseCombinedIsolationDeltaBetaCorr3Hits" ,mPFTauDisByLooseCombinedIsolationDeltaBetaCorr3Hits ,"PFTauDisByLooseCombinedIsolationDeltaBetaCorr3Hits[NPFTau]/D");
+  Branch("PFTauDisByMediumCombinedIsolationDeltaBetaCorr3Hits",mPFTauDisByMediumCombinedIsolationDeltaBetaCorr3Hits,"PFTauDisByMediumCombinedIsolationDeltaBetaCorr3Hits[NPFTau]/D");
+  Branch("PFTauDisByTightCombinedIsolationDeltaBetaCorr3Hits" ,mPFTauDisByTightCombinedIsolationDeltaBetaCorr3Hits ,"PFTauDisByTightCombinedIsolationDeltaBetaCorr3Hits[NPFTau]/D");
+  Branch("PFTauDisDecayModeFinding"                           ,mPFTauDisDecayModeFinding                           ,"PFTauDisDecayModeFinding[NPFTau]/D");
+  Branch("PFTauDisDecayModeFindingNewDMs"                     ,mPFTauDisDecayModeFindingNewDMs                     ,"PFTauDisDecayModeFindingNewDMs[NPFTau]/D");
+  Branch("PFTauPUCorrPtSum"                                   ,mPFTauPUCorrPtSum                                   ,"PFTauPUCorrPtSum[NPFTau]/D");
+  Branch("PFTauNeutralIsoPtSum"                               ,mPFTauNeutralIsoPtSum                               ,"PFTauNeutralIsoPtSum[NPFTau]/D");
+  Branch("PFTauChargedIsoPtSum"                               ,mPFTauChargedIsoPtSum                               ,"PFTauChargedIsoPtSum[NPFTau]/D");
+  //
+  Branch("PFTauJetPt"                                         ,mPFTauJetPt                                         ,"PFTauJetPt[NPFTau]/D"); 
+  Branch("PFTauJetEta"                                        ,mPFTauJetEta                                        ,"PFTauJetEta[NPFTau]/D"); 
+  Branch("PFTauJetPhi"                                        ,mPFTauJetPhi                                        ,"PFTauJetPhi[NPFTau]/D");
   
   ///-------------------------------------------------------------------------- 
   /// Photons
   ///--------------------------------------------------------------------------
-  mtree->Branch("NPhot"                                              ,&mNPhot                                             ,"NPhot/I");
-  mtree->Branch("PhotE"                                              ,mPhotE                                              ,"PhotE[NPhot]/D");
-  mtree->Branch("PhotPt"                                             ,mPhotPt                                             ,"PhotPt[NPhot]/D");
-  mtree->Branch("PhotPx"                                             ,mPhotPx                                             ,"PhotPx[NPhot]/D");
-  mtree->Branch("PhotPy"                                             ,mPhotPy                                             ,"PhotPy[NPhot]/D");
-  mtree->Branch("PhotPz"                                             ,mPhotPz                                             ,"PhotPz[NPhot]/D");
-  mtree->Branch("PhotEta"                                            ,mPhotEta                                            ,"PhotEta[NPhot]/D");
-  mtree->Branch("PhotPhi"                                            ,mPhotPhi                                            ,"PhotPhi[NPhot]/D");
-  mtree->Branch("PhotE1x5"                                           ,mPhotE1x5                                           ,"PhotE1x5[NPhot]/D");
-  mtree->Branch("PhotE2x5"                                           ,mPhotE2x5                                           ,"PhotE2x5[NPhot]/D");
-  mtree->Branch("PhotE5x5"                                           ,mPhotE5x5                                           ,"PhotE5x5[NPhot]/D");
-  mtree->Branch("PhotSigEta"                                         ,mPhotSigEta                                         ,"PhotSigEta[NPhot]/D");
-  mtree->Branch("PhotSigPhi"                                         ,mPhotSigPhi                                         ,"PhotSigPhi[NPhot]/D");
-  mtree->Branch("PhotEcalIso04"                                      ,mPhotEcalIso04                                      ,"PhotEcalIso04[NPhot]/D");
-  mtree->Branch("PhotHcalIso04"                                      ,mPhotHcalIso04                                      ,"PhotHcalIso04[NPhot]/D");
-  mtree->Branch("PhotTrackIso04"                                     ,mPhotTrackIso04                                     ,"PhotTrackIso04[NPhot]/D");
-  mtree->Branch("PhotHasPixSeed"                                     ,mPhotHasPixSeed                                     ,"PhotHasPixSeed[NPhot]/D");
-  mtree->Branch("PhotIsPhot"                                         ,mPhotIsPhot                                         ,"PhotIsPhot[NPhot]/D");
+  Branch("NPhot"                                              ,&mNPhot                                             ,"NPhot/I");
+  Branch("PhotE"                                              ,mPhotE                                              ,"PhotE[NPhot]/D");
+  Branch("PhotPt"                                             ,mPhotPt                                             ,"PhotPt[NPhot]/D");
+  Branch("PhotPx"                                             ,mPhotPx                                             ,"PhotPx[NPhot]/D");
+  Branch("PhotPy"                                             ,mPhotPy                                             ,"PhotPy[NPhot]/D");
+  Branch("PhotPz"                                             ,mPhotPz                                             ,"PhotPz[NPhot]/D");
+  Branch("PhotEta"                                            ,mPhotEta                                            ,"PhotEta[NPhot]/D");
+  Branch("PhotPhi"                                            ,mPhotPhi                                            ,"PhotPhi[NPhot]/D");
+  Branch("PhotE1x5"                                           ,mPhotE1x5                                           ,"PhotE1x5[NPhot]/D");
+  Branch("PhotE2x5"                                           ,mPhotE2x5                                           ,"PhotE2x5[NPhot]/D");
+  Branch("PhotE5x5"                                           ,mPhotE5x5                                           ,"PhotE5x5[NPhot]/D");
+  Branch("PhotSigEta"                                         ,mPhotSigEta                                         ,"PhotSigEta[NPhot]/D");
+  Branch("PhotSigPhi"                                         ,mPhotSigPhi                                         ,"PhotSigPhi[NPhot]/D");
+  Branch("PhotEcalIso04"                                      ,mPhotEcalIso04                                      ,"PhotEcalIso04[NPhot]/D");
+  Branch("PhotHcalIso04"                                      ,mPhotHcalIso04                                      ,"PhotHcalIso04[NPhot]/D");
+  Branch("PhotTrackIso04"                                     ,mPhotTrackIso04                                     ,"PhotTrackIso04[NPhot]/D");
+  Branch("PhotHasPixSeed"                                     ,mPhotHasPixSeed                                     ,"PhotHasPixSeed[NPhot]/D");
+  Branch("PhotIsPhot"                                         ,mPhotIsPhot                                         ,"PhotIsPhot[NPhot]/D");
   
   ///-------------------------------------------------------------------------- 
   /// Primiry vertices
   ///--------------------------------------------------------------------------
-  mtree->Branch("NPV"                                                ,&mNPV                                               ,"NPV/I");
-  mtree->Branch("PVx"                                                ,mPVx                                                ,"PVx[NPV]/D");
-  mtree->Branch("PVy"                                                ,mPVy                                                ,"PVy[NPV]/D");
-  mtree->Branch("PVz"                                                ,mPVz                                                ,"PVz[NPV]/D");
-  mtree->Branch("PVchi2"                                             ,mPVchi2                                             ,"PVchi2[NPV]/D");
-  mtree->Branch("PVndof"                                             ,mPVndof                                             ,"PVndof[NPV]/D");
-  mtree->Branch("PVntracks"                                          ,mPVntracks                                          ,"PVntracks[NPV]/I");
+  Branch("NPV"                                                ,&mNPV                                               ,"NPV/I");
+  Branch("PVx"                                                ,mPVx                                                ,"PVx[NPV]/D");
+  Branch("PVy"                                                ,mPVy                                                ,"PVy[NPV]/D");
+  Branch("PVz"                                                ,mPVz                                                ,"PVz[NPV]/D");
+  Branch("PVchi2"                                             ,mPVchi2                                             ,"PVchi2[NPV]/D");
+  Branch("PVndof"                                             ,mPVndof                                             ,"PVndof[NPV]/D");
+  Branch("PVntracks"                                          ,mPVntracks                                          ,"PVntracks[NPV]/I");
   
   ///-------------------------------------------------------------------------- 
   /// Gen information
   ///--------------------------------------------------------------------------
   if(isMCTag){
-    mtree->Branch("NGenPar"                                          ,&mNGenPar                                           ,"NGenPar/I");
-    mtree->Branch("GenParId"                                         ,mGenParId                                           ,"GenParId[NGenPar]/I");
-    mtree->Branch("GenParStatus"                                     ,mGenParStatus                                       ,"GenParStatus[NGenPar]/I");
-    mtree->Branch("GenParE"                                          ,mGenParE                                            ,"GenParE[NGenPar]/D");
-    mtree->Branch("GenParPx"                                         ,mGenParPx                                           ,"GenParPx[NGenPar]/D");
-    mtree->Branch("GenParPy"                                         ,mGenParPy                                           ,"GenParPy[NGenPar]/D");
-    mtree->Branch("GenParPz"                                         ,mGenParPz                                           ,"GenParPz[NGenPar]/D");
-    mtree->Branch("GenParEta"                                        ,mGenParEta                                          ,"GenParEta[NGenPar]/D");
-    mtree->Branch("GenParPhi"                                        ,mGenParPhi                                          ,"GenParPhi[NGenPar]/D");
-    mtree->Branch("GenParCharge"                                     ,mGenParCharge                                       ,"GenParCharge[NGenPar]/I");
-    mtree->Branch("GenParPt"                                         ,mGenParPt                                           ,"GenParPt[NGenPar]/D");
-    mtree->Branch("GenParMass"                                       ,mGenParMass                                         ,"GenParMass[NGenPar]/D");
-    mtree->Branch("GenParDoughterOf"                                 ,mGenParDoughterOf                                   ,"GenParDoughterOf[NGenPar]/I");
-    mtree->Branch("GenParMother1"                                    ,mGenParMother1                                      ,"GenParMother1[NGenPar]/I");
-    mtree->Branch("GenParMother2"                                    ,mGenParMother2                                      ,"GenParMother2[NGenPar]/I");	
-    mtree->Branch("GenScale"                                         ,&mGenScale                                          ,"GenScale/D");
+    Branch("NGenPar"                                          ,&mNGenPar                                           ,"NGenPar/I");
+    Branch("GenParId"                                         ,mGenParId                                           ,"GenParId[NGenPar]/I");
+    Branch("GenParStatus"                                     ,mGenParStatus                                       ,"GenParStatus[NGenPar]/I");
+    Branch("GenParE"                                          ,mGenParE                                            ,"GenParE[NGenPar]/D");
+    Branch("GenParPx"                                         ,mGenParPx                                           ,"GenParPx[NGenPar]/D");
+    Branch("GenParPy"                                         ,mGenParPy                                           ,"GenParPy[NGenPar]/D");
+    Branch("GenParPz"                                         ,mGenParPz                                           ,"GenParPz[NGenPar]/D");
+    Branch("GenParEta"                                        ,mGenParEta                                          ,"GenParEta[NGenPar]/D");
+    Branch("GenParPhi"                                        ,mGenParPhi                                          ,"GenParPhi[NGenPar]/D");
+    Branch("GenParCharge"                                     ,mGenParCharge                                       ,"GenParCharge[NGenPar]/I");
+    Branch("GenParPt"                                         ,mGenParPt                                           ,"GenParPt[NGenPar]/D");
+    Branch("GenParMass"                                       ,mGenParMass                                         ,"GenParMass[NGenPar]/D");
+    Branch("GenParDoughterOf"                                 ,mGenParDoughterOf                                   ,"GenParDoughterOf[NGenPar]/I");
+    Branch("GenParMother1"                                    ,mGenParMother1                                      ,"GenParMother1[NGenPar]/I");
+    Branch("GenParMother2"                                    ,mGenParMother2                                      ,"GenParMother2[NGenPar]/I");	
+    Branch("GenScale"                                         ,&mGenScale                                          ,"GenScale/D");
     // PDF
-    mtree->Branch("PDFx1"                                            ,&mPdfx1                                             ,"PDFx1/D");
-    mtree->Branch("PDFx2"                                            ,&mPdfx2                                             ,"PDFx2/D");
-    mtree->Branch("PDFf1"                                            ,&mPdff1                                             ,"PDFf1/I");
-    mtree->Branch("PDFf2"                                            ,&mPdff2                                             ,"PDFf2/I");
-    mtree->Branch("PDFscale"                                         ,&mPdfscale                                          ,"PDFscale/D");
-    mtree->Branch("PDFpdf1"                                          ,&mPdfpdf1                                           ,"PDFpdf1/D");
-    mtree->Branch("PDFpdf2"                                          ,&mPdfpdf2                                           ,"PDFpdf2/D");
+    Branch("PDFx1"                                            ,&mPdfx1                                             ,"PDFx1/D");
+    Branch("PDFx2"                                            ,&mPdfx2                                             ,"PDFx2/D");
+    Branch("PDFf1"                                            ,&mPdff1                                             ,"PDFf1/I");
+    Branch("PDFf2"                                            ,&mPdff2                                             ,"PDFf2/I");
+    Branch("PDFscale"                                         ,&mPdfscale                                          ,"PDFscale/D");
+    Branch("PDFpdf1"                                          ,&mPdfpdf1                                           ,"PDFpdf1/D");
+    Branch("PDFpdf2"                                          ,&mPdfpdf2                                           ,"PDFpdf2/D");
     // W-Decay mode
-    mtree->Branch("WTauDecayMode"                                    ,&mWTauDecayMode                                     ,"WTauDecayMode/I");
-    mtree->Branch("WTauN"                                            ,&mWTauN                                             ,"WTauN/I" );
-    mtree->Branch("WTauDecayId"                                      ,mWTauDecayId                                        ,"WTauDecayId[WTauN]/I");
-    mtree->Branch("WTauDecayStatus"                                  ,mWTauDecayStatus                                    ,"WTauDecayStatus[WTauN]/I");
-    mtree->Branch("WTauDecayPt"                                      ,mWTauDecayPt                                        ,"WTauDecayPt[WTauN]/D");
-    mtree->Branch("WTauDecayEta"                                     ,mWTauDecayEta                                       ,"WTauDecayEta[WTauN]/D");
-    mtree->Branch("WTauDecayPhi"                                     ,mWTauDecayPhi                                       ,"WTauDecayPhi[WTauN]/D"); 
-    mtree->Branch("WTauDecayMass"                                    ,mWTauDecayMass                                      ,"WTauDecayMass[WTauN]/D");
+    Branch("WTauDecayMode"                                    ,&mWTauDecayMode                                     ,"WTauDecayMode/I");
+    Branch("WTauN"                                            ,&mWTauN                                             ,"WTauN/I" );
+    Branch("WTauDecayId"                                      ,mWTauDecayId                                        ,"WTauDecayId[WTauN]/I");
+    Branch("WTauDecayStatus"                                  ,mWTauDecayStatus                                    ,"WTauDecayStatus[WTauN]/I");
+    Branch("WTauDecayPt"                                      ,mWTauDecayPt                                        ,"WTauDecayPt[WTauN]/D");
+    Branch("WTauDecayEta"                                     ,mWTauDecayEta                                       ,"WTauDecayEta[WTauN]/D");
+    Branch("WTauDecayPhi"                                     ,mWTauDecayPhi                                       ,"WTauDecayPhi[WTauN]/D"); 
+    Branch("WTauDecayMass"                                    ,mWTauDecayMass                                      ,"WTauDecayMass[WTauN]/D");
     // PDF
     if(isSignalTag==1.){
-      mtree->Branch("NPDFWeights1"                                   ,&mNPdfWeights1                                      ,"NPDFWeights1/I");
-      mtree->Branch("PDFWeights1"                                    ,mPdfWeights1                                        ,"PDFWeights1[NPDFWeights1]/D");
+      Branch("NPDFWeights1"                                   ,&mNPdfWeights1                                      ,"NPDFWeights1/I");
+      Branch("PDFWeights1"                                    ,mPdfWeights1                                        ,"PDFWeights1[NPDFWeights1]/D");
     }
     if(isSignalTag==2.){
-      mtree->Branch("NPDFWeights"                                    ,&mNPdfWeights                                       ,"NPDFWeights/I");
-      mtree->Branch("PDFWeights"                                     ,mPdfWeights                                         ,"PDFWeights[NPDFWeights]/D");
+      Branch("NPDFWeights"                                    ,&mNPdfWeights                                       ,"NPDFWeights/I");
+      Branch("PDFWeights"                                     ,mPdfWeights                                         ,"PDFWeights[NPDFWeights]/D");
     }
     if(isSignalTag==3.){
-      mtree->Branch("NPDFWeights"                                    ,&mNPdfWeights                                       ,"NPDFWeights/I");
-      mtree->Branch("PDFWeights"                                     ,mPdfWeights                                         ,"PDFWeights[NPDFWeights]/D");
+      Branch("NPDFWeights"                                    ,&mNPdfWeights                                       ,"NPDFWeights/I");
+      Branch("PDFWeights"                                     ,mPdfWeights                                         ,"PDFWeights[NPDFWeights]/D");
     }
   }
   
   ///-------------------------------------------------------------------------- 
   /// HLT
   ///--------------------------------------------------------------------------
-  mtree->Branch("nHLT"                                               ,&nHLT                                               ,"nHLT/I");
-  mtree->Branch("HLTArray"                                           ,HLTArray                                            ,"HLTArray[nHLT]/I");
-  mtree->Branch("HLTArray2"                                          ,HLTArray2                                           ,"HLTArray2[100]/I");
-  mtree->Branch("HLTNames"                                           ,trgnm                                               ,"HLTNames/C");
-  mtree->Branch("HLTPreScale2"                                       ,HLTPreScale2                                        ,"HLTPreScale2[100]/I");
+  Branch("nHLT"                                               ,&nHLT                                               ,"nHLT/I");
+  Branch("HLTArray"                                           ,HLTArray                                            ,"HLTArray[nHLT]/I");
+  Branch("HLTArray2"                                          ,HLTArray2                                           ,"HLTArray2[100]/I");
+  Branch("HLTNames"                                           ,trgnm                                               ,"HLTNames/C");
+  Branch("HLTPreScale2"                                       ,HLTPreScale2                                        ,"HLTPreScale2[100]/I");
   
   ///-------------------------------------------------------------------------- 
   /// Noise flags
   ///--------------------------------------------------------------------------
-  mtree->Branch("nNoiseFlag"                                         ,&nNoiseFlag                                         ,"nNoiseFlag/I");
-  mtree->Branch("NoiseFlag"                                          ,NoiseFlag                                           ,"NoiseFlag[nNoiseFlag]/I");
-  mtree->Branch("HCFlag"                                             ,&flg_hnoise                                         ,"HCFlag/I");
-  mtree->Branch("HFFlag"                                             ,&flg_hfbadhit                                       ,"HFFlag/I");
-  mtree->Branch("ESFlag"                                             ,&flg_ecalspike                                      ,"ESFlag/I");
-  mtree->Branch("BeamHaloTight"                                      ,&mbeamHaloTight                                     ,"BeamHaloTight/I");
-  mtree->Branch("BeamHaloLoose"                                      ,&mbeamHaloLoose                                     ,"BeamHaloLoose/I");
-  mtree->Branch("SumTrackPt"                                         ,&mSumTrackPt                                        ,"SumTrackPt/D");
+  Branch("nNoiseFlag"                                         ,&nNoiseFlag                                         ,"nNoiseFlag/I");
+  Branch("NoiseFlag"                                          ,NoiseFlag                                           ,"NoiseFlag[nNoiseFlag]/I");
+  Branch("HCFlag"                                             ,&flg_hnoise                                         ,"HCFlag/I");
+  Branch("HFFlag"                                             ,&flg_hfbadhit                                       ,"HFFlag/I");
+  Branch("ESFlag"                                             ,&flg_ecalspike                                      ,"ESFlag/I");
+  Branch("BeamHaloTight"                                      ,&mbeamHaloTight                                     ,"BeamHaloTight/I");
+  Branch("BeamHaloLoose"                                      ,&mbeamHaloLoose                                     ,"BeamHaloLoose/I");
+  Branch("SumTrackPt"                                         ,&mSumTrackPt                                        ,"SumTrackPt/D");
   
   ///-------------------------------------------------------------------------- 
   /// L1
   ///--------------------------------------------------------------------------
   if(!isMCTag){
     /// L1
-    mtree->Branch("nL1"                                              ,&nL1                                                ,"nL1/I");
-    mtree->Branch("L1Array"                                          ,L1Array                                             ,"L1Array[nL1]/I");
+    Branch("nL1"                                              ,&nL1                                                ,"nL1/I");
+    Branch("L1Array"                                          ,L1Array                                             ,"L1Array[nL1]/I");
     
     /// L1T
-    mtree->Branch("nL1T"                                             ,&nL1T                                               ,"nL1T/I");
-    mtree->Branch("L1TArray"                                         ,L1TArray                                            ,"L1TArray[nL1T]/I");
+    Branch("nL1T"                                             ,&nL1T                                               ,"nL1T/I");
+    Branch("L1TArray"                                         ,L1TArray                                            ,"L1TArray[nL1T]/I");
   }
   
+  ///-------------------------------------------------------------------------- 
+  /// Collections to fill
+  ///--------------------------------------------------------------------------
+  fillPFAK4Jets  = Booked(jetFillerAK4.Counter());
+  fillPFAK8Jets  = Booked(jetFillerAK8.Counter());
+  fillPFMuon     = Booked("NPFMuon");
+  fillPFElec     = Booked("NPFElec");
+  fillPFTau      = Booked("NPFTau");
+  fillPFTauDis   = Booked("PFTauDis*");
+  fillPhot       = Booked("NPhot");
+  fillGenPar     = Booked("NGenPar");
+  fillPDFWeights = Booked("NPDFWeights*");
+  
+  edm::LogInfo("NtupleAnalyzer") << bookedBranches.size() << " branches booked";
 }
 
 // ------------ method called once each job just after ending the event loop  ------------
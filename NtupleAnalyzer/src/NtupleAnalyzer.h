@@ -5,9 +5,13 @@
 #include <time.h>
 
 #include <map>
+#include <set>
+#include <fnmatch.h>
+#include <cstring>
+#include <stdint.h>
 
 #include "FWCore/Framework/interface/Frameworkfwd.h"
-#include "FWCore/Framework/interface/EDAnalyzer.h"
+#include "FWCore/Framework/interface/one/EDAnalyzer.h"
 
 #include "FWCore/Framework/interface/Event.h"
 #include "FWCore/Framework/interface/MakerMacros.h"
@@ -0,0 +1,142 @@
+////////////////////////////////////////////////////////////////////////////
+//   Cut flow of Manager with and without SetReordering on the same ntuple //
+////////////////////////////////////////////////////////////////////////////
+
+#include "../bin/EventData.h"
+#include "../bin/Operation.h"
+
+// ROOT includes
+#include <TFile.h>
+#include <TTree.h>
+#include <TError.h>
+
+// std includes
+#include <fstream>
+#include <sstream>
+#include <string>
+#include <vector>
+#include <stdio.h>
+
+using namespace Operation;
+using namespace std;
+
+// Rejects the events whose number is a multiple of mDivisor, mWork sets its cost
+class CutEventModulo : public Operation::_Base
+{
+public:
+  CutEventModulo(int divisor, int work) : mDivisor(divisor), mWork(work) {}
+  bool Process(EventData & ev){
+    volatile double x = 0.;
+    for(int i=0; i<mWork; i++) x += i*0.5;
+    return ev.event() % mDivisor != 0;
+  }
+  bool Commutes() { return true; }
+  std::ostream& Description(std::ostream& ostrm){
+    ostrm << "  event % " << mDivisor << " != 0";
+    return ostrm;
+  }
+
+private:
+  int mDivisor;
+  int mWork;
+};
+
+
+// Ntuple with only the event number filled
+void WriteNtuple(const string & fileName, Long64_t nEvents)
+{
+  TFile file(fileName.c_str(), "RECREATE");
+  file.mkdir("NtupleAnalyzer")->cd();
+  TTree * tree = new TTree("ntuple", "ntuple");
+  Long64_t event;
+  tree->Branch("event", &event, "event/L");
+  for(event=1; event<=nEvents; event++) tree->Fill();
+  tree->Write();
+  file.Close();
+}
+
+
+// "Events surviving" lines of the log and the declared order counts of the JSON
+vector<string> CutFlow(const string & logFileName, bool & reordered)
+{
+  vector<string> lines;
+  string line;
+
+  ifstream log(logFileName.c_str());
+  while ( getline(log, line) ){
+    if ( line.compare(0, 16, "Events surviving") == 0 ) lines.push_back(line);
+  }
+
+  // the counts of an operation, without its position, runs and timing. An operation
+  // away from its declared position tells the cuts were reordered
+  ifstream json( (logFileName.substr(0, logFileName.size()-4) + ".json").c_str() );
+  int index = 0;
+  while ( getline(json, line) ){
+    size_t calls = line.find("\"calls\"");
+    if ( calls == string::npos ) continue;
+    stringstream position;
+    position << "\"position\": " << index++ << ",";
+    if ( line.find(position.str()) == string::npos ) reordered = true;
+    size_t runs = line.find(", \"runs\"");
+    size_t passed = line.find(", \"passed\"");
+    size_t time = line.find(", \"time\"");
+    lines.push_back( line.substr(calls, runs-calls) + line.substr(passed, time-passed) );
+  }
+  return lines;
+}
+
+
+vector<string> RunCutFlow(const string & fileName, const string & logFileName, Long64_t reorderEvents, bool & reordered)
+{
+  remove( logFileName.c_str() );
+
+  // declared with the costly, weak cut first: the reordering runs it last
+  vector<Operation::_Base*> cuts;
+  cuts.push_back( new CutEventModulo(7, 200000) );
+  cuts.push_back( new CutEventModulo(3, 2000) );
+  cuts.push_back( new CutEventModulo(2, 10) );
+
+  {
+    Manager manager(logFileName);
+    for(size_t i=0; i<cuts.size(); i++) manager.Add(cuts[i]);
+    if ( reorderEvents > 0 ) manager.SetReordering(reorderEvents);
+    EventData ev(fileName, 1000000000, 0);
+    manager.Run(ev);
+  }
+  for(size_t i=0; i<cuts.size(); i++) delete cuts[i];
+
+  reordered = false;
+  return CutFlow(logFileName, reordered);
+}
+
+
+int main()
+{
+  // the reader binds every ntuple branch, most are missing here
+  gErrorIgnoreLevel = kFatal;
+
+  string fileName = "testCutReordering.root";
+  WriteNtuple(fileName, 5000);
+
+  bool reorderedNominal, reordered;
+  vector<string> nominal = RunCutFlow(fileName, "testCutReordering_nominal.log", 0, reorderedNominal);
+  vector<string> flow    = RunCutFlow(fileName, "testCutReordering_reordered.log", 100, reordered);
+
+  int failed = 0;
+  if ( !reordered ){
+    cerr << "testCutReordering: the cuts were not reordered" << endl;
+    failed++;
+  }
+  if ( nominal.empty() || nominal.size() != flow.size() ){
+    cerr << "testCutReordering: " << nominal.size() << " cut flow lines without reordering, " << flow.size() << " with" << endl;
+    failed++;
+  }
+  for(size_t i=0; i<nominal.size() && i<flow.size(); i++){
+    if ( nominal[i] == flow[i] ) continue;
+    cerr << "testCutReordering: cut flows differ" << endl << "  " << nominal[i] << endl << "  " << flow[i] << endl;
+    failed++;
+  }
+
+  cout << "testCutReordering: " << ( failed ? "FAILED" : "passed" ) << endl;
+  return failed ? 1 : 0;
+}
@@ -19,6 +19,12 @@ iZnunu         = False
 # DebugMode
 iDebugMode     = False
 
+# Compact output: floats on disk, energy fractions with a 10 bit mantissa
+iCompactOutput = False
+
+# Branch selection, e.g. ["keep *", "drop PFAK8Jet*", "drop PFTauDis*"]
+iBranchSelection = ["keep *"]
+
 # Sample files
 iFileData      = '/store/user/srimanob/invHiggs/22Jan13/0008F234-739C-E211-A836-002590832A48.root'
 
@@ -28,6 +34,7 @@ iFileMCFast    = '/store/group/phys_higgs/vbfHinv/DataSample/FastSim-stop-5314.r
 iFileMCFull    =  'file:testMiniAOD.root'
 
 iMaxEvent      = -1
+iThreads       = 1   # cmsRun threads and streams
 
 # NonPF collection
 iIncludeNonPF  = False
@@ -101,6 +108,10 @@ process.TFileService                          = cms.Service("TFileService", file
 process.NtupleAnalyzer                        = process.NtupleAnalyzerTemplate.clone()
 process.NtupleAnalyzer.debugMode              = iDebugMode
 process.NtupleAnalyzer.includeNonPFCollection = iIncludeNonPF
+process.NtupleAnalyzer.compactOutput          = iCompactOutput
+if iCompactOutput:
+    process.NtupleAnalyzer.compactMantissaBits = cms.int32(10)
+process.NtupleAnalyzer.branchSelection        = cms.vstring(iBranchSelection)
 process.NtupleAnalyzer.TriggerTag             = cms.untracked.InputTag("TriggerResults","","HLT")
 process.NtupleAnalyzer.Tracks                 = cms.untracked.InputTag("generalTracks")
 # PF collection
@@ -212,6 +223,10 @@ if iRunData == False and iSignal == True:
 
 ##-------------------------------------------------
 ##-- Options
+process.options = cms.untracked.PSet(
+    numberOfThreads = cms.untracked.uint32(iThreads),
+    numberOfStreams = cms.untracked.uint32(iThreads)
+    )
 #process.options.wantSummary = True
 #process.MessageLogger.categories.append('PATSummaryTables')
 #process.MessageLogger.cerr.PATSummaryTables = cms.untracked.PSet(
@@ -4,11 +4,13 @@
 #include <fstream>
 #include <string>
 #include <vector>
+#include <algorithm>
 #include <istream>
 #include <sstream>
 
 #include "TCanvas.h"
 #include "TTree.h"
+#include "TTreeFormula.h"
 #include "TFile.h"
 #include "TH1F.h"
 #include "THStack.h"
@@ -51,6 +53,80 @@ void banner4Plot (const bool & isLabel){
 }
 
 
+// Fill histos[iCut][iVar] from one loop on the tree: every cut and variable expression is compiled
+// once, the same way TTree::Draw("var>>h","(weight)*(cut)","goff") would do for each combination
+void FillHistosSinglePass (TTree* tree, const std::vector<std::string> & CutList, const std::vector<std::string> & Variables,
+                           const std::string & Weight, std::vector<std::vector<TH1F*> > & histos){
+
+  if(tree == 0){ std::cerr<<" FillHistosSinglePass: null tree --> skip "<<std::endl; return ; }
+
+  std::vector<TTreeFormula*> selection ;
+  std::vector<TTreeFormula*> variable ;
+
+  for (size_t iCut=0; iCut<CutList.size(); iCut++)
+    selection.push_back(new TTreeFormula(Form("selection_%d",int(iCut)),("("+Weight+")*("+CutList.at(iCut)+")").c_str(),tree));
+  for (size_t iVar=0; iVar<Variables.size(); iVar++)
+    variable.push_back(new TTreeFormula(Form("variable_%d",int(iVar)),Variables.at(iVar).c_str(),tree));
+
+  // weights of every selection instance and values of every variable instance of the entry
+  std::vector<std::vector<double> > cutWeight (CutList.size());
+  std::vector<bool> cutPassed (CutList.size(),false);
+  std::vector<double> value ;
+  int treeNumber = -1 ;
+
+  Long64_t nentries = tree->GetEntries();
+  for (Long64_t iEntry=0; iEntry<nentries; iEntry++){
+
+    Long64_t localEntry = tree->LoadTree(iEntry);
+    if(localEntry < 0) break ;
+    if(tree->GetTreeNumber() != treeNumber){
+      treeNumber = tree->GetTreeNumber();
+      for (size_t iCut=0; iCut<selection.size(); iCut++) selection.at(iCut)->UpdateFormulaLeaves();
+      for (size_t iVar=0; iVar<variable.size(); iVar++)  variable.at(iVar)->UpdateFormulaLeaves();
+    }
+
+    // evaluate the weighted selections first, variables are read only if some instance of a cut is passed
+    bool anyPassed = false ;
+    for (size_t iCut=0; iCut<selection.size(); iCut++){
+      int nsel = selection.at(iCut)->GetNdata();
+      cutWeight.at(iCut).assign(nsel > 0 ? nsel : 0, 0.);
+      cutPassed.at(iCut) = false ;
+      for (int iData=0; iData<nsel; iData++){
+        cutWeight.at(iCut).at(iData) = selection.at(iCut)->EvalInstance(iData);
+        if(cutWeight.at(iCut).at(iData) != 0) cutPassed.at(iCut) = true ;
+      }
+      if(cutPassed.at(iCut)) anyPassed = true ;
+    }
+    if(!anyPassed) continue ;
+
+    // as in TTree::Draw a scalar goes with every instance of an array, two arrays are
+    // matched instance by instance up to the shorter one
+    for (size_t iVar=0; iVar<variable.size(); iVar++){
+      int nvar = variable.at(iVar)->GetNdata();
+      if(nvar <= 0) continue ;
+      bool varMultiple = variable.at(iVar)->GetMultiplicity() != 0 ;
+      value.assign(nvar,0.);
+      for (int iData=0; iData<nvar; iData++) value.at(iData) = variable.at(iVar)->EvalInstance(iData);
+
+      for (size_t iCut=0; iCut<selection.size(); iCut++){
+        if(!cutPassed.at(iCut)) continue ;
+        int nsel = cutWeight.at(iCut).size();
+        bool selMultiple = selection.at(iCut)->GetMultiplicity() != 0 ;
+        int ndata = std::max(varMultiple ? nvar : 1, selMultiple ? nsel : 1);
+        for (int iData=0; iData<ndata; iData++){
+          if((varMultiple && iData >= nvar) || (selMultiple && iData >= nsel)) break ;
+          double weight = cutWeight.at(iCut).at(selMultiple ? iData : 0);
+          if(weight != 0) histos[iCut][iVar]->Fill(value.at(varMultiple ? iData : 0),weight);
+        }
+      }
+    }
+  }
+
+  for (size_t iCut=0; iCut<selection.size(); iCut++) delete selection.at(iCut);
+  for (size_t iVar=0; iVar<variable.size(); iVar++)  delete variable.at(iVar);
+}
+
+
 // Main Code
 
 int main (int argc, char **argv){
@@ -359,6 +435,51 @@ int main (int argc, char **argv){
   TString hname ;
 
   bool isHerwig_ttbar = false;
+
+  for (size_t iSample=0; iSample<NameSample.size(); iSample++){
+
+    TString NameFile = Form("%s/%s.root",InputDirectory.c_str(),NameSample.at(iSample).c_str());
+    std::cout<<" Input File : "<< NameFile.Data()<<std::endl;
+
+    FileVect.push_back ( new TFile (NameFile.Data(),"READ") );  
+    TreeVect.push_back( (TTree*) FileVect.at(iSample)->Get(TreeName.c_str()));
+
+    for (size_t iCut=0; iCut<CutList.size(); iCut++){
+      for (size_t iVar=0; iVar<Variables.size(); iVar++){
+
+       hname.Form ("%s_%s_%d",NameSample.at(iSample).c_str(),Variables.at(iVar).c_str(),int(iCut));
+       hname.ReplaceAll("[","_");
+       hname.ReplaceAll("]","_");
+       hname.ReplaceAll("(","_");
+       hname.ReplaceAll(")","_");
+ 
+       histos[iCut][iVar][iSample] = new TH1F (hname.Data(),"",VariablesNbin.at(iVar),VariablesMinValue.at(iVar),VariablesMaxValue.at(iVar));
+       histos[iCut][iVar][iSample]->Sumw2();
+       histos_overflow[iCut][iVar][iSample] = new TH1F ((hname+"_over").Data(),"",VariablesNbin.at(iVar)+1,VariablesMinValue.at(iVar),VariablesMaxValue.at(iVar)+histos[iCut][iVar][iSample]->GetBinWidth(1));
+       histos_overflow[iCut][iVar][iSample]->Sumw2();
+      }
+    }
+  }
+
+  // fill every cut x variable histogram of a sample with a single pass on its tree
+  for (size_t iSample=0; iSample<NameSample.size(); iSample++){
+
+    std::string SampleWeight = BackgroundWeight ;
+    if( NameReducedSample.at(iSample) == "DATA" ) SampleWeight = "1";
+    else if(NameReducedSample.at(iSample) == SignalggHName && SignalggHName!="NULL") SampleWeight = SignalggHWeight ;
+    else if(NameReducedSample.at(iSample) == SignalqqHName && SignalqqHName!="NULL") SampleWeight = SignalqqHWeight ;
+    else if(NameReducedSample.at(iSample) == SignalRSGPythiaName && SignalRSGPythiaName!="NULL") SampleWeight = SignalRSGPythiaWeight ;
+    else if(NameReducedSample.at(iSample) == SignalRSGHerwigName && SignalRSGHerwigName!="NULL") SampleWeight = SignalRSGHerwigWeight ;
+    else if(NameReducedSample.at(iSample) == SignalGravitonName && SignalGravitonName!="NULL") SampleWeight = SignalGravitonWeight ;
+    else if(NameReducedSample.at(iSample) == "tt_bar_mcatnlo" ) SampleWeight = BackgroundWeight_mcatnlo ;
+
+    std::vector<std::vector<TH1F*> > SampleHistos (CutList.size(), std::vector<TH1F*>(Variables.size(),(TH1F*)0));
+    for (size_t iCut=0; iCut<CutList.size(); iCut++)
+      for (size_t iVar=0; iVar<Variables.size(); iVar++) SampleHistos[iCut][iVar] = histos[iCut][iVar][iSample];
+
+    std::cout<<" Filling "<<NameSample.at(iSample)<<" with weight "<<SampleWeight<<std::endl;
+    FillHistosSinglePass(TreeVect.at(iSample),CutList,Variables,SampleWeight,SampleHistos);
+  }
   
   for (size_t iCut=0; iCut<CutList.size(); iCut++){
     
@@ -374,27 +495,10 @@ int main (int argc, char **argv){
 
      for (size_t iSample=0; iSample<NameSample.size(); iSample++){
 
-       TString NameFile = Form("%s/%s.root",InputDirectory.c_str(),NameSample.at(iSample).c_str());
-       std::cout<<" Input File : "<< NameFile.Data()<<std::endl;
-
-       if( iVar == 0 && iCut == 0) FileVect.push_back ( new TFile (NameFile.Data(),"READ") );  
-       if( iVar == 0 && iCut == 0) TreeVect.push_back( (TTree*) FileVect.at(iSample)->Get(TreeName.c_str()));
+       hname = histos[iCut][iVar][iSample]->GetName();
 
-        
-       hname.Form ("%s_%s_%d",NameSample.at(iSample).c_str(),Variables.at(iVar).c_str(),int(iCut));
-       hname.ReplaceAll("[","_");
-       hname.ReplaceAll("]","_");
-       hname.ReplaceAll("(","_");
-       hname.ReplaceAll(")","_");
- 
-       histos[iCut][iVar][iSample] = new TH1F (hname.Data(),"",VariablesNbin.at(iVar),VariablesMinValue.at(iVar),VariablesMaxValue.at(iVar));
-       histos[iCut][iVar][iSample]->Sumw2();
-       histos_overflow[iCut][iVar][iSample] = new TH1F ((hname+"_over").Data(),"",VariablesNbin.at(iVar)+1,VariablesMinValue.at(iVar),VariablesMaxValue.at(iVar)+histos[iCut][iVar][iSample]->GetBinWidth(1));
-       histos_overflow[iCut][iVar][iSample]->Sumw2();
-       
        if( NameReducedSample.at(iSample) == "DATA" ){ 
          std::cout<<"iSample="<< iSample<<" iVar= "<<iVar <<" hname.Data "<<hname.Data()<<std::endl;
-         TreeVect.at(iSample)-> Draw((Variables.at(iVar)+" >> "+hname.Data()).c_str(), (CutList.at(iCut)).c_str() ,"goff");
          for( int iBin = 0 ; iBin < histos[iCut][iVar][iSample]->GetNbinsX() ; iBin ++){
 	   histos_overflow[iCut][iVar][iSample]->SetBinContent(iBin+1,histos[iCut][iVar][iSample]->GetBinContent(iBin+1));
 	   histos_overflow[iCut][iVar][iSample]->SetBinError(iBin+1,histos[iCut][iVar][iSample]->GetBinError(iBin+1));
@@ -405,7 +509,6 @@ int main (int argc, char **argv){
        }
 	 
        else if(NameReducedSample.at(iSample) == SignalggHName && SignalggHName!="NULL"){
-        TreeVect.at(iSample)->Draw((Variables.at(iVar)+" >> "+hname.Data()).c_str(),("("+SignalggHWeight+")*( "+CutList.at(iCut)+")").c_str() ,"goff");
         for( int iBin = 0 ; iBin < histos[iCut][iVar][iSample]->GetNbinsX() ; iBin ++){
 	  histos_overflow[iCut][iVar][iSample]->SetBinContent(iBin+1,histos[iCut][iVar][iSample]->GetBinContent(iBin+1));
           histos_overflow[iCut][iVar][iSample]->SetBinError(iBin+1,histos[iCut][iVar][iSample]->GetBinError(iBin+1));
@@ -416,7 +519,6 @@ std::cout<<" Signal ggH Entries "<<histos[iCut][iVar][iSample]->GetEntries()<< "
        }
 	 
        else if(NameReducedSample.at(iSample) == SignalqqHName && SignalqqHName!="NULL") {
-        TreeVect.at(iSample)->Draw((Variables.at(iVar)+" >> "+hname.Data()).c_str(),("("+SignalqqHWeight+")*( "+CutList.at(iCut)+")").c_str() ,"goff");
         for( int iBin = 0 ; iBin < histos[iCut][iVar][iSample]->GetNbinsX() ; iBin ++){
 	   histos_overflow[iCut][iVar][iSample]->SetBinContent(iBin+1,histos[iCut][iVar][iSample]->GetBinContent(iBin+1));
 	   histos_overflow[iCut][iVar][iSample]->SetBinError(iBin+1,histos[iCut][iVar][iSample]->GetBinError(iBin+1));
@@ -427,7 +529,6 @@ std::cout<<" Signal ggH Entries "<<histos[iCut][iVar][iSample]->GetEntries()<< "
        }
 	 
        else if(NameReducedSample.at(iSample) == SignalRSGPythiaName && SignalRSGPythiaName!="NULL") {
-        TreeVect.at(iSample)->Draw((Variables.at(iVar)+" >> "+hname.Data()).c_str(),("("+SignalRSGPythiaWeight+")*( "+CutList.at(iCut)+")").c_str() ,"goff");
         for( int iBin = 0 ; iBin < histos[iCut][iVar][iSample]->GetNbinsX() ; iBin ++){
 	   histos_overflow[iCut][iVar][iSample]->SetBinContent(iBin+1,histos[iCut][iVar][iSample]->GetBinContent(iBin+1));
 	   histos_overflow[iCut][iVar][iSample]->SetBinError(iBin+1,histos[iCut][iVar][iSample]->GetBinError(iBin+1));
@@ -437,7 +538,6 @@ std::cout<<" Signal ggH Entries "<<histos[iCut][iVar][iSample]->GetEntries()<< "
        }
 	 
        else if(NameReducedSample.at(iSample) == SignalRSGHerwigName && SignalRSGHerwigName!="NULL") {
-	TreeVect.at(iSample)->Draw((Variables.at(iVar)+" >> "+hname.Data()).c_str(),("("+SignalRSGHerwigWeight+")*( "+CutList.at(iCut)+")").c_str() ,"goff");
         for( int iBin = 0 ; iBin < histos[iCut][iVar][iSample]->GetNbinsX() ; iBin ++){
 	  histos_overflow[iCut][iVar][iSample]->SetBinContent(iBin+1,histos[iCut][iVar][iSample]->GetBinContent(iBin+1));
 	  histos_overflow[iCut][iVar][iSample]->SetBinError(iBin+1,histos[iCut][iVar][iSample]->GetBinError(iBin+1));
@@ -448,7 +548,6 @@ std::cout<<" Signal ggH Entries "<<histos[iCut][iVar][iSample]->GetEntries()<< "
        }
 	 
        else if(NameReducedSample.at(iSample) == SignalGravitonName && SignalGravitonName!="NULL") {
-	 TreeVect.at(iSample)->Draw((Variables.at(iVar)+" >> "+hname.Data()).c_str(),("("+SignalGravitonWeight+")*( "+CutList.at(iCut)+")").c_str() ,"goff");
          for( int iBin = 0 ; iBin < histos[iCut][iVar][iSample]->GetNbinsX() ; iBin ++){
 	   histos_overflow[iCut][iVar][iSample]->SetBinContent(iBin+1,histos[iCut][iVar][iSample]->GetBinContent(iBin+1));
 	   histos_overflow[iCut][iVar][iSample]->SetBinError(iBin+1,histos[iCut][iVar][iSample]->GetBinError(iBin+1));
@@ -460,7 +559,6 @@ std::cout<<" Signal ggH Entries "<<histos[iCut][iVar][iSample]->GetEntries()<< "
        else if(NameReducedSample.at(iSample) == "tt_bar_mcatnlo" ){
 
          isHerwig_ttbar = true ;
-         TreeVect.at(iSample)->Draw((Variables.at(iVar)+" >> "+hname.Data()).c_str(),("("+BackgroundWeight_mcatnlo+") * ("+CutList.at(iCut)+")").c_str() ,"goff");
          for( int iBin = 0 ; iBin < histos[iCut][iVar][iSample]->GetNbinsX() ; iBin ++){
 	   histos_overflow[iCut][iVar][iSample]->SetBinContent(iBin+1,histos[iCut][iVar][iSample]->GetBinContent(iBin+1));
 	   histos_overflow[iCut][iVar][iSample]->SetBinError(iBin+1,histos[iCut][iVar][iSample]->GetBinError(iBin+1));
@@ -472,7 +570,6 @@ std::cout<<" Signal ggH Entries "<<histos[iCut][iVar][iSample]->GetEntries()<< "
        }
        else {
 
-         TreeVect.at(iSample)->Draw((Variables.at(iVar)+" >> "+hname.Data()).c_str(),("("+BackgroundWeight+") * ("+CutList.at(iCut)+")").c_str() ,"goff");
          for( int iBin = 0 ; iBin < histos[iCut][iVar][iSample]->GetNbinsX() ; iBin ++){
 	   histos_overflow[iCut][iVar][iSample]->SetBinContent(iBin+1,histos[iCut][iVar][iSample]->GetBinContent(iBin+1));
 	   histos_overflow[iCut][iVar][iSample]->SetBinError(iBin+1,histos[iCut][iVar][iSample]->GetBinError(iBin+1));